@@ -188,8 +188,11 @@ int entry(int argc, char **argv)
   }
 
   // Import from input Circle file
+  // NOTE model_data outlives module, so constant data need not be copied
   luci::Importer importer;
-  auto module = importer.importModule(circle_model);
+  importer.refer_const_data(true);
+  auto module = importer.importModule(reinterpret_cast<const uint8_t *>(model_data.data()),
+                                      model_data.size());
 
   for (size_t idx = 0; idx < module->size(); ++idx)
   {
@@ -250,6 +250,20 @@ int entry(int argc, char **argv)
     .default_value(false)
     .help("Transform Minimum-Maximum pattern to Relu6 operator");
 
+  arser.add_argument("--ext_buffer")
+    .nargs(0)
+    .required(false)
+    .default_value(false)
+    .help("Store constant data outside of FlatBuffer. This lowers memory usage on export and "
+          "allows model larger than 2GB");
+
+  arser.add_argument("--worklist")
+    .nargs(0)
+    .required(false)
+    .default_value(false)
+    .help("Experimental: Run optimizations over the nodes changed by previous rewrites instead of "
+          "restarting from the whole graph.");
+
   arser.add_argument("--mute_warnings")
     .nargs(0)
     .required(false)
@@ -416,6 +430,9 @@ int entry(int argc, char **argv)
       options->param(AlgorithmParameters::NCHW_to_NHWC_preserve_output_shape, "true");
   }
 
+  if (arser.get<bool>("--worklist"))
+    options->param(AlgorithmParameters::Optimize_phase_strategy, "worklist");
+
   // Load model from the file
   foder::FileLoader file_loader{input_path};
   std::vector<char> model_data;
@@ -445,8 +462,11 @@ int entry(int argc, char **argv)
   }
 
   // Import from input Circle file
+  // NOTE model_data outlives module, so constant data need not be copied
   luci::Importer importer;
-  auto module = importer.importModule(circle_model);
+  importer.refer_const_data(true);
+  auto module = importer.importModule(reinterpret_cast<const uint8_t *>(model_data.data()),
+                                      model_data.size());
 
   // call luci optimizations for module
   optimizer.optimize(module.get());
@@ -474,7 +494,8 @@ int entry(int argc, char **argv)
   // Export to output Circle file
   luci::CircleExporter exporter;
 
-  luci::CircleFileExpContract contract(module.get(), output_path);
+  luci::CircleFileExpContract contract(module.get(), output_path,
+                                      arser.get<bool>("--ext_buffer"));
 
   if (!exporter.invoke(&contract))
   {
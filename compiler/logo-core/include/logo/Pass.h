@@ -41,6 +41,34 @@ public:
   virtual bool run(loco::Graph *graph) = 0;
 };
 
+/**
+ * @brief Pass that rewrites a pattern rooted at a node
+ *
+ * NodePass can also run for a whole graph, while PhaseRunner<PhaseStrategy::Worklist>
+ * runs it only for nodes which may be affected by previous rewrites.
+ */
+class NodePass : public Pass
+{
+public:
+  virtual ~NodePass() = default;
+
+public:
+  /**
+   * @brief  Rewrite a pattern rooted at 'root'
+   *
+   * @return false if there was nothing changed
+   *
+   * @note   Rewrite SHOULD NOT destroy any node
+   */
+  virtual bool rewrite(loco::Node *root) = 0;
+
+public:
+  /**
+   * @brief  Rewrite patterns rooted at each active node of graph
+   */
+  bool run(loco::Graph *graph) override;
+};
+
 std::string pass_name(const Pass *);
 
 } // namespace logo
@@ -21,6 +21,7 @@
 
 #include <loco.h>
 
+#include <cstdint>
 #include <vector>
 #include <memory>
 
@@ -70,9 +71,14 @@ public:
   void changed(bool changed) { _changed = changed; }
   bool changed(void) const { return _changed; }
 
+  // Elapsed time to run the pass, in nanoseconds
+  void elapsed(uint64_t elapsed) { _elapsed = elapsed; }
+  uint64_t elapsed(void) const { return _elapsed; }
+
 private:
   const Pass *_pass;
   bool _changed;
+  uint64_t _elapsed = 0;
 };
 
 struct PhaseEventListener
@@ -130,7 +136,7 @@ public:
     }
   }
 
-  void notifyPassEnd(Pass *pass, bool changed) const
+  void notifyPassEnd(Pass *pass, bool changed, uint64_t elapsed = 0) const
   {
     if (_listener)
     {
@@ -138,6 +144,7 @@ public:
 
       info.pass(pass);
       info.changed(changed);
+      info.elapsed(elapsed);
 
       _listener->notify(&info);
     }
@@ -153,6 +160,15 @@ enum class PhaseStrategy
   Saturate,
   // Same as Saturate but will restart from the first when there is a change
   Restart,
+  // Run NodePass(es) only for nodes around the ones changed in the previous round
+  //
+  // Each round runs the other passes over the graph first, and then NodePass(es) for the
+  // nodes in worklist. Nodes around a rewritten root are put into worklist of the next round.
+  //
+  // Passes other than NodePass run once for each round, until they make no change. Nodes
+  // which they create, reconnect or infer another shape/dtype (loco::shape_get/dtype_get) for
+  // are put into worklist together with the nodes around them.
+  Worklist,
 };
 
 template <PhaseStrategy S> class PhaseRunner;
@@ -187,6 +203,21 @@ private:
   loco::Graph *_graph;
 };
 
+template <> class PhaseRunner<PhaseStrategy::Worklist> final : public PhaseRunnerMixinObservable
+{
+public:
+  PhaseRunner(loco::Graph *graph) : _graph{graph}
+  {
+    // DO NOTHING
+  }
+
+public:
+  void run(const Phase &) const;
+
+private:
+  loco::Graph *_graph;
+};
+
 } // namespace logo
 
 #endif // __LOGO_PHASE_H__
@@ -19,6 +19,19 @@
 namespace logo
 {
 
+bool NodePass::run(loco::Graph *graph)
+{
+  bool changed = false;
+
+  for (auto node : loco::active_nodes(loco::output_nodes(graph)))
+  {
+    if (rewrite(node))
+      changed = true;
+  }
+
+  return changed;
+}
+
 std::string pass_name(const Pass *t)
 {
   if (t->name() == nullptr)
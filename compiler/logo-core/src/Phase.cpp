@@ -16,6 +16,153 @@
 
 #include <logo/Phase.h>
 
+#include <loco/Service/ShapeInference.h>
+#include <loco/Service/TypeInference.h>
+
+#include <chrono>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace
+{
+
+class Stopwatch final
+{
+public:
+  Stopwatch() : _begin{std::chrono::steady_clock::now()}
+  {
+    // DO NOTHING
+  }
+
+public:
+  // Elapsed time in nanoseconds
+  uint64_t elapsed(void) const
+  {
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(end - _begin).count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point _begin;
+};
+
+/**
+ * @brief Worklist of nodes for PhaseRunner<PhaseStrategy::Worklist>
+ */
+class Worklist final
+{
+public:
+  void push(loco::Node *node)
+  {
+    if (_pushed.insert(node).second)
+      _nodes.push_back(node);
+  }
+
+  bool contains(loco::Node *node) const { return _pushed.find(node) != _pushed.end(); }
+  bool empty(void) const { return _nodes.empty(); }
+
+  const std::vector<loco::Node *> &nodes(void) const { return _nodes; }
+
+private:
+  std::vector<loco::Node *> _nodes;
+  std::unordered_set<loco::Node *> _pushed;
+};
+
+/**
+ * @brief What a graph pass may change in a node, which may enable a rewrite around it
+ */
+struct NodeState
+{
+  static NodeState of(loco::Node *node)
+  {
+    NodeState state;
+
+    state.dialect = node->dialect();
+    state.opnum = node->opnum();
+    for (uint32_t n = 0; n < node->arity(); ++n)
+      state.args.push_back(node->arg(n));
+    state.shape_known = loco::shape_known(node);
+    if (state.shape_known)
+      state.shape = loco::shape_get(node);
+    state.dtype_known = loco::dtype_known(node);
+    if (state.dtype_known)
+      state.dtype = loco::dtype_get(node);
+
+    return state;
+  }
+
+  bool same_node(const NodeState &rhs) const
+  {
+    return dialect == rhs.dialect && opnum == rhs.opnum && args == rhs.args;
+  }
+
+  bool same_value(const NodeState &rhs) const
+  {
+    return shape_known == rhs.shape_known && (!shape_known || shape == rhs.shape) &&
+           dtype_known == rhs.dtype_known && (!dtype_known || dtype == rhs.dtype);
+  }
+
+  const loco::Dialect *dialect = nullptr;
+  uint32_t opnum = 0;
+  std::vector<loco::Node *> args;
+  bool shape_known = false;
+  loco::NodeShape shape;
+  bool dtype_known = false;
+  loco::DataType dtype = loco::DataType::Unknown;
+};
+
+using NodeStates = std::unordered_map<loco::Node *, NodeState>;
+
+NodeStates node_states(const std::set<loco::Node *> &nodes)
+{
+  NodeStates states;
+  for (auto node : nodes)
+    states.emplace(node, NodeState::of(node));
+  return states;
+}
+
+// Push the nodes around the ones which graph passes changed since 'before' was taken
+void push_changed(const NodeStates &before, const std::set<loco::Node *> &active,
+                  Worklist &worklist)
+{
+  for (auto node : active)
+  {
+    auto after = NodeState::of(node);
+    auto it = before.find(node);
+
+    // New or replaced node, whose operands and users may be rewritten with it
+    if (it == before.end() || !it->second.same_node(after))
+    {
+      worklist.push(node);
+      for (auto pred : loco::preds(node))
+        worklist.push(pred);
+      for (auto succ : loco::succs(node))
+        worklist.push(succ);
+      // Operands which lost a user
+      if (it != before.end())
+      {
+        for (auto arg : it->second.args)
+        {
+          if (active.find(arg) != active.end())
+            worklist.push(arg);
+        }
+      }
+      continue;
+    }
+
+    // Inferred shape or dtype is changed, which users may depend on
+    if (!it->second.same_value(after))
+    {
+      worklist.push(node);
+      for (auto succ : loco::succs(node))
+        worklist.push(succ);
+    }
+  }
+}
+
+} // namespace
+
 namespace logo
 {
 
@@ -31,10 +178,11 @@ void PhaseRunner<PhaseStrategy::Saturate>::run(const Phase &phase) const
     {
       notifyPassBegin(pass.get());
 
+      Stopwatch sw;
       bool pass_changed = pass->run(_graph);
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
+      notifyPassEnd(pass.get(), pass_changed, sw.elapsed());
     }
   }
 
@@ -53,10 +201,11 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
     {
       notifyPassBegin(pass.get());
 
+      Stopwatch sw;
       bool pass_changed = pass->run(_graph);
       changed = changed || pass_changed;
 
-      notifyPassEnd(pass.get(), pass_changed);
+      notifyPassEnd(pass.get(), pass_changed, sw.elapsed());
 
       if (changed)
       {
@@ -68,4 +217,117 @@ void PhaseRunner<PhaseStrategy::Restart>::run(const Phase &phase) const
   notifyPhaseEnd();
 }
 
+void PhaseRunner<PhaseStrategy::Worklist>::run(const Phase &phase) const
+{
+  std::vector<Pass *> graph_passes;
+  std::vector<NodePass *> node_passes;
+
+  for (auto &pass : phase)
+  {
+    if (auto node_pass = dynamic_cast<NodePass *>(pass.get()))
+      node_passes.push_back(node_pass);
+    else
+      graph_passes.push_back(pass.get());
+  }
+
+  notifyPhaseBegin();
+
+  // Every active node is visited in the first round
+  Worklist touched;
+  for (auto node : loco::postorder_traversal(loco::output_nodes(_graph)))
+    touched.push(node);
+
+  // Graph passes run again until they make no change, like PhaseStrategy::Saturate
+  for (bool graph_changed = false; !touched.empty() || graph_changed;)
+  {
+    graph_changed = false;
+
+    // NOTE Node passes in the last round may have replaced or destroyed nodes
+    auto active = loco::active_nodes(loco::output_nodes(_graph));
+    NodeStates before;
+    if (!graph_passes.empty())
+      before = node_states(active);
+
+    for (auto pass : graph_passes)
+    {
+      notifyPassBegin(pass);
+
+      Stopwatch sw;
+      bool pass_changed = pass->run(_graph);
+      graph_changed = graph_changed || pass_changed;
+
+      notifyPassEnd(pass, pass_changed, sw.elapsed());
+    }
+
+    // NOTE Nodes in worklist may be destroyed or become dead by the passes above
+    active = loco::active_nodes(loco::output_nodes(_graph));
+
+    // Graph passes (e.g. shape/type inference, dead node removal) change a few nodes in most
+    // rounds, so only the nodes around them are visited again
+    if (graph_changed)
+      push_changed(before, active, touched);
+
+    Worklist worklist;
+    for (auto node : touched.nodes())
+    {
+      if (active.find(node) != active.end())
+        worklist.push(node);
+    }
+    touched = Worklist{};
+
+    std::vector<uint64_t> elapsed(node_passes.size(), 0);
+    std::vector<bool> changed(node_passes.size(), false);
+
+    for (auto node : worklist.nodes())
+    {
+      // Node around a rewritten one is visited in the next round, after the graph passes
+      // (e.g. type/shape inference) update the graph
+      if (touched.contains(node))
+        continue;
+
+      const auto num_nodes = _graph->nodes()->size();
+      const auto node_preds = loco::preds(node);
+      const auto node_succs = loco::succs(node);
+
+      for (uint32_t n = 0; n < node_passes.size(); ++n)
+      {
+        Stopwatch sw;
+        bool pass_changed = node_passes.at(n)->rewrite(node);
+        elapsed.at(n) += sw.elapsed();
+
+        if (!pass_changed)
+          continue;
+
+        changed.at(n) = true;
+
+        // Re-visit the root, its operands and users, including the users of the node which
+        // replaces the root, and newly created nodes
+        touched.push(node);
+        for (auto pred : node_preds)
+          touched.push(pred);
+        for (auto succ : node_succs)
+        {
+          touched.push(succ);
+          for (auto succ_pred : loco::preds(succ))
+            touched.push(succ_pred);
+        }
+        for (auto succ : loco::succs(node))
+          touched.push(succ);
+        for (uint32_t i = num_nodes; i < _graph->nodes()->size(); ++i)
+          touched.push(_graph->nodes()->at(i));
+
+        break;
+      }
+    }
+
+    for (uint32_t n = 0; n < node_passes.size(); ++n)
+    {
+      notifyPassBegin(node_passes.at(n));
+      notifyPassEnd(node_passes.at(n), changed.at(n), elapsed.at(n));
+    }
+  }
+
+  notifyPhaseEnd();
+}
+
 } // namespace logo
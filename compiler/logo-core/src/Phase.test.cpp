@@ -54,3 +54,236 @@ TEST(LogoPhaseRestartTests, simple)
 
   SUCCEED();
 }
+
+namespace
+{
+
+struct RemoveForward final : public logo::NodePass
+{
+  const char *name(void) const final { return "RemoveForward"; }
+
+  bool rewrite(loco::Node *root) final
+  {
+    ++visited;
+
+    auto forward = dynamic_cast<loco::Forward *>(root);
+    if (forward == nullptr)
+      return false;
+
+    loco::replace(forward).with(forward->input());
+    forward->input(nullptr);
+    return true;
+  }
+
+  uint32_t visited = 0;
+};
+
+/**
+ * @brief Graph of Pull - Forward x N - Push
+ */
+loco::Push *build_forward_chain(loco::Graph *g, uint32_t n)
+{
+  auto pull = g->nodes()->create<loco::Pull>();
+  loco::link(g->inputs()->create(), pull);
+
+  loco::Node *last = pull;
+  for (uint32_t i = 0; i < n; ++i)
+  {
+    auto forward = g->nodes()->create<loco::Forward>();
+    forward->input(last);
+    last = forward;
+  }
+
+  auto push = g->nodes()->create<loco::Push>();
+  push->from(last);
+  loco::link(g->outputs()->create(), push);
+
+  return push;
+}
+
+} // namespace
+
+TEST(LogoPhaseWorklistTests, simple)
+{
+  loco::Graph g;
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{&g};
+  logo::Phase phase;
+
+  phase.emplace_back(std::make_unique<Bumblebee>());
+  phase_runner.run(phase);
+
+  SUCCEED();
+}
+
+TEST(LogoPhaseWorklistTests, node_pass)
+{
+  auto g = loco::make_graph();
+  auto push = build_forward_chain(g.get(), 4);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g.get()};
+  logo::Phase phase;
+
+  phase.emplace_back(std::make_unique<Bumblebee>());
+  phase.emplace_back(std::make_unique<RemoveForward>());
+  phase_runner.run(phase);
+
+  ASSERT_NE(nullptr, dynamic_cast<loco::Pull *>(push->from()));
+}
+
+TEST(LogoPhaseWorklistTests, large_graph_visits_touched_nodes_only)
+{
+  const uint32_t N = 10000;
+
+  auto g = loco::make_graph();
+  auto push = build_forward_chain(g.get(), N);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g.get()};
+  logo::Phase phase;
+
+  auto pass = std::make_unique<RemoveForward>();
+  auto pass_ptr = pass.get();
+  phase.emplace_back(std::move(pass));
+  phase_runner.run(phase);
+
+  ASSERT_NE(nullptr, dynamic_cast<loco::Pull *>(push->from()));
+  // Each node is visited a few times at most, not for every change
+  ASSERT_LT(pass_ptr->visited, 4 * N);
+}
+
+namespace
+{
+
+/**
+ * @brief Graph pass that inserts a Forward before the first output once
+ */
+struct InsertForwardOnce final : public logo::Pass
+{
+  const char *name(void) const final { return "InsertForwardOnce"; }
+
+  bool run(loco::Graph *g) final
+  {
+    if (inserted)
+      return false;
+    inserted = true;
+
+    auto push = dynamic_cast<loco::Push *>(loco::output_nodes(g).at(0));
+    auto forward = g->nodes()->create<loco::Forward>();
+    forward->input(push->from());
+    push->from(forward);
+    return true;
+  }
+
+  bool inserted = false;
+};
+
+} // namespace
+
+TEST(LogoPhaseWorklistTests, graph_pass_enables_rewrite)
+{
+  auto g = loco::make_graph();
+  auto push = build_forward_chain(g.get(), 0);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g.get()};
+  logo::Phase phase;
+
+  auto graph_pass = std::make_unique<InsertForwardOnce>();
+  auto graph_pass_ptr = graph_pass.get();
+  phase.emplace_back(std::move(graph_pass));
+  phase.emplace_back(std::make_unique<RemoveForward>());
+  phase_runner.run(phase);
+
+  // Forward was not in the worklist, but inserted by the graph pass
+  ASSERT_TRUE(graph_pass_ptr->inserted);
+  ASSERT_NE(nullptr, dynamic_cast<loco::Pull *>(push->from()));
+}
+
+namespace
+{
+
+/**
+ * @brief Remove Forward whose input is Pull, so that a chain of Forward is removed one by one
+ */
+struct RemoveForwardOfPull final : public logo::NodePass
+{
+  const char *name(void) const final { return "RemoveForwardOfPull"; }
+
+  bool rewrite(loco::Node *root) final
+  {
+    ++visited;
+
+    auto forward = dynamic_cast<loco::Forward *>(root);
+    if (forward == nullptr || dynamic_cast<loco::Pull *>(forward->input()) == nullptr)
+      return false;
+
+    loco::replace(forward).with(forward->input());
+    forward->input(nullptr);
+    return true;
+  }
+
+  uint32_t visited = 0;
+};
+
+/**
+ * @brief Graph pass that destroys Forward nodes which are not used anymore
+ */
+struct DestroyDeadForward final : public logo::Pass
+{
+  const char *name(void) const final { return "DestroyDeadForward"; }
+
+  bool run(loco::Graph *g) final
+  {
+    auto active = loco::active_nodes(loco::output_nodes(g));
+
+    std::vector<loco::Node *> dead;
+    for (auto node : loco::all_nodes(g))
+    {
+      if (dynamic_cast<loco::Forward *>(node) != nullptr && active.find(node) == active.end())
+        dead.push_back(node);
+    }
+
+    for (auto node : dead)
+    {
+      node->drop();
+      g->nodes()->destroy(node);
+    }
+
+    return !dead.empty();
+  }
+};
+
+} // namespace
+
+TEST(LogoPhaseWorklistTests, graph_pass_change_visits_changed_nodes_only)
+{
+  const uint32_t N = 10000;
+  const uint32_t K = 100;
+
+  // Pull - Forward x K - Push, with Pull - ReLU x N - Push next to it
+  auto g = loco::make_graph();
+  auto push = build_forward_chain(g.get(), K);
+  loco::Node *last = push->from();
+  while (auto forward = dynamic_cast<loco::Forward *>(last))
+    last = forward->input();
+  for (uint32_t i = 0; i < N; ++i)
+  {
+    auto relu = g->nodes()->create<loco::ReLU>();
+    relu->input(last);
+    last = relu;
+  }
+  auto relu_push = g->nodes()->create<loco::Push>();
+  relu_push->from(last);
+  loco::link(g->outputs()->create(), relu_push);
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g.get()};
+  logo::Phase phase;
+
+  auto pass = std::make_unique<RemoveForwardOfPull>();
+  auto pass_ptr = pass.get();
+  phase.emplace_back(std::make_unique<DestroyDeadForward>());
+  phase.emplace_back(std::move(pass));
+  phase_runner.run(phase);
+
+  ASSERT_NE(nullptr, dynamic_cast<loco::Pull *>(push->from()));
+  // The graph pass destroys a node in every round, which does not make every node visited
+  ASSERT_LT(pass_ptr->visited, 4 * (N + K));
+}
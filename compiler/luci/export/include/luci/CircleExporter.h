@@ -45,10 +45,23 @@ public:
     // TODO make this pure virtual
     virtual luci::Module *module(void) const;
 
+    // Store constant data outside of FlatBuffer, right after it, and refer to it with
+    // offset and size of Buffer. Constant data is then streamed through store_ext()
+    // without being copied into FlatBuffer, which also lifts 2GB limit of FlatBuffer.
+    virtual bool ext_buffer(void) const { return false; }
+
   public: // Exporter -> Client
     // Exporter calls store for export data
     // Notice: Please DO NOT STORE ptr and size when implementing this in Client
     virtual bool store(const char *ptr, const size_t size) const = 0;
+
+    // Exporter calls store_ext after store() to append constant data in order,
+    // only if ext_buffer() is true
+    // Notice: Please DO NOT STORE ptr and size when implementing this in Client
+    virtual bool store_ext(const char *, const size_t) const { return false; }
+
+    // Exporter calls store_ext_end after the last store_ext, also when storing failed
+    virtual bool store_ext_end(void) const { return true; }
   };
 
 public:
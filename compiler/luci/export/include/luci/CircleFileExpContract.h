@@ -37,11 +37,17 @@ public:
   {
     // NOTHING TO DO
   }
+  CircleFileExpContract(luci::Module *module, const std::string &filename, bool ext_buffer)
+    : _module(module), _filepath(filename), _ext_buffer(ext_buffer)
+  {
+    // NOTHING TO DO
+  }
   virtual ~CircleFileExpContract() = default;
 
 public:
   loco::Graph *graph(void) const final { return nullptr; }
   luci::Module *module(void) const final { return _module; }
+  bool ext_buffer(void) const final { return _ext_buffer; }
 
 public:
   bool store(const char *ptr, const size_t size) const final
@@ -49,15 +55,44 @@ public:
     if (!ptr)
       INTERNAL_EXN("Graph was not serialized by FlatBuffer for some reason");
 
-    std::ofstream fs(_filepath, std::ofstream::binary);
-    fs.write(ptr, size);
+    _fs.open(_filepath, std::ofstream::binary | std::ofstream::trunc);
+    _fs.write(ptr, size);
+
+    // Keep the file open to append constant data
+    if (!_ext_buffer)
+      _fs.close();
+
+    return !_fs.fail();
+  }
+
+  bool store_ext(const char *ptr, const size_t size) const final
+  {
+    if (!ptr)
+      INTERNAL_EXN("Constant data to append is null");
+
+    if (!_fs.is_open())
+      return false;
+
+    _fs.write(ptr, size);
+
+    return !_fs.fail();
+  }
+
+  bool store_ext_end(void) const final
+  {
+    if (!_fs.is_open())
+      return false;
+
+    _fs.close();
 
-    return fs.good();
+    return !_fs.fail();
   }
 
 private:
   luci::Module *_module;
   const std::string _filepath;
+  bool _ext_buffer = false;
+  mutable std::ofstream _fs;
 };
 
 } // namespace luci
@@ -39,13 +39,24 @@ bool CircleExporter::invoke(Contract *contract) const
   auto module = contract->module();
   if (module != nullptr)
   {
-    CircleExporterImpl impl(module);
+    const bool ext_buffer = contract->ext_buffer();
+    CircleExporterImpl impl(module, ext_buffer);
 
     const char *ptr = impl.getBufferPointer();
     const size_t size = impl.getBufferSize();
 
-    // we just send one time
-    return contract->store(ptr, size);
+    if (!ext_buffer)
+    {
+      // we just send one time
+      return contract->store(ptr, size);
+    }
+
+    // constant data follows FlatBuffer
+    if (!contract->store(ptr, size))
+      return false;
+
+    const bool stored = impl.storeExtBuffers(contract);
+    return contract->store_ext_end() && stored;
   }
 
   auto graph = contract->graph();
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/CircleExporter.h"
+#include "luci/CircleFileExpContract.h"
+
+#include <luci/Importer.h>
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/Module.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+
+/**
+ *  Graph with constants of several sizes, including an empty one
+ *
+ *     [Input] [empty]
+ *          \   /
+ *         [Concat] [c1]
+ *             \   /
+ *             [Add] [c2]
+ *                \   /
+ *                [Mul]
+ *                  |
+ *               [Output]
+ */
+class ConstGraph
+{
+public:
+  ConstGraph()
+  {
+    auto g = loco::make_graph();
+
+    input = g->nodes()->create<luci::CircleInput>();
+    empty = createConst(g.get(), 0, 0.0f);
+    concat = g->nodes()->create<luci::CircleConcatenation>(2);
+    c1 = createConst(g.get(), N, 1.0f);
+    add = g->nodes()->create<luci::CircleAdd>();
+    c2 = createConst(g.get(), N, -3.5f);
+    mul = g->nodes()->create<luci::CircleMul>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+
+    graph_input->dtype(loco::DataType::FLOAT32);
+    graph_output->dtype(loco::DataType::FLOAT32);
+    graph_input->shape({N});
+    graph_output->shape({N});
+    for (luci::CircleNode *node : std::vector<luci::CircleNode *>{input, concat, add, mul, output})
+    {
+      node->dtype(loco::DataType::FLOAT32);
+      node->shape({N});
+    }
+
+    concat->values(0, empty);
+    concat->values(1, input);
+    concat->axis(0);
+    concat->fusedActivationFunction(luci::FusedActFunc::NONE);
+    add->x(concat);
+    add->y(c1);
+    add->fusedActivationFunction(luci::FusedActFunc::NONE);
+    mul->x(add);
+    mul->y(c2);
+    mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+    output->from(mul);
+
+    module = luci::make_module();
+    module->add(std::move(g));
+  }
+
+private:
+  luci::CircleConst *createConst(loco::Graph *g, uint32_t size, float base)
+  {
+    auto node = g->nodes()->create<luci::CircleConst>();
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape({size});
+    node->shape_status(luci::ShapeStatus::VALID);
+    node->size<loco::DataType::FLOAT32>(size);
+    for (uint32_t i = 0; i < size; ++i)
+      node->at<loco::DataType::FLOAT32>(i) = base + i * 0.25f;
+    return node;
+  }
+
+public:
+  static constexpr uint32_t N = 37;
+
+  std::unique_ptr<luci::Module> module;
+  luci::CircleInput *input = nullptr;
+  luci::CircleConst *empty = nullptr;
+  luci::CircleConcatenation *concat = nullptr;
+  luci::CircleConst *c1 = nullptr;
+  luci::CircleAdd *add = nullptr;
+  luci::CircleConst *c2 = nullptr;
+  luci::CircleMul *mul = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+constexpr uint32_t ConstGraph::N;
+
+// Stores the exported model in memory, where constant data follows FlatBuffer
+class MemoryExpContract : public luci::CircleExporter::Contract
+{
+public:
+  MemoryExpContract(luci::Module *module, bool ext_buffer)
+    : _module(module), _ext_buffer(ext_buffer)
+  {
+  }
+
+public:
+  loco::Graph *graph(void) const final { return nullptr; }
+  luci::Module *module(void) const final { return _module; }
+  bool ext_buffer(void) const final { return _ext_buffer; }
+
+public:
+  bool store(const char *ptr, const size_t size) const final
+  {
+    data.assign(ptr, ptr + size);
+    flatbuffer_size = size;
+    return true;
+  }
+
+  bool store_ext(const char *ptr, const size_t size) const final
+  {
+    data.insert(data.end(), ptr, ptr + size);
+    return true;
+  }
+
+public:
+  mutable std::vector<uint8_t> data;
+  mutable size_t flatbuffer_size = 0;
+
+private:
+  luci::Module *_module;
+  bool _ext_buffer;
+};
+
+void expectSameConst(const luci::CircleConst *expected, loco::Node *node)
+{
+  auto actual = dynamic_cast<luci::CircleConst *>(node);
+  ASSERT_NE(nullptr, actual);
+  ASSERT_EQ(loco::DataType::FLOAT32, actual->dtype());
+  ASSERT_EQ(expected->rank(), actual->rank());
+  for (uint32_t d = 0; d < expected->rank(); ++d)
+    ASSERT_EQ(expected->dim(d).value(), actual->dim(d).value());
+  ASSERT_EQ(expected->size<loco::DataType::FLOAT32>(), actual->size<loco::DataType::FLOAT32>());
+  for (uint32_t i = 0; i < expected->size<loco::DataType::FLOAT32>(); ++i)
+    EXPECT_EQ(expected->at<loco::DataType::FLOAT32>(i), actual->at<loco::DataType::FLOAT32>(i));
+}
+
+// Import the exported model, then compare the constants with the ones of the original graph
+void checkImported(const ConstGraph &g, const std::vector<uint8_t> &data)
+{
+  luci::Importer importer;
+  auto module = importer.importModule(data.data(), data.size());
+  ASSERT_NE(nullptr, module);
+  ASSERT_EQ(1, module->size());
+
+  auto graph = module->graph();
+  ASSERT_EQ(1, graph->outputs()->size());
+  auto output = luci::output_node(graph, 0);
+  auto mul = dynamic_cast<luci::CircleMul *>(output->from());
+  ASSERT_NE(nullptr, mul);
+  auto add = dynamic_cast<luci::CircleAdd *>(mul->x());
+  ASSERT_NE(nullptr, add);
+  auto concat = dynamic_cast<luci::CircleConcatenation *>(add->x());
+  ASSERT_NE(nullptr, concat);
+
+  expectSameConst(g.c2, mul->y());
+  expectSameConst(g.c1, add->y());
+  expectSameConst(g.empty, concat->values(0));
+}
+
+// Export and import again
+void roundTrip(bool ext_buffer)
+{
+  ConstGraph g;
+  MemoryExpContract contract(g.module.get(), ext_buffer);
+  luci::CircleExporter exporter;
+  ASSERT_TRUE(exporter.invoke(&contract));
+
+  if (ext_buffer)
+    ASSERT_GT(contract.data.size(), contract.flatbuffer_size);
+  else
+    ASSERT_EQ(contract.data.size(), contract.flatbuffer_size);
+
+  checkImported(g, contract.data);
+}
+
+} // namespace
+
+TEST(CircleExporterTest, ext_buffer_round_trip)
+{
+  roundTrip(true);
+}
+
+TEST(CircleExporterTest, round_trip)
+{
+  roundTrip(false);
+}
+
+TEST(CircleExporterTest, file_ext_buffer_round_trip)
+{
+  const std::string path = "CircleExporterTest.file_ext_buffer_round_trip.circle";
+
+  ConstGraph g;
+  luci::CircleFileExpContract contract(g.module.get(), path, true);
+  luci::CircleExporter exporter;
+  ASSERT_TRUE(exporter.invoke(&contract));
+
+  std::ifstream fs(path, std::ifstream::binary);
+  std::vector<uint8_t> data((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+  fs.close();
+  std::remove(path.c_str());
+
+  checkImported(g, data);
+}
+
+TEST(CircleExporterTest, file_store_ext_without_store_NEG)
+{
+  ConstGraph g;
+  luci::CircleFileExpContract contract(g.module.get(), "unused.circle", true);
+  const char data[4] = {0};
+
+  ASSERT_FALSE(contract.store_ext(data, sizeof(data)));
+  ASSERT_FALSE(contract.store_ext_end());
+}
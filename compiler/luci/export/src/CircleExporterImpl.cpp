@@ -92,6 +92,14 @@ encodeOperatorCodes(FlatBufferBuilder &builder, std::unordered_map<luci::OpCode,
   return builder.CreateVector(operator_codes_vec);
 }
 
+// NOTE This follows 'force_align: 16' of Buffer data for mmap-friendly data structures
+constexpr uint64_t kExtBufferAlign = 16;
+
+uint64_t alignExtOffset(uint64_t offset)
+{
+  return (offset + kExtBufferAlign - 1) / kExtBufferAlign * kExtBufferAlign;
+}
+
 } // namespace
 
 namespace luci
@@ -102,6 +110,10 @@ using namespace flatbuffers;
 
 CircleExporterImpl::CircleExporterImpl(loco::Graph *graph) { exportGraph(graph); }
 CircleExporterImpl::CircleExporterImpl(Module *module) { exportModule(module); }
+CircleExporterImpl::CircleExporterImpl(Module *module, bool ext_buffer) : _ext_buffer(ext_buffer)
+{
+  exportModule(module);
+}
 
 ::flatbuffers::Offset<::circle::SubGraph>
 CircleExporterImpl::exportSubgraph(SerializedGraphData &gd)
@@ -177,8 +189,10 @@ void CircleExporterImpl::exportModule(Module *module)
   // do graph optimization
 
   SerializedModelData md;
+  md._ext_buffer = _ext_buffer;
 
   _builder.Clear();
+  _ext_buffers.clear();
 
   // prepare model data
   prepareModelData(_builder, md);
@@ -236,6 +250,61 @@ void CircleExporterImpl::exportModule(Module *module)
   auto model_offset = CreateModel(_builder, version, operator_codes, subgraphs, description,
                                   buffers, metadata_buffer);
   FinishModelBuffer(_builder, model_offset);
+
+  if (_ext_buffer)
+    finishExtBuffers(md);
+}
+
+void CircleExporterImpl::finishExtBuffers(const SerializedModelData &md)
+{
+  // NOTE Buffer offset is from the beginning of the file, and constant data is placed right
+  //      after FlatBuffer. As offset is a fixed size scalar, size of FlatBuffer does not depend
+  //      on its value. So placeholder offset is written first, and is replaced here in place.
+  auto model = GetMutableRoot<Table>(_builder.GetBufferPointer());
+  auto buffers = model->GetPointer<Vector<Offset<Table>> *>(Model::VT_BUFFERS);
+  assert(buffers != nullptr);
+
+  uint64_t offset = alignExtOffset(_builder.GetSize());
+  for (const auto &ext : md._ext_buffers)
+  {
+    const auto buffer_id = ext.first;
+    const auto node = ext.second;
+
+    size_t size = 0;
+    const_raw_data(node, size);
+
+    auto buffer = buffers->GetMutableObject(buffer_id);
+    if (!buffer->SetField<uint64_t>(Buffer::VT_OFFSET, offset, 0))
+      INTERNAL_EXN("Failed to set offset of external buffer");
+
+    _ext_buffers.emplace_back(offset, node);
+    offset = alignExtOffset(offset + size);
+  }
+}
+
+bool CircleExporterImpl::storeExtBuffers(const CircleExporter::Contract *contract) const
+{
+  static const char zeros[kExtBufferAlign] = {0};
+
+  uint64_t written = getBufferSize();
+  for (const auto &ext : _ext_buffers)
+  {
+    const auto offset = ext.first;
+    const auto node = ext.second;
+
+    assert(written <= offset && offset - written < kExtBufferAlign);
+    if (written < offset && !contract->store_ext(zeros, offset - written))
+      return false;
+
+    size_t size = 0;
+    const uint8_t *data = const_raw_data(node, size);
+    if (size > 0 && !contract->store_ext(reinterpret_cast<const char *>(data), size))
+      return false;
+
+    written = offset + size;
+  }
+
+  return true;
 }
 
 const char *CircleExporterImpl::getBufferPointer() const
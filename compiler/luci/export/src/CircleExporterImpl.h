@@ -28,6 +28,9 @@
 
 #include <loco.h>
 
+#include <utility>
+#include <vector>
+
 namespace luci
 {
 
@@ -43,6 +46,11 @@ public:
   explicit CircleExporterImpl(loco::Graph *graph);
   explicit CircleExporterImpl(Module *module);
 
+  /**
+   * @param ext_buffer store constant data outside of FlatBuffer
+   */
+  CircleExporterImpl(Module *module, bool ext_buffer);
+
   /**
    * @return pointer to buffer with serialized graph
    */
@@ -53,6 +61,13 @@ public:
    */
   size_t getBufferSize() const;
 
+  /**
+   * @brief store constant data outside of FlatBuffer through contract, which should be called
+   *        right after serialized graph is stored
+   * @return false on failure
+   */
+  bool storeExtBuffers(const CircleExporter::Contract *contract) const;
+
 private:
   /**
    * @brief create Subgraph using data stored in SerializedGraphData
@@ -73,8 +88,18 @@ private:
    */
   void exportModule(Module *module);
 
+  /**
+   * @brief set file offset of Buffers whose data is stored outside of FlatBuffer
+   * @note  this should be called after FlatBuffer is finished
+   */
+  void finishExtBuffers(const SerializedModelData &md);
+
 private:
   flatbuffers::FlatBufferBuilder _builder;
+
+  bool _ext_buffer = false;
+  // file offset and content of constant data stored outside of FlatBuffer
+  std::vector<std::pair<uint64_t, const luci::CircleConst *>> _ext_buffers;
 };
 
 } // namespace luci
@@ -279,47 +279,40 @@ flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, N
 }
 
 template <loco::DataType DT>
-flatbuffers::Offset<circle::Buffer> encodeOpBufferByDType(FlatBufferBuilder &builder,
-                                                          luci::CircleConst *c)
+const uint8_t *const_raw_data_by_dtype(const luci::CircleConst *c, size_t &size)
 {
   using NativeType = typename loco::DataTypeImpl<DT>::Type;
 
-  std::vector<NativeType> raw_data;
-  const uint32_t size = c->size<DT>();
-  raw_data.reserve(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    raw_data.push_back(c->at<DT>(i));
-  }
-  const size_t raw_size = size * sizeof(NativeType);
-  auto array_offset = builder.CreateVector(reinterpret_cast<uint8_t *>(raw_data.data()), raw_size);
-  return CreateBuffer(builder, array_offset);
+  const uint32_t num_elements = c->size<DT>();
+  size = num_elements * sizeof(NativeType);
+  if (num_elements == 0)
+    return nullptr;
+
+  return reinterpret_cast<const uint8_t *>(&c->at<DT>(0));
 }
 
 template <>
 flatbuffers::Offset<circle::Buffer> encodeOpBuffer(FlatBufferBuilder &builder, luci::CircleConst *c)
 {
-  switch (c->dtype())
-  {
-    case loco::DataType::FLOAT32:
-      return encodeOpBufferByDType<loco::DataType::FLOAT32>(builder, c);
-    case loco::DataType::S8:
-      return encodeOpBufferByDType<loco::DataType::S8>(builder, c);
-    case loco::DataType::S16:
-      return encodeOpBufferByDType<loco::DataType::S16>(builder, c);
-    case loco::DataType::S32:
-      return encodeOpBufferByDType<loco::DataType::S32>(builder, c);
-    case loco::DataType::S64:
-      return encodeOpBufferByDType<loco::DataType::S64>(builder, c);
-    case loco::DataType::U8:
-      return encodeOpBufferByDType<loco::DataType::U8>(builder, c);
-    case loco::DataType::BOOL:
-      return encodeOpBufferByDType<loco::DataType::BOOL>(builder, c);
-    default:
-      break;
-  }
+  size_t raw_size = 0;
+  const uint8_t *raw_data = const_raw_data(c, raw_size);
 
-  INTERNAL_EXN_V("Unsupported datatype", oops::to_uint32(c->dtype()));
+  auto array_offset = builder.CreateVector(raw_data, raw_size);
+  return CreateBuffer(builder, array_offset);
+}
+
+/**
+ * @brief Create Buffer that refers to data outside of FlatBuffer
+ * @note  'offset' is set to 1 as a placeholder, which is replaced with actual file offset
+ *        when model is finished. Value should not be 0 so that the field is always written.
+ */
+flatbuffers::Offset<circle::Buffer> encodeExtBuffer(FlatBufferBuilder &builder,
+                                                    luci::CircleConst *c)
+{
+  size_t raw_size = 0;
+  const_raw_data(c, raw_size);
+
+  return CreateBuffer(builder, 0, /* offset */ 1, /* size */ raw_size);
 }
 
 flatbuffers::Offset<circle::QuantizationParameters>
@@ -376,7 +369,7 @@ encodeSparsityParameters(FlatBufferBuilder &builder, luci::SparsityParam *sparsi
                                                 &sparsityparam->block_map, &dim_metadata_vec);
 }
 
-bool has_same_values(luci::CircleConst *lhs, luci::CircleConst *rhs)
+bool has_same_values(const luci::CircleConst *lhs, const luci::CircleConst *rhs)
 {
   if (lhs->dtype() != rhs->dtype())
     return false;
@@ -432,11 +425,16 @@ uint32_t get_buffer_id(FlatBufferBuilder &builder, SerializedModelData &md, luci
         return key_value.second;
     }
 
-    // When buffer with same values is not found, generate new buffer
-    auto buffer = encodeOpBuffer(builder, node);
-
     auto buffer_id = static_cast<uint32_t>(md._buffers.size());
-    md._buffers.push_back(buffer);
+
+    // When buffer with same values is not found, generate new buffer
+    if (md._ext_buffer)
+    {
+      md._buffers.push_back(encodeExtBuffer(builder, node));
+      md._ext_buffers.emplace_back(buffer_id, node);
+    }
+    else
+      md._buffers.push_back(encodeOpBuffer(builder, node));
 
     // Cache the newly generated buffer id
     md._cached_buffer_id.insert({node, buffer_id});
@@ -493,6 +491,31 @@ void prepareModelData(FlatBufferBuilder &builder, SerializedModelData &md)
   md._buffers.push_back(buffer);
 }
 
+const uint8_t *const_raw_data(const luci::CircleConst *node, size_t &size)
+{
+  switch (node->dtype())
+  {
+    case loco::DataType::FLOAT32:
+      return const_raw_data_by_dtype<loco::DataType::FLOAT32>(node, size);
+    case loco::DataType::S8:
+      return const_raw_data_by_dtype<loco::DataType::S8>(node, size);
+    case loco::DataType::S16:
+      return const_raw_data_by_dtype<loco::DataType::S16>(node, size);
+    case loco::DataType::S32:
+      return const_raw_data_by_dtype<loco::DataType::S32>(node, size);
+    case loco::DataType::S64:
+      return const_raw_data_by_dtype<loco::DataType::S64>(node, size);
+    case loco::DataType::U8:
+      return const_raw_data_by_dtype<loco::DataType::U8>(node, size);
+    case loco::DataType::BOOL:
+      return const_raw_data_by_dtype<loco::DataType::BOOL>(node, size);
+    default:
+      break;
+  }
+
+  INTERNAL_EXN_V("Unsupported datatype", oops::to_uint32(node->dtype()));
+}
+
 void exportOpDefinedTensors(loco::Graph *g, FlatBufferBuilder &builder, SerializedModelData &md,
                             SerializedGraphData &gd)
 {
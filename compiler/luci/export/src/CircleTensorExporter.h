@@ -39,6 +39,12 @@ void prepareModelData(flatbuffers::FlatBufferBuilder &builder, SerializedModelDa
 void exportOpDefinedTensors(loco::Graph *g, flatbuffers::FlatBufferBuilder &builder,
                             SerializedModelData &md, SerializedGraphData &gd);
 
+/**
+ * @brief get raw data of CircleConst
+ * @param size size of returned data in bytes
+ */
+const uint8_t *const_raw_data(const luci::CircleConst *node, size_t &size);
+
 } // namespace luci
 
 #endif // __CIRCLE_TENSOR_EXPORTER_H__
@@ -90,6 +90,11 @@ struct SerializedModelData final
   // This is used for removing buffers with same values
   std::map<luci::CircleConst *, uint32_t> _cached_buffer_id;
 
+  // Store constant data outside of FlatBuffer, see CircleExporter::Contract::ext_buffer()
+  bool _ext_buffer = false;
+  // Buffer id and its content, of which data is to be stored outside of FlatBuffer
+  std::vector<std::pair<uint32_t, luci::CircleConst *>> _ext_buffers;
+
   /**
    * @brief if opcode is not registered in table of opcodes add it
    * @param builtin_code
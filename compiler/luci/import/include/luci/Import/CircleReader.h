@@ -59,11 +59,11 @@ void copy_tensor_attributes(const circle::TensorT &tensor, CircleNode *node);
 class CircleReader
 {
 private:
-  using CircleBuffers_t = std::vector<std::unique_ptr<circle::BufferT>>;
   using CircleTensors_t = std::vector<std::unique_ptr<circle::TensorT>>;
   using CircleOperators_t = std::vector<std::unique_ptr<circle::OperatorT>>;
   using CircleOperatorCodes_t = std::vector<std::unique_ptr<circle::OperatorCodeT>>;
 
+  using CircleBuffersPtr_t = flatbuffers::Vector<flatbuffers::Offset<circle::Buffer>>;
   using CircleSubGraphsPtr_t = flatbuffers::Vector<flatbuffers::Offset<circle::SubGraph>>;
   using CircleTensorsPtr_t = flatbuffers::Vector<flatbuffers::Offset<circle::Tensor>>;
 
@@ -72,7 +72,6 @@ public:
 
 public:
   const CircleOperatorCodes_t &opcodes() const { return _model->operator_codes; }
-  const CircleBuffers_t &buffers() const { return _model->buffers; }
   const CircleTensors_t &tensors() const { return _current_subgraph->tensors; }
   const CircleOperators_t &operators() const { return _current_subgraph->operators; }
   const std::vector<int32_t> &inputs() const { return _current_subgraph->inputs; }
@@ -81,14 +80,21 @@ public:
   const circle::DataFormat &data_format() const { return _current_subgraph->data_format; }
 
   const CircleTensorsPtr_t *tensors_ptr() const { return _tensors_ptr; }
+  // NOTE buffers are not unpacked; constant data is read from the model directly
+  const CircleBuffersPtr_t *buffers_ptr() const { return _model_ptr->buffers(); }
 
   uint32_t num_subgraph() const { return _model->subgraphs.size(); }
 
   circle::BuiltinOperator builtin_code(const circle::OperatorT &op) const;
   std::string opcode_name(const circle::OperatorT &op) const;
 
+  // File data of model, which is required to access buffers stored outside of FlatBuffer
+  const uint8_t *file_data() const { return _file_data; }
+  size_t file_size() const { return _file_size; }
+
 public:
   bool parse(const circle::Model *model);
+  bool parse(const circle::Model *model, const uint8_t *data, const size_t size);
   bool select_subgraph(uint32_t subgraph);
 
 private:
@@ -97,6 +103,9 @@ private:
 
   const circle::Model *_model_ptr{nullptr};
   const CircleTensorsPtr_t *_tensors_ptr{nullptr};
+
+  const uint8_t *_file_data{nullptr};
+  size_t _file_size{0};
 };
 
 } // namespace luci
@@ -86,11 +86,16 @@ public:
   IndexNodeFinder *nodefinder() { return _indexnodefinder; }
   IndexTensorOutputs *tensoroutputs() { return _indextensoroutputs; }
 
+  /// @brief Set true to make CircleConst refer to model buffers instead of copying them
+  void refer_const_data(bool refer) { _refer_const_data = refer; }
+  bool refer_const_data(void) const { return _refer_const_data; }
+
 private:
   loco::Graph *_g;
   CircleReader *_reader;
   IndexNodeFinder *_indexnodefinder;
   IndexTensorOutputs *_indextensoroutputs;
+  bool _refer_const_data = false;
 };
 
 } // namespace luci
@@ -17,6 +17,7 @@
 #ifndef __LUCI_IMPORTER_H__
 #define __LUCI_IMPORTER_H__
 
+#include "luci/Import/CircleReader.h"
 #include "luci/Import/GraphBuilderRegistry.h"
 
 #include "luci/IR/Module.h"
@@ -44,9 +45,22 @@ public:
 public:
   std::unique_ptr<loco::Graph> import(const circle::Model *model) const;
   std::unique_ptr<Module> importModule(const circle::Model *model) const;
+  // NOTE Use this to import model with buffers stored outside of FlatBuffer
+  std::unique_ptr<Module> importModule(const uint8_t *data, const size_t size) const;
+
+public:
+  /**
+   * @brief Let CircleConst nodes refer to constant data of the source model without copy
+   * @note  Buffer of the source model should outlive the imported graph or module
+   */
+  void refer_const_data(bool refer) { _refer_const_data = refer; }
+
+private:
+  std::unique_ptr<Module> importModule(CircleReader &reader) const;
 
 private:
   const GraphBuilderSource *_source = nullptr;
+  bool _refer_const_data = false;
 };
 
 } // namespace luci
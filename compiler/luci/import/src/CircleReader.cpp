@@ -323,7 +323,29 @@ bool CircleReader::parse(const circle::Model *model)
 {
   assert(model != nullptr);
 
-  _model.reset(model->UnPack());
+  // NOTE model->UnPack() would copy all buffers, which can be as large as the model itself.
+  //      Unpack everything but buffers, which are accessed through buffers_ptr().
+  auto model_t = std::make_unique<circle::ModelT>();
+
+  model_t->version = model->version();
+  if (model->description() != nullptr)
+    model_t->description = model->description()->str();
+
+  const auto opcodes = model->operator_codes();
+  if (opcodes != nullptr)
+  {
+    for (uint32_t i = 0; i < opcodes->size(); ++i)
+      model_t->operator_codes.emplace_back(opcodes->Get(i)->UnPack());
+  }
+
+  const auto subgraphs = model->subgraphs();
+  if (subgraphs != nullptr)
+  {
+    for (uint32_t i = 0; i < subgraphs->size(); ++i)
+      model_t->subgraphs.emplace_back(subgraphs->Get(i)->UnPack());
+  }
+
+  _model = std::move(model_t);
 
   // for direct pointer access
   _model_ptr = model;
@@ -331,6 +353,17 @@ bool CircleReader::parse(const circle::Model *model)
   return true;
 }
 
+bool CircleReader::parse(const circle::Model *model, const uint8_t *data, const size_t size)
+{
+  if (!parse(model))
+    return false;
+
+  _file_data = data;
+  _file_size = size;
+
+  return true;
+}
+
 bool CircleReader::select_subgraph(uint32_t sgindex)
 {
   if (_model->subgraphs.size() <= sgindex)
@@ -38,7 +38,7 @@ namespace
 {
 
 void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &reader,
-                   loco::Graph *graph)
+                   loco::Graph *graph, bool refer_const_data)
 {
   LOGGER(l);
 
@@ -46,6 +46,7 @@ void convert_graph(const luci::GraphBuilderSource &source, luci::CircleReader &r
   auto tensoroutputs = std::make_unique<luci::IndexTensorOutputs>();
 
   luci::GraphBuilderContext gb_context(graph, &reader, nodefinder.get(), tensoroutputs.get());
+  gb_context.refer_const_data(refer_const_data);
 
   const auto &operators = reader.operators();
   const auto &tensors = reader.tensors();
@@ -252,7 +253,7 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
     return nullptr;
 
   // Convert circle::Model to loco::Graph
-  convert_graph(*source_ptr, reader, graph.get());
+  convert_graph(*source_ptr, reader, graph.get(), _refer_const_data);
 
   LOGGER(l);
   VERBOSE(l, 3) << "--- graph dump begin -------------------------------------------";
@@ -266,6 +267,24 @@ std::unique_ptr<loco::Graph> Importer::import(const circle::Model *model) const
 }
 
 std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
+{
+  CircleReader reader;
+  if (!reader.parse(model))
+    return nullptr;
+
+  return importModule(reader);
+}
+
+std::unique_ptr<Module> Importer::importModule(const uint8_t *data, const size_t size) const
+{
+  CircleReader reader;
+  if (!reader.parse(circle::GetModel(data), data, size))
+    return nullptr;
+
+  return importModule(reader);
+}
+
+std::unique_ptr<Module> Importer::importModule(CircleReader &reader) const
 {
   auto module = make_module();
 
@@ -277,10 +296,6 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
     source_ptr = _source;
   }
 
-  CircleReader reader;
-  if (!reader.parse(model))
-    return nullptr;
-
   for (uint32_t g = 0; g < reader.num_subgraph(); ++g)
   {
     auto graph = loco::make_graph();
@@ -291,7 +306,7 @@ std::unique_ptr<Module> Importer::importModule(const circle::Model *model) const
     graph->name(reader.name());
 
     // Convert circle::Model to loco::Graph
-    convert_graph(*source_ptr, reader, graph.get());
+    convert_graph(*source_ptr, reader, graph.get(), _refer_const_data);
 
     LOGGER(l);
     VERBOSE(l, 3) << "--- graph dump begin -------------------------------------------";
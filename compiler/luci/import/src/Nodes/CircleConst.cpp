@@ -23,6 +23,8 @@
 #include <oops/UserExn.h>
 
 #include <cassert>
+#include <cstring>
+#include <limits>
 
 namespace
 {
@@ -46,25 +48,28 @@ namespace luci
 {
 
 template <loco::DataType DT>
-static void copy_data(const std::vector<uint8_t> &raw_data, uint32_t num_elements,
-                      CircleConst *const_node)
+static void copy_data(const uint8_t *raw_data, uint32_t raw_size, uint32_t num_elements,
+                      CircleConst *const_node, bool refer)
 {
   using T = typename loco::DataTypeImpl<DT>::Type;
 
   // TODO calculate the exact buffer size of sparse tensor
   if (const_node->sparsityparam())
   {
-    num_elements = raw_data.size() / sizeof(T);
+    num_elements = raw_size / sizeof(T);
   }
 
-  assert(raw_data.size() == num_elements * sizeof(T));
-  const auto *data = reinterpret_cast<const T *>(raw_data.data());
+  assert(raw_size == num_elements * sizeof(T));
 
-  const_node->size<DT>(num_elements);
-  for (uint32_t i = 0; i < num_elements; ++i)
+  // NOTE buffer data in the model is not guaranteed to be aligned for T
+  if (refer && reinterpret_cast<uintptr_t>(raw_data) % alignof(T) == 0)
   {
-    const_node->at<DT>(i) = data[i];
+    const_node->refer(raw_data, num_elements * sizeof(T));
+    return;
   }
+
+  const_node->size<DT>(num_elements);
+  std::memcpy(&const_node->at<DT>(0), raw_data, num_elements * sizeof(T));
 }
 
 CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_index)
@@ -76,9 +81,31 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
   const auto &tensors = reader->tensors();
   const circle::TensorT &const_tensor = *tensors[tensor_index];
 
-  const std::vector<uint8_t> &buffer = reader->buffers()[const_tensor.buffer]->data;
+  const auto buffers = reader->buffers_ptr();
+  assert(buffers != nullptr && const_tensor.buffer < buffers->size());
+  const auto circle_buffer = buffers->Get(const_tensor.buffer);
+  const auto buffer = circle_buffer->data();
+  const uint8_t *buffer_data = buffer != nullptr ? buffer->data() : nullptr;
+  uint32_t buffer_size = buffer != nullptr ? buffer->size() : 0;
+
+  // NOTE offset 0 means not used, and 1 is a placeholder
+  if (buffer == nullptr && circle_buffer->offset() > 1)
+  {
+    const auto offset = circle_buffer->offset();
+    const auto size = circle_buffer->size();
+    if (reader->file_data() == nullptr)
+      throw oops::UserExn("Buffer outside of FlatBuffer needs file data", tensor_index);
+    if (offset > reader->file_size() || size > reader->file_size() - offset)
+      throw oops::UserExn("Invalid buffer offset", tensor_index);
+    if (size > std::numeric_limits<uint32_t>::max())
+      throw oops::UserExn("Buffer is too large", tensor_index);
+
+    buffer_data = reader->file_data() + offset;
+    buffer_size = static_cast<uint32_t>(size);
+  }
+
   std::vector<int32_t> const_dims = const_tensor.shape; // in NHWC
-  if (const_dims.size() == 0 && buffer.empty())
+  if (const_dims.size() == 0 && buffer_size == 0)
   {
     // unknown shape tensor and scalar tensor
     return nullptr;
@@ -98,7 +125,7 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
     num_elements = num_elements * const_dims[r];
   }
 
-  if (buffer.empty() && num_elements > 0)
+  if (buffer_size == 0 && num_elements > 0)
   {
     // normal empty tensor
     return nullptr;
@@ -111,34 +138,37 @@ CircleConst *create_circleconst(GraphBuilderContext *context, int32_t tensor_ind
           << const_dims << std::endl;
   if (num_elements > 0)
   {
+    const bool refer = context->refer_const_data();
+
     switch (luci_datatype(const_tensor.type))
     {
       case loco::DataType::FLOAT32:
-        copy_data<loco::DataType::FLOAT32>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::FLOAT32>(buffer_data, buffer_size, num_elements, const_node,
+                                           refer);
         break;
 
       case loco::DataType::U8:
-        copy_data<loco::DataType::U8>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::U8>(buffer_data, buffer_size, num_elements, const_node, refer);
         break;
 
       case loco::DataType::S8:
-        copy_data<loco::DataType::S8>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S8>(buffer_data, buffer_size, num_elements, const_node, refer);
         break;
 
       case loco::DataType::S16:
-        copy_data<loco::DataType::S16>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S16>(buffer_data, buffer_size, num_elements, const_node, refer);
         break;
 
       case loco::DataType::S32:
-        copy_data<loco::DataType::S32>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S32>(buffer_data, buffer_size, num_elements, const_node, refer);
         break;
 
       case loco::DataType::S64:
-        copy_data<loco::DataType::S64>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::S64>(buffer_data, buffer_size, num_elements, const_node, refer);
         break;
 
       case loco::DataType::BOOL:
-        copy_data<loco::DataType::BOOL>(buffer, num_elements, const_node);
+        copy_data<loco::DataType::BOOL>(buffer_data, buffer_size, num_elements, const_node, refer);
         break;
 
       default:
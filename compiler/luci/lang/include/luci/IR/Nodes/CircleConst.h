@@ -45,8 +45,25 @@ public:
   template <loco::DataType DT> const typename loco::DataTypeImpl<DT>::Type &scalar(void) const;
   template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &scalar(void);
 
+public:
+  /**
+   * @brief Refer to read-only data owned by others, such as a loaded model buffer,
+   *        instead of holding a copy
+   * @note  'data' should outlive this node and should be aligned for dtype().
+   *        Data is copied to own storage on first mutable access (copy-on-write).
+   */
+  void refer(const uint8_t *data, uint32_t size);
+  bool referring(void) const { return _ref_data != nullptr; }
+
+private:
+  const uint8_t *data(void) const;
+  uint32_t data_size(void) const;
+  void own(void);
+
 private:
   std::vector<uint8_t> _data;
+  const uint8_t *_ref_data = nullptr;
+  uint32_t _ref_size = 0;
 };
 
 } // namespace luci
@@ -21,16 +21,46 @@
 namespace luci
 {
 
+void CircleConst::refer(const uint8_t *data, uint32_t size)
+{
+  assert(data != nullptr);
+  _data.clear();
+  _data.shrink_to_fit();
+  _ref_data = data;
+  _ref_size = size;
+}
+
+const uint8_t *CircleConst::data(void) const
+{
+  return _ref_data != nullptr ? _ref_data : _data.data();
+}
+
+uint32_t CircleConst::data_size(void) const
+{
+  return _ref_data != nullptr ? _ref_size : static_cast<uint32_t>(_data.size());
+}
+
+void CircleConst::own(void)
+{
+  if (_ref_data == nullptr)
+    return;
+
+  _data.assign(_ref_data, _ref_data + _ref_size);
+  _ref_data = nullptr;
+  _ref_size = 0;
+}
+
 template <loco::DataType DT> uint32_t CircleConst::size(void) const
 {
   assert(dtype() == DT);
-  assert(_data.size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
-  return _data.size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
+  assert(data_size() % sizeof(typename loco::DataTypeImpl<DT>::Type) == 0);
+  return data_size() / sizeof(typename loco::DataTypeImpl<DT>::Type);
 }
 
 template <loco::DataType DT> void CircleConst::size(uint32_t l)
 {
   assert(dtype() == DT);
+  own();
   _data.resize(l * sizeof(typename loco::DataTypeImpl<DT>::Type));
 }
 
@@ -39,13 +69,14 @@ const typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n) const
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data()) + n);
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::at(uint32_t n)
 {
   assert(dtype() == DT);
   assert(n < size<DT>());
+  own();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()) + n);
 }
 
@@ -53,12 +84,13 @@ template <loco::DataType DT>
 const typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void) const
 {
   assert(dtype() == DT);
-  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
+  return *(reinterpret_cast<const typename loco::DataTypeImpl<DT>::Type *>(data()));
 }
 
 template <loco::DataType DT> typename loco::DataTypeImpl<DT>::Type &CircleConst::scalar(void)
 {
   assert(dtype() == DT);
+  own();
   return *(reinterpret_cast<typename loco::DataTypeImpl<DT>::Type *>(_data.data()));
 }
 
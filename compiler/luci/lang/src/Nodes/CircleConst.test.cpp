@@ -51,3 +51,35 @@ TEST(CircleConstTest, scalar)
   auto const &cs = const_node.scalar<loco::DataType::S32>();
   ASSERT_EQ(1, cs);
 }
+
+TEST(CircleConstTest, refer)
+{
+  const int32_t buffer[] = {1, 2, 3};
+
+  luci::CircleConst const_node;
+
+  const_node.dtype(loco::DataType::S32);
+  const_node.refer(reinterpret_cast<const uint8_t *>(buffer), sizeof(buffer));
+
+  const auto &cnode = const_node;
+  ASSERT_TRUE(const_node.referring());
+  ASSERT_EQ(3, cnode.size<loco::DataType::S32>());
+  ASSERT_EQ(2, cnode.at<loco::DataType::S32>(1));
+}
+
+TEST(CircleConstTest, refer_copy_on_write)
+{
+  const int32_t buffer[] = {1, 2, 3};
+
+  luci::CircleConst const_node;
+
+  const_node.dtype(loco::DataType::S32);
+  const_node.refer(reinterpret_cast<const uint8_t *>(buffer), sizeof(buffer));
+  const_node.at<loco::DataType::S32>(1) = 5;
+
+  ASSERT_FALSE(const_node.referring());
+  ASSERT_EQ(3, const_node.size<loco::DataType::S32>());
+  ASSERT_EQ(5, const_node.at<loco::DataType::S32>(1));
+  ASSERT_EQ(3, const_node.at<loco::DataType::S32>(2));
+  ASSERT_EQ(2, buffer[1]);
+}
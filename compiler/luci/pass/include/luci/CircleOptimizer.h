@@ -86,6 +86,9 @@ public:
       // convert NCHW to NHWC
       NCHW_to_NHWC_preserve_input_shape,
       NCHW_to_NHWC_preserve_output_shape,
+
+      // optimize
+      Optimize_phase_strategy, // "restart"(default) or "worklist"
     };
 
     virtual ~Options() = default;
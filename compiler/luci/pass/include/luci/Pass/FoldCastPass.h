@@ -26,11 +26,11 @@ namespace luci
  * @brief  Class to fold Cast to a constant tensor
  *
  */
-struct FoldCastPass final : public logo::Pass
+struct FoldCastPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::FoldCastPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
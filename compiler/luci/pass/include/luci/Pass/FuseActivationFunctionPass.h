@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to fuse activation functions into preceding operators
  */
-struct FuseActivationFunctionPass final : public logo::Pass
+struct FuseActivationFunctionPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::FuseActivationFunctionPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to fuse Add into CircleTransposeConv
  */
-struct FuseAddWithTConvPass final : public logo::Pass
+struct FuseAddWithTConvPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::FuseAddWithTConvPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to fuse Batch Normalization into CircleConv
  */
-struct FuseBatchNormWithConvPass final : public logo::Pass
+struct FuseBatchNormWithConvPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::FuseBatchNormWithConvPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -27,11 +27,11 @@ namespace luci
  * @details This class will update consecutive two Reshape node into single Reshape node.
  *          As Reshape operation just change shape, not buffer, former reshape could be unnecessary.
  */
-struct RemoveRedundantReshapePass final : public logo::Pass
+struct RemoveRedundantReshapePass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::RemoveRedundantReshapePass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
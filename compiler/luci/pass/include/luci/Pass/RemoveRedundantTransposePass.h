@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief fuse or remove subsequent Transpose operators
  */
-struct RemoveRedundantTransposePass final : public logo::Pass
+struct RemoveRedundantTransposePass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::RemoveRedundantTransposePass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to Remove Unnecessary(input shape and output shape same) Reshape node.
  */
-struct RemoveUnnecessaryReshapePass final : public logo::Pass
+struct RemoveUnnecessaryReshapePass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::RemoveUnnecessaryReshapePass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
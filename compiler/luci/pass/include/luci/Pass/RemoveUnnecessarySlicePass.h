@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to Remove Unnecessary(input and output are same) Slice node.
  */
-struct RemoveUnnecessarySlicePass final : public logo::Pass
+struct RemoveUnnecessarySlicePass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::RemoveUnnecessarySlicePass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief Remove unnecessary Split OP
  */
-struct RemoveUnnecessarySplitPass final : public logo::Pass
+struct RemoveUnnecessarySplitPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::RemoveUnnecessarySplitPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
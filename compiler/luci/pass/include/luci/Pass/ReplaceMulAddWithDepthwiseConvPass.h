@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to replace channel-wise mul/add with CircleDepthwiseConv2D
  */
-struct ReplaceMulAddWithDepthwiseConvPass final : public logo::Pass
+struct ReplaceMulAddWithDepthwiseConvPass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::ReplaceMulAddWithDepthwiseConvPass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to Substitute Pack with 1 input to single reshape node.
  */
-struct SubstitutePackToReshapePass final : public logo::Pass
+struct SubstitutePackToReshapePass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::SubstitutePackToReshapePass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to Substitute Squeeze to Reshape node for certain conditions.
  */
-struct SubstituteSqueezeToReshapePass final : public logo::Pass
+struct SubstituteSqueezeToReshapePass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::SubstituteSqueezeToReshapePass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
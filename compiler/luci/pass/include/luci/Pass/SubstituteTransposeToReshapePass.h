@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to Substitute Transpose with certain input shape condition to single reshape node.
  */
-struct SubstituteTransposeToReshapePass final : public logo::Pass
+struct SubstituteTransposeToReshapePass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::SubstituteTransposeToReshapePass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
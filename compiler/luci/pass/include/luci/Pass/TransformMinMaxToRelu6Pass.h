@@ -25,11 +25,11 @@ namespace luci
 /**
  * @brief  Class to transform Maximum(Minimum(input, 6), 0) to Relu6
  */
-struct TransformMinMaxToRelu6Pass final : public logo::Pass
+struct TransformMinMaxToRelu6Pass final : public logo::NodePass
 {
   const char *name(void) const final { return "luci::TransformMinMaxToRelu6Pass"; }
 
-  bool run(loco::Graph *g) final;
+  bool rewrite(loco::Node *node) final;
 };
 
 } // namespace luci
@@ -301,6 +301,15 @@ void CircleOptimizer::optimize(loco::Graph *g) const
 
   /* TRANSFORM DECLARATION END */
 
+  if (_options->param(Options::AlgorithmParameters::Optimize_phase_strategy) == "worklist")
+  {
+    ProgressReporter prog(g, logo::PhaseStrategy::Worklist);
+    logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g};
+    phase_runner.attach(&prog);
+    phase_runner.run(phase);
+    return;
+  }
+
   ProgressReporter prog(g, logo::PhaseStrategy::Restart);
   logo::PhaseRunner<logo::PhaseStrategy::Restart> phase_runner{g};
   phase_runner.attach(&prog);
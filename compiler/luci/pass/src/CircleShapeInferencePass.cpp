@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "helpers/InferenceCache.h"
 #include "helpers/InferenceCandidates.h"
 
 #include "luci/Pass/CircleShapeInferencePass.h"
@@ -73,15 +74,24 @@ bool CircleShapeInferencePass::run(loco::Graph *g)
     loco::TensorShape shape;
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
 
-    if (shape_infer_rule.infer(circle_node, shape) && !is_same_shape(circle_node, shape))
-    {
-      circle_node->rank(shape.rank());
-      for (uint32_t i = 0; i < shape.rank(); ++i)
-        circle_node->dim(i) = shape.dim(i);
-
-      circle_node->shape_status(luci::ShapeStatus::VALID);
+    // Skip nodes whose inputs are not changed since the last inference
+    if (!shape_dirty(circle_node))
+      continue;
 
-      changed = true;
+    if (shape_infer_rule.infer(circle_node, shape))
+    {
+      bool node_changed = !is_same_shape(circle_node, shape);
+      if (node_changed)
+      {
+        circle_node->rank(shape.rank());
+        for (uint32_t i = 0; i < shape.rank(); ++i)
+          circle_node->dim(i) = shape.dim(i);
+
+        circle_node->shape_status(luci::ShapeStatus::VALID);
+
+        changed = true;
+      }
+      shape_inferred(circle_node, node_changed);
     }
   }
 
@@ -362,3 +362,153 @@ TEST(CircleShapeInferencePassTest, not_used_virtual_op)
 
   SUCCEED();
 }
+
+/**
+ * This test is to check whether a node is inferred again when its attribute is changed
+ * in place.
+ */
+TEST(CircleShapeInferencePassTest, attribute_changed)
+{
+  luci::CircleShapeInferencePass pass;
+  auto g = loco::make_graph();
+
+  auto input1 = g->nodes()->create<luci::CircleInput>();
+  auto input2 = g->nodes()->create<luci::CircleInput>();
+  auto concat = g->nodes()->create<luci::CircleConcatenation>(2);
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  auto graph_input1 = g->inputs()->create();
+  input1->index(graph_input1->index());
+  input1->shape({1, 2});
+  input1->shape_status(luci::ShapeStatus::VALID);
+
+  auto graph_input2 = g->inputs()->create();
+  input2->index(graph_input2->index());
+  input2->shape({1, 2});
+  input2->shape_status(luci::ShapeStatus::VALID);
+
+  concat->values(0, input1);
+  concat->values(1, input2);
+  concat->axis(0);
+  concat->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  output->from(concat);
+  graph_output->shape({2, 2});
+
+  while (pass.run(g.get()) == true)
+    ;
+  ASSERT_EQ(2, concat->dim(0).value());
+  ASSERT_EQ(2, concat->dim(1).value());
+
+  // Nothing is changed
+  ASSERT_FALSE(pass.run(g.get()));
+
+  concat->axis(1);
+
+  while (pass.run(g.get()) == true)
+    ;
+  ASSERT_EQ(1, concat->dim(0).value());
+  ASSERT_EQ(4, concat->dim(1).value());
+}
+
+/**
+ * This test is to check whether a node is inferred again when contents of its constant input
+ * are changed in place.
+ */
+TEST(CircleShapeInferencePassTest, const_changed)
+{
+  luci::CircleShapeInferencePass pass;
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto shape = g->nodes()->create<luci::CircleConst>();
+  auto reshape = g->nodes()->create<luci::CircleReshape>();
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  auto graph_input = g->inputs()->create();
+  input->index(graph_input->index());
+  input->shape({2, 6});
+  input->shape_status(luci::ShapeStatus::VALID);
+
+  shape->dtype(loco::DataType::S32);
+  shape->shape({2});
+  shape->shape_status(luci::ShapeStatus::VALID);
+  shape->size<loco::DataType::S32>(2);
+  shape->at<loco::DataType::S32>(0) = 3;
+  shape->at<loco::DataType::S32>(1) = 4;
+
+  reshape->tensor(input);
+  reshape->shape(shape);
+
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  output->from(reshape);
+  graph_output->shape({3, 4});
+
+  while (pass.run(g.get()) == true)
+    ;
+  ASSERT_EQ(3, reshape->dim(0).value());
+  ASSERT_EQ(4, reshape->dim(1).value());
+
+  // Nothing is changed
+  ASSERT_FALSE(pass.run(g.get()));
+
+  shape->at<loco::DataType::S32>(0) = 4;
+  shape->at<loco::DataType::S32>(1) = 3;
+
+  while (pass.run(g.get()) == true)
+    ;
+  ASSERT_EQ(4, reshape->dim(0).value());
+  ASSERT_EQ(3, reshape->dim(1).value());
+}
+
+/**
+ * This test is to check whether a node is inferred again when contents of its FLOAT32 constant
+ * input are changed in place, without invalidate_inference().
+ */
+TEST(CircleShapeInferencePassTest, range_const_changed)
+{
+  luci::CircleShapeInferencePass pass;
+  auto g = loco::make_graph();
+
+  auto create_scalar = [&g](float value) {
+    auto node = g->nodes()->create<luci::CircleConst>();
+    node->dtype(loco::DataType::FLOAT32);
+    node->rank(0);
+    node->shape_status(luci::ShapeStatus::VALID);
+    node->size<loco::DataType::FLOAT32>(1);
+    node->at<loco::DataType::FLOAT32>(0) = value;
+    return node;
+  };
+
+  auto start = create_scalar(0.0f);
+  auto limit = create_scalar(1.5f);
+  auto delta = create_scalar(0.5f);
+  auto range = g->nodes()->create<luci::CircleRange>();
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  range->start(start);
+  range->limit(limit);
+  range->delta(delta);
+
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  output->from(range);
+  graph_output->shape({3});
+
+  while (pass.run(g.get()) == true)
+    ;
+  ASSERT_EQ(3, range->dim(0).value());
+
+  // Nothing is changed
+  ASSERT_FALSE(pass.run(g.get()));
+
+  // Same value when casted to an integer
+  limit->at<loco::DataType::FLOAT32>(0) = 1.9f;
+
+  while (pass.run(g.get()) == true)
+    ;
+  ASSERT_EQ(4, range->dim(0).value());
+}
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "helpers/InferenceCache.h"
 #include "helpers/InferenceCandidates.h"
 
 #include "luci/Pass/CircleTypeInferencePass.h"
@@ -48,10 +49,19 @@ bool CircleTypeInferencePass::run(loco::Graph *g)
     loco::DataType dtype;
     auto circle_node = loco::must_cast<luci::CircleNode *>(node);
 
-    if (type_infer_rule.infer(circle_node, dtype) && circle_node->dtype() != dtype)
+    // Skip nodes whose inputs are not changed since the last inference
+    if (!dtype_dirty(circle_node))
+      continue;
+
+    if (type_infer_rule.infer(circle_node, dtype))
     {
-      circle_node->dtype(dtype);
-      changed = true;
+      bool node_changed = circle_node->dtype() != dtype;
+      if (node_changed)
+      {
+        circle_node->dtype(dtype);
+        changed = true;
+      }
+      dtype_inferred(circle_node, node_changed);
     }
   }
 
@@ -16,6 +16,7 @@
 
 #include "luci/Pass/ConvertNCHWToNHWCPass.h"
 #include "CircleOptimizerUtils.h"
+#include "helpers/InferenceCache.h"
 
 #include <luci/IR/CircleNodes.h>
 #include <luci/IR/CircleNodeVisitor.h>
@@ -470,6 +471,7 @@ class ConvertNCHWToNHWC final : public luci::CircleNodeMutableVisitor<bool>
     node->shape_status(luci::ShapeStatus::UNDEFINED);
 
     node->axis(nchw_axis_to_nhwc(node->axis()));
+    luci::invalidate_inference(node);
 
     auto post_trans = create_post_transpose(node);
     loco::replace(node).with(post_trans);
@@ -21,12 +21,12 @@
 namespace
 {
 
-luci::CircleConst *cast_const(luci::CircleConst *node, loco::DataType from_dtype,
-                              loco::DataType to_dtype)
+luci::CircleConst *cast_const(loco::Graph *graph, const luci::CircleConst *node,
+                              loco::DataType from_dtype, loco::DataType to_dtype)
 {
   assert(node->dtype() == from_dtype);
 
-  auto constant = node->graph()->nodes()->create<luci::CircleConst>();
+  auto constant = graph->nodes()->create<luci::CircleConst>();
   constant->dtype(to_dtype);
   constant->rank(node->rank());
   uint32_t num_elems = 1;
@@ -68,7 +68,7 @@ bool fold_cast(luci::CircleCast *cast)
   const auto in_dtype = const_x->dtype();
   const auto out_dtype = cast->dtype();
 
-  auto casted_const = cast_const(const_x, in_dtype, out_dtype);
+  auto casted_const = cast_const(cast->graph(), const_x, in_dtype, out_dtype);
   if (not casted_const)
     return false;
 
@@ -85,19 +85,12 @@ namespace luci
 /**
  * Constant Folding for Cast Op
  **/
-bool FoldCastPass::run(loco::Graph *g)
+bool FoldCastPass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto cast = dynamic_cast<luci::CircleCast *>(node))
-    {
-      if (fold_cast(cast))
-        changed = true;
-    }
-  }
+  if (auto cast = dynamic_cast<luci::CircleCast *>(node))
+    return fold_cast(cast);
 
-  return changed;
+  return false;
 }
 
 } // namespace luci
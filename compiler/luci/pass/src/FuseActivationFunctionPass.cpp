@@ -88,22 +88,17 @@ bool fuse_activation_function(luci::CircleNode *node)
   return true;
 }
 
-bool FuseActivationFunctionPass::run(loco::Graph *g)
+bool FuseActivationFunctionPass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  auto circle_node = static_cast<luci::CircleNode *>(node);
+  auto opcode = circle_node->opcode();
+  if (opcode == luci::CircleOpcode::RELU || opcode == luci::CircleOpcode::RELU6 ||
+      opcode == luci::CircleOpcode::RELU_N1_TO_1 || opcode == luci::CircleOpcode::TANH)
   {
-    auto circle_node = static_cast<luci::CircleNode *>(node);
-    auto opcode = circle_node->opcode();
-    if (opcode == luci::CircleOpcode::RELU || opcode == luci::CircleOpcode::RELU6 ||
-        opcode == luci::CircleOpcode::RELU_N1_TO_1 || opcode == luci::CircleOpcode::TANH)
-    {
-      if (fuse_activation_function(circle_node))
-        changed = true;
-    }
+    return fuse_activation_function(circle_node);
   }
 
-  return changed;
+  return false;
 }
 
 } // namespace luci
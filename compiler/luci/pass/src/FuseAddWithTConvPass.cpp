@@ -110,20 +110,13 @@ bool fuse_add_with_tconv(luci::CircleTransposeConv *tconv)
 namespace luci
 {
 
-bool FuseAddWithTConvPass::run(loco::Graph *g)
+bool FuseAddWithTConvPass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto tconv = dynamic_cast<luci::CircleTransposeConv *>(node);
-    if (not tconv)
-      continue;
-
-    if (fuse_add_with_tconv(tconv))
-      changed = true;
-  }
+  auto tconv = dynamic_cast<luci::CircleTransposeConv *>(node);
+  if (not tconv)
+    return false;
 
-  return changed;
+  return fuse_add_with_tconv(tconv);
 }
 
 } // namespace luci
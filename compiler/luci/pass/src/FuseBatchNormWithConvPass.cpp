@@ -50,7 +50,7 @@ namespace
 bool fused_batch_norm_with_conv(luci::CircleAdd *add)
 {
   luci::CircleMul *mul = nullptr;
-  luci::CircleConst *shift = nullptr;
+  const luci::CircleConst *shift = nullptr;
   if (auto add_lhs = dynamic_cast<luci::CircleMul *>(add->x()))
   {
     mul = add_lhs;
@@ -79,7 +79,7 @@ bool fused_batch_norm_with_conv(luci::CircleAdd *add)
       return false;
 
   luci::CircleConv2D *conv = nullptr;
-  luci::CircleConst *scale = nullptr;
+  const luci::CircleConst *scale = nullptr;
   if (auto mul_lhs = dynamic_cast<luci::CircleConv2D *>(mul->x()))
   {
     conv = mul_lhs;
@@ -107,8 +107,8 @@ bool fused_batch_norm_with_conv(luci::CircleAdd *add)
   if (conv->fusedActivationFunction() != luci::FusedActFunc::NONE)
     return false;
 
-  luci::CircleConst *filter = dynamic_cast<luci::CircleConst *>(conv->filter());
-  luci::CircleConst *bias = dynamic_cast<luci::CircleConst *>(conv->bias());
+  const luci::CircleConst *filter = dynamic_cast<luci::CircleConst *>(conv->filter());
+  const luci::CircleConst *bias = dynamic_cast<luci::CircleConst *>(conv->bias());
 
   // If filter or bias of conv is not const, this pass cannot be applied.
   if (filter == nullptr || bias == nullptr)
@@ -205,19 +205,12 @@ bool fused_batch_norm_with_conv(luci::CircleAdd *add)
 namespace luci
 {
 
-bool FuseBatchNormWithConvPass::run(loco::Graph *g)
+bool FuseBatchNormWithConvPass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto add = dynamic_cast<luci::CircleAdd *>(node))
-    {
-      if (fused_batch_norm_with_conv(add))
-        changed = true;
-    }
-  }
+  if (auto add = dynamic_cast<luci::CircleAdd *>(node))
+    return fused_batch_norm_with_conv(add);
 
-  return changed;
+  return false;
 }
 
 } // namespace luci
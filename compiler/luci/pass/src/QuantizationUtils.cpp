@@ -16,10 +16,143 @@
 
 #include "QuantizationUtils.h"
 
+#include "helpers/ParallelFor.h"
+
 #include <luci/Log.h>
 
+#include <algorithm>
 #include <iostream>
 #include <cmath>
+#include <mutex>
+
+namespace
+{
+
+// Minimum number of values for a thread to quantize
+const uint32_t kQuantizeGrain = 1 << 16;
+
+// Same as static_cast<int32_t>(std::round(f)) for values in int32 range, in a form which
+// compilers can vectorize
+inline int32_t round_to_int32(float f)
+{
+  const int32_t i = static_cast<int32_t>(f);
+  const float r = f - static_cast<float>(i);
+  return i + (r >= 0.5f) - (r <= -0.5f);
+}
+
+struct ChannelQuantizer
+{
+  float clip_min;
+  float clip_max;
+  float offset;
+  float scale;
+  float scale_inv;
+  int32_t zerop;
+  int32_t qmin;
+  int32_t qmax;
+
+  int32_t quantize(float f) const
+  {
+    f = f < clip_min ? clip_min : f;
+    f = f > clip_max ? clip_max : f;
+    const int32_t q = round_to_int32((f - offset) * scale_inv) + zerop;
+    return std::min(qmax, std::max(qmin, q));
+  }
+};
+
+std::vector<ChannelQuantizer> make_quantizers(const luci::QuantizeParams &params)
+{
+  const auto channels = params.scale.size();
+  assert(params.clip_min.size() == channels);
+  assert(params.clip_max.size() == channels);
+  assert(params.offset.size() == channels);
+  assert(params.zerop.size() == channels);
+
+  std::vector<ChannelQuantizer> quantizers(channels);
+  for (uint32_t c = 0; c < channels; ++c)
+  {
+    auto &q = quantizers[c];
+    q.clip_min = params.clip_min[c];
+    q.clip_max = params.clip_max[c];
+    q.offset = params.offset[c];
+    q.scale = params.scale[c];
+    q.scale_inv = 1.0 / params.scale[c];
+    q.zerop = params.zerop[c];
+    q.qmin = params.qmin;
+    q.qmax = params.qmax;
+  }
+  return quantizers;
+}
+
+// Call fn(begin, end, channel) for each run of [begin, end) whose values belong to the same channel
+template <typename Fn>
+void for_each_channel_run(uint32_t begin, uint32_t end, uint32_t channels, uint32_t inner, Fn fn)
+{
+  while (begin < end)
+  {
+    const uint32_t row = begin / inner;
+    const uint32_t run_end = std::min(end, (row + 1) * inner);
+    fn(begin, run_end, row % channels);
+    begin = run_end;
+  }
+}
+
+// Quantize values in [begin, end)
+template <typename T>
+void quantize(const float *input, T *output, uint32_t begin, uint32_t end,
+              const std::vector<ChannelQuantizer> &quantizers, uint32_t inner)
+{
+  const uint32_t channels = quantizers.size();
+  assert(channels > 0);
+
+  luci::parallel_for(end - begin, kQuantizeGrain, [&](uint32_t chunk_begin, uint32_t chunk_end) {
+    for_each_channel_run(begin + chunk_begin, begin + chunk_end, channels, inner,
+                         [&](uint32_t run_begin, uint32_t run_end, uint32_t c) {
+                           // Copy to let compilers know that output does not alias it
+                           const ChannelQuantizer q = quantizers[c];
+                           for (uint32_t i = run_begin; i < run_end; ++i)
+                             output[i] = static_cast<T>(q.quantize(input[i]));
+                         });
+  });
+}
+
+template <typename T>
+void quantize(const float *input, T *output, uint32_t size, const luci::QuantizeParams &params)
+{
+  quantize(input, output, 0, size, make_quantizers(params), params.inner);
+}
+
+// Quantize float values of node over themselves and change dtype of node to DT
+template <loco::DataType DT>
+void quantize_in_place(luci::CircleConst *node, const luci::QuantizeParams &params)
+{
+  using T = typename loco::DataTypeImpl<DT>::Type;
+  static_assert(sizeof(T) < sizeof(float), "Quantized value should be smaller than float");
+  const uint32_t ratio = sizeof(float) / sizeof(T);
+
+  const uint32_t size = node->size<loco::DataType::FLOAT32>();
+  if (size > 0)
+  {
+    const auto quantizers = make_quantizers(params);
+    float *values = &node->at<loco::DataType::FLOAT32>(0);
+    T *output = reinterpret_cast<T *>(values);
+
+    // Quantized value at i is stored over float value at i / ratio. Values are quantized in
+    // waves of [begin, begin * ratio), which overwrite only values of the previous waves, so
+    // that the values of a wave are quantized in parallel.
+    quantize(values, output, 0, 1, quantizers, params.inner);
+    for (uint64_t begin = 1; begin < size; begin *= ratio)
+    {
+      const auto end = static_cast<uint32_t>(std::min<uint64_t>(size, begin * ratio));
+      quantize(values, output, static_cast<uint32_t>(begin), end, quantizers, params.inner);
+    }
+  }
+
+  node->dtype(DT);
+  node->size<DT>(size); // shrink tensor
+}
+
+} // namespace
 
 namespace luci
 {
@@ -87,24 +220,18 @@ void asymmetric_wquant_with_minmax_per_layer(CircleConst *node, float min, float
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
   compute_asym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
-  const float scaling_factor_inv = 1.0 / scaling_factor;
-  std::vector<int32_t> quantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    // clipping
-    auto data = node->at<loco::DataType::FLOAT32>(i);
-    data = data < nudged_min ? nudged_min : data;
-    data = data > nudged_max ? nudged_max : data;
-    quantized_values[i] =
-      static_cast<int32_t>(std::round((data - nudged_min) * scaling_factor_inv));
-  }
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  QuantizeParams params;
+  params.clip_min = {nudged_min};
+  params.clip_max = {nudged_max};
+  params.offset = {nudged_min};
+  params.scale = {scaling_factor};
+  params.zerop = {0};
+  params.qmin = kMinScale;
+  params.qmax = kMaxScale;
+  params.inner = size;
+
+  quantize_const_values(node, loco::DataType::U8, params);
 }
 
 // Per-layer quantization of weights (const tensor) using given min/max values
@@ -117,24 +244,18 @@ void symmetric_wquant_with_minmax_per_layer(CircleConst *node, float min, float
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
   compute_sym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
-  const float scaling_factor_inv = 1.0 / scaling_factor;
-  std::vector<int32_t> quantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    // clipping
-    auto data = node->at<loco::DataType::FLOAT32>(i);
-    data = data < nudged_min ? nudged_min : data;
-    data = data > nudged_max ? nudged_max : data;
-    quantized_values[i] = static_cast<int32_t>(std::round(data * scaling_factor_inv));
-  }
 
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::S16>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
+  QuantizeParams params;
+  params.clip_min = {nudged_min};
+  params.clip_max = {nudged_max};
+  params.offset = {0.0f};
+  params.scale = {scaling_factor};
+  params.zerop = {0};
+  params.qmin = kMinScale;
+  params.qmax = kMaxScale;
+  params.inner = size;
+
+  quantize_const_values(node, loco::DataType::S16, params);
 }
 
 void compute_sym_scale_zp(float min, float max, float &scaling_factor, int64_t &zp,
@@ -301,6 +422,108 @@ bool get_channel_dim_index(CircleConst *node, loco::TensorShape &dimension, int
   return false;
 }
 
+uint32_t channel_inner_size(const loco::TensorShape &dimension, int channel_dim_index)
+{
+  uint32_t inner = 1;
+  for (uint32_t axis = channel_dim_index + 1; axis < dimension.rank(); ++axis)
+    inner *= dimension.dim(axis).value();
+  return inner;
+}
+
+void compute_minmax(const float *values, uint32_t size, uint32_t inner, std::vector<float> &min,
+                    std::vector<float> &max)
+{
+  const uint32_t channels = min.size();
+  assert(channels > 0);
+  assert(max.size() == channels);
+
+  std::fill(min.begin(), min.end(), std::numeric_limits<float>::max());
+  std::fill(max.begin(), max.end(), std::numeric_limits<float>::lowest());
+
+  std::mutex mutex;
+  parallel_for(size, kQuantizeGrain, [&](uint32_t begin, uint32_t end) {
+    std::vector<float> chunk_min(channels, std::numeric_limits<float>::max());
+    std::vector<float> chunk_max(channels, std::numeric_limits<float>::lowest());
+
+    for_each_channel_run(begin, end, channels, inner,
+                         [&](uint32_t run_begin, uint32_t run_end, uint32_t c) {
+                           float run_min = chunk_min[c];
+                           float run_max = chunk_max[c];
+                           for (uint32_t i = run_begin; i < run_end; ++i)
+                           {
+                             run_min = values[i] < run_min ? values[i] : run_min;
+                             run_max = values[i] > run_max ? values[i] : run_max;
+                           }
+                           chunk_min[c] = run_min;
+                           chunk_max[c] = run_max;
+                         });
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (uint32_t c = 0; c < channels; ++c)
+    {
+      min[c] = std::min(min[c], chunk_min[c]);
+      max[c] = std::max(max[c], chunk_max[c]);
+    }
+  });
+
+  // Channels without values, e.g. of an empty tensor
+  for (uint32_t c = 0; c < channels; ++c)
+  {
+    if (min[c] > max[c])
+      min[c] = max[c] = 0.0f;
+  }
+}
+
+void quantize_values(const float *input, uint8_t *output, uint32_t size,
+                     const QuantizeParams &params)
+{
+  quantize(input, output, size, params);
+}
+
+void quantize_values(const float *input, int16_t *output, uint32_t size,
+                     const QuantizeParams &params)
+{
+  quantize(input, output, size, params);
+}
+
+void quantize_const_values(CircleConst *node, loco::DataType quant_type,
+                           const QuantizeParams &params)
+{
+  assert(node->dtype() == loco::DataType::FLOAT32);
+
+  switch (quant_type)
+  {
+    case loco::DataType::U8:
+      quantize_in_place<loco::DataType::U8>(node, params);
+      break;
+    case loco::DataType::S16:
+      quantize_in_place<loco::DataType::S16>(node, params);
+      break;
+    default:
+      throw std::runtime_error("Unsupported data type");
+  }
+}
+
+void fake_quantize_values(float *values, uint32_t size, const QuantizeParams &params)
+{
+  const auto quantizers = make_quantizers(params);
+  const uint32_t channels = quantizers.size();
+  assert(channels > 0);
+
+  parallel_for(size, kQuantizeGrain, [&](uint32_t begin, uint32_t end) {
+    for_each_channel_run(begin, end, channels, params.inner,
+                         [&](uint32_t run_begin, uint32_t run_end, uint32_t c) {
+                           const ChannelQuantizer q = quantizers[c];
+                           for (uint32_t i = run_begin; i < run_end; ++i)
+                           {
+                             const int32_t quantized = q.quantize(values[i]);
+                             values[i] =
+                               static_cast<float>(quantized - q.zerop) * q.scale + q.offset;
+                           }
+                         });
+  });
+}
+
 uint32_t cal_offset(loco::TensorShape &dimension, uint32_t *indices)
 {
   return indices[0] * dimension.dim(1).value() * dimension.dim(2).value() *
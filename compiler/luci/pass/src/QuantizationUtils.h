@@ -20,6 +20,8 @@
 #include <luci/IR/CircleNodes.h>
 #include <loco/IR/TensorShape.h>
 
+#include <vector>
+
 namespace luci
 {
 
@@ -39,6 +41,63 @@ void symmetric_wquant_with_minmax_per_layer(CircleConst *node, float min, float
 
 bool get_channel_dim_index(CircleConst *node, loco::TensorShape &dimension, int &channel_dim_index);
 
+/**
+ * @brief Parameters to quantize float values per channel
+ *
+ * @note  q = clamp(round((clip(f, clip_min, clip_max) - offset) / scale) + zerop, qmin, qmax)
+ *        Each vector has a value per channel, or a single value for layer-wise quantization.
+ *        Values are laid out as [outer, channel, inner].
+ */
+struct QuantizeParams
+{
+  std::vector<float> clip_min;
+  std::vector<float> clip_max;
+  std::vector<float> offset;
+  std::vector<float> scale;
+  std::vector<int32_t> zerop;
+
+  int32_t qmin = 0;
+  int32_t qmax = 0;
+
+  uint32_t inner = 1;
+};
+
+/**
+ * @brief Return the number of values per channel for the layout of get_channel_dim_index()
+ */
+uint32_t channel_inner_size(const loco::TensorShape &dimension, int channel_dim_index);
+
+/**
+ * @brief Find min/max of 'size' float values per channel, laid out as [outer, channel, inner]
+ *
+ * @note  min/max of a channel without values is 0. 'values' may be nullptr if 'size' is 0.
+ */
+void compute_minmax(const float *values, uint32_t size, uint32_t inner, std::vector<float> &min,
+                    std::vector<float> &max);
+
+/**
+ * @brief Quantize 'size' float values of 'input' into 'output'
+ */
+void quantize_values(const float *input, uint8_t *output, uint32_t size,
+                     const QuantizeParams &params);
+void quantize_values(const float *input, int16_t *output, uint32_t size,
+                     const QuantizeParams &params);
+
+/**
+ * @brief Quantize float values of 'node' in place and change its dtype to 'quant_type' (U8/S16)
+ *
+ * @note  Quantized values are written into the storage of 'node' over its float values
+ */
+void quantize_const_values(CircleConst *node, loco::DataType quant_type,
+                           const QuantizeParams &params);
+
+/**
+ * @brief Quantize and dequantize 'size' float values in place
+ *
+ * @note  f = (q - zerop) * scale + offset
+ */
+void fake_quantize_values(float *values, uint32_t size, const QuantizeParams &params);
+
 uint32_t cal_offset(loco::TensorShape &dimension, uint32_t *indices);
 
 void propagate_concat_quantparam(luci::CircleConcatenation *concat, loco::DataType quant_type);
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "QuantizationUtils.h"
+
+#include <loco.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+luci::QuantizeParams layer_params(float scale, float offset, uint32_t size)
+{
+  luci::QuantizeParams params;
+  params.clip_min = {std::numeric_limits<float>::lowest()};
+  params.clip_max = {std::numeric_limits<float>::max()};
+  params.offset = {offset};
+  params.scale = {scale};
+  params.zerop = {0};
+  params.qmin = 0;
+  params.qmax = 255;
+  params.inner = size;
+  return params;
+}
+
+luci::CircleConst *create_float_const(loco::Graph *g, const std::vector<float> &values)
+{
+  auto node = g->nodes()->create<luci::CircleConst>();
+  node->dtype(loco::DataType::FLOAT32);
+  node->rank(1);
+  node->dim(0).set(values.size());
+  node->size<loco::DataType::FLOAT32>(values.size());
+  for (uint32_t i = 0; i < values.size(); ++i)
+    node->at<loco::DataType::FLOAT32>(i) = values[i];
+  return node;
+}
+
+} // namespace
+
+TEST(QuantizationUtilsTest, quantize_values_round)
+{
+  const uint32_t size = 512;
+  std::vector<float> input(size);
+  for (uint32_t i = 0; i < size; ++i)
+    input[i] = i * 0.25f; // includes halves
+
+  auto params = layer_params(0.5f, 0.0f, size);
+  std::vector<uint8_t> output(size);
+  luci::quantize_values(input.data(), output.data(), size, params);
+
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    int32_t expected = static_cast<int32_t>(std::round(input[i] * (1.0f / 0.5f)));
+    expected = std::min(255, std::max(0, expected));
+    ASSERT_EQ(expected, output[i]);
+  }
+}
+
+TEST(QuantizationUtilsTest, quantize_values_per_channel)
+{
+  // [outer = 2, channel = 3, inner = 2]
+  std::vector<float> input{1, 2, 3, 4, 5, 6, -1, -2, -3, -4, -5, -6};
+
+  luci::QuantizeParams params;
+  params.clip_min.assign(3, std::numeric_limits<float>::lowest());
+  params.clip_max.assign(3, std::numeric_limits<float>::max());
+  params.offset.assign(3, 0.0f);
+  params.scale = {1.0f, 2.0f, 0.5f};
+  params.zerop.assign(3, 0);
+  params.qmin = -32767;
+  params.qmax = 32767;
+  params.inner = 2;
+
+  std::vector<int16_t> output(input.size());
+  luci::quantize_values(input.data(), output.data(), input.size(), params);
+
+  std::vector<int16_t> expected{1, 2, 2, 2, 10, 12, -1, -2, -2, -2, -10, -12};
+  ASSERT_EQ(expected, output);
+}
+
+TEST(QuantizationUtilsTest, quantize_values_large)
+{
+  const uint32_t size = 1 << 20;
+  std::vector<float> input(size);
+  for (uint32_t i = 0; i < size; ++i)
+    input[i] = static_cast<float>(i % 1000) / 10.0f - 50.0f;
+
+  auto params = layer_params(0.4f, -50.0f, size);
+  std::vector<uint8_t> output(size);
+  luci::quantize_values(input.data(), output.data(), size, params);
+
+  const float scale_inv = 1.0 / 0.4f;
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    int32_t expected = static_cast<int32_t>(std::round((input[i] - (-50.0f)) * scale_inv));
+    expected = std::min(255, std::max(0, expected));
+    ASSERT_EQ(expected, output[i]);
+  }
+}
+
+TEST(QuantizationUtilsTest, quantize_const_values_u8)
+{
+  // Not a power of 4, so that the last wave is partial
+  const uint32_t size = (1 << 20) + 3;
+  std::vector<float> input(size);
+  for (uint32_t i = 0; i < size; ++i)
+    input[i] = static_cast<float>(i % 1000) / 10.0f - 50.0f;
+
+  auto g = loco::make_graph();
+  auto node = create_float_const(g.get(), input);
+  auto params = layer_params(0.4f, -50.0f, size);
+  luci::quantize_const_values(node, loco::DataType::U8, params);
+
+  std::vector<uint8_t> expected(size);
+  luci::quantize_values(input.data(), expected.data(), size, params);
+
+  ASSERT_EQ(loco::DataType::U8, node->dtype());
+  ASSERT_EQ(size, node->size<loco::DataType::U8>());
+  for (uint32_t i = 0; i < size; ++i)
+    ASSERT_EQ(expected[i], node->at<loco::DataType::U8>(i));
+}
+
+TEST(QuantizationUtilsTest, quantize_const_values_s16_per_channel)
+{
+  // [outer, channel = 3, inner = 5]
+  const uint32_t size = 3 * 5 * 30001;
+  std::vector<float> input(size);
+  for (uint32_t i = 0; i < size; ++i)
+    input[i] = static_cast<float>(i % 777) - 388.0f;
+
+  luci::QuantizeParams params;
+  params.clip_min.assign(3, std::numeric_limits<float>::lowest());
+  params.clip_max.assign(3, std::numeric_limits<float>::max());
+  params.offset.assign(3, 0.0f);
+  params.scale = {0.5f, 1.0f, 0.25f};
+  params.zerop.assign(3, 0);
+  params.qmin = -32767;
+  params.qmax = 32767;
+  params.inner = 5;
+
+  auto g = loco::make_graph();
+  auto node = create_float_const(g.get(), input);
+  luci::quantize_const_values(node, loco::DataType::S16, params);
+
+  std::vector<int16_t> expected(size);
+  luci::quantize_values(input.data(), expected.data(), size, params);
+
+  ASSERT_EQ(loco::DataType::S16, node->dtype());
+  ASSERT_EQ(size, node->size<loco::DataType::S16>());
+  for (uint32_t i = 0; i < size; ++i)
+    ASSERT_EQ(expected[i], node->at<loco::DataType::S16>(i));
+}
+
+TEST(QuantizationUtilsTest, quantize_const_values_empty)
+{
+  auto g = loco::make_graph();
+  auto node = create_float_const(g.get(), {});
+  luci::quantize_const_values(node, loco::DataType::U8, layer_params(1.0f, 0.0f, 0));
+
+  ASSERT_EQ(loco::DataType::U8, node->dtype());
+  ASSERT_EQ(0, node->size<loco::DataType::U8>());
+}
+
+TEST(QuantizationUtilsTest, quantize_const_values_type_NEG)
+{
+  auto g = loco::make_graph();
+  auto node = create_float_const(g.get(), {1.0f, 2.0f});
+
+  EXPECT_ANY_THROW(
+    luci::quantize_const_values(node, loco::DataType::S32, layer_params(1.0f, 0.0f, 2)));
+}
+
+TEST(QuantizationUtilsTest, compute_minmax)
+{
+  // [outer = 2, channel = 2, inner = 2]
+  std::vector<float> input{1, -2, 3, 4, 5, 6, -7, 8};
+  std::vector<float> min(2);
+  std::vector<float> max(2);
+
+  luci::compute_minmax(input.data(), input.size(), 2, min, max);
+
+  ASSERT_FLOAT_EQ(-2, min[0]);
+  ASSERT_FLOAT_EQ(6, max[0]);
+  ASSERT_FLOAT_EQ(-7, min[1]);
+  ASSERT_FLOAT_EQ(8, max[1]);
+}
+
+TEST(QuantizationUtilsTest, compute_minmax_empty)
+{
+  std::vector<float> min(2);
+  std::vector<float> max(2);
+
+  luci::compute_minmax(nullptr, 0, 0, min, max);
+
+  for (uint32_t c = 0; c < 2; ++c)
+  {
+    ASSERT_FLOAT_EQ(0, min[c]);
+    ASSERT_FLOAT_EQ(0, max[c]);
+  }
+}
+
+TEST(QuantizationUtilsTest, fake_quantize_values)
+{
+  std::vector<float> values{-1.0f, 0.3f, 0.7f, 2.0f};
+
+  auto params = layer_params(0.5f, 0.0f, values.size());
+  params.clip_min = {0.0f};
+  params.clip_max = {1.0f};
+  luci::fake_quantize_values(values.data(), values.size(), params);
+
+  ASSERT_FLOAT_EQ(0.0f, values[0]);
+  ASSERT_FLOAT_EQ(0.5f, values[1]);
+  ASSERT_FLOAT_EQ(0.5f, values[2]);
+  ASSERT_FLOAT_EQ(1.0f, values[3]);
+}
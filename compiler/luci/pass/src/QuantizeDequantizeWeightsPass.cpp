@@ -35,222 +35,62 @@ void cal_minmax_per_channel(CircleConst *node, std::vector<float> &min, std::vec
 {
   loco::TensorShape dimension;
   dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
   int channel_dim_index{0};
-  int size{0};
 
   if (!get_channel_dim_index(node, dimension, channel_dim_index))
   {
     assert(false);
     return;
   }
-  size = dimension.dim(channel_dim_index).value();
 
-  std::vector<bool> has_min_max_value(size, false);
+  auto size = dimension.dim(channel_dim_index).value();
   min.resize(size);
   max.resize(size);
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          if (has_min_max_value[channel_idx])
-          {
-            min[channel_idx] = data < min[channel_idx] ? data : min[channel_idx];
-            max[channel_idx] = data > max[channel_idx] ? data : max[channel_idx];
-          }
-          else
-          {
-            min[channel_idx] = data;
-            max[channel_idx] = data;
-            has_min_max_value[channel_idx] = true;
-          }
-        }
-      }
-    }
-  }
-}
-
-void sym_wquant_per_channel(CircleConst *node, std::vector<float> &min, std::vector<float> &max,
-                            std::vector<float> &scaling_factor, std::vector<int64_t> &zp,
-                            std::vector<float> &nudged_min, std::vector<float> &nudged_max)
-{
-  assert(node->dtype() == loco::DataType::FLOAT32);
-  const int32_t kMaxScale = std::numeric_limits<int16_t>::max();
-  const int32_t kMinScale = -kMaxScale;
-
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
-
-  for (size_t i = 0; i < min.size(); ++i)
-  {
-    compute_sym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i]);
-  }
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
-  int channel_dim_index{0};
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
-  }
-
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
-          data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
-          quantized_values[cal_offset(dimension, indices)] =
-            static_cast<int32_t>(std::round(data * scaling_factor_inv));
-        }
-      }
-    }
-  }
-
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::S16>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
-}
-
-void sym_wdequant_per_channel(CircleConst *node, std::vector<float> &scaling_factor)
-{
-  assert(node->dtype() == loco::DataType::S16);
-  uint32_t size = node->size<loco::DataType::S16>();
-  std::vector<float> dequantized_values(size);
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
-  int channel_dim_index{0};
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
-  }
 
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          auto data = node->at<loco::DataType::S16>(cal_offset(dimension, indices));
-          dequantized_values[cal_offset(dimension, indices)] =
-            static_cast<float>(data) * scaling_factor[channel_idx];
-        }
-      }
-    }
-  }
-
-  node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
-  node->size<loco::DataType::FLOAT32>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
-  }
+  // Read through const node not to copy referred values
+  const auto const_node = static_cast<const CircleConst *>(node);
+  const uint32_t num_values = node->size<loco::DataType::FLOAT32>();
+  const float *values = num_values > 0 ? &const_node->at<loco::DataType::FLOAT32>(0) : nullptr;
+  compute_minmax(values, num_values, channel_inner_size(dimension, channel_dim_index), min, max);
 }
 
-void asymmetric_wquant_per_channel(CircleConst *node, std::vector<float> &min,
-                                   std::vector<float> &max, std::vector<float> &scaling_factor,
-                                   std::vector<int64_t> &zp, std::vector<float> &nudged_min,
-                                   std::vector<float> &nudged_max)
+// Quantize and dequantize weights per channel in place
+void wquant_dequant_per_channel(CircleConst *node, loco::DataType quant_type,
+                                std::vector<float> &min, std::vector<float> &max,
+                                std::vector<float> &scaling_factor, std::vector<int64_t> &zp,
+                                std::vector<float> &nudged_min, std::vector<float> &nudged_max)
 {
   assert(node->dtype() == loco::DataType::FLOAT32);
+  assert(quant_type == loco::DataType::U8 || quant_type == loco::DataType::S16);
 
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
-
-  for (size_t i = 0; i < min.size(); ++i)
+  QuantizeParams params;
+  if (quant_type == loco::DataType::U8)
   {
-    compute_asym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i], nudged_max[i]);
-  }
+    for (size_t i = 0; i < min.size(); ++i)
+      compute_asym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i],
+                            nudged_max[i]);
 
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
-  int channel_dim_index{0};
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
+    params.offset = nudged_min;
+    params.qmin = 0;
+    params.qmax = 255;
   }
-
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
+  else
   {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          data = data < nudged_min[channel_idx] ? nudged_min[channel_idx] : data;
-          data = data > nudged_max[channel_idx] ? nudged_max[channel_idx] : data;
-          quantized_values[cal_offset(dimension, indices)] =
-            static_cast<int32_t>(std::round((data - nudged_min[channel_idx]) * scaling_factor_inv));
-        }
-      }
-    }
-  }
+    for (size_t i = 0; i < min.size(); ++i)
+      compute_sym_scale_zp(min[i], max[i], scaling_factor[i], zp[i], nudged_min[i],
+                           nudged_max[i]);
 
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    params.offset.assign(min.size(), 0.0f);
+    params.qmax = std::numeric_limits<int16_t>::max();
+    params.qmin = -params.qmax;
   }
-}
-
-void asymmetric_wdequant_per_channel(CircleConst *node, std::vector<float> &scaling_factor,
-                                     std::vector<float> &nudged_min)
-{
-  assert(node->dtype() == loco::DataType::U8);
-  uint32_t size = node->size<loco::DataType::U8>();
-  std::vector<float> dequantized_values(size);
+  params.clip_min = nudged_min;
+  params.clip_max = nudged_max;
+  params.scale = scaling_factor;
+  params.zerop.assign(min.size(), 0);
 
   loco::TensorShape dimension;
   dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
   int channel_dim_index{0};
 
   if (!get_channel_dim_index(node, dimension, channel_dim_index))
@@ -258,49 +98,35 @@ void asymmetric_wdequant_per_channel(CircleConst *node, std::vector<float> &scal
     assert(false);
     return;
   }
+  params.inner = channel_inner_size(dimension, channel_dim_index);
 
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          auto data = node->at<loco::DataType::U8>(cal_offset(dimension, indices));
-          dequantized_values[cal_offset(dimension, indices)] =
-            static_cast<float>(data) * scaling_factor[channel_idx] + nudged_min[channel_idx];
-        }
-      }
-    }
-  }
-
-  node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
-  node->size<loco::DataType::FLOAT32>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
-  }
+  if (node->size<loco::DataType::FLOAT32>() > 0)
+    fake_quantize_values(&node->at<loco::DataType::FLOAT32>(0),
+                         node->size<loco::DataType::FLOAT32>(), params);
 }
 
-void asymmetric_wdequant_with_minmax_per_layer(CircleConst *node, float scaling_factor,
-                                               float nudged_min)
+// Quantize and dequantize weights per layer in place
+void asymmetric_wquant_dequant_per_layer(CircleConst *node, float min, float max,
+                                         float &scaling_factor, int64_t &zp, float &nudged_min,
+                                         float &nudged_max)
 {
-  uint32_t size = node->size<loco::DataType::U8>();
-  std::vector<float> dequantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    auto data = node->at<loco::DataType::U8>(i);
-    dequantized_values[i] = static_cast<float>(data) * scaling_factor + nudged_min;
-  }
+  assert(node->dtype() == loco::DataType::FLOAT32);
 
-  node->dtype(loco::DataType::FLOAT32);      // change the type of tensor
-  node->size<loco::DataType::FLOAT32>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::FLOAT32>(i) = dequantized_values[i];
-  }
+  compute_asym_scale_zp(min, max, scaling_factor, zp, nudged_min, nudged_max);
+
+  QuantizeParams params;
+  params.clip_min = {nudged_min};
+  params.clip_max = {nudged_max};
+  params.offset = {nudged_min};
+  params.scale = {scaling_factor};
+  params.zerop = {0};
+  params.qmin = 0;
+  params.qmax = 255;
+  params.inner = node->size<loco::DataType::FLOAT32>();
+
+  if (node->size<loco::DataType::FLOAT32>() > 0)
+    fake_quantize_values(&node->at<loco::DataType::FLOAT32>(0),
+                         node->size<loco::DataType::FLOAT32>(), params);
 }
 
 /**
@@ -352,18 +178,8 @@ struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<b
           std::vector<float> scaling_factor(min.size());
           std::vector<int64_t> zp(min.size());
 
-          if (output_type == loco::DataType::U8)
-          {
-            asymmetric_wquant_per_channel(circle_const, min, max, scaling_factor, zp, nudged_min,
-                                          nudged_max);
-            asymmetric_wdequant_per_channel(circle_const, scaling_factor, nudged_min);
-          }
-          else
-          {
-            sym_wquant_per_channel(circle_const, min, max, scaling_factor, zp, nudged_min,
-                                   nudged_max);
-            sym_wdequant_per_channel(circle_const, scaling_factor);
-          }
+          wquant_dequant_per_channel(circle_const, output_type, min, max, scaling_factor, zp,
+                                     nudged_min, nudged_max);
 
           auto quantparam = std::make_unique<CircleQuantParam>();
           quantparam->min = nudged_min;
@@ -375,22 +191,21 @@ struct QuantizeDequantizeWeights final : public luci::CircleNodeMutableVisitor<b
         // Find min/max per layer-wise
         else
         {
-          float min = std::numeric_limits<float>::max();
-          float max = std::numeric_limits<float>::lowest();
-          for (uint32_t i = 0; i < circle_const->size<loco::DataType::FLOAT32>(); i++)
-          {
-            auto data = circle_const->at<loco::DataType::FLOAT32>(i);
-            min = data < min ? data : min;
-            max = data > max ? data : max;
-          }
+          std::vector<float> min(1);
+          std::vector<float> max(1);
+          const auto const_node = static_cast<const CircleConst *>(circle_const);
+          const uint32_t num_values = circle_const->size<loco::DataType::FLOAT32>();
+          const float *values =
+            num_values > 0 ? &const_node->at<loco::DataType::FLOAT32>(0) : nullptr;
+          compute_minmax(values, num_values, num_values, min, max);
+
           float scaling_factor{0};
           int64_t zp{0};
           float nudged_min{0};
           float nudged_max{0};
 
-          asymmetric_wquant_with_minmax_per_layer(circle_const, min, max, scaling_factor, zp,
-                                                  nudged_min, nudged_max);
-          asymmetric_wdequant_with_minmax_per_layer(circle_const, scaling_factor, nudged_min);
+          asymmetric_wquant_dequant_per_layer(circle_const, min[0], max[0], scaling_factor, zp,
+                                              nudged_min, nudged_max);
           auto quantparam = std::make_unique<CircleQuantParam>();
           quantparam->min.push_back(nudged_min);
           quantparam->max.push_back(nudged_max);
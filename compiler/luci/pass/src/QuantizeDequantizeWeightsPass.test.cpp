@@ -16,8 +16,60 @@
 
 #include "luci/Pass/QuantizeDequantizeWeightsPass.h"
 
+#include <luci/IR/CircleNodes.h>
+
 #include <gtest/gtest.h>
 
+namespace
+{
+
+/**
+ *  input ---> [conv] ---> output
+ *               |
+ *  filter ------+  (without values)
+ */
+class EmptyFilterGraph
+{
+public:
+  EmptyFilterGraph()
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    filter = g->nodes()->create<luci::CircleConst>();
+    bias = g->nodes()->create<luci::CircleOutputExclude>();
+    conv = g->nodes()->create<luci::CircleConv2D>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    input->dtype(loco::DataType::FLOAT32);
+
+    // OHWI with a single output channel and no values
+    filter->dtype(loco::DataType::FLOAT32);
+    filter->shape({1, 0, 1, 1});
+    filter->shape_status(luci::ShapeStatus::VALID);
+    filter->size<loco::DataType::FLOAT32>(0);
+
+    conv->input(input);
+    conv->filter(filter);
+    conv->bias(bias);
+    conv->fusedActivationFunction(luci::FusedActFunc::NONE);
+
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+    output->from(conv);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleConst *filter = nullptr;
+  luci::CircleOutputExclude *bias = nullptr;
+  luci::CircleConv2D *conv = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
 TEST(QuantizeDequantizeWeightsPassTest, name)
 {
   luci::QuantizeDequantizeWeightsPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
@@ -25,3 +77,27 @@ TEST(QuantizeDequantizeWeightsPassTest, name)
   auto const name = pass.name();
   ASSERT_NE(nullptr, name);
 }
+
+TEST(QuantizeDequantizeWeightsPassTest, empty_weights_layer_wise)
+{
+  EmptyFilterGraph g;
+  luci::QuantizeDequantizeWeightsPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
+                                           luci::QuantizationGranularity::LayerWise);
+
+  pass.run(g.g.get());
+
+  ASSERT_EQ(0, g.filter->size<loco::DataType::FLOAT32>());
+  ASSERT_NE(nullptr, g.filter->quantparam());
+}
+
+TEST(QuantizeDequantizeWeightsPassTest, empty_weights_channel_wise)
+{
+  EmptyFilterGraph g;
+  luci::QuantizeDequantizeWeightsPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
+                                           luci::QuantizationGranularity::ChannelWise);
+
+  pass.run(g.g.get());
+
+  ASSERT_EQ(0, g.filter->size<loco::DataType::FLOAT32>());
+  ASSERT_NE(nullptr, g.filter->quantparam());
+}
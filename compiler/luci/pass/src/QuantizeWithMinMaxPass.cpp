@@ -85,33 +85,30 @@ void quant_const_values(luci::CircleConst *const_node, float scaling_factor, flo
 {
   uint32_t size = const_node->size<loco::DataType::FLOAT32>();
 
-  const float scaling_factor_inv = 1.0 / scaling_factor;
-  std::vector<int32_t> quantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    auto data = const_node->at<loco::DataType::FLOAT32>(i);
-    quantized_values[i] = static_cast<int32_t>(std::round(data * scaling_factor_inv) + zerop);
-  }
+  QuantizeParams params;
+  params.clip_min = {std::numeric_limits<float>::lowest()};
+  params.clip_max = {std::numeric_limits<float>::max()};
+  params.offset = {0.0f};
+  params.scale = {scaling_factor};
+  params.zerop = {static_cast<int32_t>(zerop)};
+  params.inner = size;
 
   switch (quant_type)
   {
     case loco::DataType::U8:
-      const_node->dtype(loco::DataType::U8);      // change the type of tensor
-      const_node->size<loco::DataType::U8>(size); // resize tensor
-      for (uint32_t i = 0; i < size; ++i)
-        const_node->at<loco::DataType::U8>(i) = std::min(255, std::max(0, quantized_values[i]));
+      params.qmin = 0;
+      params.qmax = 255;
       break;
     case loco::DataType::S16:
       assert(zerop == 0);
-      const_node->dtype(loco::DataType::S16);      // change the type of tensor
-      const_node->size<loco::DataType::S16>(size); // resize tensor
-      for (uint32_t i = 0; i < size; ++i)
-        const_node->at<loco::DataType::S16>(i) =
-          std::min(32767, std::max(-32767, quantized_values[i]));
+      params.qmin = -32767;
+      params.qmax = 32767;
       break;
     default:
       throw std::runtime_error("Unsupported data type");
   }
+
+  quantize_const_values(const_node, quant_type, params);
 }
 
 // Quantize const per channel
@@ -303,21 +300,15 @@ CircleConst *asym_quant_bias_per_layer(CircleConst *node, float input_scale, flo
   const float scaling_factor_inv = (scale == 0) ? 0 : 1.0 / scale;
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    quantized_values[i] =
-      static_cast<int32_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
-  }
-
   auto new_bias = create_empty_const_from<loco::DataType::S32>(node, size);
 
   const int32_t kMinScale = std::numeric_limits<int32_t>::lowest();
   const int32_t kMaxScale = std::numeric_limits<int32_t>::max();
   for (uint32_t i = 0; i < size; ++i)
   {
-    new_bias->at<loco::DataType::S32>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
+    const auto quantized =
+      static_cast<int32_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
+    new_bias->at<loco::DataType::S32>(i) = std::min(kMaxScale, std::max(kMinScale, quantized));
   }
   *scaling_factor = scale;
   *zp = 0;
@@ -332,27 +323,20 @@ CircleConst *quant_bias_per_channel(CircleConst *node, float input_scale,
   float scaling_factor_inv{0};
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
+  auto new_bias = create_empty_const_from<loco::DataType::S32>(node, size);
 
+  const int32_t kMinScale = std::numeric_limits<int32_t>::lowest();
+  const int32_t kMaxScale = std::numeric_limits<int32_t>::max();
   for (uint32_t i = 0; i < size; ++i)
   {
     scaling_factor[i] = input_scale * weight_scale[i];
     scaling_factor_inv = (scaling_factor[i] == 0) ? 0 : 1.0 / scaling_factor[i];
-    quantized_values[i] =
+    const auto quantized =
       static_cast<int32_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
+    new_bias->at<loco::DataType::S32>(i) = std::min(kMaxScale, std::max(kMinScale, quantized));
     zp[i] = 0;
   }
 
-  auto new_bias = create_empty_const_from<loco::DataType::S32>(node, size);
-
-  const int32_t kMinScale = std::numeric_limits<int32_t>::lowest();
-  const int32_t kMaxScale = std::numeric_limits<int32_t>::max();
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    new_bias->at<loco::DataType::S32>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
-
   return new_bias;
 }
 
@@ -364,24 +348,17 @@ CircleConst *int16_quant_bias_per_channel(CircleConst *node, float input_scale,
   float scaling_factor_inv{0};
 
   uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int64_t> quantized_values(size);
+  auto new_bias = create_empty_const_from<loco::DataType::S64>(node, size);
 
   for (uint32_t i = 0; i < size; ++i)
   {
     scaling_factor[i] = input_scale * weight_scale[i];
     scaling_factor_inv = (scaling_factor[i] == 0) ? 0 : 1.0 / scaling_factor[i];
-    quantized_values[i] =
+    new_bias->at<loco::DataType::S64>(i) =
       static_cast<int64_t>(std::round(node->at<loco::DataType::FLOAT32>(i) * scaling_factor_inv));
     zp[i] = 0;
   }
 
-  auto new_bias = create_empty_const_from<loco::DataType::S64>(node, size);
-
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    new_bias->at<loco::DataType::S64>(i) = quantized_values[i];
-  }
-
   return new_bias;
 }
 
@@ -390,128 +367,6 @@ bool has_min_max(const CircleNode *node)
   return node->quantparam() && !node->quantparam()->min.empty() && !node->quantparam()->max.empty();
 }
 
-void sym_wquant_per_channel(CircleConst *node, std::vector<float> &scaling_factor,
-                            int32_t &channel_dim_index)
-{
-  assert(node->dtype() == loco::DataType::FLOAT32);
-
-  const int32_t kMaxScale = std::numeric_limits<int16_t>::max();
-  const int32_t kMinScale = -kMaxScale;
-
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
-  }
-
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          quantized_values[cal_offset(dimension, indices)] =
-            static_cast<int32_t>(std::round(data * scaling_factor_inv));
-        }
-      }
-    }
-  }
-
-  node->dtype(loco::DataType::S16);      // change the type of tensor
-  node->size<loco::DataType::S16>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::S16>(i) =
-      std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
-}
-
-void asym_wquant_per_channel(CircleConst *node, std::vector<float> &min,
-                             std::vector<float> &scaling_factor, int32_t &channel_dim_index)
-{
-  assert(node->dtype() == loco::DataType::FLOAT32);
-
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-  std::vector<int32_t> quantized_values(size);
-
-  loco::TensorShape dimension;
-  dimension.rank(4);
-  uint32_t indices[4] = {
-    0,
-  };
-
-  if (!get_channel_dim_index(node, dimension, channel_dim_index))
-  {
-    assert(false);
-    return;
-  }
-
-  for (indices[0] = 0; indices[0] < dimension.dim(0).value(); indices[0]++)
-  {
-    for (indices[1] = 0; indices[1] < dimension.dim(1).value(); indices[1]++)
-    {
-      for (indices[2] = 0; indices[2] < dimension.dim(2).value(); indices[2]++)
-      {
-        for (indices[3] = 0; indices[3] < dimension.dim(3).value(); indices[3]++)
-        {
-          int channel_idx = indices[channel_dim_index];
-          const float scaling_factor_inv = 1.0 / scaling_factor[channel_idx];
-          auto data = node->at<loco::DataType::FLOAT32>(cal_offset(dimension, indices));
-          quantized_values[cal_offset(dimension, indices)] =
-            static_cast<int32_t>(std::round((data - min[channel_idx]) * scaling_factor_inv));
-        }
-      }
-    }
-  }
-
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
-}
-
-void asym_wquant_per_layer(CircleConst *node, float min, float scaling_factor)
-{
-  const int32_t kMinScale = 0;
-  const int32_t kMaxScale = 255;
-
-  uint32_t size = node->size<loco::DataType::FLOAT32>();
-
-  const float scaling_factor_inv = 1.0 / scaling_factor;
-  std::vector<int32_t> quantized_values(size);
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    auto data = node->at<loco::DataType::FLOAT32>(i);
-    quantized_values[i] = static_cast<int32_t>(std::round((data - min) * scaling_factor_inv));
-  }
-
-  node->dtype(loco::DataType::U8);      // change the type of tensor
-  node->size<loco::DataType::U8>(size); // resize tensor
-  for (uint32_t i = 0; i < size; ++i)
-  {
-    node->at<loco::DataType::U8>(i) = std::min(kMaxScale, std::max(kMinScale, quantized_values[i]));
-  }
-}
-
 void set_bias(luci::CircleNode *node, luci::CircleConst *bias)
 {
   if (auto conv = dynamic_cast<CircleConv2D *>(node))
@@ -708,48 +563,104 @@ struct QuantizeWeights final : public luci::CircleNodeMutableVisitor<bool>
   QuantizationGranularity granularity;
 
 private:
-  void quantize_weights(luci::CircleConst *weights)
+  // Create a const node to store quantized values of weights
+  luci::CircleConst *create_quantized_weights(luci::CircleConst *weights)
+  {
+    auto quantparam = weights->quantparam();
+    if (quantparam == nullptr)
+      throw std::runtime_error("quantparam of weights is not found");
+
+    const auto size = weights->size<loco::DataType::FLOAT32>();
+
+    luci::CircleConst *new_weights = nullptr;
+    if (granularity == QuantizationGranularity::ChannelWise && output_type == loco::DataType::S16)
+      new_weights = create_empty_const_from<loco::DataType::S16>(weights, size);
+    else
+      new_weights = create_empty_const_from<loco::DataType::U8>(weights, size);
+
+    auto new_quantparam = std::make_unique<CircleQuantParam>();
+    new_quantparam->scale = quantparam->scale;
+    new_quantparam->zerop = quantparam->zerop;
+    new_quantparam->min = quantparam->min;
+    new_quantparam->max = quantparam->max;
+    new_quantparam->quantized_dimension = quantparam->quantized_dimension;
+    new_weights->quantparam(std::move(new_quantparam));
+
+    // Quantized values keep the layout of sparse weights
+    if (auto sparsityparam = weights->sparsityparam())
+      new_weights->sparsityparam(std::make_unique<SparsityParam>(*sparsityparam));
+
+    return new_weights;
+  }
+
+  // Quantize values of weights into new_weights, which is created by create_quantized_weights()
+  void quantize_weights(const luci::CircleConst *weights, luci::CircleConst *new_weights)
   {
-    // Find min/max per channel-wise
+    auto quantparam = new_weights->quantparam();
+    assert(quantparam != nullptr);
+
+    const auto size = weights->size<loco::DataType::FLOAT32>();
+
+    QuantizeParams params;
+    params.qmin = 0;
+    params.qmax = 255;
+
+    // Quantize per channel-wise using recorded quantparam
     if (granularity == QuantizationGranularity::ChannelWise)
     {
-      auto quantparam = weights->quantparam();
-      if (quantparam == nullptr)
+      loco::TensorShape dimension;
+      dimension.rank(4);
+      int32_t channel_dim_index = 0;
+
+      if (!get_channel_dim_index(new_weights, dimension, channel_dim_index))
       {
-        assert(false && "quantparam is nullptr");
+        assert(false);
         return;
       }
 
-      auto min = quantparam->min;
-      auto scaling_factor = quantparam->scale;
-      int32_t channel_dim_index = 0;
+      const auto channels = quantparam->scale.size();
+      params.clip_min.assign(channels, std::numeric_limits<float>::lowest());
+      params.clip_max.assign(channels, std::numeric_limits<float>::max());
+      params.scale = quantparam->scale;
+      params.zerop.assign(channels, 0);
+      params.inner = channel_inner_size(dimension, channel_dim_index);
 
       if (output_type == loco::DataType::U8)
       {
-        asym_wquant_per_channel(weights, min, scaling_factor, channel_dim_index);
+        params.offset = quantparam->min;
       }
       else
       {
-        sym_wquant_per_channel(weights, scaling_factor, channel_dim_index);
+        params.offset.assign(channels, 0.0f);
+        params.qmax = std::numeric_limits<int16_t>::max();
+        params.qmin = -params.qmax;
       }
-      quantparam->min.clear();
-      quantparam->max.clear();
       quantparam->quantized_dimension = channel_dim_index;
     }
-    // Find min/max per layer-wise
+    // Quantize per layer-wise using recorded quantparam
     else
     {
-      // Quantize using recorded quantparam
-      auto quantparam = weights->quantparam();
-      assert(quantparam != nullptr);
       assert(quantparam->min.size() == 1);   // only support layer-wise quant
       assert(quantparam->scale.size() == 1); // only support layer-wise quant
-      auto min = quantparam->min[0];
-      auto scaling_factor = quantparam->scale[0];
-      asym_wquant_per_layer(weights, min, scaling_factor);
-      quantparam->min.clear();
-      quantparam->max.clear();
+      params.clip_min = {std::numeric_limits<float>::lowest()};
+      params.clip_max = {std::numeric_limits<float>::max()};
+      params.offset = {quantparam->min[0]};
+      params.scale = {quantparam->scale[0]};
+      params.zerop = {0};
+      params.inner = size;
     }
+    quantparam->min.clear();
+    quantparam->max.clear();
+
+    if (size == 0)
+      return;
+
+    // Values are written directly into new_weights
+    const float *values = &weights->at<loco::DataType::FLOAT32>(0);
+    if (new_weights->dtype() == loco::DataType::U8)
+      quantize_values(values, &new_weights->at<loco::DataType::U8>(0), size, params);
+    else
+      quantize_values(values, &new_weights->at<loco::DataType::S16>(0), size, params);
   }
 
   bool visit(luci::CircleConv2D *node)
@@ -760,9 +671,9 @@ private:
     auto weights = loco::must_cast<luci::CircleConst *>(node->filter());
     if (!is_quantized(weights))
     {
-      auto new_weights = luci::clone(weights);
+      auto new_weights = create_quantized_weights(weights);
       node->filter(new_weights);
-      quantize_weights(new_weights);
+      quantize_weights(weights, new_weights);
       return true;
     }
     return false;
@@ -776,9 +687,9 @@ private:
     auto weights = loco::must_cast<luci::CircleConst *>(node->filter());
     if (!is_quantized(weights))
     {
-      auto new_weights = luci::clone(weights);
+      auto new_weights = create_quantized_weights(weights);
       node->filter(new_weights);
-      quantize_weights(new_weights);
+      quantize_weights(weights, new_weights);
       return true;
     }
     return false;
@@ -849,9 +760,9 @@ private:
     auto weights = loco::must_cast<luci::CircleConst *>(node->filter());
     if (!is_quantized(weights))
     {
-      auto new_weights = luci::clone(weights);
+      auto new_weights = create_quantized_weights(weights);
       node->filter(new_weights);
-      quantize_weights(new_weights);
+      quantize_weights(weights, new_weights);
       return true;
     }
     return false;
@@ -865,9 +776,9 @@ private:
     auto weights = loco::must_cast<luci::CircleConst *>(node->weights());
     if (!is_quantized(weights))
     {
-      auto new_weights = luci::clone(weights);
+      auto new_weights = create_quantized_weights(weights);
       node->weights(new_weights);
-      quantize_weights(new_weights);
+      quantize_weights(weights, new_weights);
       return true;
     }
     return false;
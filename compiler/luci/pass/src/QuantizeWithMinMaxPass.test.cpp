@@ -16,6 +16,8 @@
 
 #include "luci/Pass/QuantizeWithMinMaxPass.h"
 
+#include <luci/IR/CircleNodes.h>
+
 #include <gtest/gtest.h>
 
 TEST(QuantizeWithMinMaxPassTest, name)
@@ -25,3 +27,80 @@ TEST(QuantizeWithMinMaxPassTest, name)
   auto const name = pass.name();
   ASSERT_NE(nullptr, name);
 }
+
+namespace
+{
+
+void set_minmax(luci::CircleNode *node, float min, float max)
+{
+  auto quantparam = std::make_unique<luci::CircleQuantParam>();
+  quantparam->min.push_back(min);
+  quantparam->max.push_back(max);
+  node->quantparam(std::move(quantparam));
+}
+
+} // namespace
+
+TEST(QuantizeWithMinMaxPassTest, sparse_weights_keep_sparsityparam)
+{
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto weights = g->nodes()->create<luci::CircleConst>();
+  auto bias = g->nodes()->create<luci::CircleOutputExclude>();
+  auto fc = g->nodes()->create<luci::CircleFullyConnected>();
+  auto output = g->nodes()->create<luci::CircleOutput>();
+
+  auto graph_input = g->inputs()->create();
+  input->index(graph_input->index());
+  input->dtype(loco::DataType::FLOAT32);
+  input->shape({1, 4});
+  set_minmax(input, -1.0f, 1.0f);
+
+  weights->dtype(loco::DataType::FLOAT32);
+  weights->shape({2, 4});
+  weights->size<loco::DataType::FLOAT32>(8);
+  for (uint32_t i = 0; i < 8; ++i)
+    weights->at<loco::DataType::FLOAT32>(i) = i * 0.1f;
+  set_minmax(weights, 0.0f, 0.7f);
+  weights->quantparam()->scale.push_back(0.7f / 255.0f);
+  weights->quantparam()->zerop.push_back(0);
+
+  auto sparsityparam = std::make_unique<luci::SparsityParam>();
+  sparsityparam->traversal_order = {0, 1};
+  sparsityparam->dim_metadata.emplace_back(luci::DimensionType::DENSE, 2);
+  sparsityparam->dim_metadata.emplace_back(
+    luci::DimensionType::SPARSE_CSR, 0,
+    luci::SparseIndexVector{luci::SparseIndexVectorType::I32, std::vector<int32_t>{0, 4, 8}},
+    luci::SparseIndexVector{luci::SparseIndexVectorType::I32,
+                            std::vector<int32_t>{0, 1, 2, 3, 0, 1, 2, 3}});
+  weights->sparsityparam(std::move(sparsityparam));
+
+  fc->input(input);
+  fc->weights(weights);
+  fc->bias(bias);
+  fc->fusedActivationFunction(luci::FusedActFunc::NONE);
+  fc->dtype(loco::DataType::FLOAT32);
+  fc->shape({1, 2});
+  set_minmax(fc, -2.0f, 2.0f);
+
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  output->from(fc);
+
+  luci::QuantizeWithMinMaxPass pass(loco::DataType::FLOAT32, loco::DataType::U8,
+                                    luci::QuantizationGranularity::LayerWise);
+  pass.run(g.get());
+
+  auto new_weights = dynamic_cast<luci::CircleConst *>(fc->weights());
+  ASSERT_NE(nullptr, new_weights);
+  ASSERT_EQ(loco::DataType::U8, new_weights->dtype());
+
+  auto new_sparsityparam = new_weights->sparsityparam();
+  ASSERT_NE(nullptr, new_sparsityparam);
+  ASSERT_EQ(std::vector<int32_t>({0, 1}), new_sparsityparam->traversal_order);
+  ASSERT_EQ(2, new_sparsityparam->dim_metadata.size());
+  ASSERT_EQ(luci::DimensionType::SPARSE_CSR, new_sparsityparam->dim_metadata[1].format());
+  ASSERT_EQ(std::vector<int32_t>({0, 4, 8}),
+            *new_sparsityparam->dim_metadata[1].array_segments().as_int32_vector());
+}
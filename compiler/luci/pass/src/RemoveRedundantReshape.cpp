@@ -55,18 +55,12 @@ namespace luci
  *                               |
  *                         [CircleNode]
  **/
-bool RemoveRedundantReshapePass::run(loco::Graph *g)
+bool RemoveRedundantReshapePass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto reshape_node = dynamic_cast<luci::CircleReshape *>(node))
-    {
-      if (remove_redundant_reshape(reshape_node))
-        changed = true;
-    }
-  }
-  return changed;
+  if (auto reshape_node = dynamic_cast<luci::CircleReshape *>(node))
+    return remove_redundant_reshape(reshape_node);
+
+  return false;
 }
 
 } // namespace luci
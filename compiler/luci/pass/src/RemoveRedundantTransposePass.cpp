@@ -41,11 +41,11 @@ bool remove_consecutive_transpose_function(luci::CircleTranspose *target_node)
   if (pred_node == nullptr)
     return false;
 
-  auto pred_perm = dynamic_cast<luci::CircleConst *>(target_node->perm());
+  auto pred_perm = dynamic_cast<const luci::CircleConst *>(target_node->perm());
   if (pred_perm == nullptr)
     return false;
 
-  auto main_perm = dynamic_cast<luci::CircleConst *>(pred_node->perm());
+  auto main_perm = dynamic_cast<const luci::CircleConst *>(pred_node->perm());
   if (main_perm == nullptr)
     return false;
 
@@ -56,7 +56,7 @@ bool remove_consecutive_transpose_function(luci::CircleTranspose *target_node)
   }
   else
   {
-    auto g = main_perm->graph();
+    auto g = target_node->graph();
     auto new_const_node = g->nodes()->create<luci::CircleConst>();
 
     new_const_node->dtype(loco::DataType::S32);
@@ -110,18 +110,12 @@ namespace luci
  *                   |                            |
  *
  */
-bool RemoveRedundantTransposePass::run(loco::Graph *g)
+bool RemoveRedundantTransposePass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto transpose = dynamic_cast<luci::CircleTranspose *>(node))
-    {
-      if (remove_consecutive_transpose_function(transpose))
-        changed = true;
-    }
-  }
-  return changed;
+  if (auto transpose = dynamic_cast<luci::CircleTranspose *>(node))
+    return remove_consecutive_transpose_function(transpose);
+
+  return false;
 }
 
 } // namespace luci
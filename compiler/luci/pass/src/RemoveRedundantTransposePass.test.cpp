@@ -14,6 +14,13 @@
  * limitations under the License.
  */
 #include "luci/Pass/RemoveRedundantTransposePass.h"
+#include "luci/Pass/CircleShapeInferencePass.h"
+#include "luci/Pass/CircleTypeInferencePass.h"
+#include "luci/Pass/ShapeInferencePass.h"
+#include "luci/Pass/TypeInferencePass.h"
+
+#include <logo/Phase.h>
+#include <logo/RemoveDeadNodeWithQueryPass.h>
 
 #include <luci/IR/CircleNodes.h>
 
@@ -296,3 +303,103 @@ TEST(RemoveRedundantTransposePass, remove_consecutive_transpose_function_with_br
   ASSERT_EQ(3, perm->at<loco::DataType::S32>(2));
   ASSERT_EQ(2, perm->at<loco::DataType::S32>(3));
 }
+
+namespace
+{
+
+// Count the roots which the pass is asked to rewrite
+class CountRewrites final : public logo::NodePass
+{
+public:
+  CountRewrites(std::unique_ptr<logo::NodePass> &&pass) : _pass(std::move(pass)) {}
+
+public:
+  const char *name(void) const final { return _pass->name(); }
+
+  bool rewrite(loco::Node *root) final
+  {
+    ++rewrites;
+    return _pass->rewrite(root);
+  }
+
+public:
+  uint32_t rewrites = 0;
+
+private:
+  std::unique_ptr<logo::NodePass> _pass;
+};
+
+} // namespace
+
+/**
+ *  input - [Transpose] x K - [Relu] x N - output
+ *
+ *  Transposes are merged one by one in successive rounds, while inference passes
+ *  report a change in each of them
+ */
+TEST(RemoveRedundantTransposePass, worklist_phase_with_inference)
+{
+  const uint32_t K = 20;
+  const uint32_t N = 2000;
+
+  auto g = loco::make_graph();
+
+  auto input = g->nodes()->create<luci::CircleInput>();
+  auto graph_input = g->inputs()->create();
+  input->index(graph_input->index());
+  input->dtype(loco::DataType::FLOAT32);
+  input->shape({1, 2, 3, 4});
+  input->shape_status(luci::ShapeStatus::VALID);
+  graph_input->dtype(loco::DataType::FLOAT32);
+  graph_input->shape({1, 2, 3, 4});
+
+  luci::CircleNode *last = input;
+  for (uint32_t i = 0; i < K; ++i)
+  {
+    auto perm = g->nodes()->create<luci::CircleConst>();
+    setValue(perm, {0, 2, 1, 3});
+    perm->shape_status(luci::ShapeStatus::VALID);
+
+    auto transpose = g->nodes()->create<luci::CircleTranspose>();
+    transpose->a(last);
+    transpose->perm(perm);
+    last = transpose;
+  }
+  for (uint32_t i = 0; i < N; ++i)
+  {
+    auto relu = g->nodes()->create<luci::CircleRelu>();
+    relu->features(last);
+    last = relu;
+  }
+
+  auto output = g->nodes()->create<luci::CircleOutput>();
+  output->from(last);
+  auto graph_output = g->outputs()->create();
+  output->index(graph_output->index());
+  graph_output->dtype(loco::DataType::FLOAT32);
+  graph_output->shape({1, 2, 3, 4});
+
+  logo::Phase phase;
+  phase.emplace_back(std::make_unique<logo::RemoveDeadNodeWithQueryPass>());
+  phase.emplace_back(std::make_unique<luci::TypeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::ShapeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::CircleShapeInferencePass>());
+  phase.emplace_back(std::make_unique<luci::CircleTypeInferencePass>());
+  auto count =
+    std::make_unique<CountRewrites>(std::make_unique<luci::RemoveRedundantTransposePass>());
+  auto count_ptr = count.get();
+  phase.emplace_back(std::move(count));
+
+  logo::PhaseRunner<logo::PhaseStrategy::Worklist> phase_runner{g.get()};
+  phase_runner.run(phase);
+
+  // Even number of the same swapping transposes is the identity
+  auto relu = dynamic_cast<luci::CircleRelu *>(last);
+  while (dynamic_cast<luci::CircleRelu *>(relu->features()) != nullptr)
+    relu = dynamic_cast<luci::CircleRelu *>(relu->features());
+  ASSERT_EQ(input, relu->features());
+
+  // Every node is visited in the first round, and only a few around the merged transposes in
+  // the others
+  ASSERT_LT(count_ptr->rewrites, N + 20 * K);
+}
@@ -27,7 +27,7 @@ bool remove_no_effect_reshape(luci::CircleNode *node)
   if (target_node == nullptr)
     return false;
 
-  auto new_shape = dynamic_cast<luci::CircleConst *>(target_node->shape());
+  auto new_shape = dynamic_cast<const luci::CircleConst *>(target_node->shape());
   if (new_shape == nullptr)
     return false;
 
@@ -58,18 +58,10 @@ bool remove_no_effect_reshape(luci::CircleNode *node)
 namespace luci
 {
 
-bool RemoveUnnecessaryReshapePass::run(loco::Graph *g)
+bool RemoveUnnecessaryReshapePass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    if (remove_no_effect_reshape(circle_node))
-    {
-      changed = true;
-    }
-  }
-  return changed;
+  auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+  return remove_no_effect_reshape(circle_node);
 }
 
 } // namespace luci
@@ -43,11 +43,11 @@ bool remove_no_effect_slice(luci::CircleNode *node)
   if (target_node == nullptr)
     return false;
 
-  auto begin_const = dynamic_cast<luci::CircleConst *>(target_node->begin());
+  auto begin_const = dynamic_cast<const luci::CircleConst *>(target_node->begin());
   if (begin_const == nullptr)
     return false;
 
-  auto size_const = dynamic_cast<luci::CircleConst *>(target_node->size());
+  auto size_const = dynamic_cast<const luci::CircleConst *>(target_node->size());
   if (size_const == nullptr)
     return false;
 
@@ -94,18 +94,10 @@ namespace luci
  *    1. Static Shape : begin_const[idx] is 0 AND size_const[idx] is (-1 OR input_dimension[idx])
  *    2. Dynamic Shape : begin_const[idx] is 0 AND size_const[idx] is -1
  */
-bool RemoveUnnecessarySlicePass::run(loco::Graph *g)
+bool RemoveUnnecessarySlicePass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    if (remove_no_effect_slice(circle_node))
-    {
-      changed = true;
-    }
-  }
-  return changed;
+  auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+  return remove_no_effect_slice(circle_node);
 }
 
 } // namespace luci
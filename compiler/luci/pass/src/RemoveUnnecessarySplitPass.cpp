@@ -47,18 +47,10 @@ bool remove_unnecessary_split(luci::CircleNode *node)
 namespace luci
 {
 
-bool RemoveUnnecessarySplitPass::run(loco::Graph *g)
+bool RemoveUnnecessarySplitPass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    if (remove_unnecessary_split(circle_node))
-    {
-      changed = true;
-    }
-  }
-  return changed;
+  auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+  return remove_unnecessary_split(circle_node);
 }
 
 } // namespace luci
@@ -21,13 +21,13 @@
 namespace
 {
 
-luci::CircleConst *create_weights_from_gamma(luci::CircleConst *gamma)
+luci::CircleConst *create_weights_from_gamma(loco::Graph *graph, const luci::CircleConst *gamma)
 {
   assert(gamma->rank() == 1);
   auto channel_size = gamma->dim(0).value();
 
   // Channel-wise MUL is the same as DEPTHWISE_CONV2D with filter shape (1,1,1,channel_size)
-  auto weights = gamma->graph()->nodes()->create<luci::CircleConst>();
+  auto weights = graph->nodes()->create<luci::CircleConst>();
   weights->dtype(loco::DataType::FLOAT32);
   weights->rank(4);
   weights->dim(0).set(1);
@@ -44,13 +44,13 @@ luci::CircleConst *create_weights_from_gamma(luci::CircleConst *gamma)
   return weights;
 }
 
-luci::CircleConst *create_bias_from_beta(luci::CircleConst *beta)
+luci::CircleConst *create_bias_from_beta(loco::Graph *graph, const luci::CircleConst *beta)
 {
   assert(beta->rank() == 1);
   auto channel_size = beta->dim(0).value();
 
   // Channel-wise ADD is the same as bias (shape = (channel_size)) of DEPTHWISE_CONV2D
-  auto bias = beta->graph()->nodes()->create<luci::CircleConst>();
+  auto bias = graph->nodes()->create<luci::CircleConst>();
   bias->dtype(loco::DataType::FLOAT32);
   bias->rank(1);
   bias->dim(0).set(channel_size);
@@ -177,8 +177,8 @@ bool replace_mul_add_with_dwconv(luci::CircleAdd *add)
       gamma->dtype() != loco::DataType::FLOAT32)
     return false;
 
-  auto weights = create_weights_from_gamma(gamma);
-  auto bias = create_bias_from_beta(beta);
+  auto weights = create_weights_from_gamma(add->graph(), gamma);
+  auto bias = create_bias_from_beta(add->graph(), beta);
 
   auto dwconv = add->graph()->nodes()->create<luci::CircleDepthwiseConv2D>();
   dwconv->input(pred_node);
@@ -201,19 +201,12 @@ bool replace_mul_add_with_dwconv(luci::CircleAdd *add)
 namespace luci
 {
 
-bool ReplaceMulAddWithDepthwiseConvPass::run(loco::Graph *g)
+bool ReplaceMulAddWithDepthwiseConvPass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto add = dynamic_cast<luci::CircleAdd *>(node))
-    {
-      if (replace_mul_add_with_dwconv(add))
-        changed = true;
-    }
-  }
+  if (auto add = dynamic_cast<luci::CircleAdd *>(node))
+    return replace_mul_add_with_dwconv(add);
 
-  return changed;
+  return false;
 }
 
 } // namespace luci
@@ -20,6 +20,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 namespace
 {
 
@@ -134,6 +136,44 @@ TEST(ReplaceMulAddWithDepthwiseConv, simple)
   }
 }
 
+TEST(ReplaceMulAddWithDepthwiseConv, refer_const)
+{
+  SimpleGraph g;
+
+  // gamma and beta refer to data of a model buffer, which the pass only reads
+  uint32_t channel_size = 16;
+  std::vector<float> gamma_data(channel_size);
+  std::vector<float> beta_data(channel_size);
+  for (uint32_t i = 0; i < channel_size; i++)
+  {
+    gamma_data[i] = i * 2;
+    beta_data[i] = i * 3;
+  }
+  g.gamma->refer(reinterpret_cast<const uint8_t *>(gamma_data.data()),
+                 channel_size * sizeof(float));
+  g.beta->refer(reinterpret_cast<const uint8_t *>(beta_data.data()), channel_size * sizeof(float));
+
+  luci::ReplaceMulAddWithDepthwiseConvPass pass;
+  while (pass.run(&g.g))
+    ;
+
+  auto dwconv = dynamic_cast<luci::CircleDepthwiseConv2D *>(g.output->from());
+  ASSERT_NE(nullptr, dwconv);
+  auto weights = dynamic_cast<luci::CircleConst *>(dwconv->filter());
+  auto bias = dynamic_cast<luci::CircleConst *>(dwconv->bias());
+  ASSERT_NE(nullptr, weights);
+  ASSERT_NE(nullptr, bias);
+  for (uint32_t i = 0; i < channel_size; i++)
+  {
+    EXPECT_FLOAT_EQ(i * 2, weights->at<loco::DataType::FLOAT32>(i));
+    EXPECT_FLOAT_EQ(i * 3, bias->at<loco::DataType::FLOAT32>(i));
+  }
+
+  // Reading them did not copy the data
+  EXPECT_TRUE(g.gamma->referring());
+  EXPECT_TRUE(g.beta->referring());
+}
+
 TEST(ReplaceMulAddWithDepthwiseConv, wrong_op_NEG)
 {
   SimpleGraph g;
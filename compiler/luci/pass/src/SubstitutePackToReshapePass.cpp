@@ -102,18 +102,10 @@ namespace luci
  *                 [CircleNode]
  *                      |
  */
-bool SubstitutePackToReshapePass::run(loco::Graph *g)
+bool SubstitutePackToReshapePass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    auto circle_node = loco::must_cast<luci::CircleNode *>(node);
-    if (unknown_dim_count(circle_node) <= 1 && substitute_pack_to_reshape(circle_node))
-    {
-      changed = true;
-    }
-  }
-  return changed;
+  auto circle_node = loco::must_cast<luci::CircleNode *>(node);
+  return unknown_dim_count(circle_node) <= 1 && substitute_pack_to_reshape(circle_node);
 }
 
 } // namespace luci
@@ -159,18 +159,12 @@ namespace luci
  *                   [CircleNode]
  *                        |
  */
-bool SubstituteSqueezeToReshapePass::run(loco::Graph *g)
+bool SubstituteSqueezeToReshapePass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto squeeze = dynamic_cast<luci::CircleSqueeze *>(node))
-    {
-      if (substitute_squeeze_to_reshape(squeeze))
-        changed = true;
-    }
-  }
-  return changed;
+  if (auto squeeze = dynamic_cast<luci::CircleSqueeze *>(node))
+    return substitute_squeeze_to_reshape(squeeze);
+
+  return false;
 }
 
 } // namespace luci
@@ -32,7 +32,7 @@ namespace
  */
 bool substitute_transpose_to_reshape(luci::CircleTranspose *node)
 {
-  auto perm_const = dynamic_cast<luci::CircleConst *>(node->perm());
+  auto perm_const = dynamic_cast<const luci::CircleConst *>(node->perm());
   if (perm_const == nullptr)
     return false;
 
@@ -111,20 +111,12 @@ namespace luci
  *            [CircleNode]
  *
  */
-bool SubstituteTransposeToReshapePass::run(loco::Graph *g)
+bool SubstituteTransposeToReshapePass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto circle_node = dynamic_cast<luci::CircleTranspose *>(node))
-    {
-      if (substitute_transpose_to_reshape(circle_node))
-      {
-        changed = true;
-      }
-    }
-  }
-  return changed;
+  if (auto circle_node = dynamic_cast<luci::CircleTranspose *>(node))
+    return substitute_transpose_to_reshape(circle_node);
+
+  return false;
 }
 
 } // namespace luci
@@ -25,7 +25,8 @@ namespace
 {
 
 template <loco::DataType DT>
-bool is_scalar_with_value(luci::CircleConst *node, typename loco::DataTypeImpl<DT>::Type val)
+bool is_scalar_with_value(const luci::CircleConst *node,
+                          typename loco::DataTypeImpl<DT>::Type val)
 {
   if (node->dtype() != DT)
     return false;
@@ -109,20 +110,12 @@ template <loco::DataType DT> bool transform_min_max_pattern(luci::CircleMaximum
 namespace luci
 {
 
-bool TransformMinMaxToRelu6Pass::run(loco::Graph *g)
+bool TransformMinMaxToRelu6Pass::rewrite(loco::Node *node)
 {
-  bool changed = false;
-
-  for (auto node : loco::active_nodes(loco::output_nodes(g)))
-  {
-    if (auto maxi = dynamic_cast<luci::CircleMaximum *>(node))
-    {
-      if (transform_min_max_pattern<loco::DataType::FLOAT32>(maxi))
-        changed = true;
-    }
-  }
-
-  return changed;
+  if (auto maxi = dynamic_cast<luci::CircleMaximum *>(node))
+    return transform_min_max_pattern<loco::DataType::FLOAT32>(maxi);
+
+  return false;
 }
 
 } // namespace luci
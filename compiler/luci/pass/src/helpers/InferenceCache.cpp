@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InferenceCache.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/IR/CircleNodeVisitor.h>
+
+#include <loco.h>
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+uint64_t next_stamp(void)
+{
+  static std::atomic<uint64_t> stamp{0};
+  return ++stamp;
+}
+
+/**
+ * @brief Attributes of a node which shape or dtype inference reads
+ *
+ * @note  Attributes are collected as integers so that changing any of them in place makes the
+ *        node dirty even when a pass forgets to call luci::invalidate_inference(). Contents of
+ *        constants are collected as a hash, as shape inference reads them as shapes, paddings,
+ *        axes, ranges (e.g. FLOAT32 start/limit/delta of Range) and so on.
+ */
+class Attributes final : public luci::CircleNodeVisitor<void>
+{
+public:
+  static std::vector<int64_t> of(const luci::CircleNode *node)
+  {
+    Attributes attrs;
+    node->accept(&attrs);
+    return attrs._values;
+  }
+
+public:
+  void visit(const luci::CircleNode *) final {}
+
+  void visit(const luci::CircleConst *node) final
+  {
+    switch (node->dtype())
+    {
+      case loco::DataType::S8:
+        add_contents<loco::DataType::S8>(node);
+        break;
+      case loco::DataType::U8:
+        add_contents<loco::DataType::U8>(node);
+        break;
+      case loco::DataType::S16:
+        add_contents<loco::DataType::S16>(node);
+        break;
+      case loco::DataType::S32:
+        add_contents<loco::DataType::S32>(node);
+        break;
+      case loco::DataType::S64:
+        add_contents<loco::DataType::S64>(node);
+        break;
+      case loco::DataType::FLOAT32:
+        add_contents<loco::DataType::FLOAT32>(node);
+        break;
+      case loco::DataType::BOOL:
+        add_contents<loco::DataType::BOOL>(node);
+        break;
+      default:
+        break;
+    }
+  }
+
+  void visit(const luci::CircleArgMax *node) final { add(node->output_type()); }
+  void visit(const luci::CircleArgMin *node) final { add(node->output_type()); }
+  void visit(const luci::CircleAveragePool2D *node) final { add_pool(node); }
+  void visit(const luci::CircleBatchMatMul *node) final
+  {
+    add(node->adj_x());
+    add(node->adj_y());
+  }
+  void visit(const luci::CircleBCQGather *node) final
+  {
+    add(node->axis());
+    add(node->input_hidden_size());
+  }
+  void visit(const luci::CircleConcatenation *node) final { add(node->axis()); }
+  void visit(const luci::CircleConv2D *node) final { add_conv(node); }
+  void visit(const luci::CircleDepthToSpace *node) final { add(node->block_size()); }
+  void visit(const luci::CircleDepthwiseConv2D *node) final
+  {
+    add_conv(node);
+    add(node->depthMultiplier());
+  }
+  void visit(const luci::CircleGather *node) final { add(node->axis()); }
+  void visit(const luci::CircleL2Pool2D *node) final { add_pool(node); }
+  void visit(const luci::CircleMaxPool2D *node) final { add_pool(node); }
+  void visit(const luci::CircleMean *node) final { add(node->keep_dims()); }
+  void visit(const luci::CircleOneHot *node) final { add(node->axis()); }
+  void visit(const luci::CirclePack *node) final { add(node->axis()); }
+  void visit(const luci::CircleReduceAny *node) final { add(node->keep_dims()); }
+  void visit(const luci::CircleReduceMax *node) final { add(node->keep_dims()); }
+  void visit(const luci::CircleReduceMin *node) final { add(node->keep_dims()); }
+  void visit(const luci::CircleReduceProd *node) final { add(node->keep_dims()); }
+  void visit(const luci::CircleReshape *node) final
+  {
+    auto new_shape = node->newShape();
+    add(new_shape->rank());
+    for (uint32_t i = 0; i < new_shape->rank(); ++i)
+      add(new_shape->dim(i));
+  }
+  void visit(const luci::CircleShape *node) final { add(node->out_type()); }
+  void visit(const luci::CircleSpaceToDepth *node) final { add(node->block_size()); }
+  void visit(const luci::CircleSplit *node) final { add(node->num_split()); }
+  void visit(const luci::CircleSplitV *node) final { add(node->num_split()); }
+  void visit(const luci::CircleSqueeze *node) final
+  {
+    add(node->squeeze_dims().size());
+    for (auto dim : node->squeeze_dims())
+      add(dim);
+  }
+  void visit(const luci::CircleStridedSlice *node) final
+  {
+    add(node->begin_mask());
+    add(node->end_mask());
+    add(node->ellipsis_mask());
+    add(node->new_axis_mask());
+    add(node->shrink_axis_mask());
+  }
+  void visit(const luci::CircleSum *node) final { add(node->keep_dims()); }
+  void visit(const luci::CircleTransposeConv *node) final
+  {
+    add(node->padding());
+    add(node->stride()->h());
+    add(node->stride()->w());
+  }
+  void visit(const luci::CircleUnique *node) final { add(node->idx_out_type()); }
+  void visit(const luci::CircleUnpack *node) final
+  {
+    add(node->axis());
+    add(node->num());
+  }
+
+  // Outputs of multiple output operations
+  void visit(const luci::CircleBidirectionalSequenceLSTMOut *node) final { add(node->index()); }
+  void visit(const luci::CircleCustomOut *node) final { add(node->index()); }
+  void visit(const luci::CircleNonMaxSuppressionV4Out *node) final { add(node->index()); }
+  void visit(const luci::CircleNonMaxSuppressionV5Out *node) final { add(node->index()); }
+  void visit(const luci::CircleSplitOut *node) final { add(node->index()); }
+  void visit(const luci::CircleSplitVOut *node) final { add(node->index()); }
+  void visit(const luci::CircleTopKV2Out *node) final { add(node->index()); }
+  void visit(const luci::CircleUniqueOut *node) final { add(node->index()); }
+  void visit(const luci::CircleUnpackOut *node) final { add(node->index()); }
+
+private:
+  template <typename T> void add(T value) { _values.push_back(static_cast<int64_t>(value)); }
+
+  template <class Conv2DType> void add_conv(const Conv2DType *node)
+  {
+    add(node->padding());
+    add(node->stride()->h());
+    add(node->stride()->w());
+    add(node->dilation()->h());
+    add(node->dilation()->w());
+  }
+
+  template <class Pool2DType> void add_pool(const Pool2DType *node)
+  {
+    add(node->padding());
+    add(node->filter()->h());
+    add(node->filter()->w());
+    add(node->stride()->h());
+    add(node->stride()->w());
+  }
+
+  template <loco::DataType DT> void add_contents(const luci::CircleConst *node)
+  {
+    // FNV-1a
+    uint64_t hash = 14695981039346656037ull;
+    for (uint32_t i = 0; i < node->size<DT>(); ++i)
+    {
+      // Bits of the value, as casting a float would map different values to the same integer
+      uint64_t bits = 0;
+      const auto value = node->at<DT>(i);
+      std::memcpy(&bits, &value, sizeof(value));
+
+      hash ^= bits;
+      hash *= 1099511628211ull;
+    }
+    add(node->size<DT>());
+    add(hash);
+  }
+
+private:
+  std::vector<int64_t> _values;
+};
+
+struct ShapeState
+{
+  static ShapeState of(const luci::CircleNode *node)
+  {
+    ShapeState state;
+
+    state.status = node->shape_status();
+    for (uint32_t i = 0; i < node->rank(); ++i)
+    {
+      auto &dim = node->dim(i);
+      state.dims.emplace_back(dim.known(), dim.known() ? dim.value() : 0);
+    }
+    state.attrs = Attributes::of(node);
+
+    return state;
+  }
+
+  bool operator==(const ShapeState &rhs) const
+  {
+    return status == rhs.status && dims == rhs.dims && attrs == rhs.attrs;
+  }
+
+  luci::ShapeStatus status = luci::ShapeStatus::UNDEFINED;
+  std::vector<std::pair<bool, uint32_t>> dims;
+  std::vector<int64_t> attrs;
+};
+
+struct DTypeState
+{
+  static DTypeState of(const luci::CircleNode *node)
+  {
+    DTypeState state;
+    state.dtype = node->dtype();
+    state.attrs = Attributes::of(node);
+    return state;
+  }
+
+  bool operator==(const DTypeState &rhs) const { return dtype == rhs.dtype && attrs == rhs.attrs; }
+
+  loco::DataType dtype = loco::DataType::Unknown;
+  std::vector<int64_t> attrs;
+};
+
+/**
+ * @brief Inference result of a node and the inputs which it was inferred from
+ *
+ * @note  'stamp' is renewed whenever the node is re-inferred, so that the nodes using this node
+ *        can tell that they should be re-inferred as well.
+ */
+template <typename State> class InferenceAnnotation final : public loco::NodeAnnotation
+{
+public:
+  struct Arg
+  {
+    const loco::Node *node;
+    uint64_t stamp;
+  };
+
+public:
+  uint64_t stamp = 0;
+  bool cached = false;
+  State state;
+  std::vector<Arg> args;
+};
+
+bool always_dirty(const luci::CircleNode *node)
+{
+  // Shape and dtype of these nodes depend on other graphs or graph outputs
+  switch (node->opcode())
+  {
+    case luci::CircleOpcode::CIRCLEOUTPUT:
+    case luci::CircleOpcode::IF:
+    case luci::CircleOpcode::CIRCLEIFOUT:
+    case luci::CircleOpcode::WHILE:
+    case luci::CircleOpcode::CIRCLEWHILEOUT:
+      return true;
+    default:
+      break;
+  }
+  return false;
+}
+
+template <typename State> uint64_t stamp_of(const loco::Node *node)
+{
+  if (node == nullptr)
+    return 0;
+
+  auto annot = node->annot<InferenceAnnotation<State>>();
+  return annot != nullptr ? annot->stamp : 0;
+}
+
+template <typename State> bool dirty(const luci::CircleNode *node)
+{
+  auto annot = node->annot<InferenceAnnotation<State>>();
+  if (annot == nullptr || !annot->cached)
+    return true;
+
+  // Changed outside of inference, including attributes and constant contents
+  if (!(annot->state == State::of(node)))
+    return true;
+
+  if (annot->args.size() != node->arity())
+    return true;
+
+  for (uint32_t n = 0; n < node->arity(); ++n)
+  {
+    auto arg = node->arg(n);
+    auto &cached_arg = annot->args.at(n);
+
+    if (cached_arg.node != arg || cached_arg.stamp != stamp_of<State>(arg))
+      return true;
+  }
+
+  return false;
+}
+
+template <typename State> void inferred(luci::CircleNode *node, bool changed)
+{
+  auto prev = node->annot<InferenceAnnotation<State>>();
+  auto annot = std::make_unique<InferenceAnnotation<State>>();
+
+  annot->cached = !always_dirty(node);
+  // Nodes which are always re-inferred renew the stamp only when the result is changed
+  if (annot->cached || changed || prev == nullptr)
+    annot->stamp = next_stamp();
+  else
+    annot->stamp = prev->stamp;
+  annot->state = State::of(node);
+
+  if (annot->cached)
+  {
+    for (uint32_t n = 0; n < node->arity(); ++n)
+    {
+      auto arg = node->arg(n);
+      annot->args.push_back({arg, stamp_of<State>(arg)});
+    }
+  }
+
+  node->annot<InferenceAnnotation<State>>(nullptr);
+  node->annot(std::move(annot));
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool shape_dirty(const luci::CircleNode *node) { return dirty<ShapeState>(node); }
+
+void shape_inferred(luci::CircleNode *node, bool changed) { inferred<ShapeState>(node, changed); }
+
+bool dtype_dirty(const luci::CircleNode *node) { return dirty<DTypeState>(node); }
+
+void dtype_inferred(luci::CircleNode *node, bool changed) { inferred<DTypeState>(node, changed); }
+
+void invalidate_inference(luci::CircleNode *node)
+{
+  node->annot<InferenceAnnotation<ShapeState>>(nullptr);
+  node->annot<InferenceAnnotation<DTypeState>>(nullptr);
+}
+
+} // namespace luci
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_INFERENCE_CACHE_H__
+#define __LUCI_INFERENCE_CACHE_H__
+
+#include <luci/IR/CircleNode.h>
+
+namespace luci
+{
+
+/**
+ * @brief Return true if shape of the node should be inferred again
+ *
+ * @note  Shape of a node is dirty when it was never inferred, when it was invalidated or
+ *        changed outside of shape inference, or when any of its inputs was replaced or
+ *        re-inferred since.
+ *        Nodes whose shape depends on other graphs (e.g. CircleOutput, CircleIfOut) are always
+ *        dirty.
+ */
+bool shape_dirty(const luci::CircleNode *node);
+
+/**
+ * @brief Record that shape of the node is inferred with its current inputs
+ *
+ * @note  'changed' tells whether inferred shape differs from the previous one
+ */
+void shape_inferred(luci::CircleNode *node, bool changed);
+
+/**
+ * @brief Return true if dtype of the node should be inferred again
+ */
+bool dtype_dirty(const luci::CircleNode *node);
+
+/**
+ * @brief Record that dtype of the node is inferred with its current inputs
+ */
+void dtype_inferred(luci::CircleNode *node, bool changed);
+
+/**
+ * @brief Drop cached shape/dtype inference of the node
+ *
+ * @note  Replacing inputs of a node is detected by inference passes. Call this when a pass
+ *        changes an attribute which shape or dtype depends on (e.g. axis) or contents of a
+ *        constant in place. Nodes which use the node are re-inferred together.
+ *        Attributes and constant contents are also compared when inference runs, only as a
+ *        safety net for passes which do not call this.
+ */
+void invalidate_inference(luci::CircleNode *node);
+
+} // namespace luci
+
+#endif // __LUCI_INFERENCE_CACHE_H__
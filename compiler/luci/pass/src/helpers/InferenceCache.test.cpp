@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "InferenceCache.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+
+/**
+ *  input ---> [relu] ---> output
+ */
+class ReluGraph
+{
+public:
+  ReluGraph()
+  {
+    input = g->nodes()->create<luci::CircleInput>();
+    relu = g->nodes()->create<luci::CircleRelu>();
+    output = g->nodes()->create<luci::CircleOutput>();
+
+    auto graph_input = g->inputs()->create();
+    input->index(graph_input->index());
+    input->shape({1, 4});
+    input->shape_status(luci::ShapeStatus::VALID);
+
+    relu->features(input);
+    relu->shape({1, 4});
+    relu->shape_status(luci::ShapeStatus::VALID);
+
+    auto graph_output = g->outputs()->create();
+    output->index(graph_output->index());
+    output->from(relu);
+  }
+
+public:
+  std::unique_ptr<loco::Graph> g = loco::make_graph();
+  luci::CircleInput *input = nullptr;
+  luci::CircleRelu *relu = nullptr;
+  luci::CircleOutput *output = nullptr;
+};
+
+} // namespace
+
+TEST(LuciPassHelpersInferenceCache, inferred)
+{
+  ReluGraph g;
+
+  ASSERT_TRUE(luci::shape_dirty(g.input));
+  ASSERT_TRUE(luci::shape_dirty(g.relu));
+
+  luci::shape_inferred(g.input, true);
+  luci::shape_inferred(g.relu, true);
+
+  ASSERT_FALSE(luci::shape_dirty(g.input));
+  ASSERT_FALSE(luci::shape_dirty(g.relu));
+  // dtype is cached separately
+  ASSERT_TRUE(luci::dtype_dirty(g.relu));
+}
+
+TEST(LuciPassHelpersInferenceCache, input_reinferred)
+{
+  ReluGraph g;
+
+  luci::shape_inferred(g.input, true);
+  luci::shape_inferred(g.relu, true);
+
+  g.input->shape({2, 4});
+  ASSERT_TRUE(luci::shape_dirty(g.input));
+  ASSERT_FALSE(luci::shape_dirty(g.relu));
+
+  luci::shape_inferred(g.input, true);
+  ASSERT_FALSE(luci::shape_dirty(g.input));
+  ASSERT_TRUE(luci::shape_dirty(g.relu));
+}
+
+TEST(LuciPassHelpersInferenceCache, input_replaced)
+{
+  ReluGraph g;
+  auto input2 = g.g->nodes()->create<luci::CircleInput>();
+
+  luci::dtype_inferred(g.input, true);
+  luci::dtype_inferred(g.relu, true);
+  luci::dtype_inferred(input2, true);
+
+  g.relu->features(input2);
+  ASSERT_TRUE(luci::dtype_dirty(g.relu));
+}
+
+TEST(LuciPassHelpersInferenceCache, invalidate)
+{
+  ReluGraph g;
+
+  luci::shape_inferred(g.input, true);
+  luci::shape_inferred(g.relu, true);
+  luci::dtype_inferred(g.input, true);
+  luci::dtype_inferred(g.relu, true);
+
+  luci::invalidate_inference(g.input);
+  ASSERT_TRUE(luci::shape_dirty(g.input));
+  ASSERT_TRUE(luci::dtype_dirty(g.input));
+
+  // Users are re-inferred after the node is
+  luci::shape_inferred(g.input, false);
+  ASSERT_TRUE(luci::shape_dirty(g.relu));
+}
+
+TEST(LuciPassHelpersInferenceCache, output_always_dirty)
+{
+  ReluGraph g;
+
+  luci::shape_inferred(g.relu, true);
+  luci::shape_inferred(g.output, false);
+
+  ASSERT_TRUE(luci::shape_dirty(g.output));
+}
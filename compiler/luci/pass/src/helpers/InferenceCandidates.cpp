@@ -18,17 +18,20 @@
 
 #include <luci/IR/DeadNodeQueryService.h>
 
+#include <unordered_set>
+
 namespace luci
 {
 
 std::vector<loco::Node *> inference_candidates(loco::Graph *g)
 {
   auto candidates = loco::postorder_traversal(loco::output_nodes(g));
+  std::unordered_set<loco::Node *> visited(candidates.begin(), candidates.end());
 
   for (auto node : loco::all_nodes(g))
   {
     // already included as candidate
-    if (std::find(candidates.begin(), candidates.end(), node) != candidates.end())
+    if (visited.find(node) != visited.end())
       continue;
 
     // As the node is not used for both graph output and multiple output operation,
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelFor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+using ChunkFn = std::function<void(uint32_t begin, uint32_t end)>;
+
+/**
+ * @brief Chunks of a parallel_for call, which the calling thread and workers take in turn
+ */
+class Job final
+{
+public:
+  Job(uint32_t size, uint32_t chunk, const ChunkFn &fn)
+    : _size(size), _chunk(chunk), _num_chunks((size + chunk - 1) / chunk), _fn(fn)
+  {
+  }
+
+public:
+  uint32_t num_chunks(void) const { return _num_chunks; }
+
+  // Run a chunk which is not taken yet, and return false if there is none
+  bool run_one(void)
+  {
+    const uint32_t n = _next++;
+    if (n >= _num_chunks)
+      return false;
+
+    const uint32_t begin = n * _chunk;
+    _fn(begin, std::min(_size, begin + _chunk));
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (++_done == _num_chunks)
+      _cv.notify_all();
+    return true;
+  }
+
+  void wait(void)
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] { return _done == _num_chunks; });
+  }
+
+private:
+  const uint32_t _size;
+  const uint32_t _chunk;
+  const uint32_t _num_chunks;
+  // Valid until all chunks are done, as the calling thread waits for them
+  const ChunkFn &_fn;
+
+  std::atomic<uint32_t> _next{0};
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  uint32_t _done = 0;
+};
+
+/**
+ * @brief Worker threads shared by all parallel_for calls
+ */
+class WorkerPool final
+{
+public:
+  static WorkerPool &get(void)
+  {
+    static WorkerPool pool;
+    return pool;
+  }
+
+private:
+  WorkerPool()
+  {
+    // The calling thread of parallel_for takes chunks as well
+    const uint32_t num_workers = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+    for (uint32_t i = 0; i < num_workers; ++i)
+      _workers.emplace_back([this] { work(); });
+  }
+
+  ~WorkerPool()
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _cv.notify_all();
+
+    for (auto &worker : _workers)
+      worker.join();
+  }
+
+public:
+  uint32_t num_workers(void) const { return _workers.size(); }
+
+  // Let 'count' workers take chunks of the job
+  void help(const std::shared_ptr<Job> &job, uint32_t count)
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for (uint32_t i = 0; i < count; ++i)
+        _jobs.push_back(job);
+    }
+    _cv.notify_all();
+  }
+
+private:
+  void work(void)
+  {
+    while (true)
+    {
+      std::shared_ptr<Job> job;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _stop || !_jobs.empty(); });
+        if (_jobs.empty())
+          return;
+
+        job = std::move(_jobs.front());
+        _jobs.pop_front();
+      }
+
+      while (job->run_one())
+        ;
+    }
+  }
+
+private:
+  std::vector<std::thread> _workers;
+  std::deque<std::shared_ptr<Job>> _jobs;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _stop = false;
+};
+
+} // namespace
+
+namespace luci
+{
+
+void parallel_for(uint32_t size, uint32_t grain, const ChunkFn &fn)
+{
+  if (size == 0)
+    return;
+
+  grain = std::max(grain, 1u);
+
+  auto &pool = WorkerPool::get();
+  const uint32_t num_chunks = std::min(pool.num_workers() + 1, (size + grain - 1) / grain);
+  if (num_chunks <= 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  auto job = std::make_shared<Job>(size, (size + num_chunks - 1) / num_chunks, fn);
+  pool.help(job, job->num_chunks() - 1);
+
+  // The calling thread takes chunks too, so that nested calls do not wait for busy workers
+  while (job->run_one())
+    ;
+  job->wait();
+}
+
+} // namespace luci
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_PARALLEL_FOR_H__
+#define __LUCI_PARALLEL_FOR_H__
+
+#include <cstdint>
+#include <functional>
+
+namespace luci
+{
+
+/**
+ * @brief Call fn(begin, end) for the chunks of [0, size) on multiple threads
+ *
+ * @note  Each chunk has at least 'grain' elements except the last one, so that small workloads
+ *        run on the calling thread only. There are at most as many chunks as hardware threads,
+ *        which the calling thread and a pool of worker threads shared by all calls run.
+ *        fn SHOULD NOT throw.
+ */
+void parallel_for(uint32_t size, uint32_t grain,
+                  const std::function<void(uint32_t begin, uint32_t end)> &fn);
+
+} // namespace luci
+
+#endif // __LUCI_PARALLEL_FOR_H__
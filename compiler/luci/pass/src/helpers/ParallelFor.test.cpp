@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ParallelFor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(LuciPassHelpersParallelFor, cover_all)
+{
+  const uint32_t size = 100000;
+  std::vector<uint8_t> visited(size, 0);
+
+  luci::parallel_for(size, 100, [&](uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; ++i)
+      visited[i]++;
+  });
+
+  for (uint32_t i = 0; i < size; ++i)
+    ASSERT_EQ(1, visited[i]);
+}
+
+TEST(LuciPassHelpersParallelFor, chunks_per_thread)
+{
+  const uint32_t max_chunks = std::max(std::thread::hardware_concurrency(), 1u);
+  std::atomic<uint32_t> calls{0};
+
+  luci::parallel_for(100000, 1, [&](uint32_t, uint32_t) { calls++; });
+
+  ASSERT_LE(calls, max_chunks);
+}
+
+TEST(LuciPassHelpersParallelFor, nested)
+{
+  const uint32_t size = 1000;
+  std::vector<std::atomic<uint32_t>> visited(size * size);
+
+  luci::parallel_for(size, 1, [&](uint32_t begin, uint32_t end) {
+    for (uint32_t i = begin; i < end; ++i)
+    {
+      luci::parallel_for(size, 1, [&](uint32_t inner_begin, uint32_t inner_end) {
+        for (uint32_t j = inner_begin; j < inner_end; ++j)
+          visited[i * size + j]++;
+      });
+    }
+  });
+
+  for (uint32_t i = 0; i < size * size; ++i)
+    ASSERT_EQ(1, visited[i]);
+}
+
+TEST(LuciPassHelpersParallelFor, small_size)
+{
+  std::atomic<uint32_t> calls{0};
+
+  luci::parallel_for(10, 100, [&](uint32_t begin, uint32_t end) {
+    ASSERT_EQ(0, begin);
+    ASSERT_EQ(10, end);
+    calls++;
+  });
+
+  ASSERT_EQ(1, calls);
+}
+
+TEST(LuciPassHelpersParallelFor, zero_size_NEG)
+{
+  bool called = false;
+
+  luci::parallel_for(0, 100, [&](uint32_t, uint32_t) { called = true; });
+
+  ASSERT_FALSE(called);
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_BENCHMARK_BENCHMARK_H__
+#define __NNFW_CKER_BENCHMARK_BENCHMARK_H__
+
+#include <cker/Shape.h>
+
+#include <benchmark/benchmark.h>
+#include <ruy/context.h>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cker_benchmark
+{
+
+/**
+ * @brief Thread counts given to kernels taking ruy::Context
+ */
+const std::vector<int64_t> kThreadCounts = {1, 2, 4};
+
+/**
+ * @brief Register cases [0, N) of a benchmark
+ *
+ * Every case has two arguments, "case" for the index of the shape and "threads". Kernels which do
+ * not take ruy::Context run with threads=1 only so that the names stay comparable. Threaded cases
+ * are timed in wall clock as CPU time only counts the calling thread.
+ */
+template <int N, bool threaded> void Cases(::benchmark::internal::Benchmark *b)
+{
+  b->ArgNames({"case", "threads"});
+  if (threaded)
+    b->UseRealTime();
+  for (int i = 0; i < N; ++i)
+  {
+    if (threaded)
+    {
+      for (auto threads : kThreadCounts)
+        b->Args({i, threads});
+    }
+    else
+    {
+      b->Args({i, 1});
+    }
+  }
+}
+
+template <int N> void SerialCases(::benchmark::internal::Benchmark *b) { Cases<N, false>(b); }
+template <int N> void ThreadedCases(::benchmark::internal::Benchmark *b) { Cases<N, true>(b); }
+
+inline int CaseIndex(const ::benchmark::State &state) { return static_cast<int>(state.range(0)); }
+
+/**
+ * @brief Create ruy::Context with the "threads" argument of a case
+ */
+inline std::unique_ptr<ruy::Context> MakeRuyContext(const ::benchmark::State &state)
+{
+  std::unique_ptr<ruy::Context> ruy_context = std::make_unique<ruy::Context>();
+  ruy_context->set_max_num_threads(static_cast<int>(state.range(1)));
+  return ruy_context;
+}
+
+/**
+ * @brief Fill a vector with reproducible random values
+ *
+ * Floats are in [-1, 1], and integers cover the whole range of 8-bit types and [-128, 127] for
+ * wider ones unless a range is given.
+ */
+template <typename T>
+std::vector<T> RandomVector(size_t size, T min_value, T max_value, uint32_t seed = 1)
+{
+  std::mt19937 generator(seed);
+  std::vector<T> vec(size);
+  using Distribution =
+    typename std::conditional<std::is_floating_point<T>::value, std::uniform_real_distribution<T>,
+                              std::uniform_int_distribution<int64_t>>::type;
+  Distribution distribution(min_value, max_value);
+  for (auto &value : vec)
+    value = static_cast<T>(distribution(generator));
+  return vec;
+}
+
+template <typename T> std::vector<T> RandomVector(size_t size, uint32_t seed = 1)
+{
+  if (std::is_floating_point<T>::value)
+    return RandomVector<T>(size, static_cast<T>(-1), static_cast<T>(1), seed);
+  if (sizeof(T) == 1)
+    return RandomVector<T>(size, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(),
+                           seed);
+  return RandomVector<T>(size, static_cast<T>(std::is_signed<T>::value ? -128 : 0),
+                         static_cast<T>(127), seed);
+}
+
+template <> inline std::vector<bool> RandomVector<bool>(size_t size, uint32_t seed)
+{
+  std::mt19937 generator(seed);
+  std::bernoulli_distribution distribution;
+  std::vector<bool> vec(size);
+  for (size_t i = 0; i < size; ++i)
+    vec[i] = distribution(generator);
+  return vec;
+}
+
+/**
+ * @brief Buffer of bool, which std::vector<bool> cannot give as a pointer
+ */
+inline std::unique_ptr<bool[]> RandomBoolBuffer(size_t size, uint32_t seed = 1)
+{
+  const auto values = RandomVector<bool>(size, seed);
+  std::unique_ptr<bool[]> buffer(new bool[size]);
+  for (size_t i = 0; i < size; ++i)
+    buffer[i] = values[i];
+  return buffer;
+}
+
+inline std::string ToString(const nnfw::cker::Shape &shape)
+{
+  std::string str;
+  for (int i = 0; i < shape.DimensionsCount(); ++i)
+  {
+    if (i > 0)
+      str += "x";
+    str += std::to_string(shape.Dims(i));
+  }
+  return str;
+}
+
+/**
+ * @brief Report the shape of a case and bytes moved per iteration
+ */
+inline void Report(::benchmark::State &state, const nnfw::cker::Shape &shape, int64_t bytes)
+{
+  state.SetLabel(ToString(shape));
+  state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+/**
+ * @brief Report the shape of a case and bytes and arithmetic operations per iteration
+ *
+ * FLOPs are reported as a rate counter named "FLOPS".
+ */
+inline void Report(::benchmark::State &state, const nnfw::cker::Shape &shape, int64_t bytes,
+                   int64_t flops)
+{
+  Report(state, shape, bytes);
+  state.counters["FLOPS"] = ::benchmark::Counter(static_cast<double>(flops),
+                                                 ::benchmark::Counter::kIsIterationInvariantRate);
+}
+
+} // namespace cker_benchmark
+
+#endif // __NNFW_CKER_BENCHMARK_BENCHMARK_H__
@@ -0,0 +1,324 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/AddN.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Comparison.h>
+#include <cker/operation/LogicalAnd.h>
+#include <cker/operation/LogicalOr.h>
+#include <cker/operation/MaxMin.h>
+#include <cker/operation/Pow.h>
+#include <cker/operation/Select.h>
+#include <cker/operation/SqDiff.h>
+
+#include <utility>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::BinaryArithmeticOpType;
+using nnfw::cker::Shape;
+
+const std::vector<Shape> kShapes = {{1, 112, 112, 32}, {1, 56, 56, 128}, {1, 7, 7, 1024}};
+constexpr int kNumShapes = 3;
+
+// Per-channel and per-pixel operands
+const std::vector<std::pair<Shape, Shape>> kBroadcastShapes = {
+  {{1, 56, 56, 128}, {1, 1, 1, 128}},
+  {{1, 56, 56, 128}, {1, 56, 56, 1}},
+  {{1, 7, 7, 1024}, {1, 1, 1, 1024}}};
+constexpr int kNumBroadcastShapes = 3;
+
+// Parameters of float
+template <typename T>
+void SetParams(nnfw::cker::BinaryArithmeticOpParam *params, BinaryArithmeticOpType)
+{
+  params->float_activation_min = std::numeric_limits<float>::lowest();
+  params->float_activation_max = std::numeric_limits<float>::max();
+}
+
+// Fixed point parameters of scales around 1, which is the usual case
+template <typename T>
+void SetQuantParams(nnfw::cker::BinaryArithmeticOpParam *params, BinaryArithmeticOpType op_type)
+{
+  params->input1_offset = -static_cast<int32_t>(std::numeric_limits<T>::max() / 2);
+  params->input2_offset = -static_cast<int32_t>(std::numeric_limits<T>::max() / 2);
+  params->output_offset = std::numeric_limits<T>::max() / 2;
+  params->quantized_activation_min = std::numeric_limits<T>::min();
+  params->quantized_activation_max = std::numeric_limits<T>::max();
+  if (op_type == BinaryArithmeticOpType::MUL)
+  {
+    params->output_multiplier = 1 << 30;
+    params->output_shift = -7;
+  }
+  else
+  {
+    params->left_shift = 20;
+    params->input1_multiplier = params->input2_multiplier = 1 << 30;
+    params->input1_shift = params->input2_shift = 0;
+    params->output_multiplier = 1 << 30;
+    params->output_shift = -19;
+  }
+}
+
+template <>
+void SetParams<uint8_t>(nnfw::cker::BinaryArithmeticOpParam *params, BinaryArithmeticOpType op_type)
+{
+  SetQuantParams<uint8_t>(params, op_type);
+}
+
+template <>
+void SetParams<int8_t>(nnfw::cker::BinaryArithmeticOpParam *params, BinaryArithmeticOpType op_type)
+{
+  SetQuantParams<int8_t>(params, op_type);
+}
+
+template <BinaryArithmeticOpType op_type, typename T>
+void BM_BinaryArithmetic(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input1 = RandomVector<T>(shape.FlatSize(), 1);
+  // Nonzero for Div
+  const auto input2 = std::is_floating_point<T>::value
+                        ? RandomVector<T>(shape.FlatSize(), static_cast<T>(1), static_cast<T>(2), 2)
+                        : RandomVector<T>(shape.FlatSize(), 2);
+  std::vector<T> output(shape.FlatSize());
+  nnfw::cker::BinaryArithmeticOpParam params;
+  SetParams<T>(&params, op_type);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::BinaryArithmeticOp<op_type>(params, shape, input1.data(), shape, input2.data(),
+                                            shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 3 * shape.FlatSize() * sizeof(T), shape.FlatSize());
+}
+
+template <BinaryArithmeticOpType op_type, typename T>
+void BM_BroadcastBinaryArithmetic(benchmark::State &state)
+{
+  const auto &shapes = kBroadcastShapes[CaseIndex(state)];
+  const auto &output_shape = shapes.first;
+  const auto input1 = RandomVector<T>(shapes.first.FlatSize(), 1);
+  const auto input2 = RandomVector<T>(shapes.second.FlatSize(), 2);
+  std::vector<T> output(output_shape.FlatSize());
+  nnfw::cker::BinaryArithmeticOpParam params;
+  SetParams<T>(&params, op_type);
+  nnfw::cker::ProcessBroadcastShapes(shapes.first, shapes.second, &params);
+  auto ruy_context = MakeRuyContext(state);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::BroadcastBinaryArithmeticOp<op_type>(params, shapes.first, input1.data(),
+                                                     shapes.second, input2.data(), output_shape,
+                                                     output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, output_shape,
+         (2 * output_shape.FlatSize() + shapes.second.FlatSize()) * sizeof(T),
+         output_shape.FlatSize());
+}
+
+void BM_Greater(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input1 = RandomVector<float>(shape.FlatSize(), 1);
+  const auto input2 = RandomVector<float>(shape.FlatSize(), 2);
+  std::unique_ptr<bool[]> output(new bool[shape.FlatSize()]);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Comparison<nnfw::cker::GreaterFn<float>>(shape, input1.data(), shape,
+                                                         input2.data(), shape, output.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * (2 * sizeof(float) + sizeof(bool)));
+}
+
+void BM_BroadcastGreater(benchmark::State &state)
+{
+  const auto &shapes = kBroadcastShapes[CaseIndex(state)];
+  const auto &output_shape = shapes.first;
+  const auto input1 = RandomVector<float>(shapes.first.FlatSize(), 1);
+  const auto input2 = RandomVector<float>(shapes.second.FlatSize(), 2);
+  std::unique_ptr<bool[]> output(new bool[output_shape.FlatSize()]);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::BroadcastComparison4DSlow<float, nnfw::cker::GreaterFn<float>>(
+      shapes.first, input1.data(), shapes.second, input2.data(), output_shape, output.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, output_shape, output_shape.FlatSize() * (sizeof(float) + sizeof(bool)));
+}
+
+void BM_Maximum(benchmark::State &state)
+{
+  const auto &shapes = kBroadcastShapes[CaseIndex(state)];
+  const auto &output_shape = shapes.first;
+  const auto input1 = RandomVector<float>(shapes.first.FlatSize(), 1);
+  const auto input2 = RandomVector<float>(shapes.second.FlatSize(), 2);
+  std::vector<float> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Max<float>(shapes.first, input1.data(), shapes.second, input2.data(),
+                           output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, output_shape, 2 * output_shape.FlatSize() * sizeof(float));
+}
+
+void BM_SquaredDifference(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input1 = RandomVector<float>(shape.FlatSize(), 1);
+  const auto input2 = RandomVector<float>(shape.FlatSize(), 2);
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::SqDiff<float>(shape, input1.data(), shape, input2.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 3 * shape.FlatSize() * sizeof(float), 2 * shape.FlatSize());
+}
+
+void BM_Pow(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input1 = RandomVector<float>(shape.FlatSize(), 0.1f, 2.f, 1);
+  const auto input2 = RandomVector<float>(shape.FlatSize(), 2);
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::powImpl<float>(shape, input1.data(), shape, input2.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 3 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_LogicalAnd(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input1 = RandomBoolBuffer(shape.FlatSize(), 1);
+  const auto input2 = RandomBoolBuffer(shape.FlatSize(), 2);
+  std::unique_ptr<bool[]> output(new bool[shape.FlatSize()]);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::LogicalAndElementwise<bool>(shape, input1.get(), input2.get(), output.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 3 * shape.FlatSize() * sizeof(bool));
+}
+
+void BM_BroadcastLogicalOr(benchmark::State &state)
+{
+  const auto &shapes = kBroadcastShapes[CaseIndex(state)];
+  const auto &output_shape = shapes.first;
+  const auto input1 = RandomBoolBuffer(shapes.first.FlatSize(), 1);
+  const auto input2 = RandomBoolBuffer(shapes.second.FlatSize(), 2);
+  std::unique_ptr<bool[]> output(new bool[output_shape.FlatSize()]);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::LogicalOrBroadcast<bool>(shapes.first, input1.get(), shapes.second, input2.get(),
+                                         output_shape, output.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, output_shape, 2 * output_shape.FlatSize() * sizeof(bool));
+}
+
+void BM_AddN(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  constexpr size_t num_inputs = 4;
+  std::vector<std::vector<float>> inputs;
+  std::vector<const float *> input_data;
+  for (size_t i = 0; i < num_inputs; ++i)
+  {
+    inputs.emplace_back(RandomVector<float>(shape.FlatSize(), i + 1));
+    input_data.emplace_back(inputs.back().data());
+  }
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::AddN<float>(shape, num_inputs, input_data.data(), output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, (num_inputs + 1) * shape.FlatSize() * sizeof(float),
+         (num_inputs - 1) * shape.FlatSize());
+}
+
+void BM_Select(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto condition = RandomBoolBuffer(shape.FlatSize());
+  const auto input_x = RandomVector<float>(shape.FlatSize(), 1);
+  const auto input_y = RandomVector<float>(shape.FlatSize(), 2);
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Select<bool, float>(shape, condition.get(), shape, input_x.data(), shape,
+                                    input_y.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * (3 * sizeof(float) + sizeof(bool)));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_BinaryArithmetic, BinaryArithmeticOpType::ADD, float)
+  ->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_BinaryArithmetic, BinaryArithmeticOpType::SUB, float)
+  ->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_BinaryArithmetic, BinaryArithmeticOpType::MUL, float)
+  ->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_BinaryArithmetic, BinaryArithmeticOpType::DIV, float)
+  ->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_BinaryArithmetic, BinaryArithmeticOpType::ADD, uint8_t)
+  ->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_BinaryArithmetic, BinaryArithmeticOpType::MUL, uint8_t)
+  ->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_BinaryArithmetic, BinaryArithmeticOpType::ADD, int8_t)
+  ->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_BinaryArithmetic, BinaryArithmeticOpType::MUL, int8_t)
+  ->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_BroadcastBinaryArithmetic, BinaryArithmeticOpType::ADD, float)
+  ->Apply(ThreadedCases<kNumBroadcastShapes>);
+BENCHMARK_TEMPLATE(BM_BroadcastBinaryArithmetic, BinaryArithmeticOpType::MUL, float)
+  ->Apply(ThreadedCases<kNumBroadcastShapes>);
+BENCHMARK_TEMPLATE(BM_BroadcastBinaryArithmetic, BinaryArithmeticOpType::ADD, uint8_t)
+  ->Apply(ThreadedCases<kNumBroadcastShapes>);
+BENCHMARK_TEMPLATE(BM_BroadcastBinaryArithmetic, BinaryArithmeticOpType::MUL, int8_t)
+  ->Apply(ThreadedCases<kNumBroadcastShapes>);
+BENCHMARK(BM_Greater)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_BroadcastGreater)->Apply(SerialCases<kNumBroadcastShapes>);
+BENCHMARK(BM_Maximum)->Apply(SerialCases<kNumBroadcastShapes>);
+BENCHMARK(BM_SquaredDifference)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_Pow)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_LogicalAnd)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_BroadcastLogicalOr)->Apply(SerialCases<kNumBroadcastShapes>);
+BENCHMARK(BM_AddN)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_Select)->Apply(SerialCases<kNumShapes>);
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/Conv.h>
+#include <cker/operation/DepthwiseConv.h>
+#include <cker/operation/TransposeConv.h>
+
+#include <algorithm>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+struct ConvCase
+{
+  Shape input;  // NHWC
+  Shape filter; // OHWI, or 1HWO for depthwise
+  int stride;
+};
+
+// 3x3 in the middle of a network, pointwise and a strided one
+const std::vector<ConvCase> kConvCases = {{{1, 56, 56, 64}, {64, 3, 3, 64}, 1},
+                                          {{1, 28, 28, 128}, {256, 1, 1, 128}, 1},
+                                          {{1, 14, 14, 256}, {512, 3, 3, 256}, 2}};
+constexpr int kNumConvCases = 3;
+
+const std::vector<ConvCase> kDepthwiseConvCases = {{{1, 112, 112, 32}, {1, 3, 3, 32}, 1},
+                                                   {{1, 56, 56, 128}, {1, 3, 3, 128}, 2},
+                                                   {{1, 14, 14, 512}, {1, 3, 3, 512}, 1}};
+constexpr int kNumDepthwiseConvCases = 3;
+
+// 3x3 of stride 1 in stages of a backbone
+const std::vector<ConvCase> kWinogradConvCases = {{{1, 56, 56, 64}, {64, 3, 3, 64}, 1},
+                                                  {{1, 28, 28, 128}, {128, 3, 3, 128}, 1},
+                                                  {{1, 14, 14, 256}, {256, 3, 3, 256}, 1}};
+constexpr int kNumWinogradConvCases = 3;
+
+// Upsampling by 2 as in decoders
+const std::vector<ConvCase> kTransposeConvCases = {{{1, 14, 14, 128}, {64, 3, 3, 128}, 2},
+                                                   {{1, 28, 28, 64}, {32, 3, 3, 64}, 2}};
+constexpr int kNumTransposeConvCases = 2;
+
+// SAME padding
+int PadBefore(int input_size, int filter_size, int stride, int output_size)
+{
+  return std::max(0, ((output_size - 1) * stride + filter_size - input_size) / 2);
+}
+
+Shape ConvOutputShape(const ConvCase &c, int output_depth)
+{
+  return Shape{c.input.Dims(0), (c.input.Dims(1) + c.stride - 1) / c.stride,
+               (c.input.Dims(2) + c.stride - 1) / c.stride, output_depth};
+}
+
+template <typename Params> void SetCommonParams(const ConvCase &c, const Shape &output, Params *p)
+{
+  p->padding_type = nnfw::cker::PaddingType::kSame;
+  p->padding_values.height =
+    PadBefore(c.input.Dims(1), c.filter.Dims(1), c.stride, output.Dims(1));
+  p->padding_values.width = PadBefore(c.input.Dims(2), c.filter.Dims(2), c.stride, output.Dims(2));
+  p->stride_height = p->stride_width = c.stride;
+  p->dilation_height_factor = p->dilation_width_factor = 1;
+  p->float_activation_min = std::numeric_limits<float>::lowest();
+  p->float_activation_max = std::numeric_limits<float>::max();
+}
+
+template <typename T, typename Params> void SetQuantParams(Params *p)
+{
+  p->input_offset = -static_cast<int32_t>(std::numeric_limits<T>::max() / 2);
+  p->weights_offset = std::is_signed<T>::value ? 0 : -128;
+  p->output_offset = std::numeric_limits<T>::max() / 2;
+  p->output_multiplier = 1 << 30;
+  p->output_shift = -8;
+  p->quantized_activation_min = std::numeric_limits<T>::min();
+  p->quantized_activation_max = std::numeric_limits<T>::max();
+}
+
+// Float kernels take no quantization parameters
+template <> void SetQuantParams<float>(nnfw::cker::DepthwiseConvParams *) {}
+
+// Multithreaded float Conv runs on the Eigen thread pool, which is not controlled by "threads"
+void BM_ConvFloat(benchmark::State &state)
+{
+  const auto &c = kConvCases[CaseIndex(state)];
+  const auto output_shape = ConvOutputShape(c, c.filter.Dims(0));
+  const Shape bias_shape{c.filter.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<float>(c.filter.FlatSize(), 2);
+  const auto bias = RandomVector<float>(bias_shape.FlatSize(), 3);
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::ConvParams params;
+  SetCommonParams(c, output_shape, &params);
+  nnfw::cker::Conv conv;
+  bool is_replaced_weights = false;
+  conv.prepare(c.filter, filter.data(), params.padding_type, is_replaced_weights, 1, 1, c.stride,
+               c.stride, output_shape);
+
+  for (auto _ : state)
+  {
+    conv(params, c.input, input.data(), c.filter, filter.data(), bias_shape, bias.data(),
+         output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(0);
+  Report(state, c.input,
+         (c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         2 * macs);
+}
+
+// The Eigen path which Conv takes for these cases without Winograd
+void BM_ConvFloatEigen(benchmark::State &state)
+{
+  const auto &c = kWinogradConvCases[CaseIndex(state)];
+  const auto output_shape = ConvOutputShape(c, c.filter.Dims(0));
+  const Shape bias_shape{c.filter.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<float>(c.filter.FlatSize(), 2);
+  const auto bias = RandomVector<float>(bias_shape.FlatSize(), 3);
+  std::vector<float> output(output_shape.FlatSize());
+
+  // [out_ch, kh * kw * in_ch] to [kh * kw * in_ch, out_ch] as Conv::prepare() does
+  const int output_depth = c.filter.Dims(0);
+  const int patch_size = c.filter.FlatSize() / output_depth;
+  std::vector<float> transposed_filter(filter.size());
+  for (int o = 0; o < output_depth; ++o)
+  {
+    for (int i = 0; i < patch_size; ++i)
+      transposed_filter[i * output_depth + o] = filter[o * patch_size + i];
+  }
+
+  nnfw::cker::ConvParams params;
+  SetCommonParams(c, output_shape, &params);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::multithreaded::Conv(params, c.input, input.data(), c.filter,
+                                    transposed_filter.data(), bias_shape, bias.data(),
+                                    output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(0);
+  Report(state, c.input,
+         (c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         2 * macs);
+}
+
+// FLOPS are of the direct convolution, so that they compare with BM_ConvFloatEigen
+template <int output_tile> void BM_ConvFloatWinograd(benchmark::State &state)
+{
+  const auto &c = kWinogradConvCases[CaseIndex(state)];
+  const auto output_shape = ConvOutputShape(c, c.filter.Dims(0));
+  const Shape bias_shape{c.filter.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<float>(c.filter.FlatSize(), 2);
+  const auto bias = RandomVector<float>(bias_shape.FlatSize(), 3);
+  std::vector<float> output(output_shape.FlatSize());
+
+  std::vector<float> transformed_filter(
+    nnfw::cker::optimized::WinogradFilterSize(output_tile, c.filter));
+  nnfw::cker::optimized::TransformWinogradFilter(output_tile, c.filter, filter.data(),
+                                                 transformed_filter.data());
+
+  nnfw::cker::ConvParams params;
+  SetCommonParams(c, output_shape, &params);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::optimized::WinogradConv(params, output_tile, c.input, input.data(), c.filter,
+                                        transformed_filter.data(), bias_shape, bias.data(),
+                                        output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(0);
+  Report(state, c.input,
+         (c.input.FlatSize() + transformed_filter.size() + output_shape.FlatSize()) *
+           sizeof(float),
+         2 * macs);
+}
+
+// Filter kept as float16 by CPU_WEIGHT_STORAGE, which is expanded in each run
+void BM_ConvFloatHalfFilter(benchmark::State &state)
+{
+  const auto &c = kConvCases[CaseIndex(state)];
+  const auto output_shape = ConvOutputShape(c, c.filter.Dims(0));
+  const Shape bias_shape{c.filter.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<float>(c.filter.FlatSize(), 2);
+  const auto bias = RandomVector<float>(bias_shape.FlatSize(), 3);
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::ConvParams params;
+  SetCommonParams(c, output_shape, &params);
+  nnfw::cker::Conv conv;
+  conv.prepareHalf(c.filter, filter.data(), nnfw::cker::HalfType::kFloat16, params.padding_type,
+                   1, 1);
+
+  for (auto _ : state)
+  {
+    conv(params, c.input, input.data(), c.filter, nullptr, bias_shape, bias.data(), output_shape,
+         output.data());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(0);
+  Report(state, c.input,
+         (c.input.FlatSize() + output_shape.FlatSize()) * sizeof(float) +
+           c.filter.FlatSize() * sizeof(uint16_t),
+         2 * macs);
+}
+
+void BM_ConvUint8(benchmark::State &state)
+{
+  const auto &c = kConvCases[CaseIndex(state)];
+  const auto output_shape = ConvOutputShape(c, c.filter.Dims(0));
+  const Shape bias_shape{c.filter.Dims(0)};
+  const auto input = RandomVector<uint8_t>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<uint8_t>(c.filter.FlatSize(), 2);
+  const auto bias = RandomVector<int32_t>(bias_shape.FlatSize(), 3);
+  std::vector<uint8_t> output(output_shape.FlatSize());
+
+  nnfw::cker::ConvParams params;
+  SetCommonParams(c, output_shape, &params);
+  SetQuantParams<uint8_t>(&params);
+  params.is_replaced_weights = true;
+  nnfw::cker::Conv conv;
+  conv.prepareQuant(c.input, c.filter, output_shape, c.stride, c.stride, 1, 1);
+
+  for (auto _ : state)
+  {
+    conv(params, c.input, input.data(), c.filter, filter.data(), bias_shape, bias.data(),
+         output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(0);
+  Report(state, c.input, c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize(),
+         2 * macs);
+}
+
+void BM_ConvInt8PerChannel(benchmark::State &state)
+{
+  const auto &c = kConvCases[CaseIndex(state)];
+  const auto output_shape = ConvOutputShape(c, c.filter.Dims(0));
+  const Shape bias_shape{c.filter.Dims(0)};
+  const auto input = RandomVector<int8_t>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<int8_t>(c.filter.FlatSize(), 2);
+  const auto bias = RandomVector<int32_t>(bias_shape.FlatSize(), 3);
+  std::vector<int8_t> output(output_shape.FlatSize());
+
+  nnfw::cker::ConvParams params;
+  SetCommonParams(c, output_shape, &params);
+  SetQuantParams<int8_t>(&params);
+  nnfw::cker::Conv conv;
+  conv.per_channel_output_multiplier().assign(c.filter.Dims(0), 1 << 30);
+  conv.per_channel_output_shift().assign(c.filter.Dims(0), -8);
+
+  for (auto _ : state)
+  {
+    conv(params, c.input, input.data(), c.filter, filter.data(), bias_shape, bias.data(),
+         output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(0);
+  Report(state, c.input, c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize(),
+         2 * macs);
+}
+
+template <typename T, typename TS> void BM_DepthwiseConv(benchmark::State &state)
+{
+  const auto &c = kDepthwiseConvCases[CaseIndex(state)];
+  const auto output_shape = ConvOutputShape(c, c.filter.Dims(3));
+  const Shape bias_shape{c.filter.Dims(3)};
+  const auto input = RandomVector<T>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<T>(c.filter.FlatSize(), 2);
+  const auto bias = RandomVector<TS>(bias_shape.FlatSize(), 3);
+  std::vector<T> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+
+  nnfw::cker::DepthwiseConvParams params;
+  SetCommonParams(c, output_shape, &params);
+  params.depth_multiplier = 1;
+  SetQuantParams<T>(&params);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::DepthwiseConv<T, TS>(params, c.input, input.data(), c.filter, filter.data(),
+                                     bias_shape, bias.data(), output_shape, output.data(),
+                                     ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) * c.filter.Dims(1) *
+                       c.filter.Dims(2);
+  Report(state, c.input,
+         (c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize()) * sizeof(T),
+         2 * macs);
+}
+
+void BM_DepthwiseConvInt8PerChannel(benchmark::State &state)
+{
+  const auto &c = kDepthwiseConvCases[CaseIndex(state)];
+  const auto output_shape = ConvOutputShape(c, c.filter.Dims(3));
+  const Shape bias_shape{c.filter.Dims(3)};
+  const auto input = RandomVector<int8_t>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<int8_t>(c.filter.FlatSize(), 2);
+  const auto bias = RandomVector<int32_t>(bias_shape.FlatSize(), 3);
+  std::vector<int8_t> output(output_shape.FlatSize());
+  const std::vector<int32_t> output_multiplier(c.filter.Dims(3), 1 << 30);
+  const std::vector<int32_t> output_shift(c.filter.Dims(3), -8);
+  auto ruy_context = MakeRuyContext(state);
+
+  nnfw::cker::DepthwiseConvParams params;
+  SetCommonParams(c, output_shape, &params);
+  params.depth_multiplier = 1;
+  SetQuantParams<int8_t>(&params);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::optimized_integer_ops::DepthwiseConvPerChannel(
+      params, output_multiplier.data(), output_shift.data(), c.input, input.data(), c.filter,
+      filter.data(), bias_shape, bias.data(), output_shape, output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(output_shape.FlatSize()) * c.filter.Dims(1) *
+                       c.filter.Dims(2);
+  Report(state, c.input, c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize(),
+         2 * macs);
+}
+
+void BM_TransposeConv(benchmark::State &state)
+{
+  const auto &c = kTransposeConvCases[CaseIndex(state)];
+  const Shape output_shape{c.input.Dims(0), c.input.Dims(1) * c.stride,
+                           c.input.Dims(2) * c.stride, c.filter.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<float>(c.filter.FlatSize(), 2);
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::TransposeConvParams params;
+  // Padding of the equivalent convolution from output to input
+  SetCommonParams(ConvCase{output_shape, c.filter, c.stride}, c.input, &params);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::TransposeConv(params, c.input, input.data(), c.filter, filter.data(),
+                              output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(c.input.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(3);
+  Report(state, c.input,
+         (c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         2 * macs);
+}
+
+// GEMM + col2im against the scatter loop of BM_TransposeConv, with the filter reordered once
+void BM_TransposeConvGemmFloat(benchmark::State &state)
+{
+  const auto &c = kTransposeConvCases[CaseIndex(state)];
+  const Shape output_shape{c.input.Dims(0), c.input.Dims(1) * c.stride,
+                           c.input.Dims(2) * c.stride, c.filter.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<float>(c.filter.FlatSize(), 2);
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::TransposeConvParams params;
+  SetCommonParams(ConvCase{output_shape, c.filter, c.stride}, c.input, &params);
+  nnfw::cker::TransposeConvGemm transpose_conv;
+  transpose_conv.prepare(c.filter, filter.data());
+
+  for (auto _ : state)
+  {
+    transpose_conv(params, c.input, input.data(), c.filter, filter.data(), output_shape,
+                   output.data());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(c.input.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(3);
+  Report(state, c.input,
+         (c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         2 * macs);
+}
+
+template <typename T> void BM_TransposeConvGemmQuant(benchmark::State &state)
+{
+  const auto &c = kTransposeConvCases[CaseIndex(state)];
+  const Shape output_shape{c.input.Dims(0), c.input.Dims(1) * c.stride,
+                           c.input.Dims(2) * c.stride, c.filter.Dims(0)};
+  const auto input = RandomVector<T>(c.input.FlatSize(), 1);
+  const auto filter = RandomVector<T>(c.filter.FlatSize(), 2);
+  std::vector<T> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+
+  nnfw::cker::TransposeConvParams params;
+  SetCommonParams(ConvCase{output_shape, c.filter, c.stride}, c.input, &params);
+  SetQuantParams<T>(&params);
+  nnfw::cker::TransposeConvGemm transpose_conv;
+  transpose_conv.prepare(c.filter, filter.data());
+  // Used by int8 only
+  transpose_conv.per_channel_output_multiplier().assign(c.filter.Dims(0), 1 << 30);
+  transpose_conv.per_channel_output_shift().assign(c.filter.Dims(0), -8);
+
+  for (auto _ : state)
+  {
+    transpose_conv(params, c.input, input.data(), c.filter, filter.data(), output_shape,
+                   output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  const int64_t macs = static_cast<int64_t>(c.input.FlatSize()) * c.filter.FlatSize() /
+                       c.filter.Dims(3);
+  Report(state, c.input, c.input.FlatSize() + c.filter.FlatSize() + output_shape.FlatSize(),
+         2 * macs);
+}
+
+} // namespace
+
+BENCHMARK(BM_ConvFloat)->Apply(SerialCases<kNumConvCases>);
+BENCHMARK(BM_ConvFloatEigen)->Apply(SerialCases<kNumWinogradConvCases>);
+BENCHMARK_TEMPLATE(BM_ConvFloatWinograd, 2)->Apply(SerialCases<kNumWinogradConvCases>);
+BENCHMARK_TEMPLATE(BM_ConvFloatWinograd, 4)->Apply(SerialCases<kNumWinogradConvCases>);
+BENCHMARK(BM_ConvFloatHalfFilter)->Apply(SerialCases<kNumConvCases>);
+BENCHMARK(BM_ConvUint8)->Apply(SerialCases<kNumConvCases>);
+BENCHMARK(BM_ConvInt8PerChannel)->Apply(SerialCases<kNumConvCases>);
+BENCHMARK_TEMPLATE(BM_DepthwiseConv, float, float)->Apply(ThreadedCases<kNumDepthwiseConvCases>);
+BENCHMARK_TEMPLATE(BM_DepthwiseConv, uint8_t, int32_t)
+  ->Apply(ThreadedCases<kNumDepthwiseConvCases>);
+BENCHMARK(BM_DepthwiseConvInt8PerChannel)->Apply(ThreadedCases<kNumDepthwiseConvCases>);
+BENCHMARK(BM_TransposeConv)->Apply(SerialCases<kNumTransposeConvCases>);
+BENCHMARK(BM_TransposeConvGemmFloat)->Apply(SerialCases<kNumTransposeConvCases>);
+BENCHMARK_TEMPLATE(BM_TransposeConvGemmQuant, uint8_t)
+  ->Apply(ThreadedCases<kNumTransposeConvCases>);
+BENCHMARK_TEMPLATE(BM_TransposeConvGemmQuant, int8_t)->Apply(ThreadedCases<kNumTransposeConvCases>);
@@ -0,0 +1,543 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/BatchToSpaceND.h>
+#include <cker/operation/BroadcastTo.h>
+#include <cker/operation/Concatenation.h>
+#include <cker/operation/DepthToSpace.h>
+#include <cker/operation/EmbeddingLookup.h>
+#include <cker/operation/Gather.h>
+#include <cker/operation/Pack.h>
+#include <cker/operation/Pad.h>
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/Reverse.h>
+#include <cker/operation/Slice.h>
+#include <cker/operation/SpaceToBatchND.h>
+#include <cker/operation/SpaceToDepth.h>
+#include <cker/operation/Split.h>
+#include <cker/operation/SplitV.h>
+#include <cker/operation/StridedSlice.h>
+#include <cker/operation/Tile.h>
+#include <cker/operation/Transpose.h>
+#include <cker/operation/Unpack.h>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+// Depths are multiples of 4 for DepthToSpace
+const std::vector<Shape> kShapes = {{1, 112, 112, 32}, {1, 56, 56, 128}, {1, 7, 7, 1024}};
+constexpr int kNumShapes = 3;
+
+// NHWC to NCHW
+void BM_Transpose(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape output_shape{shape.Dims(0), shape.Dims(3), shape.Dims(1), shape.Dims(2)};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::TransposeParams params;
+  params.perm_count = 4;
+  params.perm[0] = 0;
+  params.perm[1] = 3;
+  params.perm[2] = 1;
+  params.perm[3] = 2;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Transpose(params, shape, input.data(), output_shape, output.data(),
+                          ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_Pad(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const std::vector<int32_t> paddings{0, 0, 1, 1, 1, 1, 0, 0};
+  const Shape output_shape{shape.Dims(0), shape.Dims(1) + 2, shape.Dims(2) + 2, shape.Dims(3)};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+  const float constant = 0.f;
+  auto ruy_context = MakeRuyContext(state);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Pad(paddings.data(), 4, shape, input.data(), output_shape, output.data(),
+                    &constant, ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, (shape.FlatSize() + output_shape.FlatSize()) * sizeof(float));
+}
+
+// Two inputs on the depth axis
+void BM_Concatenation(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape output_shape{shape.Dims(0), shape.Dims(1), shape.Dims(2), 2 * shape.Dims(3)};
+  const auto input0 = RandomVector<float>(shape.FlatSize(), 1);
+  const auto input1 = RandomVector<float>(shape.FlatSize(), 2);
+  std::vector<float> output(output_shape.FlatSize());
+  const Shape *input_shapes[] = {&shape, &shape};
+  const float *input_data[] = {input0.data(), input1.data()};
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::ConcatenationParams params;
+  params.axis = 3;
+  params.inputs_count = 2;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Concatenation<float>(params, input_shapes, input_data, output_shape,
+                                     output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * output_shape.FlatSize() * sizeof(float));
+}
+
+// Rows of a [H * W, C] table in random order
+void BM_Gather(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const int32_t rows = shape.Dims(1) * shape.Dims(2);
+  const Shape table_shape{rows, shape.Dims(3)};
+  const Shape coords_shape{rows};
+  const auto table = RandomVector<float>(table_shape.FlatSize());
+  const auto coords = RandomVector<int32_t>(rows, 0, rows - 1);
+  std::vector<float> output(table_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::GatherParams params;
+  params.axis = 0;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Gather<float>(params, table_shape, table.data(), coords_shape, coords.data(),
+                              table_shape, output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * table_shape.FlatSize() * sizeof(float));
+}
+
+// Table kept as float16 by CPU_WEIGHT_STORAGE, whose rows are expanded to float output
+void BM_GatherHalfTable(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const int32_t rows = shape.Dims(1) * shape.Dims(2);
+  const Shape table_shape{rows, shape.Dims(3)};
+  const Shape coords_shape{rows};
+  const auto float_table = RandomVector<float>(table_shape.FlatSize());
+  std::vector<uint16_t> table(table_shape.FlatSize());
+  nnfw::cker::ConvertFloatToHalf(float_table.data(), table.size(), nnfw::cker::HalfType::kFloat16,
+                                 table.data());
+  const auto coords = RandomVector<int32_t>(rows, 0, rows - 1);
+  std::vector<float> output(table_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::GatherParams params;
+  params.axis = 0;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Gather(params, table_shape, table.data(), nnfw::cker::HalfType::kFloat16,
+                       coords_shape, coords.data(), table_shape, output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, table_shape.FlatSize() * (sizeof(uint16_t) + sizeof(float)));
+}
+
+// Lookups of a [rows, depth] embedding table, whose ids are skewed to repeat like real ids
+struct EmbeddingCase
+{
+  int32_t rows;
+  int32_t depth;
+  int32_t lookups;
+};
+const std::vector<EmbeddingCase> kEmbeddingCases = {{1 << 18, 64, 4096}, {1 << 16, 256, 1024}};
+constexpr int kNumEmbeddingCases = 2;
+
+// Batches of ids differ from each other, so that the table is not in cache as in a real model
+constexpr int kNumIdBatches = 16;
+
+std::vector<int32_t> SkewedIds(int32_t rows, int32_t count, uint32_t seed)
+{
+  auto ids = RandomVector<float>(count, 0.f, 1.f, seed);
+  std::vector<int32_t> result(count);
+  for (int32_t i = 0; i < count; ++i)
+    result[i] = std::min(rows - 1, static_cast<int32_t>(ids[i] * ids[i] * ids[i] * rows));
+  return result;
+}
+
+void BM_GatherEmbedding(benchmark::State &state)
+{
+  const auto &c = kEmbeddingCases[CaseIndex(state)];
+  const Shape table_shape{c.rows, c.depth};
+  const Shape coords_shape{c.lookups};
+  const Shape output_shape{c.lookups, c.depth};
+  const auto table = RandomVector<float>(table_shape.FlatSize());
+  std::vector<std::vector<int32_t>> ids;
+  for (int i = 0; i < kNumIdBatches; ++i)
+    ids.emplace_back(SkewedIds(c.rows, c.lookups, i + 1));
+  std::vector<float> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::GatherParams params;
+  params.axis = 0;
+
+  int batch = 0;
+  for (auto _ : state)
+  {
+    nnfw::cker::Gather<float>(params, table_shape, table.data(), coords_shape,
+                              ids[batch++ % kNumIdBatches].data(), output_shape, output.data(),
+                              ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, table_shape, 2 * output_shape.FlatSize() * sizeof(float));
+}
+
+void BM_EmbeddingLookup(benchmark::State &state)
+{
+  const auto &c = kEmbeddingCases[CaseIndex(state)];
+  const Shape table_shape{c.rows, c.depth};
+  const Shape output_shape{c.lookups, c.depth};
+  const auto table = RandomVector<float>(table_shape.FlatSize());
+  std::vector<std::vector<int32_t>> ids;
+  for (int i = 0; i < kNumIdBatches; ++i)
+    ids.emplace_back(SkewedIds(c.rows, c.lookups, i + 1));
+  std::vector<float> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::EmbeddingLookup embedding_lookup;
+
+  int batch = 0;
+  for (auto _ : state)
+  {
+    embedding_lookup(table_shape, table.data(), c.lookups, ids[batch++ % kNumIdBatches].data(),
+                     output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, table_shape, 2 * output_shape.FlatSize() * sizeof(float));
+}
+
+// Every other pixel
+void BM_StridedSlice(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape output_shape{shape.Dims(0), (shape.Dims(1) + 1) / 2, (shape.Dims(2) + 1) / 2,
+                           shape.Dims(3)};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::StridedSliceParams params;
+  params.start_indices_count = params.stop_indices_count = params.strides_count = 4;
+  params.begin_mask = params.end_mask = params.ellipsis_mask = 0;
+  params.new_axis_mask = params.shrink_axis_mask = 0;
+  for (int i = 0; i < 4; ++i)
+  {
+    params.start_indices[i] = 0;
+    params.stop_indices[i] = shape.Dims(i);
+    params.strides[i] = (i == 1 || i == 2) ? 2 : 1;
+  }
+
+  for (auto _ : state)
+  {
+    nnfw::cker::StridedSlice(params, shape, input.data(), output_shape, output.data(),
+                             ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, (shape.FlatSize() + output_shape.FlatSize()) * sizeof(float));
+}
+
+// Upscale by 2
+void BM_ResizeBilinear(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  nnfw::cker::ResizeBilinearParams params;
+  params.output_height = 2 * shape.Dims(1);
+  params.output_width = 2 * shape.Dims(2);
+  params.align_corners = false;
+  params.half_pixel_centers = true;
+  const Shape output_shape{shape.Dims(0), params.output_height, params.output_width,
+                           shape.Dims(3)};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::ResizeBilinear(params, shape, input.data(), output_shape, output.data(),
+                               ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, (shape.FlatSize() + output_shape.FlatSize()) * sizeof(float));
+}
+
+// Center crop of half the height and width
+void BM_Slice(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  nnfw::cker::SliceParams params;
+  params.begin_count = params.size_count = 4;
+  for (int i = 0; i < 4; ++i)
+  {
+    const bool spatial = (i == 1 || i == 2);
+    params.begin[i] = spatial ? shape.Dims(i) / 4 : 0;
+    params.size[i] = spatial ? shape.Dims(i) / 2 : shape.Dims(i);
+  }
+  const Shape output_shape{params.size[0], params.size[1], params.size[2], params.size[3]};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Slice(params, shape, input.data(), output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * output_shape.FlatSize() * sizeof(float));
+}
+
+// Two halves on the depth axis
+void BM_Split(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape output_shape{shape.Dims(0), shape.Dims(1), shape.Dims(2), shape.Dims(3) / 2};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output0(output_shape.FlatSize());
+  std::vector<float> output1(output_shape.FlatSize());
+  float *output_data[] = {output0.data(), output1.data()};
+  nnfw::cker::SplitParams params;
+  params.num_split = 2;
+  params.axis = 3;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Split(params, shape, input.data(), output_shape, output_data);
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+// Two inputs on a new outermost axis
+void BM_Pack(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape output_shape{2, shape.Dims(0), shape.Dims(1), shape.Dims(2), shape.Dims(3)};
+  const auto input0 = RandomVector<float>(shape.FlatSize(), 1);
+  const auto input1 = RandomVector<float>(shape.FlatSize(), 2);
+  std::vector<float> output(output_shape.FlatSize());
+  const float *input_data[] = {input0.data(), input1.data()};
+  nnfw::cker::PackParams params;
+  params.axis = 0;
+  params.inputs_count = 2;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Pack(params, input_data, output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * output_shape.FlatSize() * sizeof(float));
+}
+
+void BM_Reverse(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Reverse(2, shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_DepthToSpace(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape output_shape{shape.Dims(0), 2 * shape.Dims(1), 2 * shape.Dims(2),
+                           shape.Dims(3) / 4};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::DepthToSpace(shape, input.data(), output_shape, output.data(), 2);
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+// Inverse of BM_DepthToSpace, so that the output has the shape of a case
+void BM_SpaceToDepth(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape input_shape{shape.Dims(0), 2 * shape.Dims(1), 2 * shape.Dims(2), shape.Dims(3) / 4};
+  const auto input = RandomVector<float>(input_shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+  nnfw::cker::SpaceToDepthParams params;
+  params.block_size = 2;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::SpaceToDepth(params, input_shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+// Per-channel values to the whole shape
+void BM_BroadcastTo(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape input_shape{1, 1, 1, shape.Dims(3)};
+  auto input = RandomVector<float>(input_shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::BroadcastTo(input_shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * sizeof(float));
+}
+
+// Quarter and three quarters of the depth
+void BM_SplitV(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  std::vector<Shape> output_shapes = {
+    Shape{shape.Dims(0), shape.Dims(1), shape.Dims(2), shape.Dims(3) / 4},
+    Shape{shape.Dims(0), shape.Dims(1), shape.Dims(2), shape.Dims(3) * 3 / 4}};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output0(output_shapes[0].FlatSize());
+  std::vector<float> output1(output_shapes[1].FlatSize());
+  float *output_data[] = {output0.data(), output1.data()};
+  nnfw::cker::SplitVParams params;
+  params.num_split = 2;
+  params.axis = 3;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::SplitV(params, shape, input.data(), output_shapes, output_data);
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+// Inverse of BM_Pack
+void BM_Unpack(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape input_shape{2, shape.Dims(0), shape.Dims(1), shape.Dims(2), shape.Dims(3)};
+  const auto input = RandomVector<float>(input_shape.FlatSize());
+  std::vector<float> output0(shape.FlatSize());
+  std::vector<float> output1(shape.FlatSize());
+  float *output_data[] = {output0.data(), output1.data()};
+  nnfw::cker::UnpackParams params;
+  params.num_split = 2;
+  params.axis = 0;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Unpack(params, input_shape, input.data(), shape, output_data);
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * input_shape.FlatSize() * sizeof(float));
+}
+
+// Twice in height and width
+void BM_Tile(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const int32_t multipliers[] = {1, 2, 2, 1};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(4 * shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::TileOneDimension(shape, input.data(), multipliers, output.data(), 0);
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 5 * shape.FlatSize() * sizeof(float));
+}
+
+// 2x2 blocks with padding to even height and width
+void BM_SpaceToBatchND(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const int32_t block_shape[] = {2, 2};
+  const int32_t paddings[] = {0, shape.Dims(1) % 2, 0, shape.Dims(2) % 2};
+  const Shape output_shape{4 * shape.Dims(0), (shape.Dims(1) + 1) / 2, (shape.Dims(2) + 1) / 2,
+                           shape.Dims(3)};
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::SpaceToBatchParams params;
+  params.output_offset = 0;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::SpaceToBatchND(params, shape, input.data(), Shape{2}, block_shape, Shape{2, 2},
+                               paddings, output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, (shape.FlatSize() + output_shape.FlatSize()) * sizeof(float));
+}
+
+// Inverse of BM_SpaceToBatchND
+void BM_BatchToSpaceND(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const int32_t block_shape[] = {2, 2};
+  const int32_t crops[] = {0, shape.Dims(1) % 2, 0, shape.Dims(2) % 2};
+  const Shape input_shape{4 * shape.Dims(0), (shape.Dims(1) + 1) / 2, (shape.Dims(2) + 1) / 2,
+                          shape.Dims(3)};
+  const auto input = RandomVector<float>(input_shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::BatchToSpaceND(input_shape, input.data(), block_shape, crops, shape,
+                               output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, (input_shape.FlatSize() + shape.FlatSize()) * sizeof(float));
+}
+
+} // namespace
+
+BENCHMARK(BM_Transpose)->Apply(ThreadedCases<kNumShapes>);
+BENCHMARK(BM_Pad)->Apply(ThreadedCases<kNumShapes>);
+BENCHMARK(BM_Concatenation)->Apply(ThreadedCases<kNumShapes>);
+BENCHMARK(BM_Gather)->Apply(ThreadedCases<kNumShapes>);
+BENCHMARK(BM_GatherHalfTable)->Apply(ThreadedCases<kNumShapes>);
+BENCHMARK(BM_GatherEmbedding)->Apply(ThreadedCases<kNumEmbeddingCases>);
+BENCHMARK(BM_EmbeddingLookup)->Apply(ThreadedCases<kNumEmbeddingCases>);
+BENCHMARK(BM_StridedSlice)->Apply(ThreadedCases<kNumShapes>);
+BENCHMARK(BM_ResizeBilinear)->Apply(ThreadedCases<kNumShapes>);
+BENCHMARK(BM_Slice)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_Split)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_Pack)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_Reverse)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_DepthToSpace)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_SpaceToDepth)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_BroadcastTo)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_SplitV)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_Unpack)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_Tile)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_SpaceToBatchND)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_BatchToSpaceND)->Apply(SerialCases<kNumShapes>);
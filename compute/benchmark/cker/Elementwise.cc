@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/ELU.h>
+#include <cker/operation/Elementwise.h>
+#include <cker/operation/Erf.h>
+#include <cker/operation/Exp.h>
+#include <cker/operation/HardSwish.h>
+#include <cker/operation/LeakyReLU.h>
+#include <cker/operation/LogicalNot.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/ReLU.h>
+#include <cker/operation/ReLU6.h>
+#include <cker/operation/Round.h>
+#include <cker/operation/Tanh.h>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+const std::vector<Shape> kShapes = {{1, 112, 112, 32}, {1, 56, 56, 128}, {1, 7, 7, 1024}};
+constexpr int kNumShapes = 3;
+
+using UnaryFn = void (*)(const Shape &, const float *, const Shape &, float *);
+
+template <UnaryFn Fn> void BM_Unary(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  // Positive to be valid for Log, Sqrt and Rsqrt
+  const auto input = RandomVector<float>(shape.FlatSize(), 0.1f, 2.f);
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    Fn(shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_ReLU6(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input = RandomVector<float>(shape.FlatSize(), -8.f, 8.f);
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::ReLU6(shape, input.data(), output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_LeakyReLU(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+  nnfw::cker::LeakyReluParams params;
+  params.alpha = 0.2f;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::LeakyReLU(params, shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_LogicalNot(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input = RandomBoolBuffer(shape.FlatSize());
+  std::unique_ptr<bool[]> output(new bool[shape.FlatSize()]);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::LogicalNot(shape, input.get(), shape, output.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(bool));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::ReLU)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_ReLU6)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_LeakyReLU)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::ELU)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::HardSwish)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Logistic)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Tanh)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Exp)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Erf)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Round)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Sin)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Cos)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Abs)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Rsqrt)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Neg<float>)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Log)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Floor)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Sqrt)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Unary, nnfw::cker::Square)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_LogicalNot)->Apply(SerialCases<kNumShapes>);
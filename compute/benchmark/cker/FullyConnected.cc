@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/BatchMatMul.h>
+#include <cker/operation/Einsum.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/FullyConnectedDense16x1.h>
+
+#include <string>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+struct FullyConnectedCase
+{
+  Shape input;
+  Shape weights;
+};
+
+// Single batch (GEMV) and batched (GEMM) cases
+const std::vector<FullyConnectedCase> kFullyConnectedCases = {
+  {{1, 1024}, {1008, 1024}}, {{16, 512}, {512, 512}}, {{128, 256}, {256, 256}}};
+constexpr int kNumFullyConnectedCases = 3;
+
+struct MatMulCase
+{
+  Shape lhs;
+  Shape rhs;
+};
+
+const std::vector<MatMulCase> kMatMulCases = {{{8, 64, 64}, {8, 64, 64}},
+                                              {{4, 128, 256}, {4, 256, 128}},
+                                              {{1, 384, 64}, {1, 64, 384}}};
+constexpr int kNumMatMulCases = 3;
+
+Shape OutputShape(const FullyConnectedCase &c)
+{
+  return Shape{c.input.FlatSize() / c.weights.Dims(1), c.weights.Dims(0)};
+}
+
+int64_t Flops(const FullyConnectedCase &c)
+{
+  return 2 * static_cast<int64_t>(c.input.FlatSize()) * c.weights.Dims(0);
+}
+
+template <typename T> void SetQuantParams(nnfw::cker::FullyConnectedParams *params)
+{
+  params->input_offset = -static_cast<int32_t>(std::numeric_limits<T>::max() / 2);
+  params->weights_offset = std::is_signed<T>::value ? 0 : -128;
+  params->output_offset = std::numeric_limits<T>::max() / 2;
+  params->output_multiplier = 1 << 30;
+  params->output_shift = -8;
+  params->quantized_activation_min = std::numeric_limits<T>::min();
+  params->quantized_activation_max = std::numeric_limits<T>::max();
+}
+
+void BM_FullyConnectedFloat(benchmark::State &state)
+{
+  const auto &c = kFullyConnectedCases[CaseIndex(state)];
+  const auto output_shape = OutputShape(c);
+  const Shape bias_shape{c.weights.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto weights = RandomVector<float>(c.weights.FlatSize(), 2);
+  const auto bias = RandomVector<float>(bias_shape.FlatSize(), 3);
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::FullyConnectedParams params;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::FullyConnected(params, c.input, input.data(), c.weights, weights.data(),
+                               bias_shape, bias.data(), output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input,
+         (c.input.FlatSize() + c.weights.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         Flops(c));
+}
+
+void BM_FullyConnectedUint8(benchmark::State &state)
+{
+  const auto &c = kFullyConnectedCases[CaseIndex(state)];
+  const auto output_shape = OutputShape(c);
+  const Shape bias_shape{c.weights.Dims(0)};
+  const auto input = RandomVector<uint8_t>(c.input.FlatSize(), 1);
+  const auto weights = RandomVector<uint8_t>(c.weights.FlatSize(), 2);
+  const auto bias = RandomVector<int32_t>(bias_shape.FlatSize(), 3);
+  std::vector<uint8_t> output(output_shape.FlatSize());
+  nnfw::cker::FullyConnectedParams params;
+  SetQuantParams<uint8_t>(&params);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::FullyConnected(params, c.input, input.data(), c.weights, weights.data(),
+                               bias_shape, bias.data(), output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, c.input.FlatSize() + c.weights.FlatSize() + output_shape.FlatSize(),
+         Flops(c));
+}
+
+void BM_FullyConnectedInt8PerChannel(benchmark::State &state)
+{
+  const auto &c = kFullyConnectedCases[CaseIndex(state)];
+  const auto output_shape = OutputShape(c);
+  const Shape bias_shape{c.weights.Dims(0)};
+  const auto input = RandomVector<int8_t>(c.input.FlatSize(), 1);
+  const auto weights = RandomVector<int8_t>(c.weights.FlatSize(), 2);
+  const auto bias = RandomVector<int32_t>(bias_shape.FlatSize(), 3);
+  std::vector<int8_t> output(output_shape.FlatSize());
+  const std::vector<int32_t> output_multiplier(c.weights.Dims(0), 1 << 30);
+  const std::vector<int> output_shift(c.weights.Dims(0), -8);
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::FullyConnectedParams params;
+  SetQuantParams<int8_t>(&params);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::FullyConnectedPerChannel(params, output_multiplier.data(), output_shift.data(),
+                                         c.input, input.data(), c.weights, weights.data(),
+                                         bias_shape, bias.data(), output_shape, output.data(),
+                                         ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, c.input.FlatSize() + c.weights.FlatSize() + output_shape.FlatSize(),
+         Flops(c));
+}
+
+// Float input with int8 symmetric weights, which is multithreaded with USE_RUY_GEMV only
+void BM_FullyConnectedHybrid(benchmark::State &state)
+{
+  const auto &c = kFullyConnectedCases[CaseIndex(state)];
+  const auto output_shape = OutputShape(c);
+  const Shape bias_shape{c.weights.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto weights = RandomVector<int8_t>(c.weights.FlatSize(), 2);
+  const auto bias = RandomVector<float>(bias_shape.FlatSize(), 3);
+  std::vector<float> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::FullyConnectedParams params;
+  params.weights_scale = 1.f / 127;
+  nnfw::cker::FCTempArena temp_arena;
+  temp_arena.prepare(c.input, c.weights);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::FullyConnectedHybrid(params, c.input, input.data(), c.weights, weights.data(),
+                                     bias_shape, bias.data(), output_shape, output.data(),
+                                     temp_arena, ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input,
+         c.input.FlatSize() * sizeof(float) + c.weights.FlatSize() +
+           output_shape.FlatSize() * sizeof(float),
+         Flops(c));
+}
+
+// Float input with weights kept as float16 or bfloat16 by CPU_WEIGHT_STORAGE
+template <nnfw::cker::HalfType WeightsType>
+void BM_FullyConnectedHalfWeights(benchmark::State &state)
+{
+  const auto &c = kFullyConnectedCases[CaseIndex(state)];
+  const auto output_shape = OutputShape(c);
+  const Shape bias_shape{c.weights.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto float_weights = RandomVector<float>(c.weights.FlatSize(), 2);
+  std::vector<uint16_t> weights(c.weights.FlatSize());
+  nnfw::cker::ConvertFloatToHalf(float_weights.data(), weights.size(), WeightsType, weights.data());
+  const auto bias = RandomVector<float>(bias_shape.FlatSize(), 3);
+  std::vector<float> output(output_shape.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+  nnfw::cker::FullyConnectedParams params;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::FullyConnectedHalfWeights(params, c.input, input.data(), c.weights,
+                                          weights.data(), WeightsType, bias_shape, bias.data(),
+                                          output_shape, output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input,
+         (c.input.FlatSize() + output_shape.FlatSize()) * sizeof(float) +
+           c.weights.FlatSize() * sizeof(uint16_t),
+         Flops(c));
+}
+
+#if defined(__aarch64__) && defined(USE_NEON)
+void BM_FullyConnected16x1Float32(benchmark::State &state)
+{
+  const auto &c = kFullyConnectedCases[CaseIndex(state)];
+  const auto output_shape = OutputShape(c);
+  const Shape bias_shape{c.weights.Dims(0)};
+  const auto input = RandomVector<float>(c.input.FlatSize(), 1);
+  const auto weights = RandomVector<float>(c.weights.FlatSize(), 2);
+  const auto bias = RandomVector<float>(bias_shape.FlatSize(), 3);
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::FullyConnectedParams params;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::FullyConnected16x1Float32(params, c.input, input.data(), c.weights,
+                                          weights.data(), bias_shape, bias.data(), output_shape,
+                                          output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input,
+         (c.input.FlatSize() + c.weights.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         Flops(c));
+}
+#endif
+
+void BM_BatchMatMul(benchmark::State &state)
+{
+  const auto &c = kMatMulCases[CaseIndex(state)];
+  const Shape output_shape{c.lhs.Dims(0), c.lhs.Dims(1), c.rhs.Dims(2)};
+  const auto lhs = RandomVector<float>(c.lhs.FlatSize(), 1);
+  const auto rhs = RandomVector<float>(c.rhs.FlatSize(), 2);
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::BatchMatMul batch_mat_mul;
+  batch_mat_mul.prepare(c.lhs, c.rhs, false, false);
+
+  for (auto _ : state)
+  {
+    batch_mat_mul(c.lhs, lhs.data(), c.rhs, rhs.data(), false, false, output_shape,
+                  output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.lhs,
+         (c.lhs.FlatSize() + c.rhs.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         2 * static_cast<int64_t>(c.lhs.FlatSize()) * c.rhs.Dims(2));
+}
+
+// Same contraction as BM_BatchMatMul, to compare the overhead of parsing and reshaping
+void BM_Einsum(benchmark::State &state)
+{
+  const auto &c = kMatMulCases[CaseIndex(state)];
+  const Shape output_shape{c.lhs.Dims(0), c.lhs.Dims(1), c.rhs.Dims(2)};
+  const auto lhs = RandomVector<float>(c.lhs.FlatSize(), 1);
+  const auto rhs = RandomVector<float>(c.rhs.FlatSize(), 2);
+  std::vector<float> output(output_shape.FlatSize());
+  std::string equation = "abc,acd->abd";
+  nnfw::cker::Einsum einsum;
+
+  for (auto _ : state)
+  {
+    einsum(equation, {c.lhs, c.rhs}, {lhs.data(), rhs.data()}, output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.lhs,
+         (c.lhs.FlatSize() + c.rhs.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         2 * static_cast<int64_t>(c.lhs.FlatSize()) * c.rhs.Dims(2));
+}
+
+// Attention scores of [batch, heads, sequence, depth] queries and keys, which are contracted
+// along depth without transposing the keys
+const std::vector<Shape> kAttentionShapes = {{1, 12, 128, 64}, {8, 4, 32, 32}};
+constexpr int kNumAttentionShapes = 2;
+
+void BM_EinsumAttention(benchmark::State &state)
+{
+  const auto &shape = kAttentionShapes[CaseIndex(state)];
+  const Shape output_shape{shape.Dims(0), shape.Dims(1), shape.Dims(2), shape.Dims(2)};
+  const auto query = RandomVector<float>(shape.FlatSize(), 1);
+  const auto key = RandomVector<float>(shape.FlatSize(), 2);
+  std::vector<float> output(output_shape.FlatSize());
+  std::string equation = "bhqd,bhkd->bhqk";
+  nnfw::cker::Einsum einsum;
+
+  for (auto _ : state)
+  {
+    einsum(equation, {shape, shape}, {query.data(), key.data()}, output_shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, (2 * shape.FlatSize() + output_shape.FlatSize()) * sizeof(float),
+         2 * static_cast<int64_t>(shape.FlatSize()) * shape.Dims(2));
+}
+
+} // namespace
+
+BENCHMARK(BM_FullyConnectedFloat)->Apply(SerialCases<kNumFullyConnectedCases>);
+BENCHMARK(BM_FullyConnectedUint8)->Apply(SerialCases<kNumFullyConnectedCases>);
+BENCHMARK(BM_FullyConnectedInt8PerChannel)->Apply(ThreadedCases<kNumFullyConnectedCases>);
+BENCHMARK(BM_FullyConnectedHybrid)->Apply(ThreadedCases<kNumFullyConnectedCases>);
+BENCHMARK_TEMPLATE(BM_FullyConnectedHalfWeights, nnfw::cker::HalfType::kFloat16)
+  ->Apply(ThreadedCases<kNumFullyConnectedCases>);
+BENCHMARK_TEMPLATE(BM_FullyConnectedHalfWeights, nnfw::cker::HalfType::kBFloat16)
+  ->Apply(ThreadedCases<kNumFullyConnectedCases>);
+#if defined(__aarch64__) && defined(USE_NEON)
+BENCHMARK(BM_FullyConnected16x1Float32)->Apply(SerialCases<kNumFullyConnectedCases>);
+#endif
+BENCHMARK(BM_BatchMatMul)->Apply(SerialCases<kNumMatMulCases>);
+BENCHMARK(BM_Einsum)->Apply(SerialCases<kNumMatMulCases>);
+BENCHMARK(BM_EinsumAttention)->Apply(SerialCases<kNumAttentionShapes>);
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/Fill.h>
+#include <cker/operation/MatrixBandPart.h>
+#include <cker/operation/OneHot.h>
+#include <cker/operation/Range.h>
+#include <cker/operation/StatelessRandomUniform.h>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+const std::vector<Shape> kShapes = {{1, 112, 112, 32}, {1, 56, 56, 128}, {1, 7, 7, 1024}};
+constexpr int kNumShapes = 3;
+
+// Batches of square matrices
+const std::vector<Shape> kMatrixShapes = {{64, 64, 64}, {8, 256, 256}, {1, 1024, 1024}};
+constexpr int kNumMatrixShapes = 3;
+
+void BM_Fill(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const float value = 1.f;
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Fill(&value, shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * sizeof(float));
+}
+
+void BM_Range(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const float start = 0.f;
+  const float limit = static_cast<float>(shape.FlatSize());
+  const float delta = 1.f;
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Range(&start, &limit, &delta, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * sizeof(float));
+}
+
+// Indices of the innermost axis of a case to one-hot vectors of its depth
+void BM_OneHot(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const int32_t depth = shape.Dims(3);
+  const Shape indices_shape{shape.FlatSize() / depth};
+  const auto indices = RandomVector<int32_t>(indices_shape.FlatSize(), 0, depth - 1);
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::OneHot(depth, 1.f, 0.f, -1, indices_shape, indices.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * sizeof(float));
+}
+
+// Keep the tridiagonal band
+void BM_MatrixBandPart(benchmark::State &state)
+{
+  const auto &shape = kMatrixShapes[CaseIndex(state)];
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::MatrixBandPart<int32_t>(1, 1, shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_StatelessRandomUniform(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const Shape shape_shape{shape.DimensionsCount()};
+  const std::vector<int32_t> shape_data(shape.DimsData(),
+                                        shape.DimsData() + shape.DimensionsCount());
+  const Shape seed_shape{2};
+  const int32_t seed[] = {1, 2};
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::StatelessRandomUniform(shape_shape, shape_data.data(), seed_shape, seed, shape,
+                                       output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * sizeof(float));
+}
+
+} // namespace
+
+BENCHMARK(BM_Fill)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_Range)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_OneHot)->Apply(SerialCases<kNumShapes>);
+BENCHMARK(BM_MatrixBandPart)->Apply(SerialCases<kNumMatrixShapes>);
+BENCHMARK(BM_StatelessRandomUniform)->Apply(SerialCases<kNumShapes>);
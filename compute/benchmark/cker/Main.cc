@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/CpuFeatures.h>
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+namespace
+{
+
+// Build configuration which makes results of two builds incomparable
+void AddBuildContext()
+{
+#if defined(__aarch64__)
+  benchmark::AddCustomContext("cker_arch", "aarch64");
+#elif defined(__arm__)
+  benchmark::AddCustomContext("cker_arch", "arm");
+#elif defined(__x86_64__)
+  benchmark::AddCustomContext("cker_arch", "x86_64");
+#else
+  benchmark::AddCustomContext("cker_arch", "unknown");
+#endif
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+  benchmark::AddCustomContext("cker_neon", "on");
+#else
+  benchmark::AddCustomContext("cker_neon", "off");
+#endif
+
+#if defined(CKER_X86_DISPATCH)
+  // Selected at runtime
+  benchmark::AddCustomContext("cker_f16c", nnfw::cker::CpuHasF16C() ? "on" : "off");
+#else
+  benchmark::AddCustomContext("cker_f16c", "off");
+#endif
+
+#if defined(USE_RUY_GEMV)
+  benchmark::AddCustomContext("cker_ruy_gemv", "on");
+#else
+  benchmark::AddCustomContext("cker_ruy_gemv", "off");
+#endif
+
+#if defined(__VERSION__)
+  benchmark::AddCustomContext("compiler", __VERSION__);
+#endif
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+
+  AddBuildContext();
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
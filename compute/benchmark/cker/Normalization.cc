@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/InstanceNorm.h>
+#include <cker/operation/L2Normalize.h>
+#include <cker/operation/LogSoftMax.h>
+#include <cker/operation/SoftMax.h>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+// Classifier logits, attention scores and a long row
+const std::vector<Shape> kSoftmaxShapes = {{1, 1001}, {12, 128, 128}, {4, 32768}};
+constexpr int kNumSoftmaxShapes = 3;
+
+const std::vector<Shape> kNormShapes = {{1, 112, 112, 32}, {1, 56, 56, 128}, {1, 7, 7, 1024}};
+constexpr int kNumNormShapes = 3;
+
+void BM_SoftmaxFloat(benchmark::State &state)
+{
+  const auto &shape = kSoftmaxShapes[CaseIndex(state)];
+  const auto input = RandomVector<float>(shape.FlatSize(), -8.f, 8.f);
+  std::vector<float> output(shape.FlatSize());
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.0;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Softmax(params, shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+// Same lookup tables as SoftMaxLayer::configure() of the cpu backend
+void BM_SoftmaxUint8(benchmark::State &state)
+{
+  const auto &shape = kSoftmaxShapes[CaseIndex(state)];
+  const auto input = RandomVector<uint8_t>(shape.FlatSize());
+  std::vector<uint8_t> output(shape.FlatSize());
+  const float input_scale = 0.1f;
+  const float beta = 1.f;
+  nnfw::cker::SoftmaxParams params;
+  params.scale = 1.f / 256;
+  params.zero_point = 0;
+#ifdef TFLITE_SOFTMAX_USE_UINT16_LUT
+  uint8_t uint8_table1[256];
+  uint8_t uint8_table2[256];
+  nnfw::cker::PopulateSoftmaxUInt8LookupTable(uint8_table1, uint8_table2, input_scale, beta);
+  params.uint8_table1 = uint8_table1;
+  params.uint8_table2 = uint8_table2;
+#else
+  float table[256];
+  nnfw::cker::PopulateSoftmaxLookupTable(table, input_scale, beta);
+  params.table = table;
+#endif
+
+  for (auto _ : state)
+  {
+#ifdef TFLITE_SOFTMAX_USE_UINT16_LUT
+    nnfw::cker::SoftmaxInt8LUT<uint8_t, uint8_t>(params, shape, input.data(), shape,
+                                                 output.data());
+#else
+    nnfw::cker::Softmax<uint8_t, uint8_t>(params, shape, input.data(), shape, output.data());
+#endif
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize());
+}
+
+void BM_LogSoftmax(benchmark::State &state)
+{
+  const auto &shape = kSoftmaxShapes[CaseIndex(state)];
+  const auto input = RandomVector<float>(shape.FlatSize(), -8.f, 8.f);
+  std::vector<float> output(shape.FlatSize());
+  nnfw::cker::SoftmaxParams params;
+  params.beta = 1.0;
+  params.axis = -1;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::LogSoftmax(params, shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_L2Normalize(benchmark::State &state)
+{
+  const auto &shape = kNormShapes[CaseIndex(state)];
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::L2NormalizeFloat32(shape, input.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+void BM_InstanceNorm(benchmark::State &state)
+{
+  const auto &shape = kNormShapes[CaseIndex(state)];
+  const Shape channel_shape{shape.Dims(3)};
+  const auto input = RandomVector<float>(shape.FlatSize(), 1);
+  const auto gamma = RandomVector<float>(channel_shape.FlatSize(), 2);
+  const auto beta = RandomVector<float>(channel_shape.FlatSize(), 3);
+  std::vector<float> output(shape.FlatSize());
+  nnfw::cker::InstanceNormParams params;
+  params.epsilon = 1e-5f;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+
+  for (auto _ : state)
+  {
+    nnfw::cker::InstanceNorm(params, shape, input.data(), channel_shape, gamma.data(),
+                             channel_shape, beta.data(), shape, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize() * sizeof(float));
+}
+
+} // namespace
+
+BENCHMARK(BM_SoftmaxFloat)->Apply(SerialCases<kNumSoftmaxShapes>);
+BENCHMARK(BM_SoftmaxUint8)->Apply(SerialCases<kNumSoftmaxShapes>);
+BENCHMARK(BM_LogSoftmax)->Apply(SerialCases<kNumSoftmaxShapes>);
+BENCHMARK(BM_L2Normalize)->Apply(SerialCases<kNumNormShapes>);
+BENCHMARK(BM_InstanceNorm)->Apply(SerialCases<kNumNormShapes>);
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/AveragePool.h>
+#include <cker/operation/MaxPool.h>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+struct PoolCase
+{
+  Shape input;
+  int filter;
+  int stride;
+};
+
+// Downsampling pools and a global average pool
+const std::vector<PoolCase> kPoolCases = {
+  {{1, 112, 112, 64}, 3, 2}, {{1, 56, 56, 256}, 2, 2}, {{1, 7, 7, 1024}, 7, 1}};
+constexpr int kNumPoolCases = 3;
+
+Shape PoolOutputShape(const PoolCase &c)
+{
+  return Shape{c.input.Dims(0), (c.input.Dims(1) - c.filter) / c.stride + 1,
+               (c.input.Dims(2) - c.filter) / c.stride + 1, c.input.Dims(3)};
+}
+
+template <typename T> void SetQuantParams(nnfw::cker::PoolParams *params)
+{
+  params->quantized_activation_min = std::numeric_limits<T>::min();
+  params->quantized_activation_max = std::numeric_limits<T>::max();
+}
+
+// Float kernels take no quantization parameters
+template <> void SetQuantParams<float>(nnfw::cker::PoolParams *) {}
+
+template <typename T> nnfw::cker::PoolParams MakeParams(const PoolCase &c)
+{
+  nnfw::cker::PoolParams params;
+  params.padding_type = nnfw::cker::PaddingType::kValid;
+  params.padding_values.height = params.padding_values.width = 0;
+  params.stride_height = params.stride_width = c.stride;
+  params.filter_height = params.filter_width = c.filter;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  SetQuantParams<T>(&params);
+  return params;
+}
+
+template <typename T> void BM_MaxPool(benchmark::State &state)
+{
+  const auto &c = kPoolCases[CaseIndex(state)];
+  const auto output_shape = PoolOutputShape(c);
+  const auto input = RandomVector<T>(c.input.FlatSize());
+  std::vector<T> output(output_shape.FlatSize());
+  const auto params = MakeParams<T>(c);
+  auto ruy_context = MakeRuyContext(state);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::MaxPool<T>(params, c.input, input.data(), output_shape, output.data(),
+                           ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, (c.input.FlatSize() + output_shape.FlatSize()) * sizeof(T));
+}
+
+template <typename T> void BM_AveragePool(benchmark::State &state)
+{
+  const auto &c = kPoolCases[CaseIndex(state)];
+  const auto output_shape = PoolOutputShape(c);
+  const auto input = RandomVector<T>(c.input.FlatSize());
+  std::vector<T> output(output_shape.FlatSize());
+  const auto params = MakeParams<T>(c);
+  auto ruy_context = MakeRuyContext(state);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::AveragePool<T>(params, c.input, input.data(), output_shape, output.data(),
+                               ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, (c.input.FlatSize() + output_shape.FlatSize()) * sizeof(T));
+}
+
+} // namespace
+
+// Quantized pools do not take ruy::Context
+BENCHMARK_TEMPLATE(BM_MaxPool, float)->Apply(ThreadedCases<kNumPoolCases>);
+BENCHMARK_TEMPLATE(BM_MaxPool, uint8_t)->Apply(SerialCases<kNumPoolCases>);
+BENCHMARK_TEMPLATE(BM_AveragePool, float)->Apply(ThreadedCases<kNumPoolCases>);
+BENCHMARK_TEMPLATE(BM_AveragePool, uint8_t)->Apply(SerialCases<kNumPoolCases>);
+BENCHMARK_TEMPLATE(BM_AveragePool, int8_t)->Apply(SerialCases<kNumPoolCases>);
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/Dequantize.h>
+#include <cker/operation/LUT.h>
+#include <cker/operation/Quantize.h>
+
+#include <cmath>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+const std::vector<Shape> kShapes = {{1, 112, 112, 32}, {1, 56, 56, 128}, {1, 7, 7, 1024}};
+constexpr int kNumShapes = 3;
+
+template <typename T> void BM_Quantize(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input = RandomVector<float>(shape.FlatSize());
+  std::vector<T> output(shape.FlatSize());
+  const int32_t offset = std::is_signed<T>::value ? 0 : 128;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Quantize(shape, input.data(), shape, output.data(), 1.f / 128, offset);
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * (sizeof(float) + sizeof(T)));
+}
+
+template <typename T> void BM_Dequantize(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input = RandomVector<T>(shape.FlatSize());
+  std::vector<float> output(shape.FlatSize());
+  const int32_t zero_point = std::is_signed<T>::value ? 0 : 128;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Dequantize(shape, input.data(), shape, output.data(), 1.f / 128, zero_point);
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, shape.FlatSize() * (sizeof(float) + sizeof(T)));
+}
+
+// Conversion between uint8 and int8 of the same scale
+template <typename In, typename Out> void BM_Requantize(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input = RandomVector<In>(shape.FlatSize());
+  std::vector<Out> output(shape.FlatSize());
+  const int32_t input_zero_point = std::is_signed<In>::value ? 0 : 128;
+  const int32_t output_zero_point = std::is_signed<Out>::value ? 0 : 128;
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Requantize<In, Out>(input.data(), shape.FlatSize(), 1 << 30, 1, input_zero_point,
+                                    output_zero_point, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize());
+}
+
+// Table of a quantized activation as the cpu backend builds for some unary ops
+template <typename T> void BM_LookupTable(benchmark::State &state)
+{
+  const auto &shape = kShapes[CaseIndex(state)];
+  const auto input = RandomVector<T>(shape.FlatSize());
+  std::vector<T> output(shape.FlatSize());
+  const int32_t zero_point = std::is_signed<T>::value ? 0 : 128;
+  uint8_t table[256];
+  nnfw::cker::PopulateLookupTable<T>([](float value) { return std::tanh(value); }, 1.f / 32,
+                                     zero_point, 1.f / 128, zero_point, table);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::LookupTable(input.data(), shape.FlatSize(), table, output.data());
+    benchmark::ClobberMemory();
+  }
+  Report(state, shape, 2 * shape.FlatSize());
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_Quantize, uint8_t)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Quantize, int8_t)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Dequantize, uint8_t)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Dequantize, int8_t)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Requantize, uint8_t, int8_t)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_Requantize, int8_t, uint8_t)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_LookupTable, uint8_t)->Apply(SerialCases<kNumShapes>);
+BENCHMARK_TEMPLATE(BM_LookupTable, int8_t)->Apply(SerialCases<kNumShapes>);
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Benchmark.h"
+
+#include <cker/operation/ArgMinMax.h>
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ReduceMean.h>
+
+#include <functional>
+
+namespace
+{
+
+using namespace cker_benchmark;
+using nnfw::cker::Shape;
+
+struct ReduceCase
+{
+  Shape input;
+  std::vector<int> axes;
+  Shape output;
+};
+
+// Spatial reductions of NHWC and a reduction of the innermost axis, keeping dimensions
+const std::vector<ReduceCase> kReduceCases = {{{1, 56, 56, 256}, {1, 2}, {1, 1, 1, 256}},
+                                              {{1, 7, 7, 1024}, {1, 2}, {1, 1, 1, 1024}},
+                                              {{128, 1024}, {1}, {128, 1}}};
+constexpr int kNumReduceCases = 3;
+
+// Cases of MeanAxis1And2, which supports spatial reductions only
+constexpr int kNumSpatialReduceCases = 2;
+
+template <typename T> T Sum(const T current, const T in) { return in + current; }
+template <typename T> T Max(const T current, const T in) { return (in > current) ? in : current; }
+
+template <typename T> void BM_ReduceSum(benchmark::State &state)
+{
+  const auto &c = kReduceCases[CaseIndex(state)];
+  const auto input = RandomVector<T>(c.input.FlatSize());
+  std::vector<T> output(c.output.FlatSize());
+  nnfw::cker::Reduce reduce;
+  reduce.prepare(c.input.DimensionsCount(), c.axes.size());
+
+  for (auto _ : state)
+  {
+    reduce.ReduceGeneric<T>(c.input, input.data(), c.output, output.data(), c.axes, true,
+                            static_cast<T>(0), Sum<T>);
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, (c.input.FlatSize() + c.output.FlatSize()) * sizeof(T));
+}
+
+void BM_ReduceMax(benchmark::State &state)
+{
+  const auto &c = kReduceCases[CaseIndex(state)];
+  const auto input = RandomVector<float>(c.input.FlatSize());
+  std::vector<float> output(c.output.FlatSize());
+  nnfw::cker::Reduce reduce;
+  reduce.prepare(c.input.DimensionsCount(), c.axes.size());
+
+  for (auto _ : state)
+  {
+    reduce.ReduceGeneric<float>(c.input, input.data(), c.output, output.data(), c.axes, true,
+                                std::numeric_limits<float>::lowest(), Max<float>);
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, (c.input.FlatSize() + c.output.FlatSize()) * sizeof(float));
+}
+
+void BM_Mean(benchmark::State &state)
+{
+  const auto &c = kReduceCases[CaseIndex(state)];
+  const auto input = RandomVector<float>(c.input.FlatSize());
+  std::vector<float> output(c.output.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::Mean(c.input, input.data(), c.output, output.data(), c.axes);
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, (c.input.FlatSize() + c.output.FlatSize()) * sizeof(float));
+}
+
+void BM_MeanQ8Asymm(benchmark::State &state)
+{
+  const auto &c = kReduceCases[CaseIndex(state)];
+  const auto input = RandomVector<uint8_t>(c.input.FlatSize());
+  std::vector<uint8_t> output(c.output.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::MeanQ8Asymm(c.input, input.data(), 0.1f, 128, c.output, output.data(), 0.1f, 128,
+                            c.axes);
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, c.input.FlatSize() + c.output.FlatSize());
+}
+
+void BM_MeanAxis1And2(benchmark::State &state)
+{
+  const auto &c = kReduceCases[CaseIndex(state)];
+  const auto input = RandomVector<float>(c.input.FlatSize());
+  std::vector<float> output(c.output.FlatSize());
+  auto ruy_context = MakeRuyContext(state);
+
+  for (auto _ : state)
+  {
+    nnfw::cker::MeanAxis1And2(c.input, input.data(), c.output, output.data(), ruy_context.get());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input, (c.input.FlatSize() + c.output.FlatSize()) * sizeof(float));
+}
+
+void BM_ArgMax(benchmark::State &state)
+{
+  const auto &c = kReduceCases[CaseIndex(state)];
+  const int axis = c.axes.back();
+  Shape output_shape(c.input.DimensionsCount() - 1);
+  for (int i = 0, j = 0; i < c.input.DimensionsCount(); ++i)
+  {
+    if (i != axis)
+      output_shape.SetDim(j++, c.input.Dims(i));
+  }
+  const auto input = RandomVector<float>(c.input.FlatSize());
+  std::vector<int32_t> output(output_shape.FlatSize());
+
+  for (auto _ : state)
+  {
+    nnfw::cker::ArgMinMax(c.input, input.data(), output_shape, output.data(), axis,
+                          std::greater<float>());
+    benchmark::ClobberMemory();
+  }
+  Report(state, c.input,
+         c.input.FlatSize() * sizeof(float) + output_shape.FlatSize() * sizeof(int32_t));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_ReduceSum, float)->Apply(SerialCases<kNumReduceCases>);
+BENCHMARK_TEMPLATE(BM_ReduceSum, int32_t)->Apply(SerialCases<kNumReduceCases>);
+BENCHMARK(BM_ReduceMax)->Apply(SerialCases<kNumReduceCases>);
+BENCHMARK(BM_Mean)->Apply(SerialCases<kNumReduceCases>);
+BENCHMARK(BM_MeanQ8Asymm)->Apply(SerialCases<kNumReduceCases>);
+BENCHMARK(BM_MeanAxis1And2)->Apply(ThreadedCases<kNumSpatialReduceCases>);
+BENCHMARK(BM_ArgMax)->Apply(SerialCases<kNumReduceCases>);
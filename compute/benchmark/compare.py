@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import argparse, json, sys
+
+TIME_UNITS = {'ns': 1e-9, 'us': 1e-6, 'ms': 1e-3, 's': 1.0}
+
+
+def load(path):
+    """Return the context and the time in seconds of each benchmark in a JSON output
+
+    With --benchmark_repetitions, the median aggregate is used. Otherwise repeated runs of
+    the same name are averaged.
+    """
+    with open(path) as f:
+        result = json.load(f)
+
+    medians = {}
+    runs = {}
+    for bench in result['benchmarks']:
+        if 'error_occurred' in bench and bench['error_occurred']:
+            continue
+        name = bench.get('run_name', bench['name'])
+        seconds = bench['real_time'] * TIME_UNITS[bench.get('time_unit', 'ns')]
+        if bench.get('run_type') == 'aggregate':
+            if bench.get('aggregate_name') == 'median':
+                medians[name] = seconds
+        else:
+            runs.setdefault(name, []).append(seconds)
+
+    times = {name: sum(values) / len(values) for name, values in runs.items()}
+    times.update(medians)
+    return result.get('context', {}), times
+
+
+def main(args):
+    base_context, base = load(args.baseline)
+    context, contender = load(args.contender)
+
+    # Custom context of benchmark_cker describing the build
+    for key in sorted(base_context):
+        if key.startswith('cker_') or key == 'compiler':
+            if base_context[key] != context.get(key):
+                print('warning: {} differs: {} vs {}'.format(key, base_context[key],
+                                                             context.get(key)))
+
+    regressions = 0
+    width = max([len(name) for name in base] + [len('Benchmark')])
+    print('{:<{w}} {:>12} {:>12} {:>8}'.format('Benchmark', 'Base(us)', 'New(us)', 'Ratio',
+                                              w=width))
+    for name in sorted(base):
+        if name not in contender:
+            continue
+        ratio = contender[name] / base[name]
+        mark = ''
+        if ratio > 1 + args.threshold:
+            mark = ' <- slower'
+            regressions += 1
+        elif ratio < 1 - args.threshold:
+            mark = ' <- faster'
+        print('{:<{w}} {:>12.2f} {:>12.2f} {:>8.3f}{}'.format(
+            name, base[name] * 1e6, contender[name] * 1e6, ratio, mark, w=width))
+
+    missing = sorted(set(base) ^ set(contender))
+    for name in missing:
+        print('only in {}: {}'.format(args.baseline if name in base else args.contender,
+                                      name))
+
+    if regressions > 0:
+        print('{} benchmark(s) are slower by more than {:.1f}%'.format(
+            regressions, args.threshold * 100))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    arg_parser = argparse.ArgumentParser(
+        description='Compare two JSON outputs of benchmark_cker (--benchmark_out=<file>)')
+    arg_parser.add_argument('baseline', help='JSON output before a change')
+    arg_parser.add_argument('contender', help='JSON output after a change')
+    arg_parser.add_argument(
+        '--threshold',
+        type=float,
+        default=0.05,
+        help='Ratio of slowdown to fail with, 0.05 for 5%% by default')
+    sys.exit(main(arg_parser.parse_args()))
@@ -21,6 +21,11 @@
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
 namespace nnfw
 {
 namespace cker
@@ -37,6 +42,60 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
 }
 
+// Minimum number of elements a task of ParallelFor should process to be worth a thread
+constexpr int64_t kParallelForMinWork = 16 * 1024;
+
+/**
+ * @brief Get the minimum number of items of a ParallelFor task
+ *
+ * @param work_per_item Number of elements processed by an item
+ */
+inline int64_t ParallelForMinGrain(int64_t work_per_item)
+{
+  return std::max<int64_t>(1, kParallelForMinWork / std::max<int64_t>(1, work_per_item));
+}
+
+template <typename Func> struct ParallelForTask : Task
+{
+  ParallelForTask(const Func &fn, int64_t begin, int64_t end) : fn(fn), begin(begin), end(end) {}
+
+  void Run() override { fn(begin, end); }
+
+  const Func &fn;
+  int64_t begin;
+  int64_t end;
+};
+
+/**
+ * @brief Run fn(begin, end) over disjoint ranges that cover [0, size) on the thread pool
+ *
+ * The range is split into at most max_num_threads contiguous chunks, each of which has at least
+ * min_grain items. fn is called once in the calling thread if the range is too small to split or
+ * there is no context.
+ */
+template <typename Func>
+void ParallelFor(int64_t size, int64_t min_grain, ruy::Context *ruy_context, const Func &fn)
+{
+  if (size <= 0)
+    return;
+
+  int64_t tasks_count = ruy_context ? ruy_context->max_num_threads() : 1;
+  tasks_count = std::min(tasks_count, size / std::max<int64_t>(1, min_grain));
+  if (tasks_count <= 1)
+  {
+    fn(0, size);
+    return;
+  }
+
+  std::vector<ParallelForTask<Func>> tasks;
+  tasks.reserve(tasks_count);
+  for (int64_t i = 0; i < tasks_count; ++i)
+  {
+    tasks.emplace_back(fn, size * i / tasks_count, size * (i + 1) / tasks_count);
+  }
+  Execute(static_cast<int>(tasks_count), tasks.data(), ruy_context);
+}
+
 } // namespace cpu_backend_threadpool
 } // namespace cker
 } // namespace nnfw
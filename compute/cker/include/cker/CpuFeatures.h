@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_CPU_FEATURES_H__
+#define __NNFW_CKER_CPU_FEATURES_H__
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <cpuid.h>
+#include <immintrin.h>
+// Builds for any x86-64 do not pass -mavx2 or -mf16c, so that kernels using them are built with
+// target attributes and selected at runtime
+#define CKER_X86_DISPATCH
+#endif
+
+namespace nnfw
+{
+namespace cker
+{
+
+#ifdef CKER_X86_DISPATCH
+inline bool CpuHasF16C()
+{
+  static const bool has_f16c = [] {
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    // F16C works on AVX registers, whose state the OS should save as well
+    return __builtin_cpu_supports("avx") && __get_cpuid(1, &eax, &ebx, &ecx, &edx) &&
+           (ecx & bit_F16C) != 0;
+  }();
+  return has_f16c;
+}
+
+inline bool CpuHasAVX2()
+{
+  static const bool has_avx2 = __builtin_cpu_supports("avx2");
+  return has_avx2;
+}
+#endif // CKER_X86_DISPATCH
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_CPU_FEATURES_H__
@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_HALF_H__
+#define __NNFW_CKER_HALF_H__
+
+#include "cker/CpuFeatures.h"
+#include "cker/neon/neon_check.h"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief 16-bit floating point formats used to store float weights
+ *
+ * kFloat16 is IEEE 754 binary16, and kBFloat16 is the upper half of a binary32
+ */
+enum class HalfType
+{
+  kFloat16,
+  kBFloat16,
+};
+
+inline float Float16ToFloat(uint16_t value)
+{
+  constexpr uint32_t kShiftedExponent = 0x7c00 << 13;
+  uint32_t bits = static_cast<uint32_t>(value & 0x7fff) << 13;
+  const uint32_t exponent = bits & kShiftedExponent;
+  bits += (127 - 15) << 23;
+  if (exponent == kShiftedExponent)
+  {
+    // Inf or NaN
+    bits += (128 - 16) << 23;
+  }
+  else if (exponent == 0)
+  {
+    // Zero or subnormal, which is normalized by subtracting 2^-14 from 1.mantissa * 2^-14
+    bits += 1 << 23;
+    float normalized;
+    std::memcpy(&normalized, &bits, sizeof(normalized));
+    normalized -= 6.103515625e-05f;
+    std::memcpy(&bits, &normalized, sizeof(bits));
+  }
+  bits |= static_cast<uint32_t>(value & 0x8000) << 16;
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+/**
+ * @brief Convert a float to IEEE binary16 with round-to-nearest-even
+ */
+inline uint16_t FloatToFloat16(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+  bits &= 0x7fffffff;
+
+  if (bits >= 0x7f800000)
+  {
+    // Inf stays Inf, and NaN stays a quiet NaN
+    return sign | 0x7c00 | (bits > 0x7f800000 ? 0x0200 : 0);
+  }
+  if (bits >= 0x477ff000)
+  {
+    // 65520 and above round to Inf
+    return sign | 0x7c00;
+  }
+  if (bits < 0x38800000)
+  {
+    // Below 2^-14, adding 0.5 aligns the result to the 2^-24 step of subnormals and the FPU
+    // rounds it to nearest even
+    float aligned;
+    std::memcpy(&aligned, &bits, sizeof(aligned));
+    aligned += 0.5f;
+    std::memcpy(&bits, &aligned, sizeof(bits));
+    return sign | static_cast<uint16_t>(bits - 0x3f000000);
+  }
+  const uint32_t mantissa_odd = (bits >> 13) & 1;
+  bits += (static_cast<uint32_t>(15 - 127) << 23) + 0xfff + mantissa_odd;
+  return sign | static_cast<uint16_t>(bits >> 13);
+}
+
+inline float BFloat16ToFloat(uint16_t value)
+{
+  const uint32_t bits = static_cast<uint32_t>(value) << 16;
+  float result;
+  std::memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+/**
+ * @brief Convert a float to bfloat16 with round-to-nearest-even
+ */
+inline uint16_t FloatToBFloat16(float value)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  if ((bits & 0x7fffffff) > 0x7f800000)
+  {
+    // Keep NaN from being rounded to Inf
+    return static_cast<uint16_t>(bits >> 16) | 0x0040;
+  }
+  bits += 0x7fff + ((bits >> 16) & 1);
+  return static_cast<uint16_t>(bits >> 16);
+}
+
+/**
+ * @brief Convert 'size' float values to 'type'
+ *
+ * @note  This is called once for constant weights, so that it is not vectorized
+ */
+inline void ConvertFloatToHalf(const float *input_data, int size, HalfType type,
+                               uint16_t *output_data)
+{
+  if (type == HalfType::kFloat16)
+  {
+    for (int i = 0; i < size; ++i)
+      output_data[i] = FloatToFloat16(input_data[i]);
+  }
+  else
+  {
+    for (int i = 0; i < size; ++i)
+      output_data[i] = FloatToBFloat16(input_data[i]);
+  }
+}
+
+#ifdef CKER_X86_DISPATCH
+/**
+ * @brief Expand float16 values of multiples of 8 by F16C, returning the number expanded
+ */
+__attribute__((target("avx,f16c"))) inline int
+ConvertFloat16ToFloatF16C(const uint16_t *input_data, int size, float *output_data)
+{
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_data + i));
+    _mm256_storeu_ps(output_data + i, _mm256_cvtph_ps(input));
+  }
+  return i;
+}
+
+/**
+ * @brief Expand bfloat16 values of multiples of 8 by AVX2, returning the number expanded
+ */
+__attribute__((target("avx2"))) inline int
+ConvertBFloat16ToFloatAVX2(const uint16_t *input_data, int size, float *output_data)
+{
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    const __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input_data + i));
+    const __m256i widened = _mm256_slli_epi32(_mm256_cvtepu16_epi32(input), 16);
+    _mm256_storeu_ps(output_data + i, _mm256_castsi256_ps(widened));
+  }
+  return i;
+}
+#endif // CKER_X86_DISPATCH
+
+/**
+ * @brief Expand 'size' values of 'type' to float
+ *
+ * @note  float16 is converted by NEON on aarch64, and by F16C on x86-64 CPUs which have it
+ */
+inline void ConvertHalfToFloat(const uint16_t *input_data, int size, HalfType type,
+                               float *output_data)
+{
+  int i = 0;
+  if (type == HalfType::kFloat16)
+  {
+#if defined(USE_NEON) && defined(__aarch64__)
+    for (; i <= size - 8; i += 8)
+    {
+      const float16x8_t input = vreinterpretq_f16_u16(vld1q_u16(input_data + i));
+      vst1q_f32(output_data + i, vcvt_f32_f16(vget_low_f16(input)));
+      vst1q_f32(output_data + i + 4, vcvt_high_f32_f16(input));
+    }
+#elif defined(CKER_X86_DISPATCH)
+    if (CpuHasF16C())
+      i = ConvertFloat16ToFloatF16C(input_data, size, output_data);
+#endif
+    for (; i < size; ++i)
+      output_data[i] = Float16ToFloat(input_data[i]);
+  }
+  else
+  {
+#if defined(USE_NEON)
+    for (; i <= size - 8; i += 8)
+    {
+      const uint16x8_t input = vld1q_u16(input_data + i);
+      vst1q_f32(output_data + i, vreinterpretq_f32_u32(vshll_n_u16(vget_low_u16(input), 16)));
+      vst1q_f32(output_data + i + 4, vreinterpretq_f32_u32(vshll_n_u16(vget_high_u16(input), 16)));
+    }
+#elif defined(CKER_X86_DISPATCH)
+    if (CpuHasAVX2())
+      i = ConvertBFloat16ToFloatAVX2(input_data, size, output_data);
+#endif
+    for (; i < size; ++i)
+      output_data[i] = BFloat16ToFloat(input_data[i]);
+  }
+}
+
+/**
+ * @brief Get a float buffer of at least 'size' elements to expand half weights into
+ *
+ * @note  The buffer is per thread and shared by all kernels, so that only the largest expanded
+ *        weights stay alive instead of a float copy of every weights
+ */
+inline float *HalfExpansionBuffer(size_t size)
+{
+  static thread_local std::vector<float> buffer;
+  if (buffer.size() < size)
+    buffer.resize(size);
+  return buffer.data();
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_HALF_H__
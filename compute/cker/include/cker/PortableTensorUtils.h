@@ -19,6 +19,7 @@
 #define __NNFW_CKER_PORTABLE_TENSOR_UTILS_H__
 
 #include "cker/Types.h"
+#include "cker/Utils.h"
 #include "cker/neon/neon_check.h"
 #include <ruy/context.h>
 
@@ -118,6 +119,117 @@ inline void PortableSub1Vector(const float *vector, int v_size, float *result)
   }
 }
 
+inline void PortableSub1Vector(const int16_t *vector, int v_size, int16_t *result)
+{
+  static const int16_t kOne = 32767;
+  for (int v = 0; v < v_size; v++)
+  {
+    *result++ = kOne - *vector++;
+  }
+}
+
+inline void PortableApplySigmoid(const int16_t *input, int32_t n_batch, int32_t n_input,
+                                 int16_t *output)
+{
+  using F3 = gemmlowp::FixedPoint<int16_t, 3>;
+  using F0 = gemmlowp::FixedPoint<int16_t, 0>;
+  for (int i = 0; i < n_batch * n_input; ++i)
+  {
+    F3 sigmoid_input = F3::FromRaw(input[i]);
+    F0 sigmoid_output = gemmlowp::logistic(sigmoid_input);
+    output[i] = sigmoid_output.raw();
+  }
+}
+
+template <int IntegerBits>
+inline void PortableApplyTanhImpl(const int16_t *input, int32_t n_batch, int32_t n_input,
+                                  int16_t *output)
+{
+  using FX = gemmlowp::FixedPoint<int16_t, IntegerBits>;
+  using F0 = gemmlowp::FixedPoint<int16_t, 0>;
+  for (int i = 0; i < n_batch * n_input; ++i)
+  {
+    FX tanh_input = FX::FromRaw(input[i]);
+    F0 tanh_output = gemmlowp::tanh(tanh_input);
+    output[i] = tanh_output.raw();
+  }
+}
+
+// tanh of int16 saturates from 2^6, so that wider inputs are clamped to Q6.9
+inline void PortableApplyTanhSaturated(int32_t integer_bits, const int16_t *input, int32_t n_batch,
+                                       int32_t n_input, int16_t *output)
+{
+  assert(integer_bits > 6 && integer_bits <= 15);
+  using F6 = gemmlowp::FixedPoint<int16_t, 6>;
+  using F0 = gemmlowp::FixedPoint<int16_t, 0>;
+  const int32_t multiplier = 1 << (integer_bits - 6);
+  for (int i = 0; i < n_batch * n_input; ++i)
+  {
+    const int32_t value = static_cast<int32_t>(input[i]) * multiplier;
+    const int16_t clamped = static_cast<int16_t>(std::max(std::min(value, 32767), -32768));
+    F0 tanh_output = gemmlowp::tanh(F6::FromRaw(clamped));
+    output[i] = tanh_output.raw();
+  }
+}
+
+inline void PortableApplyTanh(int32_t integer_bits, const int16_t *input, int32_t n_batch,
+                              int32_t n_input, int16_t *output)
+{
+  assert(integer_bits >= 0);
+#define DISPATCH_TANH(i)                                       \
+  case i:                                                      \
+    PortableApplyTanhImpl<i>(input, n_batch, n_input, output); \
+    break;
+  switch (integer_bits)
+  {
+    DISPATCH_TANH(0);
+    DISPATCH_TANH(1);
+    DISPATCH_TANH(2);
+    DISPATCH_TANH(3);
+    DISPATCH_TANH(4);
+    DISPATCH_TANH(5);
+    DISPATCH_TANH(6);
+    default:
+      PortableApplyTanhSaturated(integer_bits, input, n_batch, n_input, output);
+      break;
+  }
+#undef DISPATCH_TANH
+}
+
+inline void PortableCwiseMul(const int16_t *input_1, const int16_t *input_2, int n_batch,
+                             int n_input, int shift, int16_t *output)
+{
+  for (int i = 0; i < n_batch * n_input; ++i)
+  {
+    const int32_t value = static_cast<int32_t>(input_1[i]) * input_2[i];
+    const int32_t rescaled = gemmlowp::RoundingDivideByPOT(value, shift);
+    output[i] = static_cast<int16_t>(std::max(std::min(rescaled, 32767), -32768));
+  }
+}
+
+inline void PortableCwiseMul(const int16_t *input_1, const int16_t *input_2, int32_t multiplier,
+                             int32_t shift, int32_t n_batch, int32_t n_input, int32_t output_zp,
+                             int8_t *output)
+{
+  for (int i = 0; i < n_batch * n_input; ++i)
+  {
+    int32_t value = static_cast<int32_t>(input_1[i]) * input_2[i];
+    value = MultiplyByQuantizedMultiplier(value, multiplier, shift);
+    value += output_zp;
+    output[i] = static_cast<int8_t>(std::max(std::min(value, 127), -128));
+  }
+}
+
+inline void PortableCwiseAdd(const int16_t *input_1, const int16_t *input_2, int n_batch,
+                             int n_input, int16_t *output)
+{
+  for (int i = 0; i < n_batch * n_input; ++i)
+  {
+    const int32_t sum = static_cast<int32_t>(input_1[i]) + input_2[i];
+    output[i] = static_cast<int16_t>(std::max(std::min(sum, 32767), -32768));
+  }
+}
+
 inline void PortableSymmetricQuantizeFloats(const float *values, const int size,
                                             int8_t *quantized_values, float *min_value,
                                             float *max_value, float *scaling_factor)
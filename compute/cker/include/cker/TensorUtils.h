@@ -117,6 +117,48 @@ inline void Sub1Vector(const float *vector, int v_size, float *result)
   NEON_OR_PORTABLE(Sub1Vector, vector, v_size, result);
 }
 
+inline void Sub1Vector(const int16_t *vector, int v_size, int16_t *result)
+{
+  PortableSub1Vector(vector, v_size, result);
+}
+
+inline void CwiseClipping(int16_t *vector, const int v_size, const int16_t clipping_value)
+{
+  PortableCwiseClipping(vector, v_size, clipping_value);
+}
+
+// Apply sigmoid to Q3.12 values and return Q0.15 values
+inline void ApplySigmoid(const int16_t *input, int32_t n_batch, int32_t n_input, int16_t *output)
+{
+  PortableApplySigmoid(input, n_batch, n_input, output);
+}
+
+// Apply tanh to values of 'integer_bits' integer bits and return Q0.15 values
+inline void ApplyTanh(int32_t integer_bits, const int16_t *input, int32_t n_batch,
+                      int32_t n_input, int16_t *output)
+{
+  PortableApplyTanh(integer_bits, input, n_batch, n_input, output);
+}
+
+inline void CwiseMul(const int16_t *input_1, const int16_t *input_2, int n_batch, int n_input,
+                     int shift, int16_t *output)
+{
+  PortableCwiseMul(input_1, input_2, n_batch, n_input, shift, output);
+}
+
+inline void CwiseMul(const int16_t *input_1, const int16_t *input_2, int32_t multiplier,
+                     int32_t shift, int32_t n_batch, int32_t n_input, int32_t output_zp,
+                     int8_t *output)
+{
+  PortableCwiseMul(input_1, input_2, multiplier, shift, n_batch, n_input, output_zp, output);
+}
+
+inline void CwiseAdd(const int16_t *input_1, const int16_t *input_2, int n_batch, int n_input,
+                     int16_t *output)
+{
+  PortableCwiseAdd(input_1, input_2, n_batch, n_input, output);
+}
+
 inline void SymmetricQuantizeFloats(const float *values, const int size, int8_t *quantized_values,
                                     float *min, float *max, float *scaling_factor)
 {
@@ -18,6 +18,9 @@
 #ifndef __NNFW_CKER_TYPES_H__
 #define __NNFW_CKER_TYPES_H__
 
+#include "cker/Shape.h"
+
+#include <cassert>
 #include <cstdint>
 #include <type_traits>
 #include <limits>
@@ -113,6 +116,9 @@ struct SoftmaxParams
   float *table;
   uint8_t *uint8_table1;
   uint8_t *uint8_table2;
+  // int16 inference params.
+  int16_t *exp_lut;
+  int16_t *one_over_one_plus_x_lut;
 };
 
 struct PackParams
@@ -293,6 +299,24 @@ struct LSTMParams
   bool asymmetric_quantize_inputs;
 };
 
+// Parameters of the integer (8-bit weights and activations, 16-bit cell state) LSTM
+struct IntegerLSTMParams
+{
+  // Effective scales of each gate, in the order of input, forget, cell and output gate
+  int32_t effective_input_scale_a[4];
+  int32_t effective_input_scale_b[4];
+  int32_t effective_recurrent_scale_a[4];
+  int32_t effective_recurrent_scale_b[4];
+
+  int32_t effective_hidden_scale_a;
+  int32_t effective_hidden_scale_b;
+  int32_t hidden_zp;
+
+  // log2 of the power-of-two scale of the cell state
+  int32_t cell_scale;
+  int16_t quantized_cell_clip;
+};
+
 struct GatherParams
 {
   int32_t axis;
@@ -20,6 +20,7 @@
 
 #include "cker/neon/neon_check.h"
 #include "cker/eigen/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -33,7 +34,8 @@ namespace cker
 
 // TODO Change to apply neon for this function if it is faster
 template <typename T>
-void AveragePool(const PoolParams &, const Shape &, const T *, const Shape &, T *)
+void AveragePool(const PoolParams &, const Shape &, const T *, const Shape &, T *,
+                 ruy::Context * = nullptr)
 {
   static_assert(std::is_integral<T>::value || std::is_floating_point<T>::value,
                 "cker::MaxPool : This function supports only integer or floating point");
@@ -42,7 +44,7 @@ void AveragePool(const PoolParams &, const Shape &, const T *, const Shape &, T
 
 template <>
 void AveragePool<float>(const PoolParams &params, const Shape &input_shape, const float *input_data,
-                        const Shape &output_shape, float *output_data)
+                        const Shape &output_shape, float *output_data, ruy::Context *ruy_context)
 {
   assert(input_shape.DimensionsCount() == 4);
   assert(output_shape.DimensionsCount() == 4);
@@ -57,50 +59,66 @@ void AveragePool<float>(const PoolParams &params, const Shape &input_shape, cons
   // TODO(benoitjacob) make this a proper reference impl without Eigen!
   const auto in_mat = MapAsMatrixWithLastDimAsRows(input_data, input_shape);
   auto out_mat = MapAsMatrixWithLastDimAsRows(output_data, output_shape);
-  // TODO(benoitjacob) get rid of the dynamic memory allocation here!
-  Eigen::VectorXf out_count(out_mat.cols());
-  out_count.setZero();
-  // Prefill the output to 0.
-  out_mat.setZero();
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int h = 0; h < input_height; ++h)
+
+  // Channels are independent, so each task pools a range of channels over all positions
+  auto pool = [&](int64_t c_begin, int64_t c_end) {
+    const int c_size = c_end - c_begin;
+    // TODO(benoitjacob) get rid of the dynamic memory allocation here!
+    Eigen::VectorXf out_count(out_mat.cols());
+    out_count.setZero();
+    // Prefill the output to 0.
+    out_mat.middleRows(c_begin, c_size).setZero();
+    for (int b = 0; b < batches; ++b)
     {
-      for (int w = 0; w < input_width; ++w)
+      for (int h = 0; h < input_height; ++h)
       {
-        // (h_start, h_end) * (w_start, w_end) is the range that the input
-        // vector projects to.
-        int hpad = h + params.padding_values.height;
-        int wpad = w + params.padding_values.width;
-        int h_start =
-          (hpad < params.filter_height) ? 0 : (hpad - params.filter_height) / stride_height + 1;
-        int h_end = std::min(hpad / stride_height + 1, output_height);
-        int w_start =
-          (wpad < params.filter_width) ? 0 : (wpad - params.filter_width) / stride_width + 1;
-        int w_end = std::min(wpad / stride_width + 1, output_width);
-        // compute elementwise sum
-        for (int ph = h_start; ph < h_end; ++ph)
+        for (int w = 0; w < input_width; ++w)
         {
-          for (int pw = w_start; pw < w_end; ++pw)
+          // (h_start, h_end) * (w_start, w_end) is the range that the input
+          // vector projects to.
+          int hpad = h + params.padding_values.height;
+          int wpad = w + params.padding_values.width;
+          int h_start =
+            (hpad < params.filter_height) ? 0 : (hpad - params.filter_height) / stride_height + 1;
+          int h_end = std::min(hpad / stride_height + 1, output_height);
+          int w_start =
+            (wpad < params.filter_width) ? 0 : (wpad - params.filter_width) / stride_width + 1;
+          int w_end = std::min(wpad / stride_width + 1, output_width);
+          const int in_offset = NodeOffset(b, h, w, input_height, input_width);
+          // compute elementwise sum
+          for (int ph = h_start; ph < h_end; ++ph)
           {
-            int out_offset = NodeOffset(b, ph, pw, output_height, output_width);
-            out_mat.col(out_offset) += in_mat.col(NodeOffset(b, h, w, input_height, input_width));
-            out_count(out_offset)++;
+            for (int pw = w_start; pw < w_end; ++pw)
+            {
+              int out_offset = NodeOffset(b, ph, pw, output_height, output_width);
+              out_mat.col(out_offset).segment(c_begin, c_size) +=
+                in_mat.col(in_offset).segment(c_begin, c_size);
+              out_count(out_offset)++;
+            }
           }
         }
       }
     }
-  }
-  // Divide the output by the actual number of elements being averaged over
-  assert(out_count.minCoeff() > 0);
-  out_mat.array().rowwise() /= out_count.transpose().array();
+    // Divide the output by the actual number of elements being averaged over
+    assert(out_count.minCoeff() > 0);
+    out_mat.middleRows(c_begin, c_size).array().rowwise() /= out_count.transpose().array();
 
-  const int flat_size = output_shape.FlatSize();
-  for (int i = 0; i < flat_size; ++i)
-  {
-    output_data[i] = ActivationFunctionWithMinMax(output_data[i], params.float_activation_min,
-                                                  params.float_activation_max);
-  }
+    for (int col = 0; col < out_mat.cols(); ++col)
+    {
+      for (int c = c_begin; c < c_end; ++c)
+      {
+        out_mat(c, col) = ActivationFunctionWithMinMax(out_mat(c, col), params.float_activation_min,
+                                                       params.float_activation_max);
+      }
+    }
+  };
+  // Keep enough channels in a task for vectorization
+  const int64_t kMinChannels = 8;
+  const int64_t work_per_channel = static_cast<int64_t>(batches) * input_height * input_width;
+  cpu_backend_threadpool::ParallelFor(
+    out_mat.rows(),
+    std::max(kMinChannels, cpu_backend_threadpool::ParallelForMinGrain(work_per_channel)),
+    ruy_context, pool);
 }
 
 inline void AveragePool16(const PoolParams &params, const Shape &input_shape,
@@ -383,7 +401,7 @@ inline void AveragePool32(const PoolParams &params, const Shape &input_shape,
 template <>
 void AveragePool<uint8_t>(const PoolParams &params, const Shape &input_shape,
                           const uint8_t *input_data, const Shape &output_shape,
-                          uint8_t *output_data)
+                          uint8_t *output_data, ruy::Context *)
 {
   if (params.filter_height * params.filter_width > 16 * 16)
   {
@@ -397,7 +415,8 @@ void AveragePool<uint8_t>(const PoolParams &params, const Shape &input_shape,
 
 template <>
 void AveragePool<int8_t>(const PoolParams &params, const Shape &input_shape,
-                         const int8_t *input_data, const Shape &output_shape, int8_t *output_data)
+                         const int8_t *input_data, const Shape &output_shape, int8_t *output_data,
+                         ruy::Context *)
 {
   // Here, and in other pooling ops, in order to maintain locality of reference,
   // to minimize some recalculations, and to load into NEON vector registers, we
@@ -518,6 +537,62 @@ void AveragePool<int8_t>(const PoolParams &params, const Shape &input_shape,
   }
 }
 
+template <>
+void AveragePool<int16_t>(const PoolParams &params, const Shape &input_shape,
+                          const int16_t *input_data, const Shape &output_shape,
+                          int16_t *output_data, ruy::Context *)
+{
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int depth = MatchingDim(input_shape, 3, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int stride_height = params.stride_height;
+  const int stride_width = params.stride_width;
+
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = (out_x * stride_width) - params.padding_values.width;
+        const int in_y_origin = (out_y * stride_height) - params.padding_values.height;
+        const int filter_x_start = std::max(0, -in_x_origin);
+        const int filter_x_end = std::min(params.filter_width, input_width - in_x_origin);
+        const int filter_y_start = std::max(0, -in_y_origin);
+        const int filter_y_end = std::min(params.filter_height, input_height - in_y_origin);
+        const int filter_count = (filter_x_end - filter_x_start) * (filter_y_end - filter_y_start);
+        for (int channel = 0; channel < depth; ++channel)
+        {
+          // int32 accumulator holds 2^16 int16 values
+          int32_t acc = 0;
+          for (int fy = filter_y_start; fy < filter_y_end; ++fy)
+          {
+            for (int fx = filter_x_start; fx < filter_x_end; ++fx)
+            {
+              const int in_x = in_x_origin + fx;
+              const int in_y = in_y_origin + fy;
+              acc += input_data[Offset(input_shape, batch, in_y, in_x, channel)];
+            }
+          }
+          // Round to the closest integer value.
+          acc = acc > 0 ? (acc + filter_count / 2) / filter_count
+                        : (acc - filter_count / 2) / filter_count;
+          acc = std::max(acc, params.quantized_activation_min);
+          acc = std::min(acc, params.quantized_activation_max);
+          output_data[Offset(output_shape, batch, out_y, out_x, channel)] =
+            static_cast<int16_t>(acc);
+        }
+      }
+    }
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -255,11 +255,39 @@ inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shap
   }
 }
 
+template <BinaryArithmeticOpType op_type>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const int16_t *input1_data, const Shape &input2_shape,
+                               const int16_t *input2_data, const Shape &output_shape,
+                               int16_t *output_data)
+{
+  const int flat_size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  switch (op_type)
+  {
+    case nnfw::cker::BinaryArithmeticOpType::ADD:
+    case nnfw::cker::BinaryArithmeticOpType::SUB:
+      for (int i = 0; i < flat_size; ++i)
+        output_data[i] = reference::quant16_sum(params, input1_data[i], input2_data[i]);
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::MUL:
+      for (int i = 0; i < flat_size; ++i)
+        output_data[i] = reference::quant16_mul(params, input1_data[i], input2_data[i]);
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::DIV:
+    case nnfw::cker::BinaryArithmeticOpType::POW:
+      throw std::runtime_error{"Quant16 Symm NYI"};
+    default:
+      assert(false);
+      break;
+  }
+}
+
 template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<!is_quant8<T>::value>
 BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                             const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                            const Shape &output_shape, T *output_data)
+                            const Shape &output_shape, T *output_data,
+                            ruy::Context * /* ruy_context */ = nullptr)
 {
   reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
                                              input2_data, output_shape, output_data,
@@ -270,18 +298,19 @@ template <BinaryArithmeticOpType op_type, typename T>
 inline typename std::enable_if_t<is_quant8<T>::value>
 BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                             const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                            const Shape &output_shape, T *output_data)
+                            const Shape &output_shape, T *output_data,
+                            ruy::Context *ruy_context = nullptr)
 {
   switch (op_type)
   {
     case nnfw::cker::BinaryArithmeticOpType::ADD:
     case nnfw::cker::BinaryArithmeticOpType::SUB:
       optimized::BroadcastAddDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+                                      output_shape, output_data, ruy_context);
       break;
     case nnfw::cker::BinaryArithmeticOpType::MUL:
       optimized::BroadcastMulDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+                                      output_shape, output_data, ruy_context);
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
     case nnfw::cker::BinaryArithmeticOpType::POW:
@@ -292,30 +321,62 @@ BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1
   }
 }
 
+template <BinaryArithmeticOpType op_type>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const int16_t *input1_data, const Shape &input2_shape,
+                                        const int16_t *input2_data, const Shape &output_shape,
+                                        int16_t *output_data,
+                                        ruy::Context * /* ruy_context */ = nullptr)
+{
+  std::function<int16_t(const int16_t &, const int16_t &)> fn;
+  switch (op_type)
+  {
+    case nnfw::cker::BinaryArithmeticOpType::ADD:
+    case nnfw::cker::BinaryArithmeticOpType::SUB:
+      fn = [&params](const int16_t &a, const int16_t &b) {
+        return reference::quant16_sum(params, a, b);
+      };
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::MUL:
+      fn = [&params](const int16_t &a, const int16_t &b) {
+        return reference::quant16_mul(params, a, b);
+      };
+      break;
+    case nnfw::cker::BinaryArithmeticOpType::DIV:
+    case nnfw::cker::BinaryArithmeticOpType::POW:
+      throw std::runtime_error{"Quant16 Symm NYI"};
+    default:
+      assert(false);
+      return;
+  }
+  reference::BroadcastBinaryArithmeticOpSlow(params, input1_shape, input1_data, input2_shape,
+                                             input2_data, output_shape, output_data, fn);
+}
+
 template <BinaryArithmeticOpType op_type>
 inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                         const float *input1_data, const Shape &input2_shape,
                                         const float *input2_data, const Shape &output_shape,
-                                        float *output_data)
+                                        float *output_data, ruy::Context *ruy_context = nullptr)
 {
   // Supported type is only float now
   switch (op_type)
   {
     case nnfw::cker::BinaryArithmeticOpType::ADD:
       optimized::BroadcastAddDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+                                      output_shape, output_data, ruy_context);
       break;
     case nnfw::cker::BinaryArithmeticOpType::MUL:
       optimized::BroadcastMulDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+                                      output_shape, output_data, ruy_context);
       break;
     case nnfw::cker::BinaryArithmeticOpType::SUB:
       optimized::BroadcastSubDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+                                      output_shape, output_data, ruy_context);
       break;
     case nnfw::cker::BinaryArithmeticOpType::DIV:
       optimized::BroadcastDivDispatch(params, input1_shape, input1_data, input2_shape, input2_data,
-                                      output_shape, output_data);
+                                      output_shape, output_data, ruy_context);
       break;
     case nnfw::cker::BinaryArithmeticOpType::POW:
       reference::BroadcastBinaryArithmeticOpSlow<float>(
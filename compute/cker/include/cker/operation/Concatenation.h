@@ -20,9 +20,11 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/CpuBackendThreadpool.h"
 
 #include <cstdint>
 #include <cmath>
+#include <vector>
 
 namespace nnfw
 {
@@ -32,7 +34,7 @@ namespace cker
 template <typename Scalar>
 inline void Concatenation(const ConcatenationParams &params, const Shape *const *input_shapes,
                           const Scalar *const *input_data, const Shape &output_shape,
-                          Scalar *output_data)
+                          Scalar *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = params.axis;
   int inputs_count = params.inputs_count;
@@ -67,16 +69,29 @@ inline void Concatenation(const ConcatenationParams &params, const Shape *const
     base_inner_size *= output_shape.Dims(i);
   }
 
-  Scalar *output_ptr = output_data;
-  for (int k = 0; k < outer_size; k++)
+  // Offset of each input in a row of the output, which has a copy of all inputs
+  std::vector<int64_t> row_offsets(inputs_count + 1, 0);
+  for (int i = 0; i < inputs_count; ++i)
   {
-    for (int i = 0; i < inputs_count; ++i)
+    row_offsets[i + 1] = row_offsets[i] + input_shapes[i]->Dims(axis) * base_inner_size;
+  }
+  const int64_t row_size = row_offsets[inputs_count];
+
+  // Each (k, input) pair is a contiguous copy
+  auto concat = [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end; ++index)
     {
-      const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
-      memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
-      output_ptr += copy_size;
+      const int64_t k = index / inputs_count;
+      const int i = index % inputs_count;
+      const int64_t copy_size = row_offsets[i + 1] - row_offsets[i];
+      memcpy(output_data + k * row_size + row_offsets[i], input_data[i] + k * copy_size,
+             copy_size * sizeof(Scalar));
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    outer_size * inputs_count,
+    cpu_backend_threadpool::ParallelForMinGrain(row_size / std::max(inputs_count, 1)), ruy_context,
+    concat);
 }
 
 // quantized as it takes scale as a floating point value. This should be fixed
@@ -21,8 +21,10 @@
 #include "cker/Types.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
+#include "cker/Half.h"
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
+#include "cker/operation/optimized/WinogradConv.h"
 #include <iostream>
 #include <vector>
 
@@ -55,15 +57,36 @@ inline void TransposeFloatTensor(const float *input_data, const nnfw::cker::Shap
 class Conv
 {
 public:
-  Conv() : _modified_filter_data(), _im2col_shape(4), _need_im2col(false), _prepared(false) {}
+  Conv()
+    : _modified_filter_data(), _half_filter_data(), _half_filter_type(HalfType::kFloat16),
+      _winograd_tile(0), _im2col_shape(4), _need_im2col(false), _prepared(false)
+  {
+  }
 
+  /**
+   * @brief Prepare constant float filter
+   *
+   * 3x3 convolutions of stride 1 run by Winograd if it is worth it for the channels and the size of
+   * output_shape, whose filter is transformed here. output_shape is empty if it is not known.
+   */
   void prepare(const Shape &filter_shape, const float *filter_data, PaddingType padding_type,
                bool &is_replaced_weights, uint32_t dilationWidthFactor,
-               uint32_t dilationHeightFactor)
+               uint32_t dilationHeightFactor, uint32_t strideWidth, uint32_t strideHeight,
+               const Shape &output_shape)
   {
     if (!_prepared)
     {
-      if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
+      _winograd_tile =
+        optimized::WinogradOutputTile(filter_shape, output_shape, strideWidth, strideHeight,
+                                      dilationWidthFactor, dilationHeightFactor);
+      if (_winograd_tile != 0)
+      {
+        _winograd_filter_data.resize(optimized::WinogradFilterSize(_winograd_tile, filter_shape));
+        optimized::TransformWinogradFilter(_winograd_tile, filter_shape, filter_data,
+                                           _winograd_filter_data.data());
+        is_replaced_weights = true;
+      }
+      else if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
       {
         transposeFilter(filter_shape, filter_data, is_replaced_weights);
       }
@@ -71,6 +94,33 @@ public:
     }
   }
 
+  /**
+   * @brief Prepare constant float filter to be kept as float16 or bfloat16
+   *
+   * @note  The filter is converted in the layout which the kernel reads, and expanded to float in
+   *        each run. filter_data is not used after this.
+   */
+  void prepareHalf(const Shape &filter_shape, const float *filter_data, HalfType filter_type,
+                   PaddingType padding_type, uint32_t dilationWidthFactor,
+                   uint32_t dilationHeightFactor)
+  {
+    if (!_prepared)
+    {
+      const float *source = filter_data;
+      if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
+      {
+        bool is_transposed = false;
+        transposeFilter(filter_shape, filter_data, is_transposed);
+        source = _modified_filter_data.data();
+      }
+      _half_filter_data.resize(filter_shape.FlatSize());
+      ConvertFloatToHalf(source, filter_shape.FlatSize(), filter_type, _half_filter_data.data());
+      _half_filter_type = filter_type;
+      std::vector<float>().swap(_modified_filter_data);
+      _prepared = true;
+    }
+  }
+
   void prepareQuant(const Shape &input_shape, const Shape &kernel_shape, const Shape &output_shape,
                     uint32_t stride_width, uint32_t stride_height, uint32_t dilation_width_factor,
                     uint32_t dilation_height_factor)
@@ -87,8 +137,26 @@ public:
                   const Shape &filter_shape, const float *filter_data, const Shape &bias_shape,
                   const float *bias_data, const Shape &output_shape, float *output_data)
   {
-    if (usableMultiThreaded(params.padding_type, params.dilation_width_factor,
-                            params.dilation_height_factor))
+    if (_winograd_tile != 0)
+    {
+      // Shapes are the ones of prepare() as Winograd is chosen for static output only
+      optimized::WinogradConv(params, _winograd_tile, input_shape, input_data, filter_shape,
+                              _winograd_filter_data.data(), bias_shape, bias_data, output_shape,
+                              output_data);
+      return;
+    }
+
+    const bool multi_threaded = usableMultiThreaded(
+      params.padding_type, params.dilation_width_factor, params.dilation_height_factor);
+    if (!_half_filter_data.empty())
+    {
+      // Expand the filter kept by prepareHalf(), which is already transposed if multi_threaded
+      float *expanded_filter_data = HalfExpansionBuffer(_half_filter_data.size());
+      ConvertHalfToFloat(_half_filter_data.data(), _half_filter_data.size(), _half_filter_type,
+                         expanded_filter_data);
+      filter_data = expanded_filter_data;
+    }
+    else if (multi_threaded)
     {
       bool transposed_in_execution = false;
       if (!_prepared)
@@ -98,8 +166,13 @@ public:
         // transposing filter data
         transposeFilter(filter_shape, filter_data, transposed_in_execution);
       }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
-                          bias_shape, bias_data, output_shape, output_data);
+      filter_data = &_modified_filter_data[0];
+    }
+
+    if (multi_threaded)
+    {
+      multithreaded::Conv(params, input_shape, input_data, filter_shape, filter_data, bias_shape,
+                          bias_data, output_shape, output_data);
     }
     else
     {
@@ -146,6 +219,17 @@ public:
                     input_shape, input_data, filter_shape, filter_data, bias_shape, bias_data,
                     output_shape, output_data);
   }
+
+  template <typename FilterT>
+  void operator()(const ConvParams &params, const Shape &input_shape, const int16_t *input_data,
+                  const Shape &filter_shape, const FilterT *filter_data, const Shape &bias_shape,
+                  const int64_t *bias_data, const Shape &output_shape, int16_t *output_data)
+  {
+    reference::Conv(params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+                    input_shape, input_data, filter_shape, filter_data, bias_shape, bias_data,
+                    output_shape, output_data);
+  }
+
   std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
   std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
 
@@ -188,6 +272,11 @@ private:
 
 private:
   std::vector<float> _modified_filter_data;
+  std::vector<uint16_t> _half_filter_data;
+  HalfType _half_filter_type;
+  // Output tile size of Winograd, or 0 if the convolution does not run by Winograd
+  int _winograd_tile;
+  std::vector<float> _winograd_filter_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
@@ -23,16 +23,17 @@
 #include "cker/Utils.h"
 
 #include "cker/operation/Helper/Tensor.h"
-#include "cker/operation/Helper/MatmulBCast.h"
 
 #include "Transpose.h"
-#include "BatchMatMul.h"
 
 #include <string>
 #include <vector>
 #include <map>
 #include <numeric>
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 
 namespace nnfw
 {
@@ -182,7 +183,7 @@ inline Shape copyShape(const Shape &shape)
 class Einsum
 {
 public:
-  Einsum() : _prepared(false)
+  Einsum() : _prepared(false), _planned(false), _scratch_used(0)
   {
     // DO NOTHING
   }
@@ -199,21 +200,119 @@ public:
     _prepared = true;
   }
 
+  /**
+   * @brief Plan the contraction of inputs of the shapes
+   *
+   * The plan is reused while the input shapes stay the same, so that a run only moves and
+   * multiplies data.
+   */
+  void prepare(std::string &equation, const std::vector<Shape> &input_shapes)
+  {
+    prepare(equation);
+
+    if (_planned && isPlannedFor(input_shapes))
+    {
+      return;
+    }
+
+    makePlan(input_shapes);
+    _planned = true;
+  }
+
   void operator()(std::string &equation, const std::vector<Shape> &input_shapes,
                   const std::vector<const float *> &input_data, const Shape &output_shape,
                   float *output_data)
   {
-    if (!_prepared)
+    prepare(equation, input_shapes);
+    _scratch_used = 0;
+
+    // The reduction phase (a) sums across reduction dimensions, (b) takes
+    // generalized diagonals, and (c) reshapes it into shape
+    //   [(broadcasting) batch shape] + [F,C]
+    // where F and C denote the total (compacted) size of free and contract
+    // dimensions, respectively.
+    const int num_inputs = input_shapes.size();
+    std::vector<Tensor> inputs_reduced(num_inputs);
+    for (int i = 0; i < num_inputs; ++i)
+    {
+      reduceOperand<float>(_operand_plans[i], input_shapes[i], input_data[i], &inputs_reduced[i]);
+    }
+
+    // After reduction, the inputs should be reshaped to Tensors suitable for
+    // contraction. If num_inputs is 1, the reduced input is simply forwarded to
+    // the output. The contraction is written to the output directly if it is in the order of
+    // the output already.
+    Tensor contraction_output_reshaped;
+    const bool is_final = !_inflate_output && !_transpose_output;
+    contractOperands(inputs_reduced, is_final ? output_data : nullptr,
+                     &contraction_output_reshaped);
+
+    // Reshape the contraction (or reduction) result to its expanded shape:
+    // [(broadcasted) batch shape] + [free shape 0] + [free shape 1].
+    Tensor contraction_output;
+    copyFrom(contraction_output_reshaped, _result_shape, &contraction_output);
+
+    // Inflate the output if necessary. (E.g. for the equation 'i->iii' which
+    // may arise while computing gradient of a regular Einsum).
+    // TODO(anudhyan): It's possible that Eigen's contract and inflate can be
+    // chained here to avoid materializing an intermediate.
+    Tensor output_inflated;
+    if (_inflate_output)
+    {
+      strideOrInflate<float>(contraction_output, _result_labels, _output_label_counts_planned,
+                             true /* should_inflate */, &output_inflated);
+    }
+    else
+    {
+      copyFrom(contraction_output, contraction_output.shape, &output_inflated);
+    }
+
+    assert(output_inflated.shape.FlatSize() == output_shape.FlatSize());
+    if (_transpose_output)
+    {
+      transposeTo<float>(output_inflated.shape, output_inflated.base<float>(),
+                         _output_permutation, output_data);
+    }
+    else if (output_inflated.base<float>() != output_data)
+    {
+      memcpy(output_data, output_inflated.buffer, output_shape.FlatSize() * sizeof(float));
+    }
+  }
+
+private:
+  // Steps to reduce an input to the shape [batch shape] + [F,C], which are found from its shape
+  struct OperandPlan
+  {
+    std::vector<int32_t> permutation;
+    bool transpose = false;
+    Labels labels;
+    LabelCounts label_counts;
+    bool stride = false;
+    int32_t reduce_size = 1;
+    Shape shape;
+    bool swap_free_and_contract = false;
+    Labels free_labels;
+  };
+
+  bool isPlannedFor(const std::vector<Shape> &input_shapes) const
+  {
+    if (input_shapes.size() != _planned_input_shapes.size())
+      return false;
+    for (size_t i = 0; i < input_shapes.size(); ++i)
     {
-      prepare(equation);
+      if (!(input_shapes[i] == _planned_input_shapes[i]))
+        return false;
     }
+    return true;
+  }
 
+  void makePlan(const std::vector<Shape> &input_shapes)
+  {
     const int num_inputs = input_shapes.size();
-    std::vector<InputTensor<float>> inputs(num_inputs);
-    for (int i = 0; i < num_inputs; i++)
+    _planned_input_shapes.clear();
+    for (const auto &shape : input_shapes)
     {
-      inputs[i].shape.ReplaceWith(input_shapes[i].DimensionsCount(), input_shapes[i].DimsData());
-      inputs[i].buffer = input_data[i];
+      _planned_input_shapes.emplace_back(shape);
     }
 
     OperandLabels input_labels(_input_labels);
@@ -223,128 +322,151 @@ public:
     LabelCounts output_label_counts(_output_label_counts);
     LabelToDimSizes label_to_dim_sizes;
 
-    processDimensions(inputs, &input_labels, &output_labels, &label_types, &input_label_counts,
-                      &output_label_counts, &label_to_dim_sizes);
-
-    // The reduction phase (a) sums across reduction dimensions, (b) takes
-    // generalized diagonals, and (c) reshapes it into shape
-    //   [(broadcasting) batch shape] + [F,C]
-    // where F and C denote the total (compacted) size of free and contract
-    // dimensions, respectively.
+    processDimensions(input_shapes, &input_labels, &output_labels, &label_types,
+                      &input_label_counts, &output_label_counts, &label_to_dim_sizes);
 
-    OperandLabels free_labels(num_inputs);
-    std::vector<Tensor> inputs_reduced(num_inputs);
-    std::vector<bool> swap_free_and_contract(num_inputs);
+    _operand_plans.clear();
+    _operand_plans.resize(num_inputs);
     for (int i = 0; i < num_inputs; ++i)
     {
-      bool temp_swap_free_and_contract = false;
-      reduceOperand<float>(inputs[i], label_types, input_label_counts[i], &input_labels[i],
-                           &free_labels[i], &temp_swap_free_and_contract, &inputs_reduced[i]);
-      swap_free_and_contract[i] = temp_swap_free_and_contract;
+      planOperand(input_shapes[i], label_types, input_label_counts[i], &input_labels[i],
+                  &_operand_plans[i]);
     }
 
-    // After reduction, the inputs should be reshaped to Tensors suitable for
-    // contraction. If num_inputs is 1, the reduced input is simply forwarded to
-    // the output.
-    Tensor contraction_output_reshaped;
-    contractOperands(inputs_reduced, swap_free_and_contract, &contraction_output_reshaped);
-
     // Copy the batch labels from the contraction output. Recover the batch
     // shape, which may have been broadcasted.
-    std::vector<int32_t> result_shape_dims(contraction_output_reshaped.shape.DimensionsCount() - 2);
-
-    for (size_t i = 0; i < result_shape_dims.size(); i++)
+    std::vector<int32_t> result_shape_dims;
+    if (num_inputs == 1)
     {
-      result_shape_dims[i] = contraction_output_reshaped.shape.Dims(i);
+      const Shape &shape = _operand_plans[0].shape;
+      for (int i = 0; i < shape.DimensionsCount() - 2; i++)
+      {
+        result_shape_dims.push_back(shape.Dims(i));
+      }
+    }
+    else
+    {
+      planBatches(&result_shape_dims);
     }
 
-    int num_labels = label_types.size();
-    Labels result_labels;
+    const int num_labels = label_types.size();
+    Labels batch_labels;
     // All batch dimensions should be present in the contracted result. First
     // the broadcasting dimensions, then the named batch dimensions.
     for (int label = 0; label < num_labels; ++label)
     {
       if (label_types[label] == kBroadcasting)
-        result_labels.push_back(label);
+        batch_labels.push_back(label);
     }
     for (int label = 0; label < num_labels; ++label)
     {
       if (label_types[label] == kBatch)
-        result_labels.push_back(label);
+        batch_labels.push_back(label);
     }
-    for (int i = 0; i < num_inputs; ++i)
+
+    _inflate_output = std::any_of(output_label_counts.begin(), output_label_counts.end(),
+                                  [](int c) { return c > 1; });
+    _output_label_counts_planned = output_label_counts;
+
+    // The contraction of swapped operands is the transposed contraction, so it saves transposing
+    // the output if the output has the free dimensions of the second input first
+    _swap_operands = false;
+    planResultLabels(batch_labels);
+    planOutputPermutation(output_labels, num_labels);
+    if (_transpose_output && num_inputs == 2 && !_inflate_output)
     {
-      for (int label : free_labels[i])
+      _swap_operands = true;
+      planResultLabels(batch_labels);
+      planOutputPermutation(output_labels, num_labels);
+      if (_transpose_output)
       {
-        result_labels.push_back(label);
-        result_shape_dims.push_back(label_to_dim_sizes[label]);
+        // Neither order saves the transpose
+        _swap_operands = false;
+        planResultLabels(batch_labels);
+        planOutputPermutation(output_labels, num_labels);
       }
     }
 
-    Shape result_shape(result_shape_dims.size(), result_shape_dims.data());
-
-    // Reshape the contraction (or reduction) result to its expanded shape:
-    // [(broadcasted) batch shape] + [free shape 0] + [free shape 1].
-    Tensor contraction_output;
-    copyFrom(contraction_output_reshaped, result_shape, &contraction_output);
+    if (num_inputs == 2)
+    {
+      std::vector<int32_t> contraction_dims(result_shape_dims);
+      const int lhs = _swap_operands ? 1 : 0;
+      contraction_dims.push_back(freeSize(_operand_plans[lhs]));
+      contraction_dims.push_back(freeSize(_operand_plans[1 - lhs]));
+      _contraction_shape.ReplaceWith(contraction_dims.size(), contraction_dims.data());
+    }
 
-    // Inflate the output if necessary. (E.g. for the equation 'i->iii' which
-    // may arise while computing gradient of a regular Einsum).
-    // TODO(anudhyan): It's possible that Eigen's contract and inflate can be
-    // chained here to avoid materializing an intermediate.
-    Tensor output_inflated;
-    strideOrInflate<float>(contraction_output, result_labels, output_label_counts,
-                           true /* should_inflate */, &output_inflated);
+    for (int i = 0; i < num_inputs; ++i)
+    {
+      const int operand = _swap_operands ? num_inputs - 1 - i : i;
+      for (int label : _operand_plans[operand].free_labels)
+      {
+        result_shape_dims.push_back(label_to_dim_sizes[label]);
+      }
+    }
+    _result_shape.ReplaceWith(result_shape_dims.size(), result_shape_dims.data());
 
-    if (output_inflated.shape.DimensionsCount() > contraction_output.shape.DimensionsCount())
+    if (_inflate_output)
     {
-      // We inflated the output. Modify result labels accordingly.
+      // We inflate the output. Modify result labels accordingly.
       Labels inflated_labels;
-      for (int label : result_labels)
+      for (int label : _result_labels)
       {
         inflated_labels.insert(inflated_labels.end(), output_label_counts[label], label);
       }
-      result_labels.swap(inflated_labels);
+      Labels result_labels(_result_labels);
+      _result_labels.swap(inflated_labels);
+      planOutputPermutation(output_labels, num_labels);
+      // strideOrInflate takes the labels before inflation
+      _result_labels.swap(result_labels);
     }
+  }
+
+  void planResultLabels(const Labels &batch_labels)
+  {
+    _result_labels = batch_labels;
+    const int num_inputs = _operand_plans.size();
+    for (int i = 0; i < num_inputs; ++i)
+    {
+      const int operand = _swap_operands ? num_inputs - 1 - i : i;
+      const Labels &free_labels = _operand_plans[operand].free_labels;
+      _result_labels.insert(_result_labels.end(), free_labels.begin(), free_labels.end());
+    }
+  }
 
-    // Find the permutation to map the result labels to the output labels. Note
-    // that both the result and the final output may have the repeated labels,
-    // in which case the permutation preserves the left-to-right ordering.
-    // E.g. if result labels are [0, 0, 1] and output is [0, l, 0] then the
-    // permutation should be [0, 2, 1]. We also use the fact that repeated
-    // labels in the result are adjacent to each other.
-    std::vector<int32_t> output_permutation(output_labels.size());
+  // Find the permutation to map the result labels to the output labels. Note
+  // that both the result and the final output may have the repeated labels,
+  // in which case the permutation preserves the left-to-right ordering.
+  // E.g. if result labels are [0, 0, 1] and output is [0, l, 0] then the
+  // permutation should be [0, 2, 1]. We also use the fact that repeated
+  // labels in the result are adjacent to each other.
+  void planOutputPermutation(const Labels &output_labels, int num_labels)
+  {
+    _output_permutation.resize(output_labels.size());
     std::vector<int32_t> label_to_position(num_labels, -1);
-    for (size_t i = 0; i < result_labels.size(); ++i)
+    for (size_t i = 0; i < _result_labels.size(); ++i)
     {
       // Remember the position of only the leftmost result label.
-      if (label_to_position[result_labels[i]] == -1)
+      if (label_to_position[_result_labels[i]] == -1)
       {
-        label_to_position[result_labels[i]] = i;
+        label_to_position[_result_labels[i]] = i;
       }
     }
     for (size_t i = 0; i < output_labels.size(); ++i)
     {
-      output_permutation[i] = label_to_position[output_labels[i]];
+      _output_permutation[i] = label_to_position[output_labels[i]];
       // We have found the leftmost occurrence. The next one would be adjacent.
       label_to_position[output_labels[i]] += 1;
     }
 
-    InputTensor<float> temp_inflated;
-    temp_inflated.shape.ReplaceWith(output_inflated.shape.DimensionsCount(),
-                                    output_inflated.shape.DimsData());
-    temp_inflated.buffer = (reinterpret_cast<const float *>(output_inflated.buffer));
-    ;
-
-    Tensor output;
-    transposeOperand<float>(temp_inflated, output_permutation, &output);
-
-    memcpy(output_data, output.buffer, output_shape.FlatSize() * sizeof(float));
-
-    temp_operand.clear();
+    _transpose_output = false;
+    for (size_t i = 0; i < _output_permutation.size(); ++i)
+    {
+      if (_output_permutation[i] != static_cast<int32_t>(i))
+        _transpose_output = true;
+    }
   }
 
-private:
   void parseEquation(std::string &equation)
   {
     std::vector<std::string> input_str;
@@ -441,18 +563,17 @@ private:
     }
   }
 
-  template <typename T>
-  void processDimensions(const std::vector<InputTensor<T>> &inputs, OperandLabels *input_labels,
+  void processDimensions(const std::vector<Shape> &input_shapes, OperandLabels *input_labels,
                          Labels *output_labels, std::vector<DimensionType> *label_types,
                          OperandLabelCounts *input_label_counts, LabelCounts *output_label_counts,
                          LabelToDimSizes *label_to_dim_sizes)
   {
-    if (inputs.size() != input_labels->size())
+    if (input_shapes.size() != input_labels->size())
     {
       throw std::runtime_error{"Expected " + std::to_string(input_labels->size()) +
-                               " inputs but got: " + std::to_string(inputs.size())};
+                               " inputs but got: " + std::to_string(input_shapes.size())};
     }
-    const int num_inputs = inputs.size();
+    const int num_inputs = input_shapes.size();
 
     // We infer the number of broadcasting dimensions by taking the maximum rank
     // among the broadcasting subshapes of the input.
@@ -465,29 +586,29 @@ private:
 
       if (!_input_has_ellipsis[i])
       {
-        if (inputs[i].shape.DimensionsCount() != ((int32_t)labels->size()))
+        if (input_shapes[i].DimensionsCount() != ((int32_t)labels->size()))
         {
           throw std::runtime_error{"Expected input " + std::to_string(i) + " to have rank " +
                                    std::to_string(labels->size()) + " but got: " +
-                                   std::to_string(inputs[i].shape.DimensionsCount())};
+                                   std::to_string(input_shapes[i].DimensionsCount())};
         }
         for (size_t label_idx = 0; label_idx < labels->size(); ++label_idx)
         {
           const int label = (*labels)[label_idx];
-          recordLabelToDimension(label, label_idx, inputs[i].shape, label_to_dim_sizes);
+          recordLabelToDimension(label, label_idx, input_shapes[i], label_to_dim_sizes);
         }
         continue;
       }
 
       // Input has an ellipsis.
-      if (inputs[i].shape.DimensionsCount() + 1 < (int32_t)labels->size())
+      if (input_shapes[i].DimensionsCount() + 1 < (int32_t)labels->size())
       {
         throw std::runtime_error{"Expected input " + std::to_string(i) + " to have rank at least " +
                                  std::to_string(labels->size() - 1) +
-                                 " but got: " + std::to_string(inputs[i].shape.DimensionsCount())};
+                                 " but got: " + std::to_string(input_shapes[i].DimensionsCount())};
       }
       int ellipsis_axis = -1;
-      const int num_bcast_dims = inputs[i].shape.DimensionsCount() - labels->size() + 1;
+      const int num_bcast_dims = input_shapes[i].DimensionsCount() - labels->size() + 1;
       for (size_t label_idx = 0; label_idx < labels->size(); ++label_idx)
       {
         const int label = (*labels)[label_idx];
@@ -498,7 +619,7 @@ private:
         }
         // Current label is not an ellipsis.
         const int axis = label_idx + (ellipsis_axis == -1 ? 0 : num_bcast_dims - 1);
-        recordLabelToDimension(label, axis, inputs[i].shape, label_to_dim_sizes);
+        recordLabelToDimension(label, axis, input_shapes[i], label_to_dim_sizes);
       }
       // Found an ellipsis. Replace 'kEllipsisLabel' with broadcasting
       // dimensions.
@@ -560,24 +681,21 @@ private:
     label_counts->resize(num_named_labels + num_bcast_dims, 1);
   }
 
-  template <typename T>
-  void reduceOperand(const InputTensor<T> &input, const std::vector<DimensionType> &label_types,
-                     const LabelCounts &label_counts, Labels *labels, Labels *free_labels,
-                     bool *swap_free_and_contract, Tensor *output)
+  void planOperand(const Shape &input_shape, const std::vector<DimensionType> &label_types,
+                   const LabelCounts &label_counts, Labels *labels, OperandPlan *plan)
   {
     // Find the permutation to transpose the input dimensions in the order of
     // DimensionType; i.e. batch, free, contract and reduce dimensions. This
     // makes it more convenient to invoke Reduce/Contract operations.
-    std::vector<int32_t> permutation(input.shape.DimensionsCount());
+    std::vector<int32_t> permutation(input_shape.DimensionsCount());
     std::iota(permutation.begin(), permutation.end(), 0);
-    Tensor input_transposed;
 
     // Check if we can avoid the transpose. We need to flip the adj_x (or adj_y)
     // flag during BatchMatMul. This is an extra optimization not necessary for
     // correctness.
     if (shouldSwapFreeAndContract(*labels, label_types))
     {
-      *swap_free_and_contract = true;
+      plan->swap_free_and_contract = true;
     }
     else
     {
@@ -588,15 +706,29 @@ private:
       });
     }
     // Transpose the input so that DimensionTypes are in order.
-    transposeOperand<T>(input, permutation, &input_transposed);
+    plan->transpose = shouldTranspose(input_shape, permutation) && input_shape.FlatSize() != 0;
+    plan->permutation = permutation;
 
+    std::vector<int32_t> transposed_dims(input_shape.DimensionsCount());
+    for (int i = 0; i < input_shape.DimensionsCount(); ++i)
+    {
+      transposed_dims[i] = input_shape.Dims(permutation[i]);
+    }
     permuteLabels(permutation, labels);
 
     // Take the generalized diagonal for dimensions with repeated axis labels.
-    Tensor input_deduped;
+    // Repeated labels are adjacent after the transpose.
+    std::vector<int32_t> deduped_dims;
+    for (size_t label_idx = 0; label_idx < labels->size(); ++label_idx)
+    {
+      if (label_idx == 0 || (*labels)[label_idx] != (*labels)[label_idx - 1])
+        deduped_dims.push_back(transposed_dims[label_idx]);
+    }
     labels->erase(std::unique(labels->begin(), labels->end()), labels->end());
-    strideOrInflate<T>(input_transposed, *labels, label_counts, false /* should_inflate */,
-                       &input_deduped);
+    plan->labels = *labels;
+    plan->label_counts = label_counts;
+    plan->stride =
+      !std::all_of(label_counts.begin(), label_counts.end(), [](int c) { return c <= 1; });
 
     // Reshape denotes the rank-5 shape [broadcast, batch, free, contract,
     // reduce] where we've compacted the dimensions of each DimensionType.
@@ -606,37 +738,83 @@ private:
     // That is, the batch shape is preserved (for broadcasting while
     // contracting) while the free dims and contract dims are compressed to one
     // dimension each.
-    Shape output_shape;
     std::vector<int32_t> output_shape_dims;
     for (size_t label_idx = 0; label_idx < labels->size(); ++label_idx)
     {
       const int label = labels->at(label_idx);
-      int32_t dim = input_deduped.shape.Dims(label_idx);
+      int32_t dim = deduped_dims[label_idx];
       if (label_types[label] == kBroadcasting || label_types[label] == kBatch)
       {
         output_shape_dims.push_back(dim);
       }
       else if (label_types[label] == kFree)
       {
-        free_labels->push_back(label);
+        plan->free_labels.push_back(label);
       }
       reshape[label_types[label]] *= dim;
     }
 
-    if (*swap_free_and_contract)
+    if (plan->swap_free_and_contract)
       std::swap(reshape[kFree], reshape[kContract]);
 
     output_shape_dims.push_back(reshape[kFree]);
     output_shape_dims.push_back(reshape[kContract]);
 
-    output_shape.ReplaceWith(output_shape_dims.size(), output_shape_dims.data());
+    plan->shape.ReplaceWith(output_shape_dims.size(), output_shape_dims.data());
+    plan->reduce_size = reshape[kReduce];
+  }
+
+  template <typename T>
+  void reduceOperand(const OperandPlan &plan, const Shape &input_shape, const T *input_data,
+                     Tensor *output)
+  {
+    // The input is only read, so that it is used in place unless it has to be transposed
+    Tensor input;
+    input.shape.ReplaceWith(input_shape);
+    input.buffer = const_cast<T *>(input_data);
+
+    Tensor input_transposed;
+    if (plan.transpose)
+    {
+      allocateTemp(permutedShape(input_shape, plan.permutation), &input_transposed);
+      transposeTo<T>(input_shape, input_data, plan.permutation, input_transposed.base<T>());
+    }
+    else
+    {
+      // An empty input only changes its shape
+      copyFrom(input, permutedShape(input_shape, plan.permutation), &input_transposed);
+    }
+
+    // Eigen maps of the input below expect the alignment of allocated buffers
+    const bool is_aligned =
+      reinterpret_cast<uintptr_t>(input_transposed.buffer) % alignof(std::max_align_t) == 0;
+    if (!is_aligned && (plan.stride || plan.reduce_size != 1))
+    {
+      Tensor input_copied;
+      allocateTemp(input_transposed.shape, &input_copied);
+      memcpy(input_copied.buffer, input_transposed.buffer,
+             input_transposed.shape.FlatSize() * sizeof(T));
+      copyFrom(input_copied, input_copied.shape, &input_transposed);
+    }
 
-    if (reshape[kReduce] == 1)
+    // Take the generalized diagonal for dimensions with repeated axis labels.
+    Tensor input_deduped;
+    if (plan.stride)
+    {
+      strideOrInflate<T>(input_transposed, plan.labels, plan.label_counts,
+                         false /* should_inflate */, &input_deduped);
+    }
+    else
+    {
+      copyFrom(input_transposed, input_transposed.shape, &input_deduped);
+    }
+
+    if (plan.reduce_size == 1)
     { // No need to actually reduce.
-      return copyFrom(input_deduped, output_shape, output);
+      return copyFrom(input_deduped, plan.shape, output);
     }
 
-    allocateTemp(output_shape, output);
+    allocateTemp(plan.shape, output);
 
     using Reducer = Eigen::internal::SumReducer<T>;
     using Index = typename TTypes<T>::Tensor::Index;
@@ -644,11 +822,10 @@ private:
     const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
 
     // Reduce along the last axis (i.e axis 1) of the rank-2 Tensor.
-    const int32_t output_size =
-      reshape[kBroadcasting] * reshape[kBatch] * reshape[kFree] * reshape[kContract];
+    const int32_t output_size = plan.shape.FlatSize();
     functor::ReduceFunctor<Eigen::ThreadPoolDevice, Reducer>::Reduce(
       device, output->shaped<T, 1>({output_size}),
-      input_deduped.shaped<T, 2>({output_size, reshape[kReduce]}), Eigen::array<Index, 1>({1}),
+      input_deduped.shaped<T, 2>({output_size, plan.reduce_size}), Eigen::array<Index, 1>({1}),
       Reducer());
   }
 
@@ -670,31 +847,20 @@ private:
     return true;
   }
 
-  template <typename T>
-  void transposeOperand(const InputTensor<T> &input, const std::vector<int32_t> &permutation,
-                        Tensor *output)
+  Shape permutedShape(const Shape &shape, const std::vector<int32_t> &permutation)
   {
-    if (!shouldTranspose(input.shape, permutation))
-    {
-      copyFrom(input, input.shape, output);
-      return;
-    }
-    Shape transposed_shape(input.shape.DimensionsCount());
-    for (int i = 0; i < input.shape.DimensionsCount(); ++i)
+    Shape permuted_shape(shape.DimensionsCount());
+    for (int i = 0; i < shape.DimensionsCount(); ++i)
     {
-      transposed_shape.SetDim(i, input.shape.Dims(permutation[i]));
+      permuted_shape.SetDim(i, shape.Dims(permutation[i]));
     }
-    // For empty Tensors, just change the shape. E.g. we may need to transpose
-    // from shape [1, 0, 5] to [5, 1, 0].
-    if (input.shape.FlatSize() == 0)
-    {
-      copyFrom(input, transposed_shape, output);
-      return;
-    }
-
-    temp_operand.emplace_back(std::make_unique<T[]>(transposed_shape.FlatSize()));
-    T *new_buffer = temp_operand.back().get();
+    return permuted_shape;
+  }
 
+  template <typename T>
+  void transposeTo(const Shape &input_shape, const T *input_data,
+                   const std::vector<int32_t> &permutation, T *output_data)
+  {
     TransposeParams transpose_params;
     transpose_params.perm_count = permutation.size();
     for (size_t i = 0; i < permutation.size(); i++)
@@ -702,10 +868,8 @@ private:
       transpose_params.perm[i] = permutation[i];
     }
 
-    Transpose<T>(transpose_params, input.shape, input.buffer, transposed_shape, new_buffer);
-
-    output->shape.ReplaceWith(transposed_shape.DimensionsCount(), transposed_shape.DimsData());
-    output->buffer = new_buffer;
+    Transpose<T>(transpose_params, input_shape, input_data,
+                 permutedShape(input_shape, permutation), output_data);
   }
 
   bool shouldTranspose(const Shape &input_shape, const std::vector<int32_t> &permutation)
@@ -720,18 +884,6 @@ private:
     return false;
   }
 
-  template <typename T>
-  void copyFrom(const InputTensor<T> &input, const Shape &shape, Tensor *output)
-  {
-    Tensor temp_tensor;
-    temp_tensor.shape.ReplaceWith(input.shape.DimensionsCount(), input.shape.DimsData());
-    temp_operand.emplace_back(std::make_unique<float[]>(input.shape.FlatSize()));
-    temp_tensor.buffer = temp_operand.back().get();
-    memcpy(temp_tensor.buffer, input.buffer, input.shape.FlatSize() * sizeof(float));
-
-    copyFrom(temp_tensor, shape, output);
-  }
-
   void copyFrom(const Tensor &input, const Shape &shape, Tensor *output)
   {
     if (output->copyFrom(input, shape))
@@ -797,9 +949,7 @@ private:
 
     Shape output_shape = Shape(should_inflate ? inflated_shape : strided_shape);
 
-    output->shape.ReplaceWith(output_shape.DimensionsCount(), output_shape.DimsData());
-    temp_operand.emplace_back(std::make_unique<float[]>(output_shape.FlatSize()));
-    output->buffer = temp_operand.back().get();
+    allocateTemp(output_shape, output);
 
     const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
 
@@ -840,81 +990,184 @@ private:
   void allocateTemp(const Shape &shape, Tensor *output)
   {
     output->shape.ReplaceWith(shape.DimensionsCount(), shape.DimsData());
-    temp_operand.emplace_back(std::make_unique<float[]>(shape.FlatSize()));
-    output->buffer = temp_operand.back().get();
+    output->buffer = allocateScratch(shape.FlatSize());
   }
 
-  // Contracts the inputs along the last axis. (or the second last if the
-  // corresponding value of swap_free_and_contract is true). The batch
-  // dimensions are broadcast to the output shape.
-  // TODO(anudhyan): Factor this function into a BatchMatMul functor and support
-  // transpose_x and transpose_y attributes (in addition to adj_x and adj_y).
-  // Also, the BatchMatMul might devolve into a component-wise multiplication
-  // when the matrix shape is [1,1]; in this case BatchMatMul functor would be
-  // very inefficient. The functor should detect if this is the case and perform
-  // componentwise multiplication functor instead.
-  void contractOperands(std::vector<Tensor> &inputs, std::vector<bool> &swap_free_and_contract,
-                        Tensor *output)
+  float *allocateScratch(int32_t size)
   {
-    if (inputs.size() == 1)
-      return copyFrom(inputs[0], inputs[0].shape, output);
+    // Buffers are kept across runs, and the n-th buffer of a run is reused for the same
+    // intermediate of the next run
+    if (_scratch_used == _scratch.size())
+      _scratch.emplace_back();
+    std::vector<float> &buffer = _scratch[_scratch_used++];
+    if (buffer.size() < static_cast<size_t>(size))
+      buffer.resize(size);
+    return buffer.data();
+  }
+
+  int32_t freeSize(const OperandPlan &plan) const
+  {
+    const int rank = plan.shape.DimensionsCount();
+    return plan.shape.Dims(plan.swap_free_and_contract ? rank - 1 : rank - 2);
+  }
+
+  int32_t contractSize(const OperandPlan &plan) const
+  {
+    const int rank = plan.shape.DimensionsCount();
+    return plan.shape.Dims(plan.swap_free_and_contract ? rank - 2 : rank - 1);
+  }
 
-    MatMulBCast bcast(inputs[0].shape, inputs[1].shape);
-    if (!bcast.IsValid())
+  // Broadcast the batch dimensions of the reduced inputs, and find the batch of each input that
+  // each batch of the contraction reads
+  void planBatches(std::vector<int32_t> *batch_dims)
+  {
+    const Shape &x_shape = _operand_plans[0].shape;
+    const Shape &y_shape = _operand_plans[1].shape;
+    const int x_batch_rank = x_shape.DimensionsCount() - 2;
+    const int y_batch_rank = y_shape.DimensionsCount() - 2;
+    const int batch_rank = std::max(x_batch_rank, y_batch_rank);
+
+    if (contractSize(_operand_plans[0]) != contractSize(_operand_plans[1]))
     {
-      throw std::runtime_error{"Einsum: Invalid broadcasting dimensions"};
+      throw std::runtime_error{"Einsum: Contraction dimensions of inputs do not match"};
     }
 
-    Tensor lhs;
-    reshapeToRank3(inputs[0], bcast.x_batch_size(), &lhs);
-    Tensor rhs;
-    reshapeToRank3(inputs[1], bcast.y_batch_size(), &rhs);
-    Shape old_output_shape = bcast.output_batch_shape();
-    Shape output_shape(old_output_shape.DimensionsCount() + inputs.size());
-    for (int i = 0; i < old_output_shape.DimensionsCount(); i++)
+    auto batch_dim = [](const Shape &shape, int batch_rank, int axis) {
+      return axis >= 0 && axis < batch_rank ? shape.Dims(axis) : 1;
+    };
+    batch_dims->resize(batch_rank);
+    for (int i = 0; i < batch_rank; ++i)
     {
-      output_shape.SetDim(i, old_output_shape.Dims(i));
+      const int32_t x_dim = batch_dim(x_shape, x_batch_rank, i - (batch_rank - x_batch_rank));
+      const int32_t y_dim = batch_dim(y_shape, y_batch_rank, i - (batch_rank - y_batch_rank));
+      if (x_dim != y_dim && x_dim != 1 && y_dim != 1)
+      {
+        throw std::runtime_error{"Einsum: Invalid broadcasting dimensions"};
+      }
+      (*batch_dims)[i] = (x_dim == 1) ? y_dim : x_dim;
     }
 
-    for (size_t i = 0; i < inputs.size(); ++i)
+    _batch_count = std::accumulate(batch_dims->begin(), batch_dims->end(), INT32_C(1),
+                                   std::multiplies<int32_t>());
+    for (int operand = 0; operand < 2; ++operand)
     {
-      const int32_t free_axis =
-        inputs[i].shape.DimensionsCount() - (swap_free_and_contract[i] ? 1 : 2);
-      output_shape.SetDim(i + old_output_shape.DimensionsCount(), inputs[i].shape.Dims(free_axis));
+      const Shape &shape = _operand_plans[operand].shape;
+      const int operand_batch_rank = shape.DimensionsCount() - 2;
+      std::vector<int32_t> &batch_indices = _batch_indices[operand];
+      batch_indices.resize(_batch_count);
+      for (int32_t batch = 0; batch < _batch_count; ++batch)
+      {
+        int32_t remaining = batch;
+        int32_t index = 0;
+        int32_t stride = 1;
+        for (int i = batch_rank - 1; i >= 0; --i)
+        {
+          const int32_t coord = remaining % (*batch_dims)[i];
+          remaining /= (*batch_dims)[i];
+          const int32_t dim =
+            batch_dim(shape, operand_batch_rank, i - (batch_rank - operand_batch_rank));
+          if (dim != 1)
+            index += coord * stride;
+          stride *= dim;
+        }
+        batch_indices[batch] = index;
+      }
     }
-    bool adj_x = swap_free_and_contract[0];
-    bool adj_y = !swap_free_and_contract[1];
+  }
 
-    allocateTemp(output_shape, output);
+  // Contracts the inputs along the last axis. (or the second last if the
+  // corresponding value of swap_free_and_contract is true). The batch
+  // dimensions are broadcast to the output shape. The output is written to output_data if it is
+  // given.
+  void contractOperands(std::vector<Tensor> &inputs, float *output_data, Tensor *output)
+  {
+    if (inputs.size() == 1)
+      return copyFrom(inputs[0], inputs[0].shape, output);
 
-    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+    const int lhs = _swap_operands ? 1 : 0;
+    const int rhs = 1 - lhs;
+    const OperandPlan &lhs_plan = _operand_plans[lhs];
+    const OperandPlan &rhs_plan = _operand_plans[rhs];
+    const int32_t m = freeSize(lhs_plan);
+    const int32_t n = freeSize(rhs_plan);
+    const int32_t k = contractSize(lhs_plan);
 
-    if (lhs.shape.FlatSize() == 0 || rhs.shape.FlatSize() == 0)
+    if (output_data != nullptr)
     {
-      functor::SetZeroFunctor<Eigen::ThreadPoolDevice, float> set_zero;
-      set_zero(device,
-               typename TTypes<float, 1>::Tensor(output->base<float>(), output->shape.FlatSize()));
-      return;
+      output->shape.ReplaceWith(_contraction_shape);
+      output->buffer = output_data;
+    }
+    else
+    {
+      allocateTemp(_contraction_shape, output);
     }
 
-    Tensor output_reshaped;
-    reshapeToRank3(*output, bcast.output_batch_size(), &output_reshaped);
+    float *out_data = output->base<float>();
+    if (k == 0)
+    {
+      std::fill(out_data, out_data + _contraction_shape.FlatSize(), 0.f);
+      return;
+    }
+    if (_contraction_shape.FlatSize() == 0)
+      return;
 
-    // LaunchBatchMatMul::Launch(lhs, rhs, adj_x, adj_y, bcast, &output_reshaped);
-    BatchMatMul batchMatMul;
-    batchMatMul.prepare(lhs.shape, rhs.shape, adj_x, adj_y);
-    batchMatMul(lhs.shape, lhs.base<float>(), rhs.shape, rhs.base<float>(), adj_x, adj_y,
-                output_reshaped.shape, output_reshaped.base<float>());
-  }
+    // Inputs are contracted in the layout they are in, instead of transposing them to [F,C]
+    using ConstMatrix = TTypes<float, 2>::UnalignedConstTensor;
+    using Matrix = TTypes<float, 2>::UnalignedTensor;
+    using Index = Eigen::DenseIndex;
+    const bool lhs_swap = lhs_plan.swap_free_and_contract;
+    const bool rhs_swap = rhs_plan.swap_free_and_contract;
+    const Eigen::array<Eigen::IndexPair<Index>, 1> contract_pairs = {
+      Eigen::IndexPair<Index>(lhs_swap ? 0 : 1, rhs_swap ? 0 : 1)};
+    const Eigen::DSizes<Index, 2> lhs_dims = lhs_swap ? Eigen::DSizes<Index, 2>(k, m)
+                                                      : Eigen::DSizes<Index, 2>(m, k);
+    const Eigen::DSizes<Index, 2> rhs_dims = rhs_swap ? Eigen::DSizes<Index, 2>(k, n)
+                                                      : Eigen::DSizes<Index, 2>(n, k);
+    const float *lhs_data = inputs[lhs].base<float>();
+    const float *rhs_data = inputs[rhs].base<float>();
+    const std::vector<int32_t> &lhs_indices = _batch_indices[lhs];
+    const std::vector<int32_t> &rhs_indices = _batch_indices[rhs];
+
+    auto lhs_matrix = [&](int32_t batch) {
+      return ConstMatrix(lhs_data + static_cast<int64_t>(lhs_indices[batch]) * m * k, lhs_dims);
+    };
+    auto rhs_matrix = [&](int32_t batch) {
+      return ConstMatrix(rhs_data + static_cast<int64_t>(rhs_indices[batch]) * n * k, rhs_dims);
+    };
+    auto out_matrix = [&](int32_t batch) {
+      return Matrix(out_data + static_cast<int64_t>(batch) * m * n, m, n);
+    };
 
-  void reshapeToRank3(const Tensor &input, int batch_size, Tensor *output)
-  {
-    const int rank = input.shape.DimensionsCount();
-    Shape output_shape({batch_size, input.shape.Dims(rank - 2), input.shape.Dims(rank - 1)});
-    copyFrom(input, output_shape, output);
+    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+    const int64_t matrix_cost = static_cast<int64_t>(m) * n * k;
+    if (_batch_count == 1 ||
+        (_batch_count < device.numThreads() && matrix_cost >= kMinThreadedContractionCost))
+    {
+      // Eigen splits a large contraction across the threads
+      for (int32_t batch = 0; batch < _batch_count; ++batch)
+      {
+        out_matrix(batch).device(device) =
+          lhs_matrix(batch).contract(rhs_matrix(batch), contract_pairs);
+      }
+    }
+    else
+    {
+      // Batches of small contractions run in parallel, each of which runs in a thread
+      const Eigen::TensorOpCost cost(sizeof(float) * (m + n) * k, sizeof(float) * m * n,
+                                     2 * matrix_cost);
+      device.parallelFor(_batch_count, cost, [&](Index begin, Index end) {
+        for (Index batch = begin; batch < end; ++batch)
+        {
+          out_matrix(batch) = lhs_matrix(batch).contract(rhs_matrix(batch), contract_pairs);
+        }
+      });
+    }
   }
 
 private:
+  // A contraction of as many multiply-adds as this is worth splitting across threads
+  static constexpr int64_t kMinThreadedContractionCost = 64 * 64 * 64;
+
   bool _prepared;
 
   OperandLabels _input_labels;
@@ -925,7 +1178,24 @@ private:
   std::vector<bool> _input_has_ellipsis;
   bool _output_has_ellipsis = false;
 
-  std::vector<std::unique_ptr<float[]>> temp_operand;
+  // Plan for _planned_input_shapes
+  bool _planned;
+  std::vector<Shape> _planned_input_shapes;
+  std::vector<OperandPlan> _operand_plans;
+  bool _swap_operands = false;
+  int32_t _batch_count = 0;
+  std::vector<int32_t> _batch_indices[2];
+  Shape _contraction_shape;
+  Shape _result_shape;
+  Labels _result_labels;
+  LabelCounts _output_label_counts_planned;
+  bool _inflate_output = false;
+  std::vector<int32_t> _output_permutation;
+  bool _transpose_output = false;
+
+  // Intermediate buffers, which are reused across runs
+  std::vector<std::vector<float>> _scratch;
+  size_t _scratch_used;
 };
 
 } // namespace cker
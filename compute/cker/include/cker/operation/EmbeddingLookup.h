@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_EMBEDDING_LOOKUP_H__
+#define __NNFW_CKER_EMBEDDING_LOOKUP_H__
+
+#include "cker/Shape.h"
+#include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Half.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+
+/**
+ * @brief Gather rows of a large table by lookups, such as an embedding table
+ *
+ * A row which is looked up several times in a call is read from the table once, and the other
+ * outputs are copied from the first one. Rows of upcoming lookups are prefetched, since rows of a
+ * large table are rarely in cache.
+ *
+ * @note  The table is only read, so that it may be in a mmap'd model
+ */
+class EmbeddingLookup
+{
+public:
+  // Unique rows between the row being read and the row being prefetched
+  static constexpr int kPrefetchDistance = 8;
+  // Rows longer than this are left to the hardware prefetcher after their beginning
+  static constexpr int kMaxPrefetchBytes = 1024;
+  static constexpr int kCacheLineSize = 64;
+
+public:
+  /**
+   * @brief Copy rows of T as they are
+   */
+  template <typename T, typename LookupT>
+  void operator()(const Shape &table_shape, const T *table_data, int lookups_count,
+                  const LookupT *lookups_data, T *output_data, ruy::Context *ruy_context = nullptr)
+  {
+    const int row_size = RowSize(table_shape);
+    gather(lookups_data, lookups_count, table_shape.Dims(0), table_data, row_size,
+           [&](int64_t row, T *output) {
+             std::memcpy(output, table_data + row * row_size, row_size * sizeof(T));
+           },
+           output_data, ruy_context);
+  }
+
+  /**
+   * @brief Expand rows of float16 or bfloat16 to float
+   */
+  template <typename LookupT>
+  void operator()(const Shape &table_shape, const uint16_t *table_data, HalfType table_type,
+                  int lookups_count, const LookupT *lookups_data, float *output_data,
+                  ruy::Context *ruy_context = nullptr)
+  {
+    const int row_size = RowSize(table_shape);
+    gather(lookups_data, lookups_count, table_shape.Dims(0), table_data, row_size,
+           [&](int64_t row, float *output) {
+             ConvertHalfToFloat(table_data + row * row_size, row_size, table_type, output);
+           },
+           output_data, ruy_context);
+  }
+
+  /**
+   * @brief Dequantize rows of int8 to float
+   *
+   * @param scales      Scale of each row, or a scale of the table if scales_count is 1
+   * @param zero_point  Zero point of the table
+   */
+  template <typename LookupT>
+  void operator()(const Shape &table_shape, const int8_t *table_data, const float *scales,
+                  int scales_count, int32_t zero_point, int lookups_count,
+                  const LookupT *lookups_data, float *output_data,
+                  ruy::Context *ruy_context = nullptr)
+  {
+    const int row_size = RowSize(table_shape);
+    assert(scales_count == 1 || scales_count == table_shape.Dims(0));
+    gather(lookups_data, lookups_count, table_shape.Dims(0), table_data, row_size,
+           [&](int64_t row, float *output) {
+             const int8_t *input = table_data + row * row_size;
+             const float scale = scales[scales_count == 1 ? 0 : row];
+             for (int i = 0; i < row_size; ++i)
+             {
+               output[i] = scale * (static_cast<int32_t>(input[i]) - zero_point);
+             }
+           },
+           output_data, ruy_context);
+  }
+
+private:
+  static int RowSize(const Shape &table_shape)
+  {
+    assert(table_shape.DimensionsCount() >= 1);
+    return FlatSizeSkipDim(table_shape, 0);
+  }
+
+  static void PrefetchRow(const void *row, int row_bytes)
+  {
+#if defined(__GNUC__)
+    const char *begin = static_cast<const char *>(row);
+    const int prefetch_bytes = std::min(row_bytes, kMaxPrefetchBytes);
+    for (int offset = 0; offset < prefetch_bytes; offset += kCacheLineSize)
+    {
+      __builtin_prefetch(begin + offset, 0, 3);
+    }
+#else
+    UNUSED_RELEASE(row);
+    UNUSED_RELEASE(row_bytes);
+#endif
+  }
+
+  /**
+   * @brief Find the first lookup of each row, checking that the lookups are in the table
+   *
+   * _unique gets the first lookups, and _duplicates gets the others whose first lookup is in
+   * _source.
+   */
+  template <typename LookupT>
+  void deduplicate(const LookupT *lookups_data, int lookups_count, int64_t rows_count)
+  {
+    // Open addressing by Fibonacci hashing, whose capacity is a power of two over twice the count
+    int capacity_bits = 1;
+    while ((1 << capacity_bits) < 2 * lookups_count)
+      ++capacity_bits;
+    const uint32_t mask = (1u << capacity_bits) - 1;
+    _slots.assign(mask + 1, -1);
+    _source.resize(lookups_count);
+    _unique.clear();
+    _duplicates.clear();
+
+    for (int i = 0; i < lookups_count; ++i)
+    {
+      if (lookups_data[i] < 0 || lookups_data[i] >= rows_count)
+        throw std::runtime_error("EmbeddingLookup: lookup out of the table");
+
+      const uint64_t key = static_cast<uint64_t>(lookups_data[i]);
+      uint32_t slot = static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> (64 - capacity_bits));
+      while (_slots[slot] != -1 && lookups_data[_slots[slot]] != lookups_data[i])
+      {
+        slot = (slot + 1) & mask;
+      }
+
+      if (_slots[slot] == -1)
+      {
+        _slots[slot] = i;
+        _source[i] = i;
+        _unique.push_back(i);
+      }
+      else
+      {
+        _source[i] = _slots[slot];
+        _duplicates.push_back(i);
+      }
+    }
+  }
+
+  template <typename LookupT, typename TableT, typename OutputT, typename ReadRowFn>
+  void gather(const LookupT *lookups_data, int lookups_count, int64_t rows_count,
+              const TableT *table_data, int row_size, const ReadRowFn &read_row,
+              OutputT *output_data, ruy::Context *ruy_context)
+  {
+    deduplicate(lookups_data, lookups_count, rows_count);
+
+    const int table_row_bytes = row_size * sizeof(TableT);
+    auto read_unique = [&](int64_t begin, int64_t end) {
+      for (int64_t u = begin; u < std::min<int64_t>(begin + kPrefetchDistance, end); ++u)
+      {
+        PrefetchRow(table_data + lookups_data[_unique[u]] * row_size, table_row_bytes);
+      }
+      for (int64_t u = begin; u < end; ++u)
+      {
+        if (u + kPrefetchDistance < end)
+        {
+          const auto ahead = lookups_data[_unique[u + kPrefetchDistance]];
+          PrefetchRow(table_data + ahead * row_size, table_row_bytes);
+        }
+        const int i = _unique[u];
+        read_row(lookups_data[i], output_data + static_cast<int64_t>(i) * row_size);
+      }
+    };
+    cpu_backend_threadpool::ParallelFor(_unique.size(),
+                                        cpu_backend_threadpool::ParallelForMinGrain(row_size),
+                                        ruy_context, read_unique);
+
+    auto copy_duplicates = [&](int64_t begin, int64_t end) {
+      for (int64_t d = begin; d < end; ++d)
+      {
+        const int i = _duplicates[d];
+        std::memcpy(output_data + static_cast<int64_t>(i) * row_size,
+                    output_data + static_cast<int64_t>(_source[i]) * row_size,
+                    row_size * sizeof(OutputT));
+      }
+    };
+    cpu_backend_threadpool::ParallelFor(_duplicates.size(),
+                                        cpu_backend_threadpool::ParallelForMinGrain(row_size),
+                                        ruy_context, copy_duplicates);
+  }
+
+private:
+  std::vector<int32_t> _slots;
+  std::vector<int32_t> _source;
+  std::vector<int32_t> _unique;
+  std::vector<int32_t> _duplicates;
+};
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_EMBEDDING_LOOKUP_H__
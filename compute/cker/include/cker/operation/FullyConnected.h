@@ -21,6 +21,9 @@
 #include <ruy/context.h>
 #include "cker/operation/FullyConnectedDense16x1.h"
 #include "cker/operation/FullyConnectedSparse16x1.h"
+#include "cker/ruy/RuySupport.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Half.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -89,6 +92,60 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+/**
+ * @brief FullyConnected of float input and weights stored as float16 or bfloat16
+ *
+ * @note  Rows of weights are expanded to float a block at a time in each task, and the block is
+ *        reused by every batch while it is in cache
+ */
+inline void FullyConnectedHalfWeights(const FullyConnectedParams &params, const Shape &input_shape,
+                                      const float *input_data, const Shape &weights_shape,
+                                      const uint16_t *weights_data, HalfType weights_type,
+                                      const Shape &, const float *bias_data, const Shape &,
+                                      float *output_data, ruy::Context *ruy_context)
+{
+  int total_input_size = input_shape.FlatSize();
+  const int input_size = weights_shape.Dims(1);
+  const int batch_size = total_input_size / input_size;
+  const int num_units = weights_shape.Dims(0);
+
+  // Output = bias if bias tensor exists.
+  if (bias_data)
+  {
+    VectorBatchVectorAssign(bias_data, num_units, batch_size, output_data);
+  }
+  else
+  {
+    ZeroVector(output_data, batch_size * num_units);
+  }
+
+  // 16KB of expanded weights per block
+  const int block_rows = std::max(1, 4096 / input_size);
+  auto fc = [&](int64_t begin, int64_t end) {
+    float *block = HalfExpansionBuffer(block_rows * input_size);
+    for (int64_t row = begin; row < end; row += block_rows)
+    {
+      const int rows = static_cast<int>(std::min<int64_t>(block_rows, end - row));
+      ConvertHalfToFloat(weights_data + row * input_size, rows * input_size, weights_type, block);
+      for (int b = 0; b < batch_size; ++b)
+      {
+        MatrixBatchVectorMultiplyAccumulate(block, rows, input_size, input_data + b * input_size,
+                                            /*n_batch=*/1, output_data + b * num_units + row,
+                                            /*result_stride=*/1);
+      }
+    }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    num_units, cpu_backend_threadpool::ParallelForMinGrain(input_size * batch_size), ruy_context,
+    fc);
+
+  if (params.activation != FusedActivationFunctionType::kNone)
+  {
+    // Apply activation function
+    ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
+  }
+}
+
 inline void FullyConnected(const FullyConnectedParams &params, const Shape &input_shape,
                            const uint8_t *input_data, const Shape &filter_shape,
                            const uint8_t *filter_data, const Shape &bias_shape,
@@ -143,6 +200,118 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier, const int *output_shift,
+                                     const Shape &input_shape, const int8_t *input_data,
+                                     const Shape &filter_shape, const int8_t *filter_data,
+                                     const Shape &bias_shape, const int32_t *bias_data,
+                                     const Shape &output_shape, int8_t *output_data,
+                                     ruy::Context *ruy_context)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(output_activation_min <= output_activation_max);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+    MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+
+  // Weights are constant, so ruy may keep the packed weights across runs
+  MatrixParams<int8_t> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = output_depth;
+  lhs_params.cols = accum_depth;
+  lhs_params.zero_point = -params.weights_offset;
+  lhs_params.cache_policy = CachePolicy::kAlwaysCache;
+
+  MatrixParams<int8_t> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = accum_depth;
+  rhs_params.cols = batches;
+  rhs_params.zero_point = -params.input_offset;
+
+  MatrixParams<int8_t> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = output_depth;
+  dst_params.cols = batches;
+  dst_params.zero_point = params.output_offset;
+
+  GemmParams<int32_t, int8_t, QuantizationFlavor::kIntegerWithPerRowMultiplier> gemm_params;
+  gemm_params.bias = bias_data;
+  gemm_params.clamp_min = static_cast<int8_t>(output_activation_min);
+  gemm_params.clamp_max = static_cast<int8_t>(output_activation_max);
+  gemm_params.multiplier_fixedpoint_perchannel = output_multiplier;
+  gemm_params.multiplier_exponent_perchannel = output_shift;
+
+  // Below code is from tflite::cpu_backend_gemm::detail::GemmImplUsingRuy
+  ruy::Matrix<int8_t> ruy_lhs;
+  ruy::Matrix<int8_t> ruy_rhs;
+  ruy::Matrix<int8_t> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, filter_data, &ruy_lhs, true);
+  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, output_data, &ruy_dst);
+
+  ruy::BasicSpec<int32_t, int8_t> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+// int16 activations with int8 (or int16) weights, which need the int64 accumulator
+template <typename FilterT>
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier, const int *output_shift,
+                                     const Shape &input_shape, const int16_t *input_data,
+                                     const Shape &filter_shape, const FilterT *filter_data,
+                                     const Shape &bias_shape, const int64_t *bias_data,
+                                     const Shape &output_shape, int16_t *output_data)
+{
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(output_activation_min <= output_activation_max);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+    MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int out_c = 0; out_c < output_depth; ++out_c)
+    {
+      // int16 activations are symmetric, so there is no input offset
+      int64_t acc = 0;
+      for (int d = 0; d < accum_depth; ++d)
+      {
+        int32_t input_val = input_data[b * accum_depth + d];
+        int32_t filter_val = filter_data[out_c * accum_depth + d];
+        acc += static_cast<int64_t>(filter_val) * input_val;
+      }
+      if (bias_data)
+      {
+        acc += bias_data[out_c];
+      }
+      int32_t scaled_acc =
+        MultiplyByQuantizedMultiplier(acc, output_multiplier[out_c], output_shift[out_c]);
+      scaled_acc = std::max(scaled_acc, output_activation_min);
+      scaled_acc = std::min(scaled_acc, output_activation_max);
+      output_data[out_c + output_depth * b] = static_cast<int16_t>(scaled_acc);
+    }
+  }
+}
+
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
                                  const float *input_data, const Shape &filter_shape,
                                  const int8_t *filter_data, const Shape &, const float *bias_data,
@@ -21,16 +21,26 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Half.h"
+
+#include <cstring>
 
 namespace nnfw
 {
 namespace cker
 {
 
-template <typename T, typename CoordsT = int32_t>
-inline void Gather(const GatherParams &op_params, const Shape &input_shape, const T *input_data,
-                   const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
-                   T *output_data)
+namespace gather
+{
+
+/**
+ * @brief Call copy(output_offset, input_offset, inner_size) for each slice of Gather
+ */
+template <typename CoordsT, typename CopyFn>
+inline void ForEachSlice(const GatherParams &op_params, const Shape &input_shape,
+                         const Shape &coords_shape, const CoordsT *coords_data,
+                         ruy::Context *ruy_context, const CopyFn &copy)
 {
   int axis = op_params.axis;
   if (axis < 0)
@@ -54,17 +64,51 @@ inline void Gather(const GatherParams &op_params, const Shape &input_shape, cons
     inner_size *= input_shape.Dims(i);
   }
 
-  for (int outer = 0; outer < outer_size; ++outer)
-  {
-    for (int i = 0; i < coords_count; ++i)
+  // Each (outer, coord) pair copies a contiguous slice of inner_size
+  auto gather = [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end; ++index)
     {
+      const int outer = index / coords_count;
+      const int i = index % coords_count;
       assert(coords_data[i] >= 0);
       assert(coords_data[i] < axis_size);
-      std::memcpy(output_data + (outer * coords_count + i) * inner_size,
-                  input_data + (outer * axis_size + coords_data[i]) * inner_size,
-                  sizeof(T) * inner_size);
+      const int64_t slice = static_cast<int64_t>(outer) * axis_size + coords_data[i];
+      copy(index * inner_size, slice * inner_size, inner_size);
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(static_cast<int64_t>(outer_size) * coords_count,
+                                      cpu_backend_threadpool::ParallelForMinGrain(inner_size),
+                                      ruy_context, gather);
+}
+
+} // namespace gather
+
+template <typename T, typename CoordsT = int32_t>
+inline void Gather(const GatherParams &op_params, const Shape &input_shape, const T *input_data,
+                   const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
+                   T *output_data, ruy::Context *ruy_context = nullptr)
+{
+  gather::ForEachSlice(op_params, input_shape, coords_shape, coords_data, ruy_context,
+                       [&](int64_t output_offset, int64_t input_offset, int inner_size) {
+                         std::memcpy(output_data + output_offset, input_data + input_offset,
+                                     sizeof(T) * inner_size);
+                       });
+}
+
+/**
+ * @brief Gather of float16 or bfloat16 input, whose slices are expanded to float output
+ */
+template <typename CoordsT = int32_t>
+inline void Gather(const GatherParams &op_params, const Shape &input_shape,
+                   const uint16_t *input_data, HalfType input_type, const Shape &coords_shape,
+                   const CoordsT *coords_data, const Shape &, float *output_data,
+                   ruy::Context *ruy_context = nullptr)
+{
+  gather::ForEachSlice(op_params, input_shape, coords_shape, coords_data, ruy_context,
+                       [&](int64_t output_offset, int64_t input_offset, int inner_size) {
+                         ConvertHalfToFloat(input_data + input_offset, inner_size, input_type,
+                                            output_data + output_offset);
+                       });
 }
 
 } // namespace cker
@@ -20,6 +20,8 @@
 
 #include "cker/TensorUtils.h"
 #include "cker/Types.h"
+#include "cker/Utils.h"
+#include "cker/ruy/RuySupport.h"
 
 namespace nnfw
 {
@@ -365,6 +367,288 @@ inline void LstmStepFloat(
   }
 }
 
+// Finishes a single gate of the float LSTM whose matrix products are already accumulated in
+// 'gate', for a single batch. See CalculateLstmGateFloat for the parameters.
+inline void FinishLstmGateFloat(const float *cell_state, const float *cell_to_gate_weights,
+                                const float *layer_norm_coefficients, const float *gate_bias,
+                                int n_cell, FusedActivationFunctionType activation, float *gate)
+{
+  if (cell_to_gate_weights != nullptr)
+  {
+    VectorBatchVectorCwiseProductAccumulate(cell_to_gate_weights, n_cell, cell_state, 1, gate);
+  }
+  if (layer_norm_coefficients != nullptr)
+  {
+    MeanStddevNormalization(gate, gate, n_cell, 1);
+    VectorBatchVectorCwiseProduct(layer_norm_coefficients, n_cell, gate, 1, gate);
+    VectorBatchVectorAdd(gate_bias, n_cell, 1, gate);
+  }
+  ApplyActivationToVector(gate, n_cell, activation, gate);
+}
+
+// Performs a float LSTM inference step whose input projection is precomputed.
+//
+// Unlike LstmStepFloat, the weights of the gates are packed in the order of input, forget, cell
+// and output gate (the input gate is omitted with CIFG), so that all gates are computed by a
+// single matrix product:
+//   recurrent_weights_ptr      - 'n_gates * n_cell' x 'n_output'
+//   gates_ptr                  - 'n_batch' x 'n_gates * n_cell', holds the input projection of
+//                                this step (plus gate biases without layer norm), which is
+//                                computed by LstmGatesMatMul for the whole sequence at once.
+//                                It is overwritten by the gate activations.
+//   scratch                    - 'n_cell'
+// Other parameters are the same as LstmStepFloat. Gate biases are used only with layer norm.
+inline void LstmStepFloatWithPrecomputedInput(
+  const float *recurrent_weights_ptr, const float *cell_to_input_weights_ptr,
+  const float *cell_to_forget_weights_ptr, const float *cell_to_output_weights_ptr,
+  const float *input_layer_norm_coefficients_ptr, const float *forget_layer_norm_coefficients_ptr,
+  const float *cell_layer_norm_coefficients_ptr, const float *output_layer_norm_coefficients_ptr,
+  const float *input_gate_bias_ptr, const float *forget_gate_bias_ptr,
+  const float *cell_gate_bias_ptr, const float *output_gate_bias_ptr,
+  const float *projection_weights_ptr, const float *projection_bias_ptr, const LSTMParams *params,
+  bool use_cifg, int n_batch, int n_cell, int n_output, int output_batch_leading_dim,
+  float *output_state_ptr, float *cell_state_ptr, float *gates_ptr, float *scratch,
+  float *output_ptr)
+{
+  const int n_rows = (use_cifg ? 3 : 4) * n_cell;
+
+  // The recurrent products of all gates at once
+  MatrixBatchVectorMultiplyAccumulate(recurrent_weights_ptr, n_rows, n_output, output_state_ptr,
+                                      n_batch, gates_ptr, /*result_stride=*/1);
+
+  for (int b = 0; b < n_batch; b++)
+  {
+    float *input_gate = use_cifg ? nullptr : gates_ptr + b * n_rows;
+    float *forget_gate = gates_ptr + b * n_rows + (use_cifg ? 0 : n_cell);
+    float *cell_gate = forget_gate + n_cell;
+    float *output_gate = cell_gate + n_cell;
+    float *cell_state = cell_state_ptr + b * n_cell;
+
+    if (!use_cifg)
+    {
+      FinishLstmGateFloat(cell_state, cell_to_input_weights_ptr,
+                          input_layer_norm_coefficients_ptr, input_gate_bias_ptr, n_cell,
+                          FusedActivationFunctionType::kSigmoid, input_gate);
+    }
+    FinishLstmGateFloat(cell_state, cell_to_forget_weights_ptr,
+                        forget_layer_norm_coefficients_ptr, forget_gate_bias_ptr, n_cell,
+                        FusedActivationFunctionType::kSigmoid, forget_gate);
+    FinishLstmGateFloat(cell_state, /*cell_to_gate_weights=*/nullptr,
+                        cell_layer_norm_coefficients_ptr, cell_gate_bias_ptr, n_cell,
+                        params->activation, cell_gate);
+    UpdateLstmCellFloat(1, n_cell, cell_state, input_gate, forget_gate, cell_gate, use_cifg,
+                        params->cell_clip);
+    // The output gate peeks the updated cell state
+    FinishLstmGateFloat(cell_state, cell_to_output_weights_ptr,
+                        output_layer_norm_coefficients_ptr, output_gate_bias_ptr, n_cell,
+                        FusedActivationFunctionType::kSigmoid, output_gate);
+  }
+
+  // Output states are updated after all recurrent products are done
+  for (int b = 0; b < n_batch; b++)
+  {
+    const float *output_gate = gates_ptr + b * n_rows + n_rows - n_cell;
+    CalculateLstmOutputFloat(1, n_cell, n_output, cell_state_ptr + b * n_cell, output_gate,
+                             params->activation, projection_weights_ptr, projection_bias_ptr,
+                             params->proj_clip, output_state_ptr + b * n_output, scratch);
+    std::copy_n(output_state_ptr + b * n_output, n_output,
+                output_ptr + b * output_batch_leading_dim);
+  }
+}
+
+// Multiplies the weights of all gates, which are packed into a 'n_rows' x 'n_cols' row-major
+// matrix, by 'n_batch' vectors. The results plus 'bias' are stored in 'accum' as a column-major
+// 'n_rows' x 'n_batch' matrix, i.e. the gates of a vector are contiguous.
+//
+// For integer LSTM, the zero point of the vectors is folded into 'bias', so ruy does not need to
+// handle it. The packed weights are cached by ruy across steps.
+template <typename Scalar, typename AccumScalar>
+inline void LstmGatesMatMul(const Scalar *weights, int n_rows, int n_cols, const Scalar *vectors,
+                            int n_batch, const AccumScalar *bias, AccumScalar *accum,
+                            ruy::Context *ruy_context)
+{
+  MatrixParams<Scalar> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = n_rows;
+  lhs_params.cols = n_cols;
+  lhs_params.cache_policy = CachePolicy::kAlwaysCache;
+
+  MatrixParams<Scalar> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = n_cols;
+  rhs_params.cols = n_batch;
+
+  MatrixParams<AccumScalar> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = n_rows;
+  dst_params.cols = n_batch;
+
+  GemmParams<AccumScalar, AccumScalar> gemm_params;
+  gemm_params.bias = bias;
+
+  ruy::Matrix<Scalar> ruy_lhs;
+  ruy::Matrix<Scalar> ruy_rhs;
+  ruy::Matrix<AccumScalar> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, weights, &ruy_lhs, true);
+  ruy_support::MakeRuyMatrix(rhs_params, vectors, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, accum, &ruy_dst);
+
+  ruy::BasicSpec<AccumScalar, AccumScalar> ruy_mul_params;
+  ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+// Calculates a single gate of the integer LSTM from the accumulators of LstmGatesMatMul.
+//
+// The accumulators are rescaled to Q3.12 and added, then sigmoid (or tanh for the cell gate) is
+// applied, so that 'gate' holds Q0.15 values.
+inline void CalculateLstmGateInteger8x8_16(const int32_t *input_accum,
+                                           const int32_t *recurrent_accum, int accum_rows,
+                                           int gate_offset, int32_t effective_input_scale_a,
+                                           int32_t effective_input_scale_b,
+                                           int32_t effective_recurrent_scale_a,
+                                           int32_t effective_recurrent_scale_b, int n_batch,
+                                           int n_cell, bool is_cell_gate, int16_t *gate)
+{
+  const int32_t int16_max = std::numeric_limits<int16_t>::max();
+  const int32_t int16_min = std::numeric_limits<int16_t>::min();
+  for (int b = 0; b < n_batch; ++b)
+  {
+    for (int c = 0; c < n_cell; ++c)
+    {
+      const int index = b * accum_rows + gate_offset + c;
+      int32_t value = MultiplyByQuantizedMultiplier(input_accum[index], effective_input_scale_a,
+                                                    effective_input_scale_b);
+      value = std::max(std::min(value, int16_max), int16_min);
+      value += MultiplyByQuantizedMultiplier(recurrent_accum[index], effective_recurrent_scale_a,
+                                             effective_recurrent_scale_b);
+      gate[b * n_cell + c] = static_cast<int16_t>(std::max(std::min(value, int16_max), int16_min));
+    }
+  }
+
+  if (is_cell_gate)
+  {
+    ApplyTanh(3, gate, n_batch, n_cell, gate);
+  }
+  else
+  {
+    ApplySigmoid(gate, n_batch, n_cell, gate);
+  }
+}
+
+// Updates the 16-bit cell state of the integer LSTM.
+//
+// Implements the same formula as UpdateLstmCellFloat with gates in Q0.15 and the cell state of
+// the power-of-two scale 2^cell_state_scale.
+inline void UpdateLstmCellInteger(int n_batch, int n_cell, int16_t *cell_state,
+                                  int32_t cell_state_scale, const int16_t *input_gate,
+                                  int16_t *forget_gate, const int16_t *cell_gate, bool use_cifg,
+                                  int16_t clip)
+{
+  // Use the forget_gate array as scratch, as input_gate array is not allocated in CIFG case.
+  // (Be careful not to write to the scratch before reading the forget gate data.)
+  int16_t *scratch = forget_gate;
+
+  CwiseMul(forget_gate, cell_state, n_batch, n_cell, 15, cell_state);
+  if (use_cifg)
+  {
+    Sub1Vector(forget_gate, n_batch * n_cell, scratch);
+    CwiseMul(scratch, cell_gate, n_batch, n_cell, 30 + cell_state_scale, scratch);
+  }
+  else
+  {
+    CwiseMul(input_gate, cell_gate, n_batch, n_cell, 30 + cell_state_scale, scratch);
+  }
+  CwiseAdd(cell_state, scratch, n_batch, n_cell, cell_state);
+
+  if (clip > 0)
+  {
+    CwiseClipping(cell_state, n_batch * n_cell, clip);
+  }
+}
+
+// Calculates the 8-bit output state of the integer LSTM without projection.
+//
+// Implements output_state = output_gate .* tanh(cell_state), where the output state shares the
+// quantization of the hidden state.
+inline void CalculateLstmOutputInteger8x8_16(int n_batch, int n_cell, const int16_t *cell_state,
+                                             int32_t cell_state_scale, const int16_t *output_gate,
+                                             int32_t hidden_scale_a, int32_t hidden_scale_b,
+                                             int32_t hidden_zp, int8_t *output_state,
+                                             int16_t *scratch)
+{
+  ApplyTanh(15 + cell_state_scale, cell_state, n_batch, n_cell, scratch);
+  CwiseMul(output_gate, scratch, hidden_scale_a, hidden_scale_b, n_batch, n_cell, hidden_zp,
+           output_state);
+}
+
+// Performs an integer LSTM inference step, which follows the 8x8_16 scheme of TensorFlow Lite:
+// 8-bit input, output and weights, 16-bit cell state and 32-bit bias.
+//
+// The weights of the gates are packed in the order of input, forget, cell and output gate (the
+// input gate is omitted with CIFG):
+//   input_weights_ptr          - 'n_gates * n_cell' x 'n_input'
+//   recurrent_weights_ptr      - 'n_gates * n_cell' x 'n_output'
+//   input_effective_bias_ptr   - 'n_gates * n_cell', gate bias minus input_zp * row sums
+//   recurrent_effective_bias_ptr
+//                              - 'n_gates * n_cell', minus output_state_zp * row sums
+// Scratch buffers:
+//   input_accum_scratch, recurrent_accum_scratch
+//                              - 'n_gates * n_cell * n_batch'
+//   gate_scratch               - '4 * n_cell * n_batch'
+//
+// Peephole, layer norm and projection are not supported, so n_output is equal to n_cell.
+inline void LstmStepInteger8x8_16(
+  const IntegerLSTMParams &params, bool use_cifg, const int8_t *input_ptr,
+  const int8_t *input_weights_ptr, const int32_t *input_effective_bias_ptr,
+  const int8_t *recurrent_weights_ptr, const int32_t *recurrent_effective_bias_ptr, int n_batch,
+  int n_cell, int n_input, int n_output, int output_batch_leading_dim, int8_t *output_state_ptr,
+  int16_t *cell_state_ptr, int32_t *input_accum_scratch, int32_t *recurrent_accum_scratch,
+  int16_t *gate_scratch, int8_t *output_ptr, ruy::Context *ruy_context)
+{
+  assert(n_output == n_cell);
+
+  const int first_gate = use_cifg ? 1 : 0;
+  const int accum_rows = (4 - first_gate) * n_cell;
+
+  // All gates are computed by two GEMMs, and output_state is not updated until both are done
+  LstmGatesMatMul(input_weights_ptr, accum_rows, n_input, input_ptr, n_batch,
+                  input_effective_bias_ptr, input_accum_scratch, ruy_context);
+  LstmGatesMatMul(recurrent_weights_ptr, accum_rows, n_output, output_state_ptr, n_batch,
+                  recurrent_effective_bias_ptr, recurrent_accum_scratch, ruy_context);
+
+  int16_t *gates[4];
+  for (int g = 0; g < 4; ++g)
+  {
+    gates[g] = gate_scratch + g * n_cell * n_batch;
+  }
+  for (int g = first_gate; g < 4; ++g)
+  {
+    CalculateLstmGateInteger8x8_16(
+      input_accum_scratch, recurrent_accum_scratch, accum_rows, (g - first_gate) * n_cell,
+      params.effective_input_scale_a[g], params.effective_input_scale_b[g],
+      params.effective_recurrent_scale_a[g], params.effective_recurrent_scale_b[g], n_batch,
+      n_cell, /*is_cell_gate=*/g == 2, gates[g]);
+  }
+
+  UpdateLstmCellInteger(n_batch, n_cell, cell_state_ptr, params.cell_scale, gates[0], gates[1],
+                        gates[2], use_cifg, params.quantized_cell_clip);
+  // The cell gate is not used anymore, so it is reused as scratch
+  CalculateLstmOutputInteger8x8_16(n_batch, n_cell, cell_state_ptr, params.cell_scale, gates[3],
+                                   params.effective_hidden_scale_a,
+                                   params.effective_hidden_scale_b, params.hidden_zp,
+                                   output_state_ptr, gates[2]);
+
+  // Copy output state to the output. Note that the output's rows may not be
+  // contiguous (output_batch_leading_dim != n_output).
+  for (int b = 0; b < n_batch; b++)
+  {
+    std::copy_n(output_state_ptr + b * n_output, n_output,
+                output_ptr + b * output_batch_leading_dim);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2021 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_LUT_H__
+#define __NNFW_CKER_LUT_H__
+
+#include "cker/CpuFeatures.h"
+#include "cker/neon/neon_check.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace nnfw
+{
+namespace cker
+{
+
+constexpr int kUint8LUTSize = 256;
+
+/**
+ * @brief Fill a 256-entry table which maps every 8-bit quantized input of type T to the quantized
+ *        result of 'transform'
+ *
+ * @note  The table is indexed by the bit pattern of the input, so that uint8 and int8 share
+ *        LookupTable()
+ */
+template <typename T, typename Func>
+inline void PopulateLookupTable(Func transform, float input_scale, int32_t input_zero_point,
+                                float output_scale, int32_t output_zero_point, uint8_t *table)
+{
+  static_assert(sizeof(T) == 1, "Only 8-bit types are supported");
+
+  const float inverse_scale = 1.0f / output_scale;
+  const int32_t maxval = std::numeric_limits<T>::max();
+  const int32_t minval = std::numeric_limits<T>::min();
+  for (int32_t val = minval; val <= maxval; ++val)
+  {
+    const float dequantized = input_scale * (val - input_zero_point);
+    const float transformed = transform(dequantized);
+    const float rescaled = std::round(transformed * inverse_scale);
+    const int32_t quantized = static_cast<int32_t>(rescaled + output_zero_point);
+    const T clamped = static_cast<T>(std::max(std::min(maxval, quantized), minval));
+    table[static_cast<uint8_t>(static_cast<T>(val))] = static_cast<uint8_t>(clamped);
+  }
+}
+
+#ifdef CKER_X86_DISPATCH
+/**
+ * @brief Apply a table to values of multiples of 32 by AVX2, returning the number looked up
+ */
+__attribute__((target("avx2"))) inline int
+LookupTableAVX2(const uint8_t *input_data, int size, const uint8_t *table, uint8_t *output_data)
+{
+  // pshufb looks up 16 bytes by the low nibble, so each row of 16 entries is selected by the
+  // high nibble
+  __m256i rows[16];
+  for (int r = 0; r < 16; ++r)
+  {
+    const __m128i row = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table + r * 16));
+    rows[r] = _mm256_broadcastsi128_si256(row);
+  }
+  const __m256i low_mask = _mm256_set1_epi8(0x0f);
+  int i = 0;
+  for (; i <= size - 32; i += 32)
+  {
+    const __m256i input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input_data + i));
+    const __m256i low = _mm256_and_si256(input, low_mask);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(input, 4), low_mask);
+    __m256i output = _mm256_setzero_si256();
+    for (int r = 0; r < 16; ++r)
+    {
+      const __m256i selected = _mm256_cmpeq_epi8(high, _mm256_set1_epi8(static_cast<char>(r)));
+      output = _mm256_blendv_epi8(output, _mm256_shuffle_epi8(rows[r], low), selected);
+    }
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(output_data + i), output);
+  }
+  return i;
+}
+#endif // CKER_X86_DISPATCH
+
+/**
+ * @brief Apply a table filled by PopulateLookupTable() to 'size' 8-bit values
+ */
+inline void LookupTable(const uint8_t *input_data, int size, const uint8_t *table,
+                        uint8_t *output_data)
+{
+  int i = 0;
+#if defined(USE_NEON) && defined(__aarch64__)
+  // A table of 64 bytes is looked up at once, and out-of-range indices keep the previous result
+  uint8x16x4_t tables[4];
+  for (int t = 0; t < 4; ++t)
+  {
+    for (int j = 0; j < 4; ++j)
+      tables[t].val[j] = vld1q_u8(table + t * 64 + j * 16);
+  }
+  const uint8x16_t offset_1 = vdupq_n_u8(0x40);
+  const uint8x16_t offset_2 = vdupq_n_u8(0x80);
+  const uint8x16_t offset_3 = vdupq_n_u8(0xc0);
+  for (; i <= size - 16; i += 16)
+  {
+    const uint8x16_t input = vld1q_u8(input_data + i);
+    uint8x16_t output = vqtbl4q_u8(tables[0], input);
+    output = vqtbx4q_u8(output, tables[1], veorq_u8(input, offset_1));
+    output = vqtbx4q_u8(output, tables[2], veorq_u8(input, offset_2));
+    output = vqtbx4q_u8(output, tables[3], veorq_u8(input, offset_3));
+    vst1q_u8(output_data + i, output);
+  }
+#elif defined(USE_NEON)
+  // vtbx of armv7 looks up 32 bytes at once, and out-of-range indices keep the previous result
+  uint8x8x4_t tables[8];
+  for (int t = 0; t < 8; ++t)
+  {
+    for (int j = 0; j < 4; ++j)
+      tables[t].val[j] = vld1_u8(table + t * 32 + j * 8);
+  }
+  for (; i <= size - 8; i += 8)
+  {
+    const uint8x8_t input = vld1_u8(input_data + i);
+    uint8x8_t output = vtbl4_u8(tables[0], input);
+    for (int t = 1; t < 8; ++t)
+    {
+      output = vtbx4_u8(output, tables[t], vsub_u8(input, vdup_n_u8(t * 32)));
+    }
+    vst1_u8(output_data + i, output);
+  }
+#elif defined(CKER_X86_DISPATCH)
+  if (CpuHasAVX2())
+    i = LookupTableAVX2(input_data, size, table, output_data);
+#endif
+  for (; i < size; ++i)
+  {
+    output_data[i] = table[input_data[i]];
+  }
+}
+
+inline void LookupTable(const int8_t *input_data, int size, const uint8_t *table,
+                        int8_t *output_data)
+{
+  LookupTable(reinterpret_cast<const uint8_t *>(input_data), size, table,
+              reinterpret_cast<uint8_t *>(output_data));
+}
+
+// Size of the lookup table for int16 activations. The last entry is only used for the slope.
+constexpr int kInt16LUTSize = 513;
+
+// Populate the lookup table of 'func' for int16 values, which maps [min, max] to
+// [-32768, 32767] and Q0.15 results
+template <typename Func>
+inline void PopulateInt16LookupTable(Func func, double min, double max, int16_t *table)
+{
+  const int num = kInt16LUTSize;
+  const double step = (max - min) / (num - 1);
+  const double half_step = step / 2.0;
+  for (int i = 0; i < num - 1; i++)
+  {
+    // Bias each entry by half of the interpolation error at the midpoint
+    const double sample_val = std::round(func(min + i * step) * 32768.0);
+    const double midpoint_interp_val =
+      std::round((func(min + (i + 1) * step) * 32768.0 + sample_val) / 2.0);
+    const double midpoint_val = std::round(func(min + i * step + half_step) * 32768.0);
+    const double midpoint_err = midpoint_interp_val - midpoint_val;
+    const double bias = std::round(midpoint_err / 2.0);
+    table[i] = static_cast<int16_t>(std::min(std::max(sample_val - bias, -32768.0), 32767.0));
+  }
+  table[num - 1] =
+    static_cast<int16_t>(std::min(std::max(std::round(func(max) * 32768.0), -32768.0), 32767.0));
+}
+
+// Look up the table of PopulateInt16LookupTable() with linear interpolation
+inline int16_t LookupInt16Table(int16_t value, const int16_t *table)
+{
+  // 512 base values, and table[512] only for the slope
+  const uint16_t index = static_cast<uint16_t>(256 + (value >> 7));
+  assert(index < 512);
+  const int16_t offset = value & 0x7f;
+
+  // base and slope are Q0.15
+  const int16_t base = table[index];
+  const int16_t slope = table[index + 1] - table[index];
+
+  // Q0.15 * Q0.7 = Q0.22, which is rounded to Q0.15
+  const int32_t delta = (static_cast<int32_t>(slope) * offset + 64) >> 7;
+  return base + delta;
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_LUT_H__
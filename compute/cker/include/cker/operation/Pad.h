@@ -20,6 +20,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
 #include <stdexcept>
 #include <iostream>
 namespace nnfw
@@ -29,7 +30,7 @@ namespace cker
 template <typename T>
 inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &input_shape,
                 const T *input_data, const Shape &output_shape, T *output_data,
-                const T *constant_value_data)
+                const T *constant_value_data, ruy::Context *ruy_context = nullptr)
 {
   // Note, this is pad with mode=`CONSTANT`: it doesn't support `REFLECT` and `SYMMETRIC`
   // TODO: come up with more subtle solution that uses subtensors like arm compute
@@ -57,6 +58,7 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
      functions:
      1. to prevent access violation in padding_list;
      2. handling as 4d is slower than as 2d/3d.
+     Rows of input data are split across threads if ruy_context is given.
   */
   switch (pad_rank)
   {
@@ -79,24 +81,29 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
       std::fill_n(output_data, padding_list[0].first * out_row_size, constant_value);
 
       const auto r_h_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, j = 0; i < r_h_inp_lim; ++i, ++j)
-      {
-        auto out_offset = i * out_row_size;
-        const auto in_offset = j * in_row_len;
+      auto pad_rows = [&](int64_t begin, int64_t end) {
+        for (int32_t j = begin; j < end; ++j)
+        {
+          auto out_offset = (j + padding_list[0].first) * out_row_size;
+          const auto in_offset = j * in_row_len;
 
-        // prepend padding values
-        std::fill_n(output_data + out_offset, padding_list[1].first, constant_value);
+          // prepend padding values
+          std::fill_n(output_data + out_offset, padding_list[1].first, constant_value);
 
-        out_offset += padding_list[1].first;
+          out_offset += padding_list[1].first;
 
-        // copy a row of input data
-        memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(T));
+          // copy a row of input data
+          memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(T));
 
-        out_offset += in_row_len;
+          out_offset += in_row_len;
 
-        // append padding values
-        std::fill_n(output_data + out_offset, padding_list[1].second, constant_value);
-      }
+          // append padding values
+          std::fill_n(output_data + out_offset, padding_list[1].second, constant_value);
+        }
+      };
+      cpu_backend_threadpool::ParallelFor(input_shape.Dims(0),
+                                          cpu_backend_threadpool::ParallelForMinGrain(out_row_size),
+                                          ruy_context, pad_rows);
 
       // append padding rows
       std::fill_n(output_data + r_h_inp_lim * out_row_size, padding_list[0].second * out_row_size,
@@ -113,38 +120,44 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
       std::fill_n(output_data, padding_list[0].first * plain_size, constant_value);
 
       const auto r_h_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, i_inp = 0; i < r_h_inp_lim; ++i, ++i_inp)
-      {
-        const auto out_w_offset = (i * output_shape.Dims(1) + 0) * output_shape.Dims(2);
+      auto pad_plains = [&](int64_t begin, int64_t end) {
+        for (int32_t i_inp = begin; i_inp < end; ++i_inp)
+        {
+          const auto i = i_inp + padding_list[0].first;
+          const auto out_w_offset = (i * output_shape.Dims(1) + 0) * output_shape.Dims(2);
 
-        // prepend padding rows
-        std::fill_n(output_data + out_w_offset, padding_list[1].first * out_row_size,
-                    constant_value);
+          // prepend padding rows
+          std::fill_n(output_data + out_w_offset, padding_list[1].first * out_row_size,
+                      constant_value);
 
-        const auto r_w_inp_lim = input_shape.Dims(1) + padding_list[1].first;
-        for (auto j = padding_list[1].first, j_inp = 0; j < r_w_inp_lim; ++j, ++j_inp)
-        {
-          auto out_offset = (i * output_shape.Dims(1) + j) * output_shape.Dims(2);
-          const auto in_offset = (i_inp * input_shape.Dims(1) + j_inp) * input_shape.Dims(2);
+          const auto r_w_inp_lim = input_shape.Dims(1) + padding_list[1].first;
+          for (auto j = padding_list[1].first, j_inp = 0; j < r_w_inp_lim; ++j, ++j_inp)
+          {
+            auto out_offset = (i * output_shape.Dims(1) + j) * output_shape.Dims(2);
+            const auto in_offset = (i_inp * input_shape.Dims(1) + j_inp) * input_shape.Dims(2);
 
-          // prepend padding values
-          std::fill_n(output_data + out_offset, padding_list[2].first, constant_value);
+            // prepend padding values
+            std::fill_n(output_data + out_offset, padding_list[2].first, constant_value);
 
-          out_offset += padding_list[2].first;
+            out_offset += padding_list[2].first;
 
-          // copy a row of input data
-          memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(T));
+            // copy a row of input data
+            memcpy(output_data + out_offset, input_data + in_offset, in_row_len * sizeof(T));
 
-          out_offset += in_row_len;
+            out_offset += in_row_len;
 
-          // append padding values
-          std::fill_n(output_data + out_offset, padding_list[2].second, constant_value);
-        }
+            // append padding values
+            std::fill_n(output_data + out_offset, padding_list[2].second, constant_value);
+          }
 
-        // append padding rows
-        std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
-                    padding_list[1].second * out_row_size, constant_value);
-      }
+          // append padding rows
+          std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
+                      padding_list[1].second * out_row_size, constant_value);
+        }
+      };
+      cpu_backend_threadpool::ParallelFor(input_shape.Dims(0),
+                                          cpu_backend_threadpool::ParallelForMinGrain(plain_size),
+                                          ruy_context, pad_plains);
 
       // append padding plains
       std::fill_n(output_data + r_h_inp_lim * plain_size, padding_list[0].second * plain_size,
@@ -165,15 +178,26 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
       std::fill_n(output_data, padding_list[0].first * parallelepiped_size, constant_value);
 
       const auto r_b_inp_lim = input_shape.Dims(0) + padding_list[0].first;
-      for (auto i = padding_list[0].first, i_inp = 0; i < r_b_inp_lim; ++i, ++i_inp)
+      const auto r_h_inp_lim = input_shape.Dims(1) + padding_list[1].first;
+      for (auto i = padding_list[0].first; i < r_b_inp_lim; ++i)
       {
         const auto out_h_offset = get_offset(output_shape, i, 0, 0);
         // prepend padding plains
         std::fill_n(output_data + out_h_offset, padding_list[1].first * plain_size, constant_value);
 
-        const auto r_h_inp_lim = input_shape.Dims(1) + padding_list[1].first;
-        for (auto j = padding_list[1].first, j_inp = 0; j < r_h_inp_lim; ++j, ++j_inp)
+        // append padding plains
+        std::fill_n(output_data + out_h_offset + r_h_inp_lim * plain_size,
+                    padding_list[1].second * plain_size, constant_value);
+      }
+
+      // Each (i_inp, j_inp) pair fills a plain of the output
+      auto pad_plains = [&](int64_t begin, int64_t end) {
+        for (int64_t index = begin; index < end; ++index)
         {
+          const int32_t i_inp = index / input_shape.Dims(1);
+          const int32_t j_inp = index % input_shape.Dims(1);
+          const auto i = i_inp + padding_list[0].first;
+          const auto j = j_inp + padding_list[1].first;
           const auto out_w_offset = get_offset(output_shape, i, j, 0);
 
           // prepend padding rows
@@ -204,11 +228,11 @@ inline void Pad(const int32_t *padding_data, int32_t pad_rank, const Shape &inpu
           std::fill_n(output_data + out_w_offset + r_w_inp_lim * out_row_size,
                       padding_list[2].second * out_row_size, constant_value);
         }
+      };
+      cpu_backend_threadpool::ParallelFor(
+        static_cast<int64_t>(input_shape.Dims(0)) * input_shape.Dims(1),
+        cpu_backend_threadpool::ParallelForMinGrain(plain_size), ruy_context, pad_plains);
 
-        // append padding plains
-        std::fill_n(output_data + out_h_offset + r_h_inp_lim * plain_size,
-                    padding_list[1].second * plain_size, constant_value);
-      }
       // append padding parallelepipeds
       std::fill_n(output_data + r_b_inp_lim * parallelepiped_size,
                   padding_list[0].second * parallelepiped_size, constant_value);
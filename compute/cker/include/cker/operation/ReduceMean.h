@@ -19,6 +19,7 @@
 #define __NNFW_CKER_REDUCEMEAN_H__
 
 #include "cker/Shape.h"
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/operation/Reduce.h"
 
 namespace nnfw
@@ -233,7 +234,7 @@ void MeanQ8Asymm(const Shape &input_shape, const In *input_data, float input_sca
 
 template <typename In, typename Out>
 void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &output_shape,
-                   Out *output_data)
+                   Out *output_data, ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(output_shape);
   assert(input_shape.DimensionsCount() == 4);
@@ -245,10 +246,12 @@ void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &
   const int input_height = input_shape.Dims(1);
   const int input_width = input_shape.Dims(2);
 
-  for (int out_b = 0; out_b < output_batch; ++out_b)
-  {
-    for (int out_d = 0; out_d < output_depth; ++out_d)
+  // Each (batch, depth) pair of the output is independent
+  auto mean = [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end; ++index)
     {
+      const int out_b = index / output_depth;
+      const int out_d = index % output_depth;
       float value = 0;
       for (int in_h = 0; in_h < input_height; ++in_h)
       {
@@ -259,7 +262,10 @@ void MeanAxis1And2(const Shape &input_shape, const In *input_data, const Shape &
       }
       output_data[Offset(output_shape, out_b, 0, 0, out_d)] = value / (input_width * input_height);
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    static_cast<int64_t>(output_batch) * output_depth,
+    cpu_backend_threadpool::ParallelForMinGrain(input_height * input_width), ruy_context, mean);
 }
 
 } // namespace cker
@@ -20,6 +20,7 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/CpuBackendThreadpool.h"
 #include <cmath>
 
 namespace nnfw
@@ -69,12 +70,17 @@ inline void ResizeBilinearKernel2x2(int32_t x0, int32_t x1, int32_t y0, int32_t
 inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t input_width,
                               int32_t depth, int32_t output_height, int32_t output_width,
                               const Shape &input_shape, const float *input_data,
-                              const Shape &output_shape, float *output_data)
+                              const Shape &output_shape, float *output_data,
+                              ruy::Context *ruy_context = nullptr)
 {
-  for (int b = 0; b < batches; b++)
-  {
-    for (int y0 = 0, y = 0; y <= output_height - 2; y += 2, y0++)
+  // Each (batch, input row) pair fills two rows of the output
+  const int32_t rows = output_height / 2;
+  auto resize = [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end; ++index)
     {
+      const int b = index / rows;
+      const int y0 = index % rows;
+      const int y = y0 * 2;
       for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
       {
         int32_t x1 = std::min(x0 + 1, input_width - 1);
@@ -83,7 +89,10 @@ inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t inp
                                 output_shape, output_data);
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    static_cast<int64_t>(batches) * rows,
+    cpu_backend_threadpool::ParallelForMinGrain(2 * output_width * depth), ruy_context, resize);
 }
 
 inline void ResizeBilinearKernel(const float *input_ptr, int32_t depth, float scale,
@@ -119,15 +128,18 @@ inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t
                                   int32_t depth, int32_t output_height, int32_t output_width,
                                   float height_scale, float width_scale, const Shape &input_shape,
                                   const float *input_data, float *output_data,
-                                  const bool half_pixel_centers)
+                                  const bool half_pixel_centers,
+                                  ruy::Context *ruy_context = nullptr)
 {
   memset(output_data, 0, batches * output_height * output_width * depth * sizeof(float));
 
-  int32_t output_offset = 0;
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
+  // Each (batch, output row) pair is independent
+  auto resize = [&](int64_t begin, int64_t end) {
+    int32_t output_offset = begin * output_width * depth;
+    for (int64_t index = begin; index < end; ++index)
     {
+      const int b = index / output_height;
+      const int y = index % output_height;
       float input_y;
       int32_t y0, y1;
       ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
@@ -164,7 +176,10 @@ inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t
         output_offset += depth;
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    static_cast<int64_t>(batches) * output_height,
+    cpu_backend_threadpool::ParallelForMinGrain(output_width * depth), ruy_context, resize);
 }
 
 template <typename T>
@@ -173,13 +188,16 @@ inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_hei
                                               int32_t output_height, int32_t output_width,
                                               float height_scale, float width_scale,
                                               const Shape &input_shape, const T *input_data,
-                                              T *output_data, const bool half_pixel_centers)
+                                              T *output_data, const bool half_pixel_centers,
+                                              ruy::Context *ruy_context = nullptr)
 {
-  T *output_ptr = &output_data[0];
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
+  // Each (batch, output row) pair is independent
+  auto resize = [&](int64_t begin, int64_t end) {
+    T *output_ptr = &output_data[begin * output_width * depth];
+    for (int64_t index = begin; index < end; ++index)
     {
+      const int b = index / output_height;
+      const int y = index % output_height;
       float input_y;
       int32_t y0, y1;
       ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
@@ -207,11 +225,15 @@ inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_hei
         }
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    static_cast<int64_t>(batches) * output_height,
+    cpu_backend_threadpool::ParallelForMinGrain(output_width * depth), ruy_context, resize);
 }
 
 void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   int32_t batches = static_cast<int32_t>(MatchingDim(input_shape, 0, output_shape, 0));
   int32_t input_height = input_shape.Dims(1);
@@ -223,7 +245,8 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
       params.output_height == 2 * input_height && params.output_width == 2 * input_width)
   {
     ResizeBilinear2x2(batches, input_height, input_width, depth, params.output_height,
-                      params.output_width, input_shape, input_data, output_shape, output_data);
+                      params.output_width, input_shape, input_data, output_shape, output_data,
+                      ruy_context);
   }
   else
   {
@@ -240,12 +263,13 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
 
     ResizeBilinearGeneric(batches, input_height, input_width, depth, params.output_height,
                           params.output_width, height_scale, width_scale, input_shape, input_data,
-                          output_data, params.half_pixel_centers);
+                          output_data, params.half_pixel_centers, ruy_context);
   }
 }
 
 void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
-                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data)
+                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
   int32_t input_height = input_shape.Dims(1);
@@ -262,7 +286,8 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
 
   ResizeBilinearGenericSmallChannel<uint8_t>(
     batches, input_height, input_width, depth, params.output_height, params.output_width,
-    height_scale, width_scale, input_shape, input_data, output_data, params.half_pixel_centers);
+    height_scale, width_scale, input_shape, input_data, output_data, params.half_pixel_centers,
+    ruy_context);
 }
 
 inline void ComputeInterpolationValues(const int32_t value, const int32_t scale_10,
@@ -284,7 +309,8 @@ inline void ComputeInterpolationValues(const int32_t value, const int32_t scale_
 
 inline void ResizeBilinear(const ResizeBilinearParams &op_params,
                            const Shape &unextended_input_shape, const int8_t *input_data,
-                           const Shape &unextended_output_shape, int8_t *output_data)
+                           const Shape &unextended_output_shape, int8_t *output_data,
+                           ruy::Context *ruy_context = nullptr)
 {
   // If half_pixel_centers is True, align_corners must be False.
   assert(!op_params.half_pixel_centers || !op_params.align_corners);
@@ -313,10 +339,12 @@ inline void ResizeBilinear(const ResizeBilinearParams &op_params,
     width_scale_10 = ((1 << 10) * (input_width - 1) + (output_width - 1) / 2) / (output_width - 1);
   }
 
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
+  // Each (batch, output row) pair is independent
+  auto resize = [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end; ++index)
     {
+      const int b = index / output_height;
+      const int y = index % output_height;
       int32_t input_y, y0, y1;
       ComputeInterpolationValues(y, height_scale_10, op_params.half_pixel_centers, input_height,
                                  &input_y, &y0, &y1);
@@ -346,7 +374,10 @@ inline void ResizeBilinear(const ResizeBilinearParams &op_params,
         }
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    static_cast<int64_t>(batches) * output_height,
+    cpu_backend_threadpool::ParallelForMinGrain(output_width * depth), ruy_context, resize);
 }
 
 } // namespace cker
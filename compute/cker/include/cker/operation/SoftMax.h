@@ -22,6 +22,7 @@
 #include "cker/Utils.h"
 #include "cker/Types.h"
 #include "cker/eigen/Utils.h"
+#include "cker/operation/LUT.h"
 
 #if __aarch64__ && __clang__
 #define TFLITE_SOFTMAX_USE_UINT16_LUT
@@ -30,6 +31,7 @@
 #include <Eigen/Core>
 #include <fixedpoint/fixedpoint.h>
 #include <cmath>
+#include <vector>
 
 namespace nnfw
 {
@@ -196,6 +198,82 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
   }
 }
 
+inline void PopulateSoftmaxInt16LookupTables(int16_t *exp_lut, int16_t *one_over_one_plus_x_lut)
+{
+  PopulateInt16LookupTable([](double value) { return std::exp(value); }, -10.0, 0.0, exp_lut);
+  PopulateInt16LookupTable([](double value) { return 1.0 / (1.0 + value); }, 0.0, 1.0,
+                           one_over_one_plus_x_lut);
+}
+
+// Output is Q0.15, whose scale is 1/32768 and zero point is 0
+// input_multiplier and input_left_shift scale (input - max) so that [-65535, 0] corresponds to
+// [-10.0, 0.0]
+inline void SoftmaxInt16(const SoftmaxParams &params, const Shape &input_shape,
+                         const int16_t *input_data, const Shape &output_shape,
+                         int16_t *output_data)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+
+  std::vector<int16_t> exp_result_Q015(depth);
+  for (int i = 0; i < outer_size; ++i)
+  {
+    // Find the largest element
+    int16_t max_in_row = std::numeric_limits<int16_t>::min();
+    for (int j = 0; j < depth; ++j)
+    {
+      max_in_row = std::max(max_in_row, input_data[i * depth + j]);
+    }
+
+    // Compute exp(input - max_input)
+    for (int j = 0; j < depth; ++j)
+    {
+      const int32_t input_diff = input_data[i * depth + j] - max_in_row;
+      const int32_t scaled_diff =
+        MultiplyByQuantizedMultiplier(input_diff, params.input_multiplier, params.input_left_shift);
+      // Recenter to [-32768, 32767]
+      const int32_t sym_scaled_diff = scaled_diff + 32767;
+      const int16_t sat_sym_scaled_diff =
+        std::min(std::max(sym_scaled_diff, static_cast<int32_t>(-32768)),
+                 static_cast<int32_t>(32767));
+      exp_result_Q015[j] = LookupInt16Table(sat_sym_scaled_diff, params.exp_lut);
+    }
+
+    // sum_of_exps is a Q16.15 fixed point format.
+    int32_t sum_of_exps = 0;
+    for (int j = 0; j < depth; ++j)
+    {
+      sum_of_exps += exp_result_Q015[j];
+    }
+
+    // Compute the reciprocal 1/sum_of_exps
+    const uint8_t headroom_plus_one = CountLeadingZeros(static_cast<uint32_t>(sum_of_exps));
+    const int32_t shifted_sum =
+      ((static_cast<int64_t>(sum_of_exps) << (headroom_plus_one - 1)) + (1 << 13)) >> 14;
+    // The table computes 1/(1 + x), so x = (sum - 1) is recentered from [0, 65535] to
+    // [-32768, 32767]
+    const int32_t sym_shifted_sum = shifted_sum + (-((1 << 15) + (1 << 16)));
+    const int16_t sat_sym_shifted_sum = static_cast<int16_t>(std::min(
+      std::max(sym_shifted_sum, static_cast<int32_t>(-32768)), static_cast<int32_t>(32767)));
+    const int16_t reciprocal_scale_Q015 =
+      LookupInt16Table(sat_sym_shifted_sum, params.one_over_one_plus_x_lut);
+
+    // Rescale the exp_result with reciprocal, whose range is [0, 32767] for [0.0, 1.0]
+    const uint8_t right_shift = 31 - headroom_plus_one;
+    const int64_t round = 1 << (right_shift - 1);
+    for (int j = 0; j < depth; ++j)
+    {
+      const int32_t result = (static_cast<int64_t>(exp_result_Q015[j]) *
+                                static_cast<int64_t>(reciprocal_scale_Q015) +
+                              round) >>
+                             right_shift;
+      output_data[i * depth + j] = static_cast<int16_t>(
+        std::min(std::max(result, static_cast<int32_t>(0)), static_cast<int32_t>(32767)));
+    }
+  }
+}
+
 #ifdef TFLITE_SOFTMAX_USE_UINT16_LUT
 // Looks up each element of <indices> in <table>, returns them in a vector.
 inline uint8x16_t aarch64_lookup_vector(const uint8x16x4_t table[4], uint8x16_t indices)
@@ -21,6 +21,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
 
 #include <cmath>
 
@@ -258,7 +259,8 @@ void checkOutputSize(const StridedSliceParams &op_params, const Shape &input_sha
 
 template <typename T>
 inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unextended_input_shape,
-                         const T *input_data, const Shape &unextended_output_shape, T *output_data)
+                         const T *input_data, const Shape &unextended_output_shape, T *output_data,
+                         ruy::Context *ruy_context = nullptr)
 {
   assert(unextended_input_shape.DimensionsCount() <= 4);
   assert(unextended_output_shape.DimensionsCount() <= 4);
@@ -311,13 +313,25 @@ inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unext
   const int start_d = StartForAxis(params_copy, input_shape, 3);
   const int stop_d = StopForAxis(params_copy, input_shape, 3, start_d);
 
-  T *out_ptr = output_data;
-  for (int in_b = start_b; !LoopCondition(in_b, stop_b, params_copy.strides[0]);
-       in_b += params_copy.strides[0])
-  {
-    for (int in_h = start_h; !LoopCondition(in_h, stop_h, params_copy.strides[1]);
-         in_h += params_copy.strides[1])
+  // Count iterations of each axis, which the output shape may not have due to shrink_axis_mask
+  auto loop_count = [](int start, int stop, int stride) {
+    int count = 0;
+    for (int i = start; !LoopCondition(i, stop, stride); i += stride)
+      ++count;
+    return count;
+  };
+  const int count_b = loop_count(start_b, stop_b, params_copy.strides[0]);
+  const int count_h = loop_count(start_h, stop_h, params_copy.strides[1]);
+  const int count_w = loop_count(start_w, stop_w, params_copy.strides[2]);
+  const int count_d = loop_count(start_d, stop_d, params_copy.strides[3]);
+
+  // Each (b, h) pair of the output is a contiguous block of count_w * count_d
+  auto slice = [&](int64_t begin, int64_t end) {
+    T *out_ptr = output_data + begin * count_w * count_d;
+    for (int64_t index = begin; index < end; ++index)
     {
+      const int in_b = start_b + (index / count_h) * params_copy.strides[0];
+      const int in_h = start_h + (index % count_h) * params_copy.strides[1];
       for (int in_w = start_w; !LoopCondition(in_w, stop_w, params_copy.strides[2]);
            in_w += params_copy.strides[2])
       {
@@ -328,7 +342,11 @@ inline void StridedSlice(const StridedSliceParams &op_params, const Shape &unext
         }
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    static_cast<int64_t>(count_b) * count_h,
+    cpu_backend_threadpool::ParallelForMinGrain(static_cast<int64_t>(count_w) * count_d),
+    ruy_context, slice);
 }
 
 } // namespace cker
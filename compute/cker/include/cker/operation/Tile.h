@@ -20,6 +20,10 @@
 
 #include "cker/Shape.h"
 
+#include <algorithm>
+#include <tuple>
+#include <utility>
+
 namespace nnfw
 {
 namespace cker
@@ -21,6 +21,7 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
 
 namespace nnfw
 {
@@ -290,26 +291,20 @@ size_t Flatten(const Shape &input_shape, const Shape &output_shape, const Transp
 
 } // namespace
 
-// Transpose2D only deals with typical 2D matrix transpose ops.
+// Transpose rows [row_begin, row_end) of a d0 x d1 input matrix.
 // Perform transpose by transposing 4x4 blocks of the input, proceeding from
 // left to right (down the rows) of the input, and then from top to bottom.
 template <typename T>
-inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
-                        T *output_data)
+inline void Transpose2DRows(int d0, int d1, const T *input_data, T *output_data, int row_begin,
+                            int row_end)
 {
-  assert(input_shape.DimensionsCount() == 2);
-  assert(output_shape.DimensionsCount() == 2);
-  UNUSED_RELEASE(output_shape);
-
-  const int d0 = input_shape.DimsData()[0];
-  const int d1 = input_shape.DimsData()[1];
   const int kLines = 4;
   const int kSkipSize = (kLines - 1) * d1;
 
-  const T *input = input_data;
+  const T *input = input_data + static_cast<int64_t>(row_begin) * d1;
 
-  int i = 0;
-  for (; i <= d0 - kLines; i += kLines)
+  int i = row_begin;
+  for (; i <= row_end - kLines; i += kLines)
   {
     T *output = output_data + i;
 
@@ -388,7 +383,7 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data, const Sha
       input += (d1 - j) + kSkipSize;
     }
   }
-  for (; i < d0; ++i)
+  for (; i < row_end; ++i)
   {
     T *output = output_data + i;
     for (int j = 0; j < d1; ++j)
@@ -400,11 +395,35 @@ inline void Transpose2D(const Shape &input_shape, const T *input_data, const Sha
   }
 }
 
+// Transpose2D only deals with typical 2D matrix transpose ops.
+// Blocks of 4 input rows are split across threads if ruy_context is given.
+template <typename T>
+inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
+                        T *output_data, ruy::Context *ruy_context = nullptr)
+{
+  assert(input_shape.DimensionsCount() == 2);
+  assert(output_shape.DimensionsCount() == 2);
+  UNUSED_RELEASE(output_shape);
+
+  const int d0 = input_shape.DimsData()[0];
+  const int d1 = input_shape.DimsData()[1];
+  const int kLines = 4;
+
+  const int blocks = (d0 + kLines - 1) / kLines;
+  cpu_backend_threadpool::ParallelFor(
+    blocks, cpu_backend_threadpool::ParallelForMinGrain(kLines * d1), ruy_context,
+    [&](int64_t begin, int64_t end) {
+      Transpose2DRows(d0, d1, input_data, output_data, begin * kLines,
+                      std::min<int>(end * kLines, d0));
+    });
+}
+
 // TODO(alanchiao): see if we can reduce the number
 // of lines of code in branching without affecting latency.
 template <typename T>
 inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
-                        const T *input_data, const Shape &, T *output_data)
+                        const T *input_data, const Shape &, T *output_data,
+                        ruy::Context *ruy_context = nullptr)
 {
   int s2, s3;
   s2 = input_shape.Dims(1);
@@ -458,30 +477,34 @@ inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
   o_s[1] = input_shape.Dims(params.perm[1]);
   o_s[2] = input_shape.Dims(params.perm[2]);
 
-  for (int i1 = 0; i1 < o_s[0]; ++i1)
-  {
-    for (int i2 = 0; i2 < o_s[1]; ++i2)
+  auto transpose = [&](int64_t begin, int64_t end) {
+    for (int i1 = begin; i1 < end; ++i1)
     {
-      for (int i3 = 0; i3 < o_s[2]; ++i3)
+      for (int i2 = 0; i2 < o_s[1]; ++i2)
       {
-        const int i = i1 * p1 + i2 * p2 + i3 * p3;
-        const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
-        output_data[o] = input_data[i];
+        for (int i3 = 0; i3 < o_s[2]; ++i3)
+        {
+          const int i = i1 * p1 + i2 * p2 + i3 * p3;
+          const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
+          output_data[o] = input_data[i];
+        }
       }
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(
+    o_s[0], cpu_backend_threadpool::ParallelForMinGrain(o_s[1] * o_s[2]), ruy_context, transpose);
 }
 
 template <typename T>
 void TransposeImpl(const TransposeParams &params, const Shape &input_shape, const T *input_data,
-                   const Shape &output_shape, T *output_data)
+                   const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
   const int dims_cnt = input_shape.DimensionsCount();
 
   int dim0, dim1;
   if (IsTranspose2DApplicable(params, input_shape, &dim0, &dim1))
   {
-    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data);
+    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data, ruy_context);
     return;
   }
 
@@ -497,18 +520,19 @@ void TransposeImpl(const TransposeParams &params, const Shape &input_shape, cons
   // Consider tradeoffs.
   if (dims_cnt == 3)
   {
-    Transpose3D(params, input_shape, input_data, output_shape, output_data);
+    Transpose3D(params, input_shape, input_data, output_shape, output_data, ruy_context);
     return;
   }
 
   // Reroute to the reference version if an optimized method for the given data
-  // is not available.
+  // is not available. It is not split across threads.
   reference::Transpose(params, input_shape, input_data, output_shape, output_data);
 }
 
 template <typename T>
 void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_input_shape,
-               const T *input_data, const Shape &unshrunk_output_shape, T *output_data)
+               const T *input_data, const Shape &unshrunk_output_shape, T *output_data,
+               ruy::Context *ruy_context = nullptr)
 {
   const int output_size = unshrunk_output_shape.DimensionsCount();
   assert(unshrunk_input_shape.DimensionsCount() <= 4);
@@ -560,10 +584,26 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
               &non_flatten_input_shape, &non_flatten_output_shape, &non_flatten_params);
     assert(non_flatten_params.perm[0] != 0);
 
+    // Split the flattened batches across threads if there are enough of them, or each batch
+    const int batches = total_size / non_flatten_size;
+    if (ruy_context && batches >= ruy_context->max_num_threads())
+    {
+      cpu_backend_threadpool::ParallelFor(
+        batches, cpu_backend_threadpool::ParallelForMinGrain(non_flatten_size), ruy_context,
+        [&](int64_t begin, int64_t end) {
+          for (int64_t b = begin; b < end; ++b)
+          {
+            TransposeImpl(non_flatten_params, non_flatten_input_shape,
+                          input_data + b * non_flatten_size, non_flatten_output_shape,
+                          output_data + b * non_flatten_size);
+          }
+        });
+      return;
+    }
     for (int i = 0; i < total_size; i += non_flatten_size)
     {
       TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
-                    non_flatten_output_shape, output_data + i);
+                    non_flatten_output_shape, output_data + i, ruy_context);
     }
     return;
   }
@@ -571,7 +611,7 @@ void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_inp
   // Call non-flattened case.
   TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape,
 
-                output_data);
+                output_data, ruy_context);
 }
 
 } // namespace cker
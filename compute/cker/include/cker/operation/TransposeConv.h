@@ -21,6 +21,13 @@
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/eigen/EigenSupport.h"
+#include "cker/ruy/RuySupport.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
 
 namespace nnfw
 {
@@ -105,6 +112,309 @@ inline void TransposeConv(const TransposeConvParams &params, const Shape &input_
   }
 }
 
+/**
+ * @brief Transpose convolution by a GEMM of the input and the filter, followed by col2im
+ *
+ * Each input pixel is multiplied by the whole filter at once, which gives the [kh, kw, out_ch]
+ * patch it adds to the output. The patches are accumulated to the output row by row, so that
+ * rows are accumulated in parallel without sharing any output element.
+ *
+ * The filter of [out_ch, kh, kw, in_ch] is reordered to [kh, kw, out_ch, in_ch] for the GEMM. A
+ * constant filter is reordered once by prepare(), and other filters are reordered in each call.
+ */
+class TransposeConvGemm
+{
+public:
+  TransposeConvGemm() : _filter_shape(), _prepared(false)
+  {
+    // DO NOTHING
+  }
+
+  template <typename T> void prepare(const Shape &filter_shape, const T *filter_data)
+  {
+    reorderFilter(filter_shape, filter_data);
+    _prepared = true;
+  }
+
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const float *input_data, const Shape &filter_shape, const float *filter_data,
+                  const Shape &output_shape, float *output_data)
+  {
+    const Geometry g = makeGeometry(params, input_shape, filter_shape, output_shape);
+    const float *filter = filterFor(filter_shape, filter_data);
+    _float_col.resize(static_cast<size_t>(g.input_pixels) * g.patch_size);
+
+    const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+    const Eigen::array<Eigen::IndexPair<Eigen::DenseIndex>, 1> dim_pair = {
+      Eigen::IndexPair<Eigen::DenseIndex>(1, 1)};
+    const Eigen::TensorOpCost row_cost(sizeof(float) * g.filter_height * g.input_width *
+                                         g.patch_row_size,
+                                       sizeof(float) * g.output_row_size,
+                                       g.filter_height * g.input_width * g.patch_row_size);
+    for (int b = 0; b < g.batches; ++b)
+    {
+      // [in_h * in_w, in_ch] x [kh * kw * out_ch, in_ch]^T = [in_h * in_w, kh * kw * out_ch]
+      eigen_support::ConstEigenMatrix input(input_data + b * g.input_pixels * g.input_depth,
+                                            g.input_pixels, g.input_depth);
+      eigen_support::ConstEigenMatrix filter_matrix(filter, g.patch_size, g.input_depth);
+      eigen_support::EigenMatrix col(_float_col.data(), g.input_pixels, g.patch_size);
+      eigen_support::MatMulConvFunctor<Eigen::ThreadPoolDevice, float>()(device, col, input,
+                                                                         filter_matrix, dim_pair);
+
+      float *output = output_data + b * g.output_height * g.output_row_size;
+      device.parallelFor(g.output_height, row_cost,
+                         [&](Eigen::DenseIndex begin, Eigen::DenseIndex end) {
+                           for (Eigen::DenseIndex y = begin; y < end; ++y)
+                           {
+                             float *row = output + y * g.output_row_size;
+                             std::fill(row, row + g.output_row_size, 0.0f);
+                             col2imRow(g, _float_col.data(), y, row);
+                           }
+                         });
+    }
+  }
+
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const uint8_t *input_data, const Shape &filter_shape, const uint8_t *filter_data,
+                  const Shape &output_shape, uint8_t *output_data, ruy::Context *ruy_context)
+  {
+    quantized(params, input_shape, input_data, filter_shape, filter_data, output_shape,
+              output_data, ruy_context, [&](int32_t acc, int) {
+                return MultiplyByQuantizedMultiplier(acc, params.output_multiplier,
+                                                     params.output_shift);
+              });
+  }
+
+  /**
+   * @brief Transpose convolution of int8 with per-channel quantized filter
+   *
+   * @note  per_channel_output_multiplier() and per_channel_output_shift() should be filled before
+   */
+  void operator()(const TransposeConvParams &params, const Shape &input_shape,
+                  const int8_t *input_data, const Shape &filter_shape, const int8_t *filter_data,
+                  const Shape &output_shape, int8_t *output_data, ruy::Context *ruy_context)
+  {
+    assert(static_cast<int>(_per_channel_output_multiplier.size()) == filter_shape.Dims(0));
+    assert(static_cast<int>(_per_channel_output_shift.size()) == filter_shape.Dims(0));
+    quantized(params, input_shape, input_data, filter_shape, filter_data, output_shape,
+              output_data, ruy_context, [&](int32_t acc, int channel) {
+                return MultiplyByQuantizedMultiplier(acc, _per_channel_output_multiplier[channel],
+                                                     _per_channel_output_shift[channel]);
+              });
+  }
+
+  std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
+  std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
+
+private:
+  struct Geometry
+  {
+    int batches;
+    int input_height;
+    int input_width;
+    int input_depth;
+    int input_pixels;
+    int filter_height;
+    int filter_width;
+    int output_height;
+    int output_width;
+    int output_depth;
+    int output_row_size;
+    int patch_row_size;
+    int patch_size;
+    int stride_height;
+    int stride_width;
+    int pad_height;
+    int pad_width;
+  };
+
+  static Geometry makeGeometry(const TransposeConvParams &params, const Shape &input_shape,
+                               const Shape &filter_shape, const Shape &output_shape)
+  {
+    assert(input_shape.DimensionsCount() == 4);
+    assert(filter_shape.DimensionsCount() == 4);
+    assert(output_shape.DimensionsCount() == 4);
+
+    Geometry g;
+    g.batches = MatchingDim(input_shape, 0, output_shape, 0);
+    g.input_height = input_shape.Dims(1);
+    g.input_width = input_shape.Dims(2);
+    g.input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+    g.input_pixels = g.input_height * g.input_width;
+    g.filter_height = filter_shape.Dims(1);
+    g.filter_width = filter_shape.Dims(2);
+    g.output_height = output_shape.Dims(1);
+    g.output_width = output_shape.Dims(2);
+    g.output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+    g.output_row_size = g.output_width * g.output_depth;
+    g.patch_row_size = g.filter_width * g.output_depth;
+    g.patch_size = g.filter_height * g.patch_row_size;
+    g.stride_height = params.stride_height;
+    g.stride_width = params.stride_width;
+    g.pad_height = params.padding_values.height;
+    g.pad_width = params.padding_values.width;
+    return g;
+  }
+
+  template <typename T> void reorderFilter(const Shape &filter_shape, const T *filter_data)
+  {
+    const int output_depth = filter_shape.Dims(0);
+    const int filter_height = filter_shape.Dims(1);
+    const int filter_width = filter_shape.Dims(2);
+    const int input_depth = filter_shape.Dims(3);
+
+    _filter.resize(filter_shape.FlatSize() * sizeof(T));
+    T *reordered = reinterpret_cast<T *>(_filter.data());
+    for (int y = 0; y < filter_height; ++y)
+    {
+      for (int x = 0; x < filter_width; ++x)
+      {
+        for (int c = 0; c < output_depth; ++c)
+        {
+          std::memcpy(reordered, filter_data + Offset(filter_shape, c, y, x, 0),
+                      input_depth * sizeof(T));
+          reordered += input_depth;
+        }
+      }
+    }
+    _filter_shape.ReplaceWith(filter_shape);
+  }
+
+  template <typename T> const T *filterFor(const Shape &filter_shape, const T *filter_data)
+  {
+    if (!_prepared)
+      reorderFilter(filter_shape, filter_data);
+    assert(_filter_shape == filter_shape);
+    UNUSED_RELEASE(filter_shape);
+    return reinterpret_cast<const T *>(_filter.data());
+  }
+
+  /**
+   * @brief Add the patches of the input pixels overlapping the output row out_y to row
+   *
+   * @param col  [in_h * in_w, kh * kw * out_ch] patches of a batch
+   */
+  template <typename T>
+  static void col2imRow(const Geometry &g, const T *col, int out_y, T *row)
+  {
+    for (int filter_y = 0; filter_y < g.filter_height; ++filter_y)
+    {
+      const int shifted_y = out_y + g.pad_height - filter_y;
+      if (shifted_y < 0 || shifted_y % g.stride_height != 0)
+        continue;
+      const int in_y = shifted_y / g.stride_height;
+      if (in_y >= g.input_height)
+        continue;
+
+      for (int in_x = 0; in_x < g.input_width; ++in_x)
+      {
+        const int64_t in_pixel = in_y * g.input_width + in_x;
+        const T *patch_row = col + in_pixel * g.patch_size + filter_y * g.patch_row_size;
+        const int out_x_origin = in_x * g.stride_width - g.pad_width;
+        const int filter_x_begin = std::max(0, -out_x_origin);
+        const int filter_x_end = std::min(g.filter_width, g.output_width - out_x_origin);
+        if (filter_x_begin >= filter_x_end)
+          continue;
+        // Columns of the patch in the row are contiguous in both of the patch and the output
+        const T *src = patch_row + filter_x_begin * g.output_depth;
+        T *dst = row + (out_x_origin + filter_x_begin) * g.output_depth;
+        const int size = (filter_x_end - filter_x_begin) * g.output_depth;
+        for (int i = 0; i < size; ++i)
+        {
+          dst[i] += src[i];
+        }
+      }
+    }
+  }
+
+  template <typename T, typename RequantizeFn>
+  void quantized(const TransposeConvParams &params, const Shape &input_shape, const T *input_data,
+                 const Shape &filter_shape, const T *filter_data, const Shape &output_shape,
+                 T *output_data, ruy::Context *ruy_context, const RequantizeFn &requantize)
+  {
+    const Geometry g = makeGeometry(params, input_shape, filter_shape, output_shape);
+    const T *filter = filterFor(filter_shape, filter_data);
+    _int_col.resize(static_cast<size_t>(g.input_pixels) * g.patch_size);
+
+    // The filter is constant once prepared, so ruy may keep it packed across runs
+    MatrixParams<T> lhs_params;
+    lhs_params.order = Order::kRowMajor;
+    lhs_params.rows = g.patch_size;
+    lhs_params.cols = g.input_depth;
+    lhs_params.zero_point = -params.weights_offset;
+    lhs_params.cache_policy = _prepared ? CachePolicy::kAlwaysCache : CachePolicy::kNeverCache;
+
+    MatrixParams<T> rhs_params;
+    rhs_params.order = Order::kColMajor;
+    rhs_params.rows = g.input_depth;
+    rhs_params.cols = g.input_pixels;
+    rhs_params.zero_point = -params.input_offset;
+
+    MatrixParams<int32_t> dst_params;
+    dst_params.order = Order::kColMajor;
+    dst_params.rows = g.patch_size;
+    dst_params.cols = g.input_pixels;
+
+    // Raw accumulators, which are requantized after col2im
+    GemmParams<int32_t, int32_t> gemm_params;
+    ruy::BasicSpec<int32_t, int32_t> ruy_mul_params;
+    ruy_support::MakeRuyMulParams(gemm_params, &ruy_mul_params);
+
+    ruy::Matrix<T> ruy_lhs;
+    ruy::Matrix<int32_t> ruy_dst;
+    ruy_support::MakeRuyMatrix(lhs_params, filter, &ruy_lhs, true);
+    ruy_support::MakeRuyMatrix(dst_params, _int_col.data(), &ruy_dst);
+
+    const int32_t output_min = params.quantized_activation_min;
+    const int32_t output_max = params.quantized_activation_max;
+    for (int b = 0; b < g.batches; ++b)
+    {
+      ruy::Matrix<T> ruy_rhs;
+      ruy_support::MakeRuyMatrix(rhs_params, input_data + b * g.input_pixels * g.input_depth,
+                                 &ruy_rhs);
+      ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+
+      T *output = output_data + b * g.output_height * g.output_row_size;
+      auto accumulate_rows = [&](int64_t begin, int64_t end) {
+        std::vector<int32_t> acc_row(g.output_row_size);
+        for (int64_t y = begin; y < end; ++y)
+        {
+          std::fill(acc_row.begin(), acc_row.end(), 0);
+          col2imRow(g, _int_col.data(), y, acc_row.data());
+
+          T *row = output + y * g.output_row_size;
+          for (int x = 0; x < g.output_width; ++x)
+          {
+            for (int c = 0; c < g.output_depth; ++c)
+            {
+              const int i = x * g.output_depth + c;
+              int32_t acc = requantize(acc_row[i], c) + params.output_offset;
+              acc = std::max(acc, output_min);
+              acc = std::min(acc, output_max);
+              row[i] = static_cast<T>(acc);
+            }
+          }
+        }
+      };
+      cpu_backend_threadpool::ParallelFor(
+        g.output_height,
+        cpu_backend_threadpool::ParallelForMinGrain(g.filter_height * g.input_width *
+                                                    g.patch_row_size),
+        ruy_context, accumulate_rows);
+    }
+  }
+
+private:
+  // Filter reordered to [kh, kw, out_ch, in_ch], whose element type is of the last prepare
+  std::vector<uint8_t> _filter;
+  Shape _filter_shape;
+  bool _prepared;
+  std::vector<float> _float_col;
+  std::vector<int32_t> _int_col;
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+};
+
 } // namespace cker
 } // namespace nnfw
 
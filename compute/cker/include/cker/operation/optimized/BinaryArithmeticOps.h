@@ -23,6 +23,7 @@
 #include <utility>
 #include "cker/neon/neon_check.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -35,47 +36,45 @@ namespace cker
 namespace optimized
 {
 
-/* Old version: For Sub(float) and Div. */
+// Fivefold nested loops shared by both versions of BinaryBroadcastFiveFold. The second input
+// resets its position for each iteration of the second loop. The first input resets its position
+// at the beginning of the fourth loop. The innermost loop is an elementwise add of sections of the
+// arrays. (i0, i1) pairs of the two outer loops are split across threads if ruy_context is given.
 template <typename ElementwiseF, typename ScalarBroadcastF, typename T>
-inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &params, bool switch_inputs,
-                                    const Shape & /* unswitched_input1_shape */,
-                                    const T *unswitched_input1_data,
-                                    const Shape & /* unswitched_input2_shape */,
-                                    const T *unswitched_input2_data,
-                                    const Shape & /* output_shape */, T *output_data,
-                                    ElementwiseF elementwise_f, ScalarBroadcastF scalar_broadcast_f)
+inline void BinaryBroadcastFiveFoldLoops(const BinaryArithmeticOpParam &params,
+                                         const T *input1_data, const T *input2_data,
+                                         T *output_data, ElementwiseF elementwise_f,
+                                         ScalarBroadcastF scalar_broadcast_f,
+                                         ruy::Context *ruy_context)
 {
-  const T *input1_data = switch_inputs ? unswitched_input2_data : unswitched_input1_data;
-  const T *input2_data = switch_inputs ? unswitched_input1_data : unswitched_input2_data;
-
-  // Fivefold nested loops. The second input resets its position for each
-  // iteration of the second loop. The first input resets its position at the
-  // beginning of the fourth loop. The innermost loop is an elementwise add of
-  // sections of the arrays.
-  T *output_data_ptr = output_data;
-  const T *input1_data_ptr = input1_data;
-  const T *input2_data_reset = input2_data;
   // In the fivefold pattern, y0, y2 and y4 are not broadcast, and so shared
   // between input shapes. y3 for input 1 is always broadcast, and so the
   // dimension there is 1, whereas optionally y1 might be broadcast for input 2.
   // Put another way,
   // input1.shape.FlatSize = y0 * y1 * y2 * y4,
   // input2.shape.FlatSize = y0 * y2 * y3 * y4.
-  int y0 = params.broadcast_shape[0];
-  int y1 = params.broadcast_shape[1];
-  int y2 = params.broadcast_shape[2];
-  int y3 = params.broadcast_shape[3];
-  int y4 = params.broadcast_shape[4];
-  if (y4 > 1)
-  {
-    // General fivefold pattern, with y4 > 1 so there is a non-broadcast inner
-    // dimension.
-    for (int i0 = 0; i0 < y0; ++i0)
+  const int y0 = params.broadcast_shape[0];
+  const int y1 = params.broadcast_shape[1];
+  const int y2 = params.broadcast_shape[2];
+  const int y3 = params.broadcast_shape[3];
+  const int y4 = params.broadcast_shape[4];
+
+  // Positions of inputs and output at the beginning of each (i0, i1) pair
+  const int64_t input1_stride = static_cast<int64_t>(y2) * y4;
+  const int64_t input2_stride = static_cast<int64_t>(y2) * y3 * y4;
+  const int64_t output_stride = input2_stride;
+
+  auto loops = [&](int64_t begin, int64_t end) {
+    for (int64_t index = begin; index < end; ++index)
     {
-      const T *input2_data_ptr = nullptr;
-      for (int i1 = 0; i1 < y1; ++i1)
+      const int64_t i0 = index / y1;
+      const T *input1_data_ptr = input1_data + index * input1_stride;
+      const T *input2_data_ptr = input2_data + i0 * input2_stride;
+      T *output_data_ptr = output_data + index * output_stride;
+      if (y4 > 1)
       {
-        input2_data_ptr = input2_data_reset;
+        // General fivefold pattern, with y4 > 1 so there is a non-broadcast inner
+        // dimension.
         for (int i2 = 0; i2 < y2; ++i2)
         {
           for (int i3 = 0; i3 < y3; ++i3)
@@ -88,28 +87,14 @@ inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &params, bool
           input1_data_ptr += y4;
         }
       }
-      // We have broadcast y2*y3*y4 of input2 data y1 times, and now move on.
-      input2_data_reset = input2_data_ptr;
-    }
-  }
-  else
-  {
-    // Special case of y4 == 1, in which the innermost loop is a single element
-    // and can be combined with the next (y3) as an inner broadcast.
-    //
-    // Note that this handles the case of pure scalar broadcast when
-    // y0 == y1 == y2 == 1. With low overhead it handles cases such as scalar
-    // broadcast with batch (as y2 > 1).
-    //
-    // NOTE The process is the same as the above general case except simplified
-    // for y4 == 1 and the loop over y3 is contained within the
-    // AddScalarBroadcast function.
-    for (int i0 = 0; i0 < y0; ++i0)
-    {
-      const T *input2_data_ptr = nullptr;
-      for (int i1 = 0; i1 < y1; ++i1)
+      else
       {
-        input2_data_ptr = input2_data_reset;
+        // Special case of y4 == 1, in which the innermost loop is a single element
+        // and can be combined with the next (y3) as an inner broadcast.
+        //
+        // Note that this handles the case of pure scalar broadcast when
+        // y0 == y1 == y2 == 1. With low overhead it handles cases such as scalar
+        // broadcast with batch (as y2 > 1).
         for (int i2 = 0; i2 < y2; ++i2)
         {
           scalar_broadcast_f(y3, params, *input1_data_ptr, input2_data_ptr, output_data_ptr);
@@ -118,9 +103,29 @@ inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &params, bool
           input1_data_ptr += 1;
         }
       }
-      input2_data_reset = input2_data_ptr;
     }
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(static_cast<int64_t>(y0) * y1,
+                                      cpu_backend_threadpool::ParallelForMinGrain(output_stride),
+                                      ruy_context, loops);
+}
+
+/* Old version: For Sub(float) and Div. */
+template <typename ElementwiseF, typename ScalarBroadcastF, typename T>
+inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &params, bool switch_inputs,
+                                    const Shape & /* unswitched_input1_shape */,
+                                    const T *unswitched_input1_data,
+                                    const Shape & /* unswitched_input2_shape */,
+                                    const T *unswitched_input2_data,
+                                    const Shape & /* output_shape */, T *output_data,
+                                    ElementwiseF elementwise_f, ScalarBroadcastF scalar_broadcast_f,
+                                    ruy::Context *ruy_context = nullptr)
+{
+  const T *input1_data = switch_inputs ? unswitched_input2_data : unswitched_input1_data;
+  const T *input2_data = switch_inputs ? unswitched_input1_data : unswitched_input2_data;
+
+  BinaryBroadcastFiveFoldLoops(params, input1_data, input2_data, output_data, elementwise_f,
+                               scalar_broadcast_f, ruy_context);
 }
 
 // New version: For Mul, Add and Sub(quant8)
@@ -131,7 +136,8 @@ inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &unswitched_pa
                                     const Shape & /* unswitched_input2_shape */,
                                     const T *unswitched_input2_data,
                                     const Shape & /* output_shape */, T *output_data,
-                                    ElementwiseF elementwise_f, ScalarBroadcastF scalar_broadcast_f)
+                                    ElementwiseF elementwise_f, ScalarBroadcastF scalar_broadcast_f,
+                                    ruy::Context *ruy_context = nullptr)
 {
   BinaryArithmeticOpParam switched_params = unswitched_params;
   switched_params.input1_offset = unswitched_params.input2_offset;
@@ -148,78 +154,8 @@ inline void BinaryBroadcastFiveFold(const BinaryArithmeticOpParam &unswitched_pa
   const T *input1_data = use_unswitched ? unswitched_input1_data : unswitched_input2_data;
   const T *input2_data = use_unswitched ? unswitched_input2_data : unswitched_input1_data;
 
-  // Fivefold nested loops. The second input resets its position for each
-  // iteration of the second loop. The first input resets its position at the
-  // beginning of the fourth loop. The innermost loop is an elementwise add of
-  // sections of the arrays.
-  T *output_data_ptr = output_data;
-  const T *input1_data_ptr = input1_data;
-  const T *input2_data_reset = input2_data;
-  // In the fivefold pattern, y0, y2 and y4 are not broadcast, and so shared
-  // between input shapes. y3 for input 1 is always broadcast, and so the
-  // dimension there is 1, whereas optionally y1 might be broadcast for
-  // input 2. Put another way, input1.shape.FlatSize = y0 * y1 * y2 * y4,
-  // input2.shape.FlatSize = y0 * y2 * y3 * y4.
-  int y0 = params.broadcast_shape[0];
-  int y1 = params.broadcast_shape[1];
-  int y2 = params.broadcast_shape[2];
-  int y3 = params.broadcast_shape[3];
-  int y4 = params.broadcast_shape[4];
-  if (y4 > 1)
-  {
-    // General fivefold pattern, with y4 > 1 so there is a non-broadcast inner
-    // dimension.
-    for (int i0 = 0; i0 < y0; ++i0)
-    {
-      const T *input2_data_ptr = nullptr;
-      for (int i1 = 0; i1 < y1; ++i1)
-      {
-        input2_data_ptr = input2_data_reset;
-        for (int i2 = 0; i2 < y2; ++i2)
-        {
-          for (int i3 = 0; i3 < y3; ++i3)
-          {
-            elementwise_f(y4, params, input1_data_ptr, input2_data_ptr, output_data_ptr);
-            input2_data_ptr += y4;
-            output_data_ptr += y4;
-          }
-          // We have broadcast y4 of input1 data y3 times, and now move on.
-          input1_data_ptr += y4;
-        }
-      }
-      // We have broadcast y2*y3*y4 of input2 data y1 times, and now move on.
-      input2_data_reset = input2_data_ptr;
-    }
-  }
-  else
-  {
-    // Special case of y4 == 1, in which the innermost loop is a single
-    // element and can be combined with the next (y3) as an inner broadcast.
-    //
-    // Note that this handles the case of pure scalar broadcast when
-    // y0 == y1 == y2 == 1. With low overhead it handles cases such as scalar
-    // broadcast with batch (as y2 > 1).
-    //
-    // NOTE The process is the same as the above general case except
-    // simplified for y4 == 1 and the loop over y3 is contained within the
-    // AddScalarBroadcast function.
-    for (int i0 = 0; i0 < y0; ++i0)
-    {
-      const T *input2_data_ptr = nullptr;
-      for (int i1 = 0; i1 < y1; ++i1)
-      {
-        input2_data_ptr = input2_data_reset;
-        for (int i2 = 0; i2 < y2; ++i2)
-        {
-          scalar_broadcast_f(y3, params, *input1_data_ptr, input2_data_ptr, output_data_ptr);
-          input2_data_ptr += y3;
-          output_data_ptr += y3;
-          input1_data_ptr += 1;
-        }
-      }
-      input2_data_reset = input2_data_ptr;
-    }
-  }
+  BinaryBroadcastFiveFoldLoops(params, input1_data, input2_data, output_data, elementwise_f,
+                               scalar_broadcast_f, ruy_context);
 }
 
 template <typename T>
@@ -811,7 +747,8 @@ template <typename T>
 inline typename std::enable_if_t<is_quant8<T>::value>
 BroadcastAddDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                      const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                     const Shape &output_shape, T *output_data)
+                     const Shape &output_shape, T *output_data,
+                     ruy::Context *ruy_context = nullptr)
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
@@ -829,13 +766,14 @@ BroadcastAddDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_
     static_cast<void (*)(int, const BinaryArithmeticOpParam &, const T *, const T *, T *)>(
       AddElementwise),
     static_cast<void (*)(int, const BinaryArithmeticOpParam &, T, const T *, T *)>(
-      AddScalarBroadcast));
+      AddScalarBroadcast),
+    ruy_context);
 }
 
 inline void BroadcastAddDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                  const float *input1_data, const Shape &input2_shape,
                                  const float *input2_data, const Shape &output_shape,
-                                 float *output_data)
+                                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
@@ -851,7 +789,7 @@ inline void BroadcastAddDispatch(const BinaryArithmeticOpParam &params, const Sh
     BinaryBroadcastFiveFold(
       params, params.broadcast_category == BroadcastableOpCategory::kSecondInputBroadcastsFast,
       input1_shape, input1_data, input2_shape, input2_data, output_shape, output_data,
-      implFuncs.first, implFuncs.second);
+      implFuncs.first, implFuncs.second, ruy_context);
   }
 }
 
@@ -867,20 +805,22 @@ inline void Sub(const BinaryArithmeticOpParam &params, const Shape &input1_shape
 inline void BroadcastSubDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                  const float *input1_data, const Shape &input2_shape,
                                  const float *input2_data, const Shape &output_shape,
-                                 float *output_data)
+                                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
   if (params.broadcast_category == BroadcastableOpCategory::kFirstInputBroadcastsFast)
   {
     auto implFuncs = getBinaryOpWithActivationImplFloat<BinaryOpFuncSubFloat>(params);
     BinaryBroadcastFiveFold(params, false, input1_shape, input1_data, input2_shape, input2_data,
-                            output_shape, output_data, implFuncs.first, implFuncs.second);
+                            output_shape, output_data, implFuncs.first, implFuncs.second,
+                            ruy_context);
   }
   else if (params.broadcast_category == BroadcastableOpCategory::kSecondInputBroadcastsFast)
   {
     auto implFuncs =
       getBinaryOpWithActivationImplFloat<BinaryOpFuncSwapArgs<BinaryOpFuncSubFloat>>(params);
     BinaryBroadcastFiveFold(params, true, input1_shape, input1_data, input2_shape, input2_data,
-                            output_shape, output_data, implFuncs.first, implFuncs.second);
+                            output_shape, output_data, implFuncs.first, implFuncs.second,
+                            ruy_context);
   }
   else
   {
@@ -1176,7 +1116,8 @@ template <typename T>
 inline typename std::enable_if_t<is_quant8<T>::value>
 BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                      const T *input1_data, const Shape &input2_shape, const T *input2_data,
-                     const Shape &output_shape, T *output_data)
+                     const Shape &output_shape, T *output_data,
+                     ruy::Context *ruy_context = nullptr)
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
@@ -1193,13 +1134,14 @@ BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_
     static_cast<void (*)(int, const BinaryArithmeticOpParam &, const T *, const T *, T *)>(
       MulElementwise),
     static_cast<void (*)(int, const BinaryArithmeticOpParam &, T, const T *, T *)>(
-      MulSimpleBroadcast));
+      MulSimpleBroadcast),
+    ruy_context);
 }
 
 inline void BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                  const float *input1_data, const Shape &input2_shape,
                                  const float *input2_data, const Shape &output_shape,
-                                 float *output_data)
+                                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
   if (params.broadcast_category == BroadcastableOpCategory::kGenericBroadcast)
   {
@@ -1212,7 +1154,8 @@ inline void BroadcastMulDispatch(const BinaryArithmeticOpParam &params, const Sh
   }
   auto implFuncs = getBinaryOpWithActivationImplFloat<BinaryOpFuncMulFloat>(params);
   BinaryBroadcastFiveFold(params, input1_shape, input1_data, input2_shape, input2_data,
-                          output_shape, output_data, implFuncs.first, implFuncs.second);
+                          output_shape, output_data, implFuncs.first, implFuncs.second,
+                          ruy_context);
 }
 
 inline void Div(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
@@ -1234,21 +1177,23 @@ inline void Div(const BinaryArithmeticOpParam &params, const Shape &input1_shape
 inline void BroadcastDivDispatch(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
                                  const float *input1_data, const Shape &input2_shape,
                                  const float *input2_data, const Shape &output_shape,
-                                 float *output_data)
+                                 float *output_data, ruy::Context *ruy_context = nullptr)
 {
 #ifdef __aarch64__
   if (params.broadcast_category == BroadcastableOpCategory::kFirstInputBroadcastsFast)
   {
     auto implFuncs = getBinaryOpWithActivationImplFloat<BinaryOpFuncDivFloat>(params);
     BinaryBroadcastFiveFold(params, false, input1_shape, input1_data, input2_shape, input2_data,
-                            output_shape, output_data, implFuncs.first, implFuncs.second);
+                            output_shape, output_data, implFuncs.first, implFuncs.second,
+                            ruy_context);
   }
   else if (params.broadcast_category == BroadcastableOpCategory::kSecondInputBroadcastsFast)
   {
     auto implFuncs =
       getBinaryOpWithActivationImplFloat<BinaryOpFuncSwapArgs<BinaryOpFuncDivFloat>>(params);
     BinaryBroadcastFiveFold(params, true, input1_shape, input1_data, input2_shape, input2_data,
-                            output_shape, output_data, implFuncs.first, implFuncs.second);
+                            output_shape, output_data, implFuncs.first, implFuncs.second,
+                            ruy_context);
   }
   else
 #endif // __aarch64__
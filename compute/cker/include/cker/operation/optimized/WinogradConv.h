@@ -0,0 +1,393 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
+
+#include "cker/eigen/EigenSupport.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/**
+ * Winograd minimal filtering F(m x m, 3 x 3) for 3x3 convolutions of stride 1
+ *
+ * An output tile of m x m is computed from an input tile of (m + 2) x (m + 2) as
+ *   Y = A^T [(G g G^T) .* (B^T d B)] A
+ * where the element-wise product is summed over input channels, so that it becomes a GEMM for
+ * each of the (m + 2)^2 elements of tiles. F(2x2, 3x3) multiplies 16 times for 4 outputs and
+ * F(4x4, 3x3) 36 times for 16 outputs, instead of 36 and 144 times of the direct convolution.
+ */
+namespace winograd
+{
+
+// Channels under which the transforms cost as much as the multiplications saved
+constexpr int kMinDepth = 64;
+// Outputs under which the transformed filter, which is larger than the filter, is read for too few
+// tiles to be worth it
+constexpr int kMinSize = 8;
+// Outputs from which F(4x4, 3x3) wastes few of its larger tiles at the border
+constexpr int kMinSizeForLargeTile = 24;
+// Bytes of the transformed tiles which a task keeps between transforms and GEMMs. A block has
+// enough tiles for the GEMMs to reuse the transformed filter even with many channels.
+constexpr int kBlockBytes = 2 * 1024 * 1024;
+constexpr int kMinBlockTiles = 16;
+constexpr int kMaxBlockTiles = 64;
+
+struct Transform
+{
+  int output_tile; // m
+  int input_tile;  // m + 2
+  const float *bt; // (m + 2) x (m + 2)
+  const float *g;  // (m + 2) x 3
+  const float *at; // m x (m + 2)
+};
+
+// clang-format off
+constexpr float kBT2[] = {1,  0, -1,  0,
+                          0,  1,  1,  0,
+                          0, -1,  1,  0,
+                          0,  1,  0, -1};
+constexpr float kG2[] = {1.0f,  0.0f, 0.0f,
+                         0.5f,  0.5f, 0.5f,
+                         0.5f, -0.5f, 0.5f,
+                         0.0f,  0.0f, 1.0f};
+constexpr float kAT2[] = {1, 1,  1,  0,
+                          0, 1, -1, -1};
+
+constexpr float kBT4[] = {4,  0, -5,  0, 1, 0,
+                          0, -4, -4,  1, 1, 0,
+                          0,  4, -4, -1, 1, 0,
+                          0, -2, -1,  2, 1, 0,
+                          0,  2, -1, -2, 1, 0,
+                          0,  4,  0, -5, 0, 1};
+constexpr float kG4[] = { 1.0f / 4,   0.0f,       0.0f,
+                         -1.0f / 6,  -1.0f / 6,  -1.0f / 6,
+                         -1.0f / 6,   1.0f / 6,  -1.0f / 6,
+                          1.0f / 24,  1.0f / 12,  1.0f / 6,
+                          1.0f / 24, -1.0f / 12,  1.0f / 6,
+                          0.0f,       0.0f,       1.0f};
+constexpr float kAT4[] = {1, 1,  1, 1,  1, 0,
+                          0, 1, -1, 2, -2, 0,
+                          0, 1,  1, 4,  4, 0,
+                          0, 1, -1, 8, -8, 1};
+// clang-format on
+
+inline Transform GetTransform(int output_tile)
+{
+  assert(output_tile == 2 || output_tile == 4);
+  if (output_tile == 2)
+    return Transform{2, 4, kBT2, kG2, kAT2};
+  return Transform{4, 6, kBT4, kG4, kAT4};
+}
+
+/**
+ * @brief Compute Y = L X L^T of a tile whose elements are vectors of depth
+ *
+ * X is cols x cols and Y is rows x rows, whose element (i, j) is at
+ * data + i * row_stride + j * col_stride. tmp has rows * cols * depth floats.
+ */
+inline void TransformTile(const float *l, int rows, int cols, const float *in,
+                          int64_t in_row_stride, int64_t in_col_stride, float *tmp, float *out,
+                          int64_t out_row_stride, int64_t out_col_stride, int depth)
+{
+  // tmp = L X
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      float *dst = tmp + (i * cols + j) * depth;
+      std::fill(dst, dst + depth, 0.0f);
+      for (int k = 0; k < cols; ++k)
+      {
+        const float c = l[i * cols + k];
+        if (c == 0.0f)
+          continue;
+        const float *src = in + k * in_row_stride + j * in_col_stride;
+        for (int d = 0; d < depth; ++d)
+          dst[d] += c * src[d];
+      }
+    }
+  }
+
+  // Y = tmp L^T
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < rows; ++j)
+    {
+      float *dst = out + i * out_row_stride + j * out_col_stride;
+      std::fill(dst, dst + depth, 0.0f);
+      for (int k = 0; k < cols; ++k)
+      {
+        const float c = l[j * cols + k];
+        if (c == 0.0f)
+          continue;
+        const float *src = tmp + (i * cols + k) * depth;
+        for (int d = 0; d < depth; ++d)
+          dst[d] += c * src[d];
+      }
+    }
+  }
+}
+
+} // namespace winograd
+
+/**
+ * @brief Get the output tile size of Winograd convolution worth for the shapes, or 0 if the
+ *        convolution is not for Winograd or not worth it
+ */
+inline int WinogradOutputTile(const Shape &filter_shape, const Shape &output_shape,
+                              int stride_width, int stride_height, int dilation_width_factor,
+                              int dilation_height_factor)
+{
+  if (filter_shape.DimensionsCount() != 4 || output_shape.DimensionsCount() != 4)
+    return 0;
+  if (filter_shape.Dims(1) != 3 || filter_shape.Dims(2) != 3 || stride_width != 1 ||
+      stride_height != 1 || dilation_width_factor != 1 || dilation_height_factor != 1)
+    return 0;
+  if (filter_shape.Dims(0) < winograd::kMinDepth || filter_shape.Dims(3) < winograd::kMinDepth)
+    return 0;
+
+  const int output_size = std::min(output_shape.Dims(1), output_shape.Dims(2));
+  if (output_size >= winograd::kMinSizeForLargeTile)
+    return 4;
+  if (output_size >= winograd::kMinSize)
+    return 2;
+  return 0;
+}
+
+inline int WinogradFilterSize(int output_tile, const Shape &filter_shape)
+{
+  const int input_tile = output_tile + 2;
+  return input_tile * input_tile * filter_shape.Dims(0) * filter_shape.Dims(3);
+}
+
+/**
+ * @brief Transform a 3x3 filter of [out_ch, 3, 3, in_ch] to G g G^T of
+ *        [(m + 2) * (m + 2), in_ch, out_ch]
+ *
+ * @param transformed_data  Buffer of WinogradFilterSize() floats
+ */
+inline void TransformWinogradFilter(int output_tile, const Shape &filter_shape,
+                                    const float *filter_data, float *transformed_data)
+{
+  const winograd::Transform t = winograd::GetTransform(output_tile);
+  const int elements = t.input_tile * t.input_tile;
+  const int output_depth = filter_shape.Dims(0);
+  const int input_depth = filter_shape.Dims(3);
+  assert(filter_shape.Dims(1) == 3 && filter_shape.Dims(2) == 3);
+
+  std::vector<float> tmp(t.input_tile * 3 * input_depth);
+  std::vector<float> transformed(elements * input_depth);
+  for (int o = 0; o < output_depth; ++o)
+  {
+    winograd::TransformTile(t.g, t.input_tile, 3, filter_data + Offset(filter_shape, o, 0, 0, 0),
+                            3 * input_depth, input_depth, tmp.data(), transformed.data(),
+                            t.input_tile * input_depth, input_depth, input_depth);
+    for (int e = 0; e < elements; ++e)
+    {
+      for (int i = 0; i < input_depth; ++i)
+      {
+        transformed_data[(e * input_depth + i) * output_depth + o] =
+          transformed[e * input_depth + i];
+      }
+    }
+  }
+}
+
+/**
+ * @brief 3x3 convolution of stride 1 by Winograd F(m x m, 3 x 3)
+ *
+ * Tiles are processed in blocks in parallel on the Eigen thread pool. For a block, the input tiles
+ * are transformed, multiplied by the transformed filter with a GEMM for each element of tiles,
+ * and transformed back to the output.
+ *
+ * @param transformed_filter_data  Filter transformed by TransformWinogradFilter()
+ */
+inline void WinogradConv(const ConvParams &params, int output_tile, const Shape &input_shape,
+                         const float *input_data, const Shape &filter_shape,
+                         const float *transformed_filter_data, const Shape &bias_shape,
+                         const float *bias_data, const Shape &output_shape, float *output_data)
+{
+  UNUSED_RELEASE(bias_shape);
+  assert(input_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.stride_width == 1 && params.stride_height == 1);
+
+  const winograd::Transform t = winograd::GetTransform(output_tile);
+  const int m = t.output_tile;
+  const int alpha = t.input_tile;
+  const int elements = alpha * alpha;
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int pad_height = params.padding_values.height;
+  const int pad_width = params.padding_values.width;
+  const float activation_min = params.float_activation_min;
+  const float activation_max = params.float_activation_max;
+
+  const int tiles_height = (output_height + m - 1) / m;
+  const int tiles_width = (output_width + m - 1) / m;
+  const int tiles_count = batches * tiles_height * tiles_width;
+  const int tile_bytes = elements * (input_depth + output_depth) * sizeof(float);
+  const int block_tiles = std::min(
+    tiles_count, std::max(winograd::kMinBlockTiles,
+                          std::min(winograd::kMaxBlockTiles, winograd::kBlockBytes / tile_bytes)));
+  const int blocks_count = (tiles_count + block_tiles - 1) / block_tiles;
+
+  const int64_t input_row_stride = static_cast<int64_t>(input_width) * input_depth;
+  const int max_depth = std::max(input_depth, output_depth);
+
+  auto run_blocks = [&](Eigen::Index begin, Eigen::Index end) {
+    // [elements, block_tiles, depth] of transformed input and products, and a tile
+    std::vector<float> scratch(static_cast<size_t>(elements) * block_tiles *
+                                 (input_depth + output_depth) +
+                               2 * elements * max_depth);
+    float *transformed_input = scratch.data();
+    float *products = transformed_input + static_cast<size_t>(elements) * block_tiles * input_depth;
+    float *tile = products + static_cast<size_t>(elements) * block_tiles * output_depth;
+    float *tmp = tile + elements * max_depth;
+
+    using RowMajorMatrix = Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    using MatrixMap = Eigen::Map<RowMajorMatrix>;
+    using ConstMatrixMap = Eigen::Map<const RowMajorMatrix>;
+
+    for (Eigen::Index block = begin; block < end; ++block)
+    {
+      const int first_tile = block * block_tiles;
+      const int block_count = std::min(block_tiles, tiles_count - first_tile);
+
+      // B^T d B
+      for (int k = 0; k < block_count; ++k)
+      {
+        const int tile_index = first_tile + k;
+        const int b = tile_index / (tiles_height * tiles_width);
+        const int ty = (tile_index / tiles_width) % tiles_height;
+        const int tx = tile_index % tiles_width;
+        const int in_y = ty * m - pad_height;
+        const int in_x = tx * m - pad_width;
+
+        const float *src = nullptr;
+        int64_t src_row_stride = input_row_stride;
+        if (in_y >= 0 && in_x >= 0 && in_y + alpha <= input_height && in_x + alpha <= input_width)
+        {
+          src = input_data + Offset(input_shape, b, in_y, in_x, 0);
+        }
+        else
+        {
+          // Copy the tile on the border with zeros out of the input
+          for (int y = 0; y < alpha; ++y)
+          {
+            for (int x = 0; x < alpha; ++x)
+            {
+              float *dst = tile + (y * alpha + x) * input_depth;
+              if (in_y + y < 0 || in_y + y >= input_height || in_x + x < 0 ||
+                  in_x + x >= input_width)
+              {
+                std::fill(dst, dst + input_depth, 0.0f);
+              }
+              else
+              {
+                std::memcpy(dst, input_data + Offset(input_shape, b, in_y + y, in_x + x, 0),
+                            input_depth * sizeof(float));
+              }
+            }
+          }
+          src = tile;
+          src_row_stride = alpha * input_depth;
+        }
+        const int64_t element_stride = static_cast<int64_t>(block_tiles) * input_depth;
+        winograd::TransformTile(t.bt, alpha, alpha, src, src_row_stride, input_depth, tmp,
+                                transformed_input + k * input_depth, alpha * element_stride,
+                                element_stride, input_depth);
+      }
+
+      // (G g G^T) .* (B^T d B) summed over input channels
+      for (int e = 0; e < elements; ++e)
+      {
+        ConstMatrixMap lhs(transformed_input + static_cast<size_t>(e) * block_tiles * input_depth,
+                           block_count, input_depth);
+        ConstMatrixMap rhs(transformed_filter_data +
+                             static_cast<size_t>(e) * input_depth * output_depth,
+                           input_depth, output_depth);
+        MatrixMap dst(products + static_cast<size_t>(e) * block_tiles * output_depth, block_count,
+                      output_depth);
+        dst.noalias() = lhs * rhs;
+      }
+
+      // A^T M A
+      for (int k = 0; k < block_count; ++k)
+      {
+        const int tile_index = first_tile + k;
+        const int b = tile_index / (tiles_height * tiles_width);
+        const int out_y = ((tile_index / tiles_width) % tiles_height) * m;
+        const int out_x = (tile_index % tiles_width) * m;
+        const int valid_height = std::min(m, output_height - out_y);
+        const int valid_width = std::min(m, output_width - out_x);
+
+        const int64_t element_stride = static_cast<int64_t>(block_tiles) * output_depth;
+        winograd::TransformTile(t.at, m, alpha, products + k * output_depth,
+                                alpha * element_stride, element_stride, tmp, tile,
+                                m * output_depth, output_depth, output_depth);
+
+        for (int y = 0; y < valid_height; ++y)
+        {
+          float *dst = output_data + Offset(output_shape, b, out_y + y, out_x, 0);
+          const float *src = tile + y * m * output_depth;
+          for (int x = 0; x < valid_width; ++x)
+          {
+            for (int c = 0; c < output_depth; ++c)
+            {
+              const float value = src[x * output_depth + c] + (bias_data ? bias_data[c] : 0.0f);
+              dst[x * output_depth + c] =
+                ActivationFunctionWithMinMax(value, activation_min, activation_max);
+            }
+          }
+        }
+      }
+    }
+  };
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  const double block_macs = static_cast<double>(block_tiles) * elements * input_depth *
+                            output_depth;
+  const Eigen::TensorOpCost cost(block_tiles * tile_bytes, block_tiles * m * m * output_depth *
+                                                             sizeof(float),
+                                 2 * block_macs);
+  device.parallelFor(blocks_count, cost, run_blocks);
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_WINOGRAD_CONV_H__
@@ -174,6 +174,36 @@ inline void BroadcastBinaryArithmeticOpSlow(
   }
 }
 
+// int16 activations are symmetric, so zero points are always 0
+inline int16_t quant16_sum(const BinaryArithmeticOpParam &params, const int16_t input1_data,
+                           const int16_t input2_data)
+{
+  const int32_t shifted_input1_val = static_cast<int32_t>(input1_data) * (1 << params.left_shift);
+  const int32_t shifted_input2_val = static_cast<int32_t>(input2_data) * (1 << params.left_shift);
+  const int32_t scaled_input1_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+    shifted_input1_val, params.input1_multiplier, params.input1_shift);
+  const int32_t scaled_input2_val = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+    shifted_input2_val, params.input2_multiplier, params.input2_shift);
+  const int32_t raw_sum = scaled_input1_val + scaled_input2_val;
+  const int32_t raw_output = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+    raw_sum, params.output_multiplier, params.output_shift);
+  const int32_t clamped_output = std::min(params.quantized_activation_max,
+                                          std::max(params.quantized_activation_min, raw_output));
+  return static_cast<int16_t>(clamped_output);
+}
+
+inline int16_t quant16_mul(const BinaryArithmeticOpParam &params, const int16_t input1_data,
+                           const int16_t input2_data)
+{
+  const int32_t input1_val = input1_data;
+  const int32_t input2_val = input2_data;
+  const int32_t unclamped_result = MultiplyByQuantizedMultiplier(
+    input1_val * input2_val, params.output_multiplier, params.output_shift);
+  const int32_t clamped_output = std::min(
+    params.quantized_activation_max, std::max(params.quantized_activation_min, unclamped_result));
+  return static_cast<int16_t>(clamped_output);
+}
+
 } // namespace reference
 } // namespace cker
 } // namespace nnfw
@@ -18,7 +18,6 @@
 #ifndef __NNFW_CKER_RUY_RUY_SUPPORT_H__
 #define __NNFW_CKER_RUY_RUY_SUPPORT_H__
 
-#include <util/ConfigSource.h>
 #include <ruy/matrix.h>
 #include <ruy/ruy.h>
 #include <cassert>
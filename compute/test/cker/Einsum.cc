@@ -0,0 +1,244 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Einsum.h>
+
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+struct EinsumCase
+{
+  std::string equation;
+  // The equation with ellipsis spelled out in labels, which the naive einsum takes
+  std::string naive_equation;
+  std::vector<std::vector<int>> input_dims;
+  std::vector<int> output_dims;
+};
+
+Shape MakeShape(const std::vector<int> &dims)
+{
+  return Shape(static_cast<int>(dims.size()), dims.data());
+}
+
+std::vector<std::string> SplitInputs(const std::string &inputs)
+{
+  std::vector<std::string> labels;
+  size_t begin = 0;
+  while (true)
+  {
+    const auto comma = inputs.find(',', begin);
+    labels.push_back(inputs.substr(begin, comma - begin));
+    if (comma == std::string::npos)
+      return labels;
+    begin = comma + 1;
+  }
+}
+
+/**
+ * @brief Einsum by summing products over every combination of label values
+ *
+ * Dimensions of size 1 are broadcast.
+ */
+std::vector<float> NaiveEinsum(const std::string &equation,
+                               const std::vector<std::vector<int>> &input_dims,
+                               const std::vector<std::vector<float>> &input_data,
+                               const std::vector<int> &output_dims)
+{
+  const auto arrow = equation.find("->");
+  const auto input_labels = SplitInputs(equation.substr(0, arrow));
+  const auto output_labels = equation.substr(arrow + 2);
+
+  std::map<char, int> label_sizes;
+  for (size_t i = 0; i < input_labels.size(); ++i)
+  {
+    for (size_t d = 0; d < input_labels[i].size(); ++d)
+    {
+      auto &size = label_sizes[input_labels[i][d]];
+      size = std::max(size, input_dims[i][d]);
+    }
+  }
+  std::vector<char> labels;
+  for (const auto &label_size : label_sizes)
+    labels.push_back(label_size.first);
+
+  int output_size = 1;
+  for (auto dim : output_dims)
+    output_size *= dim;
+  std::vector<float> output(output_size, 0.0f);
+
+  std::map<char, int> values;
+  for (auto label : labels)
+    values[label] = 0;
+  while (true)
+  {
+    float product = 1.0f;
+    for (size_t i = 0; i < input_labels.size(); ++i)
+    {
+      int offset = 0;
+      for (size_t d = 0; d < input_labels[i].size(); ++d)
+      {
+        const int dim = input_dims[i][d];
+        offset = offset * dim + (dim == 1 ? 0 : values[input_labels[i][d]]);
+      }
+      product *= input_data[i][offset];
+    }
+    int offset = 0;
+    for (size_t d = 0; d < output_labels.size(); ++d)
+      offset = offset * output_dims[d] + values[output_labels[d]];
+    output[offset] += product;
+
+    size_t l = 0;
+    for (; l < labels.size(); ++l)
+    {
+      if (++values[labels[l]] < label_sizes[labels[l]])
+        break;
+      values[labels[l]] = 0;
+    }
+    if (l == labels.size())
+      return output;
+  }
+}
+
+// Small integers keep the sums exact, so that any order of summation gives the same result
+std::vector<float> RandomIntegers(int size, std::mt19937 &gen)
+{
+  std::uniform_int_distribution<int> dist(-3, 3);
+  std::vector<float> values(size);
+  for (auto &value : values)
+    value = static_cast<float>(dist(gen));
+  return values;
+}
+
+void CheckEinsum(nnfw::cker::Einsum &einsum, const EinsumCase &c, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::vector<Shape> input_shapes;
+  std::vector<std::vector<float>> input_data;
+  std::vector<const float *> input_ptrs;
+  for (const auto &dims : c.input_dims)
+  {
+    input_shapes.emplace_back(MakeShape(dims));
+    input_data.emplace_back(RandomIntegers(input_shapes.back().FlatSize(), gen));
+  }
+  for (const auto &data : input_data)
+    input_ptrs.push_back(data.data());
+  const Shape output_shape = MakeShape(c.output_dims);
+
+  const auto expected = NaiveEinsum(c.naive_equation.empty() ? c.equation : c.naive_equation,
+                                    c.input_dims, input_data, c.output_dims);
+
+  std::string equation = c.equation;
+  std::vector<float> actual(output_shape.FlatSize(), 123.0f);
+  einsum(equation, input_shapes, input_ptrs, output_shape, actual.data());
+
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_EQ(actual[i], expected[i]) << c.equation << " at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, Einsum)
+{
+  const std::vector<EinsumCase> cases = {
+    {"ij,jk->ik", "", {{5, 7}, {7, 3}}, {5, 3}},
+    {"ij,kj->ik", "", {{5, 7}, {3, 7}}, {5, 3}},
+    {"ji,jk->ik", "", {{7, 5}, {7, 3}}, {5, 3}},
+    {"bij,bjk->bik", "", {{4, 5, 6}, {4, 6, 7}}, {4, 5, 7}},
+    {"bhqd,bhkd->bhqk", "", {{2, 3, 5, 8}, {2, 3, 6, 8}}, {2, 3, 5, 6}},
+    {"bhqk,bhkd->bhqd", "", {{2, 3, 5, 6}, {2, 3, 6, 8}}, {2, 3, 5, 8}},
+    {"bqhd,bkhd->bhqk", "", {{2, 5, 3, 8}, {2, 6, 3, 8}}, {2, 3, 5, 6}},
+    {"abc,cd->abd", "", {{2, 3, 4}, {4, 5}}, {2, 3, 5}},
+    {"bij,jk->bik", "", {{6, 3, 4}, {4, 5}}, {6, 3, 5}},
+    {"ijk,k->ij", "", {{3, 4, 5}, {5}}, {3, 4}},
+    {"bijk,bkl->bijl", "", {{2, 3, 4, 5}, {2, 5, 6}}, {2, 3, 4, 6}},
+    {"i,j->ij", "", {{4}, {5}}, {4, 5}},
+    {"i,i->", "", {{6}, {6}}, {}},
+    {"ij,ij->ij", "", {{3, 4}, {3, 4}}, {3, 4}},
+    {"ij,ij->i", "", {{3, 4}, {3, 4}}, {3}},
+    {"iij,jk->ik", "", {{3, 3, 4}, {4, 5}}, {3, 5}},
+    // Reduction and transpose of one input
+    {"ij->i", "", {{4, 5}}, {4}},
+    {"ij->ji", "", {{4, 5}}, {5, 4}},
+    {"ijk->kji", "", {{2, 3, 4}}, {4, 3, 2}},
+    {"ii->i", "", {{4, 4}}, {4}},
+    {"ii->", "", {{4, 4}}, {}},
+    // Ellipsis, broadcast from the dimension of size 1
+    {"...ij,...jk->...ik", "Aij,Ajk->Aik", {{2, 3, 4}, {2, 4, 5}}, {2, 3, 5}},
+    {"...ij,jk->...ik", "BAij,jk->BAik", {{2, 3, 3, 4}, {4, 5}}, {2, 3, 3, 5}},
+    {"...ij,...jk->...ik", "Aij,Ajk->Aik", {{1, 3, 4}, {2, 4, 5}}, {2, 3, 5}},
+    // Large enough to be run by the threaded GEMM
+    {"ij,jk->ik", "", {{130, 70}, {70, 90}}, {130, 90}},
+    {"bij,bjk->bik", "", {{12, 70, 80}, {12, 80, 90}}, {12, 70, 90}}};
+
+  for (size_t i = 0; i < cases.size(); ++i)
+  {
+    nnfw::cker::Einsum einsum;
+    // The second run reuses the plan of the first one
+    CheckEinsum(einsum, cases[i], i);
+    CheckEinsum(einsum, cases[i], i + 100);
+  }
+}
+
+TEST(CKer_Operation, EinsumSwappedOperands)
+{
+  // The output has the free dimensions of the second input first, which is the contraction of
+  // the swapped inputs without transposing the output
+  const std::vector<EinsumCase> cases = {
+    {"ij,jk->ki", "", {{5, 7}, {7, 3}}, {3, 5}},
+    {"bij,bjk->bki", "", {{4, 5, 6}, {4, 6, 7}}, {4, 7, 5}},
+    {"bhqd,bhkd->bhkq", "", {{2, 3, 5, 8}, {2, 3, 6, 8}}, {2, 3, 6, 5}},
+    {"ij,jk->ki", "", {{130, 70}, {70, 90}}, {90, 130}}};
+
+  for (size_t i = 0; i < cases.size(); ++i)
+  {
+    nnfw::cker::Einsum einsum;
+    CheckEinsum(einsum, cases[i], i);
+  }
+}
+
+TEST(CKer_Operation, EinsumReplanOnShapeChange)
+{
+  // One kernel runs on inputs whose shapes change, including back to the shapes planned before
+  nnfw::cker::Einsum einsum;
+  for (int batch : {1, 3, 2, 5, 3})
+  {
+    CheckEinsum(einsum, {"bij,bjk->bik", "", {{batch, 4, 5}, {batch, 5, 6}}, {batch, 4, 6}},
+                batch);
+  }
+
+  nnfw::cker::Einsum swapped;
+  for (int rows : {5, 9, 5})
+  {
+    CheckEinsum(swapped, {"ij,jk->ki", "", {{rows, 7}, {7, 3}}, {3, rows}}, rows);
+  }
+
+  nnfw::cker::Einsum broadcast;
+  for (int batch : {2, 1, 4})
+  {
+    CheckEinsum(broadcast,
+                {"...ij,...jk->...ik", "Aij,Ajk->Aik", {{batch, 3, 4}, {1, 4, 5}}, {batch, 3, 5}},
+                batch);
+  }
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/EmbeddingLookup.h>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+constexpr int kRows = 300;
+constexpr int kDepth = 37;
+
+std::vector<float> RandomTable(std::mt19937 &gen)
+{
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<float> table(kRows * kDepth);
+  for (auto &value : table)
+    value = dist(gen);
+  return table;
+}
+
+// Lookups of few distinct rows, so that most of them are duplicates
+std::vector<int32_t> RandomLookups(int count, int distinct_rows, std::mt19937 &gen)
+{
+  std::uniform_int_distribution<int> dist(0, distinct_rows - 1);
+  std::vector<int32_t> lookups(count);
+  for (auto &lookup : lookups)
+    lookup = (dist(gen) * 7) % kRows;
+  return lookups;
+}
+
+} // namespace
+
+TEST(CKer_Operation, EmbeddingLookup)
+{
+  std::mt19937 gen(1);
+  const Shape table_shape{kRows, kDepth};
+  const auto table = RandomTable(gen);
+
+  nnfw::cker::EmbeddingLookup lookup;
+  // Both of unique lookups and lookups mostly duplicated, by one kernel across calls
+  for (int distinct_rows : {kRows, 5, 1})
+  {
+    for (int count : {0, 1, 64, 500})
+    {
+      const auto lookups = RandomLookups(count, distinct_rows, gen);
+      std::vector<float> output(count * kDepth, 123.0f);
+      lookup(table_shape, table.data(), count, lookups.data(), output.data());
+
+      for (int i = 0; i < count; ++i)
+        for (int d = 0; d < kDepth; ++d)
+          ASSERT_EQ(output[i * kDepth + d], table[lookups[i] * kDepth + d])
+            << "distinct " << distinct_rows << " lookup " << i;
+    }
+  }
+
+  // 64-bit lookups
+  const std::vector<int64_t> lookups64 = {kRows - 1, 0, kRows - 1, 42};
+  std::vector<float> output(lookups64.size() * kDepth);
+  lookup(table_shape, table.data(), lookups64.size(), lookups64.data(), output.data());
+  for (size_t i = 0; i < lookups64.size(); ++i)
+    for (int d = 0; d < kDepth; ++d)
+      ASSERT_EQ(output[i * kDepth + d], table[lookups64[i] * kDepth + d]);
+}
+
+TEST(CKer_Operation, EmbeddingLookupHalf)
+{
+  std::mt19937 gen(2);
+  const Shape table_shape{kRows, kDepth};
+  const auto table = RandomTable(gen);
+  const auto lookups = RandomLookups(200, 50, gen);
+
+  for (auto type : {nnfw::cker::HalfType::kFloat16, nnfw::cker::HalfType::kBFloat16})
+  {
+    std::vector<uint16_t> half_table(table.size());
+    nnfw::cker::ConvertFloatToHalf(table.data(), table.size(), type, half_table.data());
+
+    nnfw::cker::EmbeddingLookup lookup;
+    std::vector<float> output(lookups.size() * kDepth);
+    lookup(table_shape, half_table.data(), type, lookups.size(), lookups.data(), output.data());
+
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+      for (int d = 0; d < kDepth; ++d)
+      {
+        const uint16_t value = half_table[lookups[i] * kDepth + d];
+        const float expected = type == nnfw::cker::HalfType::kFloat16
+                                 ? nnfw::cker::Float16ToFloat(value)
+                                 : nnfw::cker::BFloat16ToFloat(value);
+        ASSERT_EQ(output[i * kDepth + d], expected) << "lookup " << i;
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, EmbeddingLookupHybrid)
+{
+  std::mt19937 gen(3);
+  const Shape table_shape{kRows, kDepth};
+  std::uniform_int_distribution<int> value_dist(-128, 127);
+  std::vector<int8_t> table(kRows * kDepth);
+  for (auto &value : table)
+    value = static_cast<int8_t>(value_dist(gen));
+  std::uniform_real_distribution<float> scale_dist(0.01f, 2.0f);
+  std::vector<float> scales(kRows);
+  for (auto &scale : scales)
+    scale = scale_dist(gen);
+  const auto lookups = RandomLookups(200, 50, gen);
+  const int32_t zero_point = 3;
+
+  nnfw::cker::EmbeddingLookup lookup;
+  std::vector<float> output(lookups.size() * kDepth);
+
+  // A scale per row
+  lookup(table_shape, table.data(), scales.data(), kRows, zero_point, lookups.size(),
+         lookups.data(), output.data());
+  for (size_t i = 0; i < lookups.size(); ++i)
+  {
+    const int row = lookups[i];
+    for (int d = 0; d < kDepth; ++d)
+      ASSERT_EQ(output[i * kDepth + d], scales[row] * (table[row * kDepth + d] - zero_point))
+        << "lookup " << i;
+  }
+
+  // A scale of the table
+  lookup(table_shape, table.data(), scales.data(), 1, zero_point, lookups.size(),
+         lookups.data(), output.data());
+  for (size_t i = 0; i < lookups.size(); ++i)
+  {
+    const int row = lookups[i];
+    for (int d = 0; d < kDepth; ++d)
+      ASSERT_EQ(output[i * kDepth + d], scales[0] * (table[row * kDepth + d] - zero_point))
+        << "lookup " << i;
+  }
+}
+
+TEST(CKer_Operation, neg_EmbeddingLookupOutOfRange)
+{
+  std::mt19937 gen(4);
+  const Shape table_shape{kRows, kDepth};
+  const auto table = RandomTable(gen);
+  nnfw::cker::EmbeddingLookup lookup;
+
+  for (const std::vector<int32_t> &lookups :
+       {std::vector<int32_t>{0, kRows}, std::vector<int32_t>{-1}, std::vector<int32_t>{2, 2, -5}})
+  {
+    std::vector<float> output(lookups.size() * kDepth);
+    EXPECT_THROW(lookup(table_shape, table.data(), lookups.size(), lookups.data(), output.data()),
+                 std::runtime_error);
+  }
+}
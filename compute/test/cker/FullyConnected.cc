@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnected.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+// Per-channel FullyConnected computed one output at a time
+void ReferenceFullyConnectedPerChannel(const nnfw::cker::FullyConnectedParams &params,
+                                       const std::vector<int32_t> &output_multiplier,
+                                       const std::vector<int> &output_shift, int batches,
+                                       int accum_depth, int output_depth,
+                                       const std::vector<int8_t> &input,
+                                       const std::vector<int8_t> &filter,
+                                       const std::vector<int32_t> &bias,
+                                       std::vector<int8_t> &output)
+{
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int c = 0; c < output_depth; ++c)
+    {
+      int32_t acc = bias.empty() ? 0 : bias[c];
+      for (int d = 0; d < accum_depth; ++d)
+      {
+        const int32_t input_val = input[b * accum_depth + d] + params.input_offset;
+        const int32_t filter_val = filter[c * accum_depth + d] + params.weights_offset;
+        acc += input_val * filter_val;
+      }
+      acc = nnfw::cker::MultiplyByQuantizedMultiplier(acc, output_multiplier[c], output_shift[c]);
+      acc += params.output_offset;
+      acc = std::max(acc, params.quantized_activation_min);
+      acc = std::min(acc, params.quantized_activation_max);
+      output[b * output_depth + c] = static_cast<int8_t>(acc);
+    }
+  }
+}
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedPerChannel)
+{
+  std::mt19937 gen(1);
+  std::uniform_int_distribution<int> value_dist(-128, 127);
+  std::uniform_int_distribution<int> bias_dist(-5000, 5000);
+  // Scales of the channels span some orders of magnitude, and a few exceed 1
+  std::uniform_real_distribution<double> log_scale_dist(-12.0, 0.5);
+
+  // GEMV, small ones, and depths which are not multiples of the ruy kernel blocks
+  const std::vector<std::vector<int>> cases = {
+    {1, 64, 16}, {1, 300, 7}, {3, 17, 5}, {8, 128, 33}, {5, 1, 1}};
+  // Input offset, output offset, activation min and max
+  const std::vector<std::vector<int>> quantizations = {
+    {0, 0, -128, 127}, {-17, 5, -128, 127}, {128, -128, -128, 127}, {3, -20, -20, 100}};
+
+  for (const auto &c : cases)
+  {
+    const int batches = c[0];
+    const int accum_depth = c[1];
+    const int output_depth = c[2];
+    for (const auto &q : quantizations)
+    {
+      for (bool has_bias : {true, false})
+      {
+        std::vector<int8_t> input(batches * accum_depth);
+        for (auto &value : input)
+          value = static_cast<int8_t>(value_dist(gen));
+        std::vector<int8_t> filter(output_depth * accum_depth);
+        for (auto &value : filter)
+          value = static_cast<int8_t>(value_dist(gen));
+        std::vector<int32_t> bias;
+        if (has_bias)
+        {
+          bias.resize(output_depth);
+          for (auto &value : bias)
+            value = bias_dist(gen);
+        }
+        std::vector<int32_t> output_multiplier(output_depth);
+        std::vector<int> output_shift(output_depth);
+        for (int ch = 0; ch < output_depth; ++ch)
+          nnfw::cker::QuantizeMultiplier(std::exp2(log_scale_dist(gen)), &output_multiplier[ch],
+                                         &output_shift[ch]);
+
+        nnfw::cker::FullyConnectedParams params;
+        // Per-channel weights are symmetric
+        params.weights_offset = 0;
+        params.input_offset = q[0];
+        params.output_offset = q[1];
+        params.quantized_activation_min = q[2];
+        params.quantized_activation_max = q[3];
+
+        std::vector<int8_t> expected(batches * output_depth);
+        ReferenceFullyConnectedPerChannel(params, output_multiplier, output_shift, batches,
+                                          accum_depth, output_depth, input, filter, bias,
+                                          expected);
+
+        ruy::Context ruy_context;
+        std::vector<int8_t> actual(batches * output_depth);
+        // Run twice, as the second run reuses the weights ruy cached
+        for (int run = 0; run < 2; ++run)
+        {
+          std::fill(actual.begin(), actual.end(), 0);
+          nnfw::cker::FullyConnectedPerChannel(
+            params, output_multiplier.data(), output_shift.data(), Shape{batches, accum_depth},
+            input.data(), Shape{output_depth, accum_depth}, filter.data(), Shape{output_depth},
+            has_bias ? bias.data() : nullptr, Shape{batches, output_depth}, actual.data(),
+            &ruy_context);
+
+          for (size_t i = 0; i < expected.size(); ++i)
+            ASSERT_EQ(actual[i], expected[i])
+              << "batches " << batches << " depth " << accum_depth << " units " << output_depth
+              << " input offset " << q[0] << " run " << run << " at " << i;
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/Half.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using nnfw::cker::BFloat16ToFloat;
+using nnfw::cker::Float16ToFloat;
+using nnfw::cker::FloatToBFloat16;
+using nnfw::cker::FloatToFloat16;
+
+namespace
+{
+
+bool IsFloat16NaN(uint16_t value) { return (value & 0x7c00) == 0x7c00 && (value & 0x03ff) != 0; }
+
+bool IsBFloat16NaN(uint16_t value) { return (value & 0x7f80) == 0x7f80 && (value & 0x007f) != 0; }
+
+} // namespace
+
+TEST(CKer_Half, FloatToFloat16RoundToNearestEven)
+{
+  // Exact values
+  EXPECT_EQ(FloatToFloat16(0.0f), 0x0000);
+  EXPECT_EQ(FloatToFloat16(-0.0f), 0x8000);
+  EXPECT_EQ(FloatToFloat16(1.0f), 0x3c00);
+  EXPECT_EQ(FloatToFloat16(-2.5f), 0xc100);
+  EXPECT_EQ(FloatToFloat16(65504.0f), 0x7bff);
+
+  // Ties between 1 and the next value round to the even mantissa
+  EXPECT_EQ(FloatToFloat16(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+  EXPECT_EQ(FloatToFloat16(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3c02);
+  EXPECT_EQ(FloatToFloat16(-(1.0f + 3 * std::ldexp(1.0f, -11))), 0xbc02);
+  // Values off the ties round to the nearest
+  EXPECT_EQ(FloatToFloat16(1.0f + std::ldexp(1.0f, -11) + std::ldexp(1.0f, -20)), 0x3c01);
+  EXPECT_EQ(FloatToFloat16(1.0f + std::ldexp(1.0f, -11) - std::ldexp(1.0f, -20)), 0x3c00);
+  // A tie which carries into the exponent
+  EXPECT_EQ(FloatToFloat16(2.0f - std::ldexp(1.0f, -12)), 0x4000);
+}
+
+TEST(CKer_Half, FloatToFloat16Subnormal)
+{
+  // The smallest and the largest subnormals, and the smallest normal
+  EXPECT_EQ(FloatToFloat16(std::ldexp(1.0f, -24)), 0x0001);
+  EXPECT_EQ(FloatToFloat16(1023 * std::ldexp(1.0f, -24)), 0x03ff);
+  EXPECT_EQ(FloatToFloat16(std::ldexp(1.0f, -14)), 0x0400);
+  EXPECT_EQ(FloatToFloat16(-std::ldexp(1.0f, -24)), 0x8001);
+
+  // Ties of the 2^-24 step round to even
+  EXPECT_EQ(FloatToFloat16(std::ldexp(1.0f, -25)), 0x0000);
+  EXPECT_EQ(FloatToFloat16(3 * std::ldexp(1.0f, -25)), 0x0002);
+  EXPECT_EQ(FloatToFloat16(5 * std::ldexp(1.0f, -25)), 0x0002);
+  // The largest subnormal rounds up to the smallest normal
+  EXPECT_EQ(FloatToFloat16(2047 * std::ldexp(1.0f, -25)), 0x0400);
+  // Float values too small even for a subnormal
+  EXPECT_EQ(FloatToFloat16(std::ldexp(1.0f, -26)), 0x0000);
+  EXPECT_EQ(FloatToFloat16(-std::numeric_limits<float>::denorm_min()), 0x8000);
+
+  EXPECT_EQ(Float16ToFloat(0x0001), std::ldexp(1.0f, -24));
+  EXPECT_EQ(Float16ToFloat(0x03ff), 1023 * std::ldexp(1.0f, -24));
+  EXPECT_EQ(Float16ToFloat(0x8200), -std::ldexp(1.0f, -15));
+}
+
+TEST(CKer_Half, FloatToFloat16Overflow)
+{
+  // 65520 is the tie between 65504 and 65536, which rounds to the even, Inf
+  EXPECT_EQ(FloatToFloat16(65519.996f), 0x7bff);
+  EXPECT_EQ(FloatToFloat16(65520.0f), 0x7c00);
+  EXPECT_EQ(FloatToFloat16(-65520.0f), 0xfc00);
+  EXPECT_EQ(FloatToFloat16(1e10f), 0x7c00);
+  EXPECT_EQ(FloatToFloat16(std::numeric_limits<float>::max()), 0x7c00);
+}
+
+TEST(CKer_Half, Float16InfNaN)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  EXPECT_EQ(FloatToFloat16(inf), 0x7c00);
+  EXPECT_EQ(FloatToFloat16(-inf), 0xfc00);
+  EXPECT_TRUE(IsFloat16NaN(FloatToFloat16(std::numeric_limits<float>::quiet_NaN())));
+  EXPECT_TRUE(IsFloat16NaN(FloatToFloat16(-std::numeric_limits<float>::quiet_NaN())));
+  // A NaN whose payload is only in the lower bits does not become Inf
+  EXPECT_TRUE(IsFloat16NaN(FloatToFloat16(std::numeric_limits<float>::signaling_NaN())));
+
+  EXPECT_EQ(Float16ToFloat(0x7c00), inf);
+  EXPECT_EQ(Float16ToFloat(0xfc00), -inf);
+  EXPECT_TRUE(std::isnan(Float16ToFloat(0x7e00)));
+  EXPECT_TRUE(std::isnan(Float16ToFloat(0x7c01)));
+}
+
+TEST(CKer_Half, Float16RoundTrip)
+{
+  // Every float16 is a float, which converts back to itself
+  for (uint32_t value = 0; value <= 0xffff; ++value)
+  {
+    const uint16_t half = static_cast<uint16_t>(value);
+    const float expanded = Float16ToFloat(half);
+    if (IsFloat16NaN(half))
+    {
+      EXPECT_TRUE(std::isnan(expanded)) << std::hex << value;
+      continue;
+    }
+    ASSERT_EQ(FloatToFloat16(expanded), half) << std::hex << value;
+  }
+}
+
+TEST(CKer_Half, FloatToBFloat16)
+{
+  EXPECT_EQ(FloatToBFloat16(1.0f), 0x3f80);
+  EXPECT_EQ(FloatToBFloat16(-2.0f), 0xc000);
+  EXPECT_EQ(BFloat16ToFloat(0x3f80), 1.0f);
+
+  // Ties round to the even mantissa
+  EXPECT_EQ(FloatToBFloat16(1.0f + std::ldexp(1.0f, -8)), 0x3f80);
+  EXPECT_EQ(FloatToBFloat16(1.0f + 3 * std::ldexp(1.0f, -8)), 0x3f82);
+  EXPECT_EQ(FloatToBFloat16(1.0f + std::ldexp(1.0f, -8) + std::ldexp(1.0f, -20)), 0x3f81);
+
+  // Subnormals keep the upper bits of the float, rounded as well
+  EXPECT_EQ(FloatToBFloat16(std::ldexp(1.0f, -130)), 0x0008);
+  EXPECT_EQ(FloatToBFloat16(std::numeric_limits<float>::denorm_min()), 0x0000);
+  EXPECT_EQ(BFloat16ToFloat(0x0008), std::ldexp(1.0f, -130));
+
+  // The largest floats round to Inf
+  const float inf = std::numeric_limits<float>::infinity();
+  EXPECT_EQ(FloatToBFloat16(std::numeric_limits<float>::max()), 0x7f80);
+  EXPECT_EQ(FloatToBFloat16(inf), 0x7f80);
+  EXPECT_EQ(FloatToBFloat16(-inf), 0xff80);
+  EXPECT_EQ(BFloat16ToFloat(0x7f80), inf);
+
+  // NaN is not rounded to Inf
+  EXPECT_TRUE(IsBFloat16NaN(FloatToBFloat16(std::numeric_limits<float>::quiet_NaN())));
+  EXPECT_TRUE(IsBFloat16NaN(FloatToBFloat16(std::numeric_limits<float>::signaling_NaN())));
+  EXPECT_TRUE(std::isnan(BFloat16ToFloat(0x7fc0)));
+}
+
+TEST(CKer_Half, ConvertHalfToFloat)
+{
+  // Lengths which leave tails of every size after the vectorized part
+  for (int size : {0, 1, 7, 8, 9, 15, 16, 17, 1003})
+  {
+    std::vector<uint16_t> input(size);
+    for (int i = 0; i < size; ++i)
+      input[i] = static_cast<uint16_t>(i * 61 + 7);
+
+    std::vector<float> output(size);
+    nnfw::cker::ConvertHalfToFloat(input.data(), size, nnfw::cker::HalfType::kFloat16,
+                                   output.data());
+    for (int i = 0; i < size; ++i)
+    {
+      if (IsFloat16NaN(input[i]))
+        EXPECT_TRUE(std::isnan(output[i])) << size << " at " << i;
+      else
+        ASSERT_EQ(output[i], Float16ToFloat(input[i])) << size << " at " << i;
+    }
+
+    nnfw::cker::ConvertHalfToFloat(input.data(), size, nnfw::cker::HalfType::kBFloat16,
+                                   output.data());
+    for (int i = 0; i < size; ++i)
+    {
+      if (IsBFloat16NaN(input[i]))
+        EXPECT_TRUE(std::isnan(output[i])) << size << " at " << i;
+      else
+        ASSERT_EQ(output[i], BFloat16ToFloat(input[i])) << size << " at " << i;
+    }
+  }
+}
+
+TEST(CKer_Half, ConvertFloatToHalf)
+{
+  const std::vector<float> input = {0.0f, 1.0f, -3.75f, 1e-6f, 70000.0f, 0.1f, -1e30f};
+  std::vector<uint16_t> output(input.size());
+
+  nnfw::cker::ConvertFloatToHalf(input.data(), input.size(), nnfw::cker::HalfType::kFloat16,
+                                 output.data());
+  for (size_t i = 0; i < input.size(); ++i)
+    EXPECT_EQ(output[i], FloatToFloat16(input[i]));
+
+  nnfw::cker::ConvertFloatToHalf(input.data(), input.size(), nnfw::cker::HalfType::kBFloat16,
+                                 output.data());
+  for (size_t i = 0; i < input.size(); ++i)
+    EXPECT_EQ(output[i], FloatToBFloat16(input[i]));
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/Gather.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::HalfType;
+using nnfw::cker::Shape;
+
+std::vector<float> RandomFloats(int size, std::mt19937 &gen)
+{
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> values(size);
+  for (auto &value : values)
+    value = dist(gen);
+  return values;
+}
+
+// Relative error of rounding a float to the type
+float HalfEpsilon(HalfType type) { return type == HalfType::kFloat16 ? 1.0f / 2048 : 1.0f / 256; }
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnectedHalfWeights)
+{
+  std::mt19937 gen(1);
+  // GEMV, small and wide ones, and rows longer than a block of expanded weights
+  const std::vector<std::vector<int>> cases = {
+    {1, 1024, 1008}, {5, 37, 19}, {16, 512, 77}, {3, 5000, 3}};
+
+  for (auto type : {HalfType::kFloat16, HalfType::kBFloat16})
+  {
+    for (const auto &c : cases)
+    {
+      const int batches = c[0];
+      const int input_size = c[1];
+      const int num_units = c[2];
+      const auto input = RandomFloats(batches * input_size, gen);
+      const auto weights = RandomFloats(num_units * input_size, gen);
+      const auto bias = RandomFloats(num_units, gen);
+      const Shape input_shape{batches, input_size};
+      const Shape weights_shape{num_units, input_size};
+      const Shape bias_shape{num_units};
+      const Shape output_shape{batches, num_units};
+
+      std::vector<uint16_t> half_weights(weights.size());
+      nnfw::cker::ConvertFloatToHalf(weights.data(), weights.size(), type, half_weights.data());
+
+      nnfw::cker::FullyConnectedParams params;
+      params.activation = nnfw::cker::FusedActivationFunctionType::kNone;
+
+      std::vector<float> expected(batches * num_units);
+      nnfw::cker::FullyConnected(params, input_shape, input.data(), weights_shape, weights.data(),
+                                 bias_shape, bias.data(), output_shape, expected.data());
+
+      ruy::Context ruy_context;
+      std::vector<float> actual(batches * num_units);
+      nnfw::cker::FullyConnectedHalfWeights(params, input_shape, input.data(), weights_shape,
+                                            half_weights.data(), type, bias_shape, bias.data(),
+                                            output_shape, actual.data(), &ruy_context);
+
+      // The error is at most the rounding error of weights over the sum of |input * weight|
+      for (int b = 0; b < batches; ++b)
+      {
+        for (int u = 0; u < num_units; ++u)
+        {
+          float magnitude = 0.0f;
+          for (int i = 0; i < input_size; ++i)
+            magnitude += std::fabs(input[b * input_size + i] * weights[u * input_size + i]);
+          const float tolerance = HalfEpsilon(type) * magnitude + 1e-4f;
+          ASSERT_NEAR(actual[b * num_units + u], expected[b * num_units + u], tolerance)
+            << "batch " << b << " unit " << u;
+        }
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, GatherHalf)
+{
+  std::mt19937 gen(2);
+  const Shape input_shape{6, 100, 33};
+  const auto table = RandomFloats(input_shape.FlatSize(), gen);
+  const std::vector<int32_t> coords = {5, 99, 0, 5, 42};
+  const Shape coords_shape{static_cast<int>(coords.size())};
+
+  for (auto type : {HalfType::kFloat16, HalfType::kBFloat16})
+  {
+    std::vector<uint16_t> half_table(table.size());
+    nnfw::cker::ConvertFloatToHalf(table.data(), table.size(), type, half_table.data());
+
+    nnfw::cker::GatherParams params;
+    params.axis = 1;
+    const Shape output_shape{6, static_cast<int>(coords.size()), 33};
+
+    std::vector<float> expected(output_shape.FlatSize());
+    nnfw::cker::Gather<float>(params, input_shape, table.data(), coords_shape, coords.data(),
+                              output_shape, expected.data());
+    std::vector<float> actual(output_shape.FlatSize());
+    nnfw::cker::Gather(params, input_shape, half_table.data(), type, coords_shape, coords.data(),
+                       output_shape, actual.data());
+
+    // Values near 0 are float16 subnormals, whose step is 2^-24
+    for (size_t i = 0; i < expected.size(); ++i)
+      ASSERT_NEAR(actual[i], expected[i], HalfEpsilon(type) * std::fabs(expected[i]) + 1e-7f)
+        << "at " << i;
+  }
+}
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LSTM.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::FusedActivationFunctionType;
+
+std::vector<float> RandomFloats(int size, float range, std::mt19937 &gen)
+{
+  std::uniform_real_distribution<float> dist(-range, range);
+  std::vector<float> values(size);
+  for (auto &value : values)
+    value = dist(gen);
+  return values;
+}
+
+int8_t QuantizeInt8(float value, float scale, int32_t zero_point)
+{
+  const float quantized = std::round(value / scale) + zero_point;
+  return static_cast<int8_t>(std::max(-128.0f, std::min(127.0f, quantized)));
+}
+
+// Weights of an LSTM without peephole, layer norm and projection, in the order of input, forget,
+// cell and output gate
+struct LSTMWeights
+{
+  std::vector<float> input[4];
+  std::vector<float> recurrent[4];
+  std::vector<float> bias[4];
+};
+
+struct IntegerLSTMCase
+{
+  int n_batch;
+  int n_input;
+  int n_cell;
+  int time_steps;
+  bool use_cifg;
+  float cell_clip;
+};
+
+/**
+ * @brief Run the float LSTM and the integer LSTM of its weights quantized, and compare outputs
+ */
+void CheckIntegerLSTM(const IntegerLSTMCase &c)
+{
+  const int n_batch = c.n_batch;
+  const int n_input = c.n_input;
+  const int n_cell = c.n_cell;
+  const int n_output = c.n_cell;
+  const int first_gate = c.use_cifg ? 1 : 0;
+
+  std::mt19937 gen(n_batch * 100 + n_input * 10 + n_cell);
+  const float weight_range = 0.8f;
+  LSTMWeights weights;
+  for (int g = first_gate; g < 4; ++g)
+  {
+    weights.input[g] = RandomFloats(n_cell * n_input, weight_range, gen);
+    weights.recurrent[g] = RandomFloats(n_cell * n_output, weight_range, gen);
+    weights.bias[g] = RandomFloats(n_cell, 0.3f, gen);
+  }
+  const auto input = RandomFloats(c.time_steps * n_batch * n_input, 2.0f, gen);
+
+  // Float LSTM
+  nnfw::cker::LSTMParams params;
+  params.activation = FusedActivationFunctionType::kTanh;
+  params.cell_clip = c.cell_clip;
+  params.proj_clip = 0;
+  std::vector<float> output_state(n_batch * n_output, 0.0f);
+  std::vector<float> cell_state(n_batch * n_cell, 0.0f);
+  std::vector<float> scratch(4 * n_batch * n_cell);
+  std::vector<float> output(c.time_steps * n_batch * n_output);
+  auto gate = [&](const std::vector<float> *v, int g) {
+    return g < first_gate ? nullptr : v[g].data();
+  };
+  for (int t = 0; t < c.time_steps; ++t)
+  {
+    nnfw::cker::LstmStepFloat(
+      input.data() + t * n_batch * n_input, gate(weights.input, 0), gate(weights.input, 1),
+      gate(weights.input, 2), gate(weights.input, 3), nullptr, nullptr, nullptr, nullptr, nullptr,
+      gate(weights.recurrent, 0), gate(weights.recurrent, 1), gate(weights.recurrent, 2),
+      gate(weights.recurrent, 3), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      gate(weights.bias, 0), gate(weights.bias, 1), gate(weights.bias, 2), gate(weights.bias, 3),
+      nullptr, nullptr, &params, n_batch, n_cell, n_input, 0, n_output, n_output,
+      output_state.data(), cell_state.data(), scratch.data(), scratch.data() + n_batch * n_cell,
+      scratch.data() + 2 * n_batch * n_cell, scratch.data() + 3 * n_batch * n_cell,
+      output.data() + t * n_batch * n_output);
+  }
+
+  // Quantization which LSTMLayer would find from the tensors
+  const float input_scale = 2.0f / 127;
+  const int32_t input_zp = 3;
+  const float output_scale = 1.0f / 128;
+  const int32_t output_zp = -1;
+  const int cell_scale = -11;
+  const float weight_scale = weight_range / 127;
+  const double gate_scale = std::pow(2.0, -12);
+
+  nnfw::cker::IntegerLSTMParams integer_params;
+  integer_params.cell_scale = cell_scale;
+  integer_params.quantized_cell_clip =
+    c.cell_clip > 0 ? static_cast<int16_t>(std::round(c.cell_clip / std::pow(2.0, cell_scale)))
+                    : 0;
+  nnfw::cker::QuantizeMultiplier(std::pow(2.0, -30) / output_scale,
+                                 &integer_params.effective_hidden_scale_a,
+                                 &integer_params.effective_hidden_scale_b);
+  integer_params.hidden_zp = output_zp;
+
+  const int n_gates = 4 - first_gate;
+  std::vector<int8_t> input_weights(n_gates * n_cell * n_input);
+  std::vector<int8_t> recurrent_weights(n_gates * n_cell * n_output);
+  std::vector<int32_t> input_bias(n_gates * n_cell);
+  std::vector<int32_t> recurrent_bias(n_gates * n_cell);
+  for (int g = first_gate; g < 4; ++g)
+  {
+    nnfw::cker::QuantizeMultiplier(weight_scale * input_scale / gate_scale,
+                                   &integer_params.effective_input_scale_a[g],
+                                   &integer_params.effective_input_scale_b[g]);
+    nnfw::cker::QuantizeMultiplier(weight_scale * output_scale / gate_scale,
+                                   &integer_params.effective_recurrent_scale_a[g],
+                                   &integer_params.effective_recurrent_scale_b[g]);
+    for (int cell = 0; cell < n_cell; ++cell)
+    {
+      const int row = (g - first_gate) * n_cell + cell;
+      int32_t input_sum = 0;
+      for (int i = 0; i < n_input; ++i)
+      {
+        const int8_t w = QuantizeInt8(weights.input[g][cell * n_input + i], weight_scale, 0);
+        input_weights[row * n_input + i] = w;
+        input_sum += w;
+      }
+      int32_t recurrent_sum = 0;
+      for (int i = 0; i < n_output; ++i)
+      {
+        const int8_t w = QuantizeInt8(weights.recurrent[g][cell * n_output + i], weight_scale, 0);
+        recurrent_weights[row * n_output + i] = w;
+        recurrent_sum += w;
+      }
+      input_bias[row] =
+        static_cast<int32_t>(std::round(weights.bias[g][cell] / (weight_scale * input_scale))) -
+        input_zp * input_sum;
+      recurrent_bias[row] = -output_zp * recurrent_sum;
+    }
+  }
+
+  std::vector<int8_t> quantized_input(input.size());
+  for (size_t i = 0; i < input.size(); ++i)
+    quantized_input[i] = QuantizeInt8(input[i], input_scale, input_zp);
+
+  // Integer LSTM
+  ruy::Context ruy_context;
+  std::vector<int8_t> quantized_output_state(n_batch * n_output, output_zp);
+  std::vector<int16_t> quantized_cell_state(n_batch * n_cell, 0);
+  std::vector<int32_t> input_accum(n_gates * n_cell * n_batch);
+  std::vector<int32_t> recurrent_accum(n_gates * n_cell * n_batch);
+  std::vector<int16_t> gate_scratch(4 * n_cell * n_batch);
+  std::vector<int8_t> quantized_output(output.size());
+  for (int t = 0; t < c.time_steps; ++t)
+  {
+    nnfw::cker::LstmStepInteger8x8_16(
+      integer_params, c.use_cifg, quantized_input.data() + t * n_batch * n_input,
+      input_weights.data(), input_bias.data(), recurrent_weights.data(), recurrent_bias.data(),
+      n_batch, n_cell, n_input, n_output, n_output, quantized_output_state.data(),
+      quantized_cell_state.data(), input_accum.data(), recurrent_accum.data(),
+      gate_scratch.data(), quantized_output.data() + t * n_batch * n_output, &ruy_context);
+  }
+
+  // Quantization errors of inputs and weights add up across time steps
+  for (size_t i = 0; i < output.size(); ++i)
+    ASSERT_NEAR((quantized_output[i] - output_zp) * output_scale, output[i], 4 * output_scale)
+      << "at " << i;
+  for (size_t i = 0; i < cell_state.size(); ++i)
+    ASSERT_NEAR(quantized_cell_state[i] * std::pow(2.0f, cell_scale), cell_state[i], 0.05f)
+      << "cell at " << i;
+}
+
+struct FloatLSTMCase
+{
+  bool use_cifg;
+  bool use_peephole;
+  bool use_layer_norm;
+  bool use_projection;
+  bool time_major;
+  int n_batch;
+};
+
+/**
+ * @brief Run the sequence by LstmStepFloat and by LstmStepFloatWithPrecomputedInput, as
+ *        LSTMLayer does for each layout, and compare outputs and states
+ */
+void CheckPrecomputedInputLSTM(const FloatLSTMCase &c)
+{
+  const int n_batch = c.n_batch;
+  const int max_time = 5;
+  const int n_input = 7;
+  const int n_cell = 9;
+  const int n_output = c.use_projection ? 6 : n_cell;
+  const int first_gate = c.use_cifg ? 1 : 0;
+
+  std::mt19937 gen(1);
+  std::vector<float> input_weights[4], recurrent_weights[4], bias[4], peephole[4], layer_norm[4];
+  for (int g = 0; g < 4; ++g)
+  {
+    input_weights[g] = RandomFloats(n_cell * n_input, 0.5f, gen);
+    recurrent_weights[g] = RandomFloats(n_cell * n_output, 0.5f, gen);
+    bias[g] = RandomFloats(n_cell, 0.5f, gen);
+    peephole[g] = RandomFloats(n_cell, 0.5f, gen);
+    layer_norm[g] = RandomFloats(n_cell, 0.5f, gen);
+  }
+  const auto projection_weights = RandomFloats(n_output * n_cell, 0.5f, gen);
+  const auto projection_bias = RandomFloats(n_output, 0.5f, gen);
+  const auto input = RandomFloats(max_time * n_batch * n_input, 0.5f, gen);
+
+  nnfw::cker::LSTMParams params;
+  params.activation = FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.3f;
+  params.proj_clip = c.use_projection ? 0.4f : 0.0f;
+
+  auto optional = [](const std::vector<float> &v, bool given) {
+    return given ? v.data() : nullptr;
+  };
+  // Peephole and layer norm of the input gate are omitted with CIFG
+  const float *cell_to_input = optional(peephole[0], c.use_peephole && !c.use_cifg);
+  const float *cell_to_forget = optional(peephole[1], c.use_peephole);
+  const float *cell_to_output = optional(peephole[3], c.use_peephole);
+  const float *input_layer_norm = optional(layer_norm[0], c.use_layer_norm && !c.use_cifg);
+  const float *forget_layer_norm = optional(layer_norm[1], c.use_layer_norm);
+  const float *cell_layer_norm = optional(layer_norm[2], c.use_layer_norm);
+  const float *output_layer_norm = optional(layer_norm[3], c.use_layer_norm);
+  const float *input_gate_bias = optional(bias[0], !c.use_cifg);
+  const float *projection = optional(projection_weights, c.use_projection);
+  const float *projection_b = optional(projection_bias, c.use_projection);
+
+  // Steps of n_step_batch rows, which are all batches of a time in time-major layout and a time
+  // of a batch in batch-major layout
+  const int n_steps = c.time_major ? max_time : n_batch * max_time;
+  const int n_step_batch = c.time_major ? n_batch : 1;
+  auto state_batch = [&](int s) { return c.time_major ? 0 : s / max_time; };
+
+  // LstmStepFloat
+  std::vector<float> expected_output_state(n_batch * n_output, 0.0f);
+  std::vector<float> expected_cell_state(n_batch * n_cell, 0.0f);
+  std::vector<float> expected(max_time * n_batch * n_output);
+  std::vector<float> scratch(4 * n_batch * n_cell);
+  for (int s = 0; s < n_steps; ++s)
+  {
+    const int b = state_batch(s);
+    nnfw::cker::LstmStepFloat(
+      input.data() + s * n_step_batch * n_input, optional(input_weights[0], !c.use_cifg),
+      input_weights[1].data(), input_weights[2].data(), input_weights[3].data(), nullptr, nullptr,
+      nullptr, nullptr, nullptr, optional(recurrent_weights[0], !c.use_cifg),
+      recurrent_weights[1].data(), recurrent_weights[2].data(), recurrent_weights[3].data(),
+      cell_to_input, cell_to_forget, cell_to_output, input_layer_norm, forget_layer_norm,
+      cell_layer_norm, output_layer_norm, input_gate_bias, bias[1].data(), bias[2].data(),
+      bias[3].data(), projection, projection_b, &params, n_step_batch, n_cell, n_input, 0,
+      n_output, n_output, expected_output_state.data() + b * n_output,
+      expected_cell_state.data() + b * n_cell, scratch.data(), scratch.data() + n_batch * n_cell,
+      scratch.data() + 2 * n_batch * n_cell, scratch.data() + 3 * n_batch * n_cell,
+      expected.data() + s * n_step_batch * n_output);
+  }
+
+  // LstmStepFloatWithPrecomputedInput on the gates of the whole sequence
+  const int n_rows = (4 - first_gate) * n_cell;
+  std::vector<float> packed_input_weights, packed_recurrent_weights, packed_bias;
+  for (int g = first_gate; g < 4; ++g)
+  {
+    packed_input_weights.insert(packed_input_weights.end(), input_weights[g].begin(),
+                                input_weights[g].end());
+    packed_recurrent_weights.insert(packed_recurrent_weights.end(), recurrent_weights[g].begin(),
+                                    recurrent_weights[g].end());
+    packed_bias.insert(packed_bias.end(), bias[g].begin(), bias[g].end());
+  }
+  ruy::Context ruy_context;
+  std::vector<float> gates(max_time * n_batch * n_rows);
+  nnfw::cker::LstmGatesMatMul(packed_input_weights.data(), n_rows, n_input, input.data(),
+                              max_time * n_batch,
+                              c.use_layer_norm ? nullptr : packed_bias.data(), gates.data(),
+                              &ruy_context);
+
+  std::vector<float> output_state(n_batch * n_output, 0.0f);
+  std::vector<float> cell_state(n_batch * n_cell, 0.0f);
+  std::vector<float> actual(max_time * n_batch * n_output);
+  std::vector<float> step_scratch(n_cell);
+  for (int s = 0; s < n_steps; ++s)
+  {
+    const int b = state_batch(s);
+    nnfw::cker::LstmStepFloatWithPrecomputedInput(
+      packed_recurrent_weights.data(), cell_to_input, cell_to_forget, cell_to_output,
+      input_layer_norm, forget_layer_norm, cell_layer_norm, output_layer_norm, input_gate_bias,
+      bias[1].data(), bias[2].data(), bias[3].data(), projection, projection_b, &params,
+      c.use_cifg, n_step_batch, n_cell, n_output, n_output, output_state.data() + b * n_output,
+      cell_state.data() + b * n_cell, gates.data() + s * n_step_batch * n_rows,
+      step_scratch.data(), actual.data() + s * n_step_batch * n_output);
+  }
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], 1e-5f) << "output at " << i;
+  for (size_t i = 0; i < expected_output_state.size(); ++i)
+    ASSERT_NEAR(output_state[i], expected_output_state[i], 1e-5f) << "output state at " << i;
+  for (size_t i = 0; i < expected_cell_state.size(); ++i)
+    ASSERT_NEAR(cell_state[i], expected_cell_state[i], 1e-5f) << "cell state at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, LstmStepInteger8x8_16)
+{
+  CheckIntegerLSTM({2, 5, 4, 6, false, 0.0f});
+  CheckIntegerLSTM({1, 16, 8, 10, false, 0.0f});
+  CheckIntegerLSTM({3, 7, 12, 5, true, 0.0f});
+  // The cell state is clipped
+  CheckIntegerLSTM({2, 5, 4, 6, false, 0.5f});
+}
+
+TEST(CKer_Operation, ApplyTanhInteger)
+{
+  // Cell states of up to 15 integer bits, whose tanh saturates beyond 6 integer bits
+  std::vector<int16_t> input;
+  for (int value = -32768; value <= 32767; value += 97)
+    input.push_back(static_cast<int16_t>(value));
+  std::vector<int16_t> output(input.size());
+
+  for (int integer_bits = 0; integer_bits <= 15; ++integer_bits)
+  {
+    std::fill(output.begin(), output.end(), 0x5555);
+    nnfw::cker::ApplyTanh(integer_bits, input.data(), 1, input.size(), output.data());
+    for (size_t i = 0; i < input.size(); ++i)
+    {
+      const float x = input[i] * std::pow(2.0f, integer_bits - 15);
+      ASSERT_NEAR(output[i] / 32768.0f, std::tanh(x), 1e-3f)
+        << "integer_bits " << integer_bits << " at " << x;
+    }
+  }
+}
+
+TEST(CKer_Operation, LstmStepFloatWithPrecomputedInput)
+{
+  for (bool time_major : {true, false})
+  {
+    for (int n_batch : {1, 3})
+    {
+      for (int options = 0; options < 16; ++options)
+      {
+        const FloatLSTMCase c{(options & 1) != 0, (options & 2) != 0, (options & 4) != 0,
+                              (options & 8) != 0, time_major, n_batch};
+        SCOPED_TRACE("options " + std::to_string(options) + " batch " + std::to_string(n_batch) +
+                     (time_major ? " time major" : " batch major"));
+        CheckPrecomputedInputLSTM(c);
+      }
+    }
+  }
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/HardSwish.h>
+#include <cker/operation/LUT.h>
+#include <cker/Utils.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+// Lengths which leave tails of every size after 8, 16 and 32 values of the vectorized loops
+std::vector<int> TestSizes()
+{
+  std::vector<int> sizes;
+  for (int size = 0; size <= 70; ++size)
+    sizes.push_back(size);
+  sizes.push_back(1037);
+  return sizes;
+}
+
+// Quantized transform of a value without the table, which rescales by the inverse scale as the
+// table does
+template <typename T, typename Func>
+T QuantizedTransform(Func transform, T input, float input_scale, int32_t input_zero_point,
+                     float output_scale, int32_t output_zero_point)
+{
+  const float transformed = transform(input_scale * (input - input_zero_point));
+  const int32_t quantized =
+    static_cast<int32_t>(std::round(transformed * (1.0f / output_scale)) + output_zero_point);
+  const int32_t min = std::numeric_limits<T>::min();
+  const int32_t max = std::numeric_limits<T>::max();
+  return static_cast<T>(std::max(std::min(quantized, max), min));
+}
+
+} // namespace
+
+TEST(CKer_Operation, LookupTable)
+{
+  // Every entry of the table differs from its neighbors, so that a wrong row or column shows up
+  std::mt19937 gen(1);
+  std::vector<uint8_t> table(nnfw::cker::kUint8LUTSize);
+  for (auto &entry : table)
+    entry = static_cast<uint8_t>(gen());
+
+  for (int size : TestSizes())
+  {
+    // Inputs cover every index of the table
+    std::vector<uint8_t> input(size);
+    for (int i = 0; i < size; ++i)
+      input[i] = static_cast<uint8_t>(i * 97 + 13);
+
+    std::vector<uint8_t> output(size);
+    nnfw::cker::LookupTable(input.data(), size, table.data(), output.data());
+    for (int i = 0; i < size; ++i)
+      ASSERT_EQ(output[i], table[input[i]]) << "size " << size << " at " << i;
+
+    std::vector<int8_t> signed_output(size);
+    nnfw::cker::LookupTable(reinterpret_cast<const int8_t *>(input.data()), size, table.data(),
+                            signed_output.data());
+    for (int i = 0; i < size; ++i)
+      ASSERT_EQ(static_cast<uint8_t>(signed_output[i]), table[input[i]])
+        << "size " << size << " at " << i;
+  }
+}
+
+TEST(CKer_Operation, LookupTableHardSwish)
+{
+  auto hard_swish = [](float value) { return nnfw::cker::HardSwish(value); };
+  const float input_scale = 0.05f;
+  const float output_scale = 0.03f;
+
+  // uint8
+  {
+    const int32_t input_zero_point = 130;
+    const int32_t output_zero_point = 20;
+    uint8_t table[nnfw::cker::kUint8LUTSize];
+    nnfw::cker::PopulateLookupTable<uint8_t>(hard_swish, input_scale, input_zero_point,
+                                             output_scale, output_zero_point, table);
+    for (int size : TestSizes())
+    {
+      std::vector<uint8_t> input(size);
+      for (int i = 0; i < size; ++i)
+        input[i] = static_cast<uint8_t>(i * 37 + 5);
+      std::vector<uint8_t> output(size);
+      nnfw::cker::LookupTable(input.data(), size, table, output.data());
+
+      for (int i = 0; i < size; ++i)
+      {
+        ASSERT_EQ(output[i],
+                  QuantizedTransform<uint8_t>(hard_swish, input[i], input_scale, input_zero_point,
+                                              output_scale, output_zero_point))
+          << "size " << size << " at " << i;
+      }
+    }
+  }
+
+  // int8
+  {
+    const int32_t input_zero_point = -3;
+    const int32_t output_zero_point = -100;
+    uint8_t table[nnfw::cker::kUint8LUTSize];
+    nnfw::cker::PopulateLookupTable<int8_t>(hard_swish, input_scale, input_zero_point,
+                                            output_scale, output_zero_point, table);
+    for (int size : TestSizes())
+    {
+      std::vector<int8_t> input(size);
+      for (int i = 0; i < size; ++i)
+        input[i] = static_cast<int8_t>(i * 37 + 5);
+      std::vector<int8_t> output(size);
+      nnfw::cker::LookupTable(input.data(), size, table, output.data());
+
+      for (int i = 0; i < size; ++i)
+      {
+        ASSERT_EQ(output[i],
+                  QuantizedTransform<int8_t>(hard_swish, input[i], input_scale, input_zero_point,
+                                             output_scale, output_zero_point))
+          << "size " << size << " at " << i;
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, LookupInt16Table)
+{
+  // Symmetric int16 tensors, whose tables are built as the cpu backend does for Tanh and Logistic
+  const double output_scale = 1.0 / 32768;
+  const double rescale = 1.0 / (output_scale * 32768.0);
+  std::function<double(double)> tanh = [rescale](double value) {
+    return std::tanh(value) * rescale;
+  };
+  std::function<double(double)> logistic = [rescale](double value) {
+    return rescale / (1.0 + std::exp(-value));
+  };
+
+  for (const auto &transform : {tanh, logistic})
+  {
+    for (double input_scale : {1.0 / 32768, 8.0 / 32768, 0.001})
+    {
+      std::vector<int16_t> table(nnfw::cker::kInt16LUTSize);
+      nnfw::cker::PopulateInt16LookupTable(transform, input_scale * -32768, input_scale * 32768,
+                                           table.data());
+
+      // Every int16 value, which covers every segment and both ends of the table
+      for (int32_t value = -32768; value <= 32767; ++value)
+      {
+        const int16_t output =
+          nnfw::cker::LookupInt16Table(static_cast<int16_t>(value), table.data());
+        ASSERT_NEAR(output * output_scale, transform(value * input_scale), 1e-3)
+          << "scale " << input_scale << " at " << value;
+      }
+    }
+  }
+}
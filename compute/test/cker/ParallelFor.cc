@@ -0,0 +1,585 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/CpuBackendThreadpool.h>
+#include <cker/operation/AveragePool.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Concatenation.h>
+#include <cker/operation/Gather.h>
+#include <cker/operation/MaxPool.h>
+#include <cker/operation/Pad.h>
+#include <cker/operation/ReduceMean.h>
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/StridedSlice.h>
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+using nnfw::cker::cpu_backend_threadpool::kParallelForMinWork;
+using nnfw::cker::cpu_backend_threadpool::ParallelFor;
+using nnfw::cker::cpu_backend_threadpool::ParallelForMinGrain;
+
+constexpr int kThreads = 4;
+
+std::vector<float> RandomFloats(int size, uint32_t seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+  std::vector<float> values(size);
+  for (auto &value : values)
+    value = dist(gen);
+  return values;
+}
+
+template <typename T> std::vector<T> RandomInts(int size, uint32_t seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(std::numeric_limits<T>::lowest(),
+                                          std::numeric_limits<T>::max());
+  std::vector<T> values(size);
+  for (auto &value : values)
+    value = static_cast<T>(dist(gen));
+  return values;
+}
+
+/**
+ * @brief Run kernel(output, ruy_context) without a context and on kThreads threads, and check
+ *        that both write the same output
+ *
+ * The outputs are filled with different values first, so that an element which a task misses
+ * is a mismatch too.
+ */
+template <typename T, typename Kernel> void ExpectSameAsSerial(int output_size, Kernel kernel)
+{
+  // Otherwise ParallelFor may not split the work
+  ASSERT_GE(output_size, kThreads * kParallelForMinWork);
+
+  std::vector<T> expected(output_size, static_cast<T>(1));
+  kernel(expected.data(), nullptr);
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(kThreads);
+  std::vector<T> actual(output_size, static_cast<T>(2));
+  kernel(actual.data(), &ruy_context);
+
+  for (int i = 0; i < output_size; ++i)
+    ASSERT_EQ(actual[i], expected[i]) << "at " << i;
+}
+
+int Offset4D(const Shape &shape, const int (&index)[4])
+{
+  return ((index[0] * shape.Dims(1) + index[1]) * shape.Dims(2) + index[2]) * shape.Dims(3) +
+         index[3];
+}
+
+// Visit every index of 4D shape
+template <typename Fn> void ForEachIndex(const Shape &shape, Fn fn)
+{
+  int index[4];
+  for (index[0] = 0; index[0] < shape.Dims(0); ++index[0])
+    for (index[1] = 0; index[1] < shape.Dims(1); ++index[1])
+      for (index[2] = 0; index[2] < shape.Dims(2); ++index[2])
+        for (index[3] = 0; index[3] < shape.Dims(3); ++index[3])
+          fn(index);
+}
+
+} // namespace
+
+TEST(CKer_ParallelFor, SplitCoversRange)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(kThreads);
+
+  // (size, min_grain, expected number of tasks)
+  const std::vector<std::tuple<int64_t, int64_t, int64_t>> cases = {
+    {100003, 1000, kThreads}, // uneven split
+    {7, 1, kThreads},         // fewer items than tasks would leave some empty
+    {3, 1, 3},                // fewer items than threads
+    {2999, 1000, 2},          // grain limits the number of tasks
+    {999, 1000, 1},           // too small to split
+    {0, 1, 0}};
+
+  for (const auto &c : cases)
+  {
+    const int64_t size = std::get<0>(c);
+    const int64_t min_grain = std::get<1>(c);
+
+    std::mutex mutex;
+    std::vector<std::pair<int64_t, int64_t>> ranges;
+    std::vector<int> visits(size, 0);
+    ParallelFor(size, min_grain, &ruy_context, [&](int64_t begin, int64_t end) {
+      std::lock_guard<std::mutex> lock(mutex);
+      ranges.emplace_back(begin, end);
+      for (int64_t i = begin; i < end; ++i)
+        ++visits[i];
+    });
+
+    ASSERT_EQ(static_cast<int64_t>(ranges.size()), std::get<2>(c)) << "size " << size;
+    std::sort(ranges.begin(), ranges.end());
+    for (size_t i = 0; i < ranges.size(); ++i)
+    {
+      // Contiguous, non-empty and balanced chunks
+      ASSERT_EQ(ranges[i].first, i == 0 ? 0 : ranges[i - 1].second);
+      ASSERT_LT(ranges[i].first, ranges[i].second);
+      ASSERT_GE(ranges[i].second - ranges[i].first, size / static_cast<int64_t>(ranges.size()));
+      ASSERT_LE(ranges[i].second - ranges[i].first,
+                size / static_cast<int64_t>(ranges.size()) + 1);
+    }
+    for (int64_t i = 0; i < size; ++i)
+      ASSERT_EQ(visits[i], 1) << "size " << size << " at " << i;
+  }
+}
+
+TEST(CKer_ParallelFor, NoContextRunsOnce)
+{
+  int calls = 0;
+  ParallelFor(100003, 1, nullptr, [&](int64_t begin, int64_t end) {
+    ++calls;
+    EXPECT_EQ(begin, 0);
+    EXPECT_EQ(end, 100003);
+  });
+  EXPECT_EQ(calls, 1);
+
+  EXPECT_EQ(ParallelForMinGrain(0), kParallelForMinWork);
+  EXPECT_EQ(ParallelForMinGrain(1000), kParallelForMinWork / 1000);
+  EXPECT_EQ(ParallelForMinGrain(kParallelForMinWork * 2), 1);
+}
+
+TEST(CKer_Operation, PadThreaded)
+{
+  // Padding of each rank is filled by its own path of Pad
+  const std::vector<std::pair<Shape, std::vector<int32_t>>> cases = {
+    {Shape{301, 253}, {3, 5, 2, 4}},
+    {Shape{41, 43, 31}, {1, 2, 0, 3, 2, 1}},
+    {Shape{3, 23, 31, 27}, {1, 0, 2, 3, 1, 1, 0, 2}}};
+
+  for (const auto &c : cases)
+  {
+    const Shape &input_shape = c.first;
+    const auto &paddings = c.second;
+    const int rank = input_shape.DimensionsCount();
+    Shape output_shape(rank);
+    for (int i = 0; i < rank; ++i)
+      output_shape.SetDim(i, input_shape.Dims(i) + paddings[i * 2] + paddings[i * 2 + 1]);
+
+    const auto input = RandomFloats(input_shape.FlatSize(), rank);
+    const float constant = -3.0f;
+    ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+      nnfw::cker::Pad(paddings.data(), rank, input_shape, input.data(), output_shape, output,
+                      &constant, ctx);
+    });
+
+    // Serial path of the split loops is checked against the definition of Pad
+    std::vector<float> output(output_shape.FlatSize());
+    nnfw::cker::Pad(paddings.data(), rank, input_shape, input.data(), output_shape, output.data(),
+                    &constant);
+    const Shape input_4d = Shape::ExtendedShape(4, input_shape);
+    const Shape output_4d = Shape::ExtendedShape(4, output_shape);
+    ForEachIndex(output_4d, [&](const int(&index)[4]) {
+      int in_index[4];
+      bool padded = false;
+      for (int i = 0; i < 4; ++i)
+      {
+        const int axis = i - (4 - rank);
+        in_index[i] = axis < 0 ? index[i] : index[i] - paddings[axis * 2];
+        padded = padded || in_index[i] < 0 || in_index[i] >= input_4d.Dims(i);
+      }
+      const float expected = padded ? constant : input[Offset4D(input_4d, in_index)];
+      ASSERT_EQ(output[Offset4D(output_4d, index)], expected);
+    });
+  }
+}
+
+TEST(CKer_Operation, StridedSliceThreaded)
+{
+  const Shape input_shape{5, 131, 97, 7};
+  const auto input = RandomFloats(input_shape.FlatSize(), 1);
+
+  // Forward, strided and reversed slices, whose (b, h) pairs are split unevenly
+  const int32_t begin[][4] = {{0, 0, 0, 0}, {1, 2, 3, 1}, {4, 130, 96, 6}};
+  const int32_t end[][4] = {{5, 131, 97, 7}, {5, 131, 90, 7}, {0, 0, 0, 0}};
+  const int32_t strides[][4] = {{1, 1, 1, 1}, {1, 2, 1, 2}, {-1, -1, -1, -1}};
+  const uint32_t end_mask[] = {0, 0, 0xf};
+
+  for (int c = 0; c < 3; ++c)
+  {
+    auto op_params = nnfw::cker::buildStridedSliceParams(begin[c], end[c], strides[c], 0,
+                                                         end_mask[c], 0, 4);
+    int dims[4];
+    for (int i = 0; i < 4; ++i)
+    {
+      const int start = nnfw::cker::StartForAxis(op_params, input_shape, i);
+      const int stop = nnfw::cker::StopForAxis(op_params, input_shape, i, start);
+      dims[i] = std::max(0, (stop - start + strides[c][i] - (strides[c][i] > 0 ? 1 : -1)) /
+                              strides[c][i]);
+    }
+    const Shape output_shape{dims[0], dims[1], dims[2], dims[3]};
+    nnfw::cker::checkOutputSize(op_params, input_shape, output_shape, 4);
+
+    ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+      nnfw::cker::StridedSlice(op_params, input_shape, input.data(), output_shape, output, ctx);
+    });
+  }
+}
+
+TEST(CKer_Operation, ConcatenationThreaded)
+{
+  const Shape input_shapes[] = {{37, 11, 50}, {37, 23, 50}, {37, 5, 50}};
+  std::vector<std::vector<float>> inputs;
+  for (int i = 0; i < 3; ++i)
+    inputs.push_back(RandomFloats(input_shapes[i].FlatSize(), i));
+  const Shape *input_shape_ptrs[] = {&input_shapes[0], &input_shapes[1], &input_shapes[2]};
+  const float *input_ptrs[] = {inputs[0].data(), inputs[1].data(), inputs[2].data()};
+
+  nnfw::cker::ConcatenationParams params{};
+  params.axis = 1;
+  params.inputs_count = 3;
+  const Shape output_shape{37, 39, 50};
+
+  ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+    nnfw::cker::Concatenation<float>(params, input_shape_ptrs, input_ptrs, output_shape, output,
+                                     ctx);
+  });
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(kThreads);
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::Concatenation<float>(params, input_shape_ptrs, input_ptrs, output_shape,
+                                   output.data(), &ruy_context);
+  for (int b = 0; b < 37; ++b)
+  {
+    int axis_offset = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+      for (int j = 0; j < input_shapes[i].Dims(1); ++j)
+      {
+        for (int k = 0; k < 50; ++k)
+        {
+          ASSERT_EQ(output[(b * 39 + axis_offset + j) * 50 + k],
+                    inputs[i][(b * input_shapes[i].Dims(1) + j) * 50 + k]);
+        }
+      }
+      axis_offset += input_shapes[i].Dims(1);
+    }
+  }
+}
+
+TEST(CKer_Operation, GatherThreaded)
+{
+  const Shape input_shape{7, 100, 61};
+  const auto input = RandomFloats(input_shape.FlatSize(), 1);
+
+  std::mt19937 gen(2);
+  std::uniform_int_distribution<int32_t> dist(0, 99);
+  std::vector<int32_t> coords(301);
+  for (auto &coord : coords)
+    coord = dist(gen);
+  const Shape coords_shape{301};
+
+  nnfw::cker::GatherParams params;
+  params.axis = 1;
+  const Shape output_shape{7, 301, 61};
+
+  ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+    nnfw::cker::Gather<float>(params, input_shape, input.data(), coords_shape, coords.data(),
+                              output_shape, output, ctx);
+  });
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(kThreads);
+  std::vector<float> output(output_shape.FlatSize());
+  nnfw::cker::Gather<float>(params, input_shape, input.data(), coords_shape, coords.data(),
+                            output_shape, output.data(), &ruy_context);
+  for (int b = 0; b < 7; ++b)
+    for (int i = 0; i < 301; ++i)
+      for (int k = 0; k < 61; ++k)
+        ASSERT_EQ(output[(b * 301 + i) * 61 + k], input[(b * 100 + coords[i]) * 61 + k]);
+}
+
+TEST(CKer_Operation, MeanAxis1And2Threaded)
+{
+  const Shape input_shape{3, 40, 41, 37};
+  const Shape output_shape{3, 1, 1, 37};
+  const auto input = RandomFloats(input_shape.FlatSize(), 1);
+
+  // Each task computes few outputs of a large input
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(kThreads);
+  std::vector<float> expected(output_shape.FlatSize(), 1.0f);
+  std::vector<float> actual(output_shape.FlatSize(), 2.0f);
+  nnfw::cker::MeanAxis1And2(input_shape, input.data(), output_shape, expected.data());
+  nnfw::cker::MeanAxis1And2(input_shape, input.data(), output_shape, actual.data(), &ruy_context);
+  for (int i = 0; i < output_shape.FlatSize(); ++i)
+    ASSERT_EQ(actual[i], expected[i]) << "at " << i;
+}
+
+TEST(CKer_Operation, BroadcastBinaryArithmeticThreaded)
+{
+  using nnfw::cker::BinaryArithmeticOpType;
+  using nnfw::cker::BroadcastableOpCategory;
+
+  // Five-fold broadcasts of an inner dimension, of a scalar (y4 == 1) and of swapped inputs,
+  // whose (y0, y1) pairs are split unevenly
+  const std::vector<std::pair<Shape, Shape>> cases = {{Shape{9, 6, 1, 64}, Shape{1, 6, 50, 64}},
+                                                      {Shape{1, 6, 50, 64}, Shape{9, 6, 1, 64}},
+                                                      {Shape{3, 13, 40, 1}, Shape{3, 1, 40, 300}},
+                                                      {Shape{3, 1, 40, 300}, Shape{3, 13, 40, 1}}};
+
+  for (const auto &c : cases)
+  {
+    const Shape &input1_shape = c.first;
+    const Shape &input2_shape = c.second;
+    Shape output_shape(4);
+    for (int i = 0; i < 4; ++i)
+      output_shape.SetDim(i, std::max(input1_shape.Dims(i), input2_shape.Dims(i)));
+
+    nnfw::cker::BinaryArithmeticOpParam params;
+    ASSERT_TRUE(nnfw::cker::ProcessBroadcastShapes(input1_shape, input2_shape, &params));
+    ASSERT_NE(params.broadcast_category, BroadcastableOpCategory::kGenericBroadcast);
+
+    // Element of input of broadcast shape at index of output
+    auto broadcast_offset = [](const Shape &shape, const int(&index)[4]) {
+      int in_index[4];
+      for (int i = 0; i < 4; ++i)
+        in_index[i] = shape.Dims(i) == 1 ? 0 : index[i];
+      return Offset4D(shape, in_index);
+    };
+
+    // float
+    {
+      const auto input1 = RandomFloats(input1_shape.FlatSize(), 1);
+      const auto input2 = RandomFloats(input2_shape.FlatSize(), 2);
+      params.float_activation_min = std::numeric_limits<float>::lowest();
+      params.float_activation_max = std::numeric_limits<float>::max();
+
+      ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+        nnfw::cker::BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::MUL>(
+          params, input1_shape, input1.data(), input2_shape, input2.data(), output_shape, output,
+          ctx);
+      });
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(kThreads);
+      std::vector<float> output(output_shape.FlatSize());
+      nnfw::cker::BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::ADD>(
+        params, input1_shape, input1.data(), input2_shape, input2.data(), output_shape,
+        output.data(), &ruy_context);
+      ForEachIndex(output_shape, [&](const int(&index)[4]) {
+        ASSERT_EQ(output[Offset4D(output_shape, index)],
+                  input1[broadcast_offset(input1_shape, index)] +
+                    input2[broadcast_offset(input2_shape, index)]);
+      });
+    }
+
+    // uint8, whose inputs are switched by the kernel instead of the caller
+    {
+      const auto input1 = RandomInts<uint8_t>(input1_shape.FlatSize(), 3);
+      const auto input2 = RandomInts<uint8_t>(input2_shape.FlatSize(), 4);
+      params.input1_offset = -128;
+      params.input2_offset = -100;
+      params.output_offset = 120;
+      params.left_shift = 20;
+      nnfw::cker::QuantizeMultiplierSmallerThanOneExp(0.5, &params.input1_multiplier,
+                                                      &params.input1_shift);
+      nnfw::cker::QuantizeMultiplierSmallerThanOneExp(0.25, &params.input2_multiplier,
+                                                      &params.input2_shift);
+      nnfw::cker::QuantizeMultiplierSmallerThanOneExp(1.0 / (1 << 20), &params.output_multiplier,
+                                                      &params.output_shift);
+      params.quantized_activation_min = 0;
+      params.quantized_activation_max = 255;
+
+      ExpectSameAsSerial<uint8_t>(output_shape.FlatSize(), [&](uint8_t *output,
+                                                               ruy::Context *ctx) {
+        nnfw::cker::BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::ADD>(
+          params, input1_shape, input1.data(), input2_shape, input2.data(), output_shape, output,
+          ctx);
+      });
+
+      ruy::Context ruy_context;
+      ruy_context.set_max_num_threads(kThreads);
+      std::vector<uint8_t> output(output_shape.FlatSize());
+      nnfw::cker::BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::ADD>(
+        params, input1_shape, input1.data(), input2_shape, input2.data(), output_shape,
+        output.data(), &ruy_context);
+      ForEachIndex(output_shape, [&](const int(&index)[4]) {
+        ASSERT_EQ(output[Offset4D(output_shape, index)],
+                  nnfw::cker::optimized::quant8_sum(params,
+                                                    input1[broadcast_offset(input1_shape, index)],
+                                                    input2[broadcast_offset(input2_shape, index)]));
+      });
+    }
+  }
+}
+
+TEST(CKer_Operation, TransposeThreaded)
+{
+  // 2D, 3D, 4D of few batches, each of which is split, and 4D of many batches, which are split
+  const std::vector<std::pair<Shape, std::vector<int32_t>>> cases = {
+    {Shape{301, 257}, {1, 0}},
+    {Shape{41, 61, 29}, {2, 0, 1}},
+    {Shape{3, 37, 41, 29}, {0, 3, 1, 2}},
+    {Shape{9, 30, 40, 17}, {0, 2, 3, 1}},
+    {Shape{1, 301, 1, 257}, {3, 1, 2, 0}}};
+
+  for (const auto &c : cases)
+  {
+    const Shape &input_shape = c.first;
+    const int rank = input_shape.DimensionsCount();
+    nnfw::cker::TransposeParams params;
+    params.perm_count = rank;
+    Shape output_shape(rank);
+    for (int i = 0; i < rank; ++i)
+    {
+      params.perm[i] = c.second[i];
+      output_shape.SetDim(i, input_shape.Dims(c.second[i]));
+    }
+    const auto input = RandomFloats(input_shape.FlatSize(), rank);
+
+    ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+      nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output, ctx);
+    });
+
+    ruy::Context ruy_context;
+    ruy_context.set_max_num_threads(kThreads);
+    std::vector<float> output(output_shape.FlatSize());
+    nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output.data(),
+                          &ruy_context);
+    const Shape input_4d = Shape::ExtendedShape(4, input_shape);
+    const Shape output_4d = Shape::ExtendedShape(4, output_shape);
+    ForEachIndex(output_4d, [&](const int(&index)[4]) {
+      int in_index[4] = {0, 0, 0, 0};
+      for (int i = 0; i < rank; ++i)
+        in_index[4 - rank + c.second[i]] = index[4 - rank + i];
+      ASSERT_EQ(output[Offset4D(output_4d, index)], input[Offset4D(input_4d, in_index)]);
+    });
+  }
+}
+
+TEST(CKer_Operation, ResizeBilinearThreaded)
+{
+  struct Case
+  {
+    Shape input_shape;
+    int output_height;
+    int output_width;
+    bool align_corners;
+    bool half_pixel_centers;
+  };
+  // 2x2 upsample, generic, and generic with align_corners or half_pixel_centers
+  const std::vector<Case> cases = {{Shape{2, 41, 50, 9}, 82, 100, false, false},
+                                   {Shape{2, 41, 50, 9}, 77, 93, false, false},
+                                   {Shape{3, 29, 31, 5}, 101, 73, true, false},
+                                   {Shape{3, 29, 31, 5}, 101, 73, false, true}};
+
+  for (const auto &c : cases)
+  {
+    nnfw::cker::ResizeBilinearParams params;
+    params.output_height = c.output_height;
+    params.output_width = c.output_width;
+    params.align_corners = c.align_corners;
+    params.half_pixel_centers = c.half_pixel_centers;
+    const Shape output_shape{c.input_shape.Dims(0), c.output_height, c.output_width,
+                             c.input_shape.Dims(3)};
+
+    const auto input = RandomFloats(c.input_shape.FlatSize(), 1);
+    ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+      nnfw::cker::ResizeBilinear(params, c.input_shape, input.data(), output_shape, output, ctx);
+    });
+
+    const auto input_u8 = RandomInts<uint8_t>(c.input_shape.FlatSize(), 2);
+    ExpectSameAsSerial<uint8_t>(output_shape.FlatSize(), [&](uint8_t *output, ruy::Context *ctx) {
+      nnfw::cker::ResizeBilinear(params, c.input_shape, input_u8.data(), output_shape, output,
+                                 ctx);
+    });
+
+    const auto input_s8 = RandomInts<int8_t>(c.input_shape.FlatSize(), 3);
+    ExpectSameAsSerial<int8_t>(output_shape.FlatSize(), [&](int8_t *output, ruy::Context *ctx) {
+      nnfw::cker::ResizeBilinear(params, c.input_shape, input_s8.data(), output_shape, output,
+                                 ctx);
+    });
+  }
+}
+
+TEST(CKer_Operation, PoolThreaded)
+{
+  // Channels are split unevenly with at least 8 in a task
+  const Shape input_shape{2, 65, 67, 37};
+  const Shape output_shape{2, 33, 34, 37};
+  const auto input = RandomFloats(input_shape.FlatSize(), 1);
+
+  nnfw::cker::PoolParams params{};
+  params.padding_type = nnfw::cker::PaddingType::kSame;
+  params.padding_values.height = 1;
+  params.padding_values.width = 1;
+  params.stride_height = 2;
+  params.stride_width = 2;
+  params.filter_height = 3;
+  params.filter_width = 3;
+  params.float_activation_min = -5.0f;
+  params.float_activation_max = 5.0f;
+
+  ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+    nnfw::cker::MaxPool<float>(params, input_shape, input.data(), output_shape, output, ctx);
+  });
+  ExpectSameAsSerial<float>(output_shape.FlatSize(), [&](float *output, ruy::Context *ctx) {
+    nnfw::cker::AveragePool<float>(params, input_shape, input.data(), output_shape, output, ctx);
+  });
+}
+
+TEST(CKer_Operation, SoftmaxRowsThreaded)
+{
+  // Rows are split as SoftMaxLayer does, for both of 2D and 4D inputs
+  const int rows = 1001;
+  const int depth = 67;
+  const auto input = RandomFloats(rows * depth, 1);
+  const float beta = 1.5f;
+
+  ExpectSameAsSerial<float>(rows * depth, [&](float *output, ruy::Context *ctx) {
+    ParallelFor(rows, ParallelForMinGrain(depth), ctx, [&](int64_t begin, int64_t end) {
+      nnfw::cker::Softmax(input.data() + begin * depth, depth, end - begin, beta,
+                          output + begin * depth);
+    });
+  });
+
+  nnfw::cker::SoftmaxParams params;
+  params.beta = beta;
+  std::vector<float> expected(rows * depth);
+  nnfw::cker::reference::Softmax(params, Shape{rows, depth}, input.data(), Shape{rows, depth},
+                                 expected.data());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(kThreads);
+  std::vector<float> output(rows * depth, 2.0f);
+  ParallelFor(rows, ParallelForMinGrain(depth), &ruy_context, [&](int64_t begin, int64_t end) {
+    const Shape shape{static_cast<int>(end - begin), depth};
+    nnfw::cker::Softmax(params, shape, input.data() + begin * depth, shape,
+                        output.data() + begin * depth);
+  });
+  for (int i = 0; i < rows * depth; ++i)
+    ASSERT_NEAR(output[i], expected[i], 1e-6f) << "at " << i;
+}
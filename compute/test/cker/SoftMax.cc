@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+TEST(CKer_Operation, SoftmaxInt16)
+{
+  std::mt19937 gen(1);
+  std::vector<int16_t> exp_lut(nnfw::cker::kInt16LUTSize);
+  std::vector<int16_t> one_over_one_plus_x_lut(nnfw::cker::kInt16LUTSize);
+  nnfw::cker::PopulateSoftmaxInt16LookupTables(exp_lut.data(), one_over_one_plus_x_lut.data());
+
+  // Rows of a single value, of a few values and long ones, whose inputs span narrow and wide
+  // ranges of the exp table
+  const std::vector<std::vector<int>> shapes = {{3, 1}, {4, 5}, {2, 1000}};
+  for (const auto &dims : shapes)
+  {
+    const int outer_size = dims[0];
+    const int depth = dims[1];
+    for (float input_scale : {1.0f / 4096, 1.0f / 1024, 0.01f})
+    {
+      for (double beta : {1.0, 0.5})
+      {
+        std::uniform_int_distribution<int> dist(-32768, 32767);
+        std::vector<int16_t> input(outer_size * depth);
+        for (auto &value : input)
+          value = static_cast<int16_t>(dist(gen));
+
+        // As the cpu backend does, scale (input - max) so that [-65535, 0] is [-10.0, 0.0]
+        nnfw::cker::SoftmaxParams params;
+        nnfw::cker::QuantizeMultiplier(input_scale * beta / (10.0 / 65535.0),
+                                       &params.input_multiplier, &params.input_left_shift);
+        params.exp_lut = exp_lut.data();
+        params.one_over_one_plus_x_lut = one_over_one_plus_x_lut.data();
+
+        const nnfw::cker::Shape shape{outer_size, depth};
+        std::vector<int16_t> output(input.size());
+        nnfw::cker::SoftmaxInt16(params, shape, input.data(), shape, output.data());
+
+        for (int i = 0; i < outer_size; ++i)
+        {
+          const int16_t *row = input.data() + i * depth;
+          int16_t max = row[0];
+          for (int j = 0; j < depth; ++j)
+            max = std::max(max, row[j]);
+          // The exp table saturates below -10.0
+          auto exp = [&](int16_t value) {
+            return std::exp(std::max((value - max) * input_scale * beta, -10.0));
+          };
+          double sum = 0.0;
+          for (int j = 0; j < depth; ++j)
+            sum += exp(row[j]);
+
+          // Output is Q0.15
+          for (int j = 0; j < depth; ++j)
+          {
+            const double expected = exp(row[j]) / sum;
+            ASSERT_NEAR(output[i * depth + j] / 32768.0, expected, 1e-3)
+              << "depth " << depth << " scale " << input_scale << " beta " << beta << " at "
+              << i << ", " << j;
+          }
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TransposeConv.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+struct TransposeConvCase
+{
+  int batches;
+  int input_height;
+  int input_width;
+  int input_depth;
+  int output_depth;
+  int filter_size;
+  int stride;
+  int pad;
+};
+
+Shape OutputShape(const TransposeConvCase &c)
+{
+  return Shape{c.batches, (c.input_height - 1) * c.stride + c.filter_size - 2 * c.pad,
+               (c.input_width - 1) * c.stride + c.filter_size - 2 * c.pad, c.output_depth};
+}
+
+nnfw::cker::TransposeConvParams MakeParams(const TransposeConvCase &c)
+{
+  nnfw::cker::TransposeConvParams params;
+  params.padding_type = c.pad ? nnfw::cker::PaddingType::kSame : nnfw::cker::PaddingType::kValid;
+  params.padding_values.width = c.pad;
+  params.padding_values.height = c.pad;
+  params.stride_width = c.stride;
+  params.stride_height = c.stride;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  return params;
+}
+
+template <typename T> std::vector<T> RandomValues(int size, int min, int max, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(min, max);
+  std::vector<T> values(size);
+  for (auto &value : values)
+    value = static_cast<T>(dist(gen));
+  return values;
+}
+
+// Filter 2 of stride 3 leaves output pixels which no input pixel reaches
+const std::vector<TransposeConvCase> kCases = {{1, 4, 4, 3, 2, 3, 1, 0}, {2, 5, 3, 8, 5, 3, 2, 1},
+                                               {1, 7, 6, 16, 8, 2, 2, 0}, {1, 3, 5, 4, 3, 4, 3, 1},
+                                               {1, 3, 4, 4, 3, 2, 3, 0}, {1, 1, 1, 5, 7, 3, 1, 1}};
+
+/**
+ * @brief Accumulators of the quantized transpose convolution by the float reference
+ *
+ * Values with offsets applied are small integers, for which float arithmetic is exact.
+ */
+template <typename T>
+std::vector<float> ReferenceAccumulators(const TransposeConvCase &c, const std::vector<T> &input,
+                                         int32_t input_offset, const std::vector<T> &filter,
+                                         int32_t weights_offset)
+{
+  const Shape input_shape{c.batches, c.input_height, c.input_width, c.input_depth};
+  const Shape filter_shape{c.output_depth, c.filter_size, c.filter_size, c.input_depth};
+  const Shape output_shape = OutputShape(c);
+
+  std::vector<float> input_float(input.size());
+  std::transform(input.begin(), input.end(), input_float.begin(),
+                 [&](T v) { return static_cast<float>(v + input_offset); });
+  std::vector<float> filter_float(filter.size());
+  std::transform(filter.begin(), filter.end(), filter_float.begin(),
+                 [&](T v) { return static_cast<float>(v + weights_offset); });
+
+  std::vector<float> acc(output_shape.FlatSize());
+  nnfw::cker::TransposeConv(MakeParams(c), input_shape, input_float.data(), filter_shape,
+                            filter_float.data(), output_shape, acc.data());
+  return acc;
+}
+
+} // namespace
+
+TEST(CKer_Operation, TransposeConvGemmFloat)
+{
+  for (const auto &c : kCases)
+  {
+    const Shape input_shape{c.batches, c.input_height, c.input_width, c.input_depth};
+    const Shape filter_shape{c.output_depth, c.filter_size, c.filter_size, c.input_depth};
+    const Shape output_shape = OutputShape(c);
+    const auto params = MakeParams(c);
+
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<float> input(input_shape.FlatSize());
+    std::vector<float> filter(filter_shape.FlatSize());
+    for (auto &value : input)
+      value = dist(gen);
+    for (auto &value : filter)
+      value = dist(gen);
+
+    std::vector<float> expected(output_shape.FlatSize());
+    nnfw::cker::TransposeConv(params, input_shape, input.data(), filter_shape, filter.data(),
+                              output_shape, expected.data());
+
+    // Both of the filter reordered in each call and the prepared one
+    for (bool prepared : {false, true})
+    {
+      nnfw::cker::TransposeConvGemm kernel;
+      if (prepared)
+        kernel.prepare(filter_shape, filter.data());
+
+      // Output is not cleared by the caller
+      std::vector<float> actual(output_shape.FlatSize(), 100.0f);
+      kernel(params, input_shape, input.data(), filter_shape, prepared ? nullptr : filter.data(),
+             output_shape, actual.data());
+
+      for (size_t i = 0; i < expected.size(); ++i)
+        ASSERT_NEAR(actual[i], expected[i], 1e-5f) << "prepared " << prepared << " at " << i;
+    }
+  }
+}
+
+TEST(CKer_Operation, TransposeConvGemmUint8)
+{
+  ruy::Context ruy_context;
+  for (const auto &c : kCases)
+  {
+    const Shape input_shape{c.batches, c.input_height, c.input_width, c.input_depth};
+    const Shape filter_shape{c.output_depth, c.filter_size, c.filter_size, c.input_depth};
+    const Shape output_shape = OutputShape(c);
+    const auto input = RandomValues<uint8_t>(input_shape.FlatSize(), 0, 255, 2);
+    const auto filter = RandomValues<uint8_t>(filter_shape.FlatSize(), 0, 255, 3);
+
+    auto params = MakeParams(c);
+    params.input_offset = -128;
+    params.weights_offset = -120;
+    params.output_offset = 100;
+    nnfw::cker::QuantizeMultiplier(0.0005, &params.output_multiplier, &params.output_shift);
+    params.quantized_activation_min = 0;
+    params.quantized_activation_max = 255;
+
+    const auto acc = ReferenceAccumulators(c, input, params.input_offset, filter,
+                                           params.weights_offset);
+    for (bool prepared : {false, true})
+    {
+      nnfw::cker::TransposeConvGemm kernel;
+      if (prepared)
+        kernel.prepare(filter_shape, filter.data());
+
+      std::vector<uint8_t> actual(output_shape.FlatSize());
+      kernel(params, input_shape, input.data(), filter_shape, prepared ? nullptr : filter.data(),
+             output_shape, actual.data(), &ruy_context);
+
+      for (size_t i = 0; i < acc.size(); ++i)
+      {
+        int32_t expected = nnfw::cker::MultiplyByQuantizedMultiplier(
+                             static_cast<int32_t>(acc[i]), params.output_multiplier,
+                             params.output_shift) +
+                           params.output_offset;
+        expected = std::min(std::max(expected, 0), 255);
+        ASSERT_EQ(actual[i], expected) << "prepared " << prepared << " at " << i;
+      }
+    }
+  }
+}
+
+TEST(CKer_Operation, TransposeConvGemmInt8PerChannel)
+{
+  ruy::Context ruy_context;
+  for (const auto &c : kCases)
+  {
+    const Shape input_shape{c.batches, c.input_height, c.input_width, c.input_depth};
+    const Shape filter_shape{c.output_depth, c.filter_size, c.filter_size, c.input_depth};
+    const Shape output_shape = OutputShape(c);
+    const auto input = RandomValues<int8_t>(input_shape.FlatSize(), -128, 127, 4);
+    const auto filter = RandomValues<int8_t>(filter_shape.FlatSize(), -127, 127, 5);
+
+    auto params = MakeParams(c);
+    params.input_offset = 10;
+    params.weights_offset = 0;
+    params.output_offset = -5;
+    params.quantized_activation_min = -128;
+    params.quantized_activation_max = 127;
+
+    nnfw::cker::TransposeConvGemm kernel;
+    for (int channel = 0; channel < c.output_depth; ++channel)
+    {
+      int32_t multiplier = 0;
+      int shift = 0;
+      nnfw::cker::QuantizeMultiplier(0.0002 * (channel + 1), &multiplier, &shift);
+      kernel.per_channel_output_multiplier().push_back(multiplier);
+      kernel.per_channel_output_shift().push_back(shift);
+    }
+    // Int8 filter is always constant
+    kernel.prepare(filter_shape, filter.data());
+
+    std::vector<int8_t> actual(output_shape.FlatSize());
+    kernel(params, input_shape, input.data(), filter_shape, nullptr, output_shape, actual.data(),
+           &ruy_context);
+
+    const auto acc = ReferenceAccumulators(c, input, params.input_offset, filter, 0);
+    for (size_t i = 0; i < acc.size(); ++i)
+    {
+      const int channel = i % c.output_depth;
+      int32_t expected = nnfw::cker::MultiplyByQuantizedMultiplier(
+                           static_cast<int32_t>(acc[i]),
+                           kernel.per_channel_output_multiplier()[channel],
+                           kernel.per_channel_output_shift()[channel]) +
+                         params.output_offset;
+      expected = std::min(std::max(expected, -128), 127);
+      ASSERT_EQ(actual[i], expected) << "at " << i;
+    }
+  }
+}
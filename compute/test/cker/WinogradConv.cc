@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Conv.h>
+#include <cker/operation/optimized/WinogradConv.h>
+#include <cker/operation/reference/Conv.h>
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+struct WinogradCase
+{
+  int batches;
+  int height;
+  int width;
+  int input_depth;
+  int output_depth;
+  int pad;
+};
+
+std::vector<float> RandomFloats(int size, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> values(size);
+  for (auto &value : values)
+    value = dist(gen);
+  return values;
+}
+
+nnfw::cker::ConvParams MakeParams(int pad)
+{
+  nnfw::cker::ConvParams params;
+  params.padding_type = pad ? nnfw::cker::PaddingType::kSame : nnfw::cker::PaddingType::kValid;
+  params.padding_values.width = pad;
+  params.padding_values.height = pad;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.float_activation_min = -2.0f;
+  params.float_activation_max = 2.0f;
+  return params;
+}
+
+// Compare Winograd with the direct convolution, whose results differ by rounding only
+void CheckWinograd(const WinogradCase &c, int output_tile, float tolerance)
+{
+  const Shape input_shape{c.batches, c.height, c.width, c.input_depth};
+  const Shape filter_shape{c.output_depth, 3, 3, c.input_depth};
+  const Shape bias_shape{c.output_depth};
+  const Shape output_shape{c.batches, c.height + 2 * c.pad - 2, c.width + 2 * c.pad - 2,
+                           c.output_depth};
+  const auto input = RandomFloats(input_shape.FlatSize(), 1);
+  const auto filter = RandomFloats(filter_shape.FlatSize(), 2);
+  const auto bias = RandomFloats(bias_shape.FlatSize(), 3);
+  const auto params = MakeParams(c.pad);
+
+  std::vector<float> expected(output_shape.FlatSize());
+  nnfw::cker::reference::Conv(params, input_shape, input.data(), filter_shape, filter.data(),
+                              bias_shape, bias.data(), output_shape, expected.data());
+
+  std::vector<float> transformed_filter(
+    nnfw::cker::optimized::WinogradFilterSize(output_tile, filter_shape));
+  nnfw::cker::optimized::TransformWinogradFilter(output_tile, filter_shape, filter.data(),
+                                                 transformed_filter.data());
+  std::vector<float> actual(output_shape.FlatSize());
+  nnfw::cker::optimized::WinogradConv(params, output_tile, input_shape, input.data(), filter_shape,
+                                      transformed_filter.data(), bias_shape, bias.data(),
+                                      output_shape, actual.data());
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], tolerance) << "output_tile " << output_tile << " at " << i;
+}
+
+} // namespace
+
+TEST(CKer_Operation, WinogradConv)
+{
+  // Sizes which are not multiples of the tiles and depths which are not multiples of vectors
+  const std::vector<WinogradCase> cases = {{1, 8, 8, 16, 16, 1},
+                                           {2, 13, 11, 17, 20, 1},
+                                           {1, 7, 5, 16, 32, 0},
+                                           {1, 3, 3, 16, 16, 1},
+                                           {1, 30, 30, 64, 64, 1}};
+  for (const auto &c : cases)
+  {
+    // Error grows with the sum over 9 * in_ch products and the larger coefficients of F(4x4)
+    CheckWinograd(c, 2, 1e-4f);
+    CheckWinograd(c, 4, 1e-3f);
+  }
+}
+
+TEST(CKer_Operation, WinogradConvOutputTile)
+{
+  using nnfw::cker::optimized::WinogradOutputTile;
+
+  EXPECT_EQ(WinogradOutputTile(Shape{64, 3, 3, 64}, Shape{1, 56, 56, 64}, 1, 1, 1, 1), 4);
+  EXPECT_EQ(WinogradOutputTile(Shape{256, 3, 3, 256}, Shape{1, 14, 14, 256}, 1, 1, 1, 1), 2);
+  // Not a 3x3 convolution of stride 1
+  EXPECT_EQ(WinogradOutputTile(Shape{64, 3, 3, 64}, Shape{1, 28, 28, 64}, 2, 2, 1, 1), 0);
+  EXPECT_EQ(WinogradOutputTile(Shape{64, 3, 3, 64}, Shape{1, 56, 56, 64}, 1, 1, 2, 2), 0);
+  EXPECT_EQ(WinogradOutputTile(Shape{64, 1, 1, 64}, Shape{1, 56, 56, 64}, 1, 1, 1, 1), 0);
+  // Too few channels or outputs to be worth it
+  EXPECT_EQ(WinogradOutputTile(Shape{16, 3, 3, 16}, Shape{1, 56, 56, 16}, 1, 1, 1, 1), 0);
+  EXPECT_EQ(WinogradOutputTile(Shape{512, 3, 3, 512}, Shape{1, 7, 7, 512}, 1, 1, 1, 1), 0);
+  // Output is not known
+  EXPECT_EQ(WinogradOutputTile(Shape{64, 3, 3, 64}, Shape(), 1, 1, 1, 1), 0);
+}
+
+TEST(CKer_Operation, ConvWinograd)
+{
+  const Shape input_shape{1, 24, 24, 64};
+  const Shape filter_shape{64, 3, 3, 64};
+  const Shape bias_shape{64};
+  const Shape output_shape{1, 24, 24, 64};
+  const auto input = RandomFloats(input_shape.FlatSize(), 4);
+  const auto filter = RandomFloats(filter_shape.FlatSize(), 5);
+  const auto bias = RandomFloats(bias_shape.FlatSize(), 6);
+  const auto params = MakeParams(1);
+
+  std::vector<float> expected(output_shape.FlatSize());
+  nnfw::cker::reference::Conv(params, input_shape, input.data(), filter_shape, filter.data(),
+                              bias_shape, bias.data(), output_shape, expected.data());
+
+  nnfw::cker::Conv conv;
+  bool is_replaced_weights = false;
+  conv.prepare(filter_shape, filter.data(), params.padding_type, is_replaced_weights, 1, 1, 1, 1,
+               output_shape);
+  // The filter is transformed, so that the original one is not read any more
+  EXPECT_TRUE(is_replaced_weights);
+
+  std::vector<float> actual(output_shape.FlatSize());
+  conv(params, input_shape, input.data(), filter_shape, nullptr, bias_shape, bias.data(),
+       output_shape, actual.data());
+
+  for (size_t i = 0; i < expected.size(); ++i)
+    ASSERT_NEAR(actual[i], expected[i], 1e-3f) << "at " << i;
+}
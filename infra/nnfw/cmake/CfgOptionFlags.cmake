@@ -47,8 +47,10 @@ option(BUILD_MLAPSE "Build mlapse benchmark toolkit" OFF)
 # Default build configuration for tools
 #
 option(BUILD_KBENCHMARK "Build kernel benchmark tool" OFF)
+option(BUILD_CKER_BENCHMARK "Build cker kernel benchmark suite" OFF)
 option(BUILD_OPENCL_TOOL "Build OpenCL tool" OFF)
 option(BUILD_TFLITE_ACCURACY "Build tflite accuracy tool" OFF)
+option(BUILD_COST_MODEL_CALIBRATOR "Build cost model calibrator for HEScheduler" OFF)
 #
 # Default external libraries source download and build configuration
 #
@@ -0,0 +1,19 @@
+### Find and use pre-installed Google Benchmark
+function(_GBenchmark_import)
+  find_package(benchmark CONFIG QUIET)
+
+  if(NOT benchmark_FOUND)
+    set(GBenchmark_FOUND FALSE PARENT_SCOPE)
+    return()
+  endif(NOT benchmark_FOUND)
+
+  if(NOT TARGET gbenchmark)
+    message(STATUS "Found Google Benchmark: TRUE")
+    add_library(gbenchmark INTERFACE)
+    target_link_libraries(gbenchmark INTERFACE benchmark::benchmark)
+  endif(NOT TARGET gbenchmark)
+
+  set(GBenchmark_FOUND TRUE PARENT_SCOPE)
+endfunction(_GBenchmark_import)
+
+_GBenchmark_import()
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file FullyConnected benchmark
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/FullyConnected.h>
+
+#include <ruy/context.h>
+
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(INPUT, 1024);
+NONIUS_PARAM(OUTPUT, 1024);
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("cker::FullyConnected(uint8)", [](nonius::chronometer meter) {
+  auto batch = meter.param<BATCH>();
+  auto input_size = meter.param<INPUT>();
+  auto output_size = meter.param<OUTPUT>();
+
+  nnfw::cker::FullyConnectedParams params;
+  nnfw::cker::Shape input_shape{batch, input_size};
+  nnfw::cker::Shape weights_shape{output_size, input_size};
+  nnfw::cker::Shape bias_shape{output_size};
+  nnfw::cker::Shape output_shape{batch, output_size};
+
+  params.input_offset = -128;
+  params.weights_offset = -128;
+  params.output_offset = 128;
+  params.output_multiplier = 1 << 30;
+  params.output_shift = -8;
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 255;
+
+  std::vector<uint8_t> input(batch * input_size, 129);
+  std::vector<uint8_t> weights(output_size * input_size, 130);
+  std::vector<int32_t> bias(output_size, 0);
+  std::vector<uint8_t> output(batch * output_size);
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::FullyConnected(params, input_shape, input.data(), weights_shape, weights.data(),
+                               bias_shape, bias.data(), output_shape, output.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::FullyConnectedPerChannel(int8)", [](nonius::chronometer meter) {
+  auto batch = meter.param<BATCH>();
+  auto input_size = meter.param<INPUT>();
+  auto output_size = meter.param<OUTPUT>();
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  nnfw::cker::FullyConnectedParams params;
+  nnfw::cker::Shape input_shape{batch, input_size};
+  nnfw::cker::Shape weights_shape{output_size, input_size};
+  nnfw::cker::Shape bias_shape{output_size};
+  nnfw::cker::Shape output_shape{batch, output_size};
+
+  params.input_offset = 0;
+  params.weights_offset = 0;
+  params.output_offset = 0;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  std::vector<int32_t> output_multiplier(output_size, 1 << 30);
+  std::vector<int> output_shift(output_size, -8);
+
+  std::vector<int8_t> input(batch * input_size, 1);
+  std::vector<int8_t> weights(output_size * input_size, 2);
+  std::vector<int32_t> bias(output_size, 0);
+  std::vector<int8_t> output(batch * output_size);
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::FullyConnectedPerChannel(params, output_multiplier.data(), output_shift.data(),
+                                         input_shape, input.data(), weights_shape, weights.data(),
+                                         bias_shape, bias.data(), output_shape, output.data(),
+                                         &ruy_context);
+  });
+})
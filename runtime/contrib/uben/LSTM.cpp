@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file LSTM step benchmark
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/LSTM.h>
+
+#include <ruy/context.h>
+
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(INPUT, 256);
+NONIUS_PARAM(CELL, 512);
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("cker::LstmStepFloat", [](nonius::chronometer meter) {
+  auto n_batch = meter.param<BATCH>();
+  auto n_input = meter.param<INPUT>();
+  auto n_cell = meter.param<CELL>();
+  auto n_output = n_cell;
+
+  nnfw::cker::LSTMParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.f;
+  params.proj_clip = 0.f;
+
+  std::vector<float> input_weights[4];
+  std::vector<float> recurrent_weights[4];
+  std::vector<float> bias[4];
+  for (int g = 0; g < 4; ++g)
+  {
+    input_weights[g].assign(n_cell * n_input, 0.01f);
+    recurrent_weights[g].assign(n_cell * n_output, 0.01f);
+    bias[g].assign(n_cell, 0.f);
+  }
+
+  std::vector<float> input(n_batch * n_input, 0.5f);
+  std::vector<float> output_state(n_batch * n_output, 0.f);
+  std::vector<float> cell_state(n_batch * n_cell, 0.f);
+  std::vector<float> scratch(4 * n_batch * n_cell);
+  std::vector<float> output(n_batch * n_output);
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::LstmStepFloat(
+      input.data(), input_weights[0].data(), input_weights[1].data(), input_weights[2].data(),
+      input_weights[3].data(), nullptr, nullptr, nullptr, nullptr, nullptr,
+      recurrent_weights[0].data(), recurrent_weights[1].data(), recurrent_weights[2].data(),
+      recurrent_weights[3].data(), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      bias[0].data(), bias[1].data(), bias[2].data(), bias[3].data(), nullptr, nullptr, &params,
+      n_batch, n_cell, n_input, 0, n_output, n_output, output_state.data(), cell_state.data(),
+      scratch.data(), scratch.data() + n_batch * n_cell, scratch.data() + 2 * n_batch * n_cell,
+      scratch.data() + 3 * n_batch * n_cell, output.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::LstmStepFloatWithPrecomputedInput", [](nonius::chronometer meter) {
+  auto n_batch = meter.param<BATCH>();
+  auto n_input = meter.param<INPUT>();
+  auto n_cell = meter.param<CELL>();
+  auto n_output = n_cell;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  nnfw::cker::LSTMParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kTanh;
+  params.cell_clip = 0.f;
+  params.proj_clip = 0.f;
+
+  // Weights of 4 gates are packed
+  std::vector<float> input_weights(4 * n_cell * n_input, 0.01f);
+  std::vector<float> recurrent_weights(4 * n_cell * n_output, 0.01f);
+  std::vector<float> bias(4 * n_cell, 0.f);
+
+  std::vector<float> input(n_batch * n_input, 0.5f);
+  std::vector<float> output_state(n_batch * n_output, 0.f);
+  std::vector<float> cell_state(n_batch * n_cell, 0.f);
+  std::vector<float> gates(4 * n_batch * n_cell);
+  std::vector<float> scratch(n_cell);
+  std::vector<float> output(n_batch * n_output);
+
+  meter.measure([&](int) {
+    // Run! The input projection is amortized over the sequence in practice, but measured here
+    nnfw::cker::LstmGatesMatMul(input_weights.data(), 4 * n_cell, n_input, input.data(), n_batch,
+                                bias.data(), gates.data(), &ruy_context);
+    nnfw::cker::LstmStepFloatWithPrecomputedInput(
+      recurrent_weights.data(), nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
+      nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, &params, /*use_cifg=*/false, n_batch,
+      n_cell, n_output, n_output, output_state.data(), cell_state.data(), gates.data(),
+      scratch.data(), output.data());
+  });
+})
+
+NONIUS_BENCHMARK("cker::LstmStepInteger8x8_16", [](nonius::chronometer meter) {
+  auto n_batch = meter.param<BATCH>();
+  auto n_input = meter.param<INPUT>();
+  auto n_cell = meter.param<CELL>();
+  auto n_output = n_cell;
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  nnfw::cker::IntegerLSTMParams params;
+  for (int g = 0; g < 4; ++g)
+  {
+    params.effective_input_scale_a[g] = 1 << 30;
+    params.effective_input_scale_b[g] = -2;
+    params.effective_recurrent_scale_a[g] = 1 << 30;
+    params.effective_recurrent_scale_b[g] = -2;
+  }
+  params.effective_hidden_scale_a = 1 << 30;
+  params.effective_hidden_scale_b = -22;
+  params.hidden_zp = 0;
+  params.cell_scale = -11;
+  params.quantized_cell_clip = 0;
+
+  // Weights of 4 gates are packed
+  std::vector<int8_t> input_weights(4 * n_cell * n_input, 1);
+  std::vector<int8_t> recurrent_weights(4 * n_cell * n_output, 1);
+  std::vector<int32_t> input_bias(4 * n_cell, 0);
+  std::vector<int32_t> recurrent_bias(4 * n_cell, 0);
+
+  std::vector<int8_t> input(n_batch * n_input, 64);
+  std::vector<int8_t> output_state(n_batch * n_output, 0);
+  std::vector<int16_t> cell_state(n_batch * n_cell, 0);
+  std::vector<int32_t> input_accum(4 * n_batch * n_cell);
+  std::vector<int32_t> recurrent_accum(4 * n_batch * n_cell);
+  std::vector<int16_t> gates(4 * n_batch * n_cell);
+  std::vector<int8_t> output(n_batch * n_output);
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::LstmStepInteger8x8_16(
+      params, /*use_cifg=*/false, input.data(), input_weights.data(), input_bias.data(),
+      recurrent_weights.data(), recurrent_bias.data(), n_batch, n_cell, n_input, n_output,
+      n_output, output_state.data(), cell_state.data(), input_accum.data(),
+      recurrent_accum.data(), gates.data(), output.data(), &ruy_context);
+  });
+})
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Scaling benchmark of cker kernels split over the ruy thread pool
+ *
+ * Run with different THREADS, e.g. "-p THREADS:1 -p THREADS:4", to see how each kernel scales.
+ */
+
+#define NONIUS_RUNNER
+#include <nonius/nonius_single.h++>
+
+#include <cker/operation/AveragePool.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Concatenation.h>
+#include <cker/operation/Gather.h>
+#include <cker/operation/MaxPool.h>
+#include <cker/operation/Pad.h>
+#include <cker/operation/ReduceMean.h>
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/StridedSlice.h>
+#include <cker/operation/Transpose.h>
+
+#include <ruy/context.h>
+
+#include <limits>
+#include <vector>
+
+//
+// Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+NONIUS_PARAM(HEIGHT, 112);
+NONIUS_PARAM(WIDTH, 112);
+NONIUS_PARAM(DEPTH, 64);
+NONIUS_PARAM(THREADS, 1);
+
+namespace
+{
+
+template <typename Meter> nnfw::cker::Shape inputShape(const Meter &meter)
+{
+  return nnfw::cker::Shape{meter.template param<BATCH>(), meter.template param<HEIGHT>(),
+                           meter.template param<WIDTH>(), meter.template param<DEPTH>()};
+}
+
+} // namespace
+
+//
+// Implementations
+//
+NONIUS_BENCHMARK("cker::Transpose(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // NHWC to NCHW
+  const auto input_shape = inputShape(meter);
+  nnfw::cker::TransposeParams params;
+  params.perm_count = 4;
+  params.perm[0] = 0;
+  params.perm[1] = 3;
+  params.perm[2] = 1;
+  params.perm[3] = 2;
+  nnfw::cker::Shape output_shape{input_shape.Dims(0), input_shape.Dims(3), input_shape.Dims(1),
+                                 input_shape.Dims(2)};
+
+  std::vector<float> input(input_shape.FlatSize(), 1.f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output.data(),
+                          &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::Pad(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  const auto input_shape = inputShape(meter);
+  const std::vector<int32_t> paddings{0, 0, 1, 1, 1, 1, 0, 0};
+  nnfw::cker::Shape output_shape{input_shape.Dims(0), input_shape.Dims(1) + 2,
+                                 input_shape.Dims(2) + 2, input_shape.Dims(3)};
+  const float constant = 0.f;
+
+  std::vector<float> input(input_shape.FlatSize(), 1.f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::Pad(paddings.data(), 4, input_shape, input.data(), output_shape, output.data(),
+                    &constant, &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::Concatenation(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // Concatenate two inputs on the depth axis
+  const auto input_shape = inputShape(meter);
+  nnfw::cker::Shape output_shape{input_shape.Dims(0), input_shape.Dims(1), input_shape.Dims(2),
+                                 2 * input_shape.Dims(3)};
+  nnfw::cker::ConcatenationParams params;
+  params.axis = 3;
+  params.inputs_count = 2;
+
+  std::vector<float> input0(input_shape.FlatSize(), 1.f);
+  std::vector<float> input1(input_shape.FlatSize(), 2.f);
+  std::vector<float> output(output_shape.FlatSize());
+  const nnfw::cker::Shape *input_shapes[] = {&input_shape, &input_shape};
+  const float *input_data[] = {input0.data(), input1.data()};
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::Concatenation<float>(params, input_shapes, input_data, output_shape,
+                                     output.data(), &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::Gather(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // Gather rows of a [HEIGHT * WIDTH, DEPTH] table in reverse order
+  const auto input_shape = inputShape(meter);
+  const int32_t rows = input_shape.Dims(1) * input_shape.Dims(2);
+  nnfw::cker::Shape table_shape{rows, input_shape.Dims(3)};
+  nnfw::cker::Shape coords_shape{rows};
+  nnfw::cker::GatherParams params;
+  params.axis = 0;
+
+  std::vector<float> table(table_shape.FlatSize(), 1.f);
+  std::vector<int32_t> coords(rows);
+  for (int32_t i = 0; i < rows; ++i)
+    coords[i] = rows - 1 - i;
+  std::vector<float> output(table_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::Gather<float>(params, table_shape, table.data(), coords_shape, coords.data(),
+                              table_shape, output.data(), &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::StridedSlice(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // Take every other pixel
+  const auto input_shape = inputShape(meter);
+  nnfw::cker::StridedSliceParams params;
+  params.start_indices_count = params.stop_indices_count = params.strides_count = 4;
+  params.begin_mask = params.end_mask = params.ellipsis_mask = 0;
+  params.new_axis_mask = params.shrink_axis_mask = 0;
+  for (int i = 0; i < 4; ++i)
+  {
+    params.start_indices[i] = 0;
+    params.stop_indices[i] = input_shape.Dims(i);
+    params.strides[i] = (i == 1 || i == 2) ? 2 : 1;
+  }
+  nnfw::cker::Shape output_shape{input_shape.Dims(0), (input_shape.Dims(1) + 1) / 2,
+                                 (input_shape.Dims(2) + 1) / 2, input_shape.Dims(3)};
+
+  std::vector<float> input(input_shape.FlatSize(), 1.f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::StridedSlice(params, input_shape, input.data(), output_shape, output.data(),
+                             &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::MeanAxis1And2(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  const auto input_shape = inputShape(meter);
+  nnfw::cker::Shape output_shape{input_shape.Dims(0), 1, 1, input_shape.Dims(3)};
+
+  std::vector<float> input(input_shape.FlatSize(), 1.f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::MeanAxis1And2(input_shape, input.data(), output_shape, output.data(),
+                              &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::ResizeBilinear(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // Upscale by 2
+  const auto input_shape = inputShape(meter);
+  nnfw::cker::ResizeBilinearParams params;
+  params.output_height = 2 * input_shape.Dims(1);
+  params.output_width = 2 * input_shape.Dims(2);
+  params.align_corners = false;
+  params.half_pixel_centers = true;
+  nnfw::cker::Shape output_shape{input_shape.Dims(0), params.output_height, params.output_width,
+                                 input_shape.Dims(3)};
+
+  std::vector<float> input(input_shape.FlatSize(), 1.f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::ResizeBilinear(params, input_shape, input.data(), output_shape, output.data(),
+                               &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::BroadcastAdd(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // Add a per-channel bias
+  const auto input_shape = inputShape(meter);
+  nnfw::cker::Shape bias_shape{1, 1, 1, input_shape.Dims(3)};
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  nnfw::cker::ProcessBroadcastShapes(input_shape, bias_shape, &params);
+
+  std::vector<float> input(input_shape.FlatSize(), 1.f);
+  std::vector<float> bias(bias_shape.FlatSize(), 2.f);
+  std::vector<float> output(input_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::BroadcastBinaryArithmeticOp<nnfw::cker::BinaryArithmeticOpType::ADD>(
+      params, input_shape, input.data(), bias_shape, bias.data(), input_shape, output.data(),
+      &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::MaxPool(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // 3x3 with stride 2, VALID padding
+  const auto input_shape = inputShape(meter);
+  nnfw::cker::PoolParams params;
+  params.filter_height = params.filter_width = 3;
+  params.stride_height = params.stride_width = 2;
+  params.padding_values.height = params.padding_values.width = 0;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  nnfw::cker::Shape output_shape{input_shape.Dims(0), (input_shape.Dims(1) - 3) / 2 + 1,
+                                 (input_shape.Dims(2) - 3) / 2 + 1, input_shape.Dims(3)};
+
+  std::vector<float> input(input_shape.FlatSize(), 1.f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::MaxPool<float>(params, input_shape, input.data(), output_shape, output.data(),
+                               &ruy_context);
+  });
+})
+
+NONIUS_BENCHMARK("cker::AveragePool(float)", [](nonius::chronometer meter) {
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // 3x3 with stride 2, VALID padding
+  const auto input_shape = inputShape(meter);
+  nnfw::cker::PoolParams params;
+  params.filter_height = params.filter_width = 3;
+  params.stride_height = params.stride_width = 2;
+  params.padding_values.height = params.padding_values.width = 0;
+  params.float_activation_min = std::numeric_limits<float>::lowest();
+  params.float_activation_max = std::numeric_limits<float>::max();
+  nnfw::cker::Shape output_shape{input_shape.Dims(0), (input_shape.Dims(1) - 3) / 2 + 1,
+                                 (input_shape.Dims(2) - 3) / 2 + 1, input_shape.Dims(3)};
+
+  std::vector<float> input(input_shape.FlatSize(), 1.f);
+  std::vector<float> output(output_shape.FlatSize());
+
+  meter.measure([&](int) {
+    // Run!
+    nnfw::cker::AveragePool<float>(params, input_shape, input.data(), output_shape,
+                                   output.data(), &ruy_context);
+  });
+})
@@ -17,6 +17,7 @@
 #ifndef __NNFW_BENCHMARK_H__
 #define __NNFW_BENCHMARK_H__
 
+#include "benchmark/LoadResult.h"
 #include "benchmark/Phases.h"
 #include "benchmark/Result.h"
 
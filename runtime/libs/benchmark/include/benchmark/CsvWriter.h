@@ -36,6 +36,7 @@ public:
   void write(uint32_t val);
   void write(char val);
   bool done();
+  bool done(uint32_t rows);
 
 public:
   static const char delimiter = ',';
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_BENCHMARK_LOAD_RESULT_H__
+#define __NNFW_BENCHMARK_LOAD_RESULT_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+
+struct LoadOption
+{
+  uint32_t clients = 1;
+  bool shared_session = true;
+  double target_qps = 0; // 0 for closed loop
+  uint32_t duration = 0; // ms
+};
+
+enum LatencyType
+{
+  P50,
+  P90,
+  P99,
+  P999,
+  END_OF_LATENCY_TYPE
+};
+
+inline std::string getLatencyTypeString(int type)
+{
+  switch (type)
+  {
+    case LatencyType::P50:
+      return "p50";
+    case LatencyType::P90:
+      return "p90";
+    case LatencyType::P99:
+      return "p99";
+    case LatencyType::P999:
+      return "p99.9";
+    default:
+      return "END_OF_LATENCY_TYPE";
+  }
+}
+
+struct HistogramBucket
+{
+  double lower; // ms
+  double upper; // ms
+  uint32_t count;
+};
+
+// Data class between a load generator and libbenchmark
+class LoadResult
+{
+public:
+  /**
+   * @param latency Latency of each request in us
+   * @param elapsed Time from the start of the load to the last completion in us
+   */
+  LoadResult(const LoadOption &option, std::vector<uint64_t> latency, uint64_t elapsed);
+
+  LoadOption option;
+  uint32_t requests = 0;
+  double throughput = 0; // requests per second
+  double min = 0;        // ms
+  double max = 0;        // ms
+  double mean = 0;       // ms
+  double percentile[LatencyType::END_OF_LATENCY_TYPE] = {};
+  std::vector<HistogramBucket> histogram; // non-empty buckets only
+};
+
+void printLoadResult(const LoadResult &result);
+
+// {exec}-{model}-{backend}-load.csv for the summary and -load-histogram.csv for the histogram
+void writeLoadResult(const LoadResult &result, const std::string &exec, const std::string &model,
+                     const std::string &backend);
+
+} // namespace benchmark
+
+#endif // __NNFW_BENCHMARK_LOAD_RESULT_H__
@@ -94,7 +94,9 @@ void CsvWriter::write(char val)
   postWrite();
 }
 
-bool CsvWriter::done() { return (_col_idx == 0) && (_row_idx == 2); }
+bool CsvWriter::done() { return done(1); }
+
+bool CsvWriter::done(uint32_t rows) { return (_col_idx == 0) && (_row_idx == rows + 1); }
 
 CsvWriter &operator<<(CsvWriter &csvw, const std::string &val)
 {
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "benchmark/LoadResult.h"
+#include "benchmark/CsvWriter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+
+namespace
+{
+
+// Ratio per 1000 of each LatencyType
+const uint32_t percentile_per_mille[benchmark::LatencyType::END_OF_LATENCY_TYPE] = {500, 900, 990,
+                                                                                    999};
+
+// Histogram buckets grow by 2^(1/4) so that each bucket is at most ~19% wide
+constexpr double buckets_per_octave = 4.0;
+
+// Nearest-rank percentile of sorted latencies
+double percentileMs(const std::vector<uint64_t> &sorted, uint32_t per_mille)
+{
+  size_t rank = (sorted.size() * per_mille + 999) / 1000;
+  rank = std::max<size_t>(rank, 1);
+  return sorted[rank - 1] / 1e3;
+}
+
+double bucketBoundMs(int index) { return std::pow(2.0, index / buckets_per_octave) / 1e3; }
+
+int bucketIndex(uint64_t latency_us)
+{
+  if (latency_us == 0)
+    return 0;
+  return static_cast<int>(std::floor(std::log2(latency_us) * buckets_per_octave));
+}
+
+} // namespace
+
+namespace benchmark
+{
+
+LoadResult::LoadResult(const LoadOption &opt, std::vector<uint64_t> latency, uint64_t elapsed)
+  : option(opt)
+{
+  requests = latency.size();
+  if (elapsed > 0)
+    throughput = requests / (elapsed / 1e6);
+
+  if (latency.empty())
+    return;
+
+  std::sort(latency.begin(), latency.end());
+  min = latency.front() / 1e3;
+  max = latency.back() / 1e3;
+  mean = std::accumulate(latency.begin(), latency.end(), 0.0) / latency.size() / 1e3;
+  for (int i = LatencyType::P50; i < LatencyType::END_OF_LATENCY_TYPE; ++i)
+    percentile[i] = percentileMs(latency, percentile_per_mille[i]);
+
+  // latency is sorted, so that each bucket is a contiguous range
+  for (auto it = latency.begin(); it != latency.end();)
+  {
+    const int index = bucketIndex(*it);
+    const uint64_t upper_us = static_cast<uint64_t>(std::ceil(std::pow(2.0, (index + 1) /
+                                                                              buckets_per_octave)));
+    auto next = std::lower_bound(it, latency.end(), std::max(upper_us, *it + 1));
+    histogram.push_back({bucketBoundMs(index), bucketBoundMs(index + 1),
+                         static_cast<uint32_t>(next - it)});
+    it = next;
+  }
+}
+
+void printLoadResult(const LoadResult &result)
+{
+  const auto &option = result.option;
+
+  std::cout << "===================================" << std::endl;
+
+  std::streamsize ss_precision = std::cout.precision();
+  std::cout << std::setprecision(3);
+  std::cout << std::fixed;
+
+  std::cout << "clients      : " << option.clients << " ("
+            << (option.shared_session ? "shared session" : "session per client") << ")"
+            << std::endl;
+  if (option.target_qps > 0)
+    std::cout << "load         : open loop at " << option.target_qps << " qps" << std::endl;
+  else
+    std::cout << "load         : closed loop" << std::endl;
+  std::cout << "requests     : " << result.requests << std::endl;
+  std::cout << "throughput   : " << result.throughput << " qps" << std::endl;
+
+  std::cout << "- " << std::setw(9) << std::left << "MIN"
+            << ":  " << result.min << " ms" << std::endl;
+  std::cout << "- " << std::setw(9) << std::left << "MEAN"
+            << ":  " << result.mean << " ms" << std::endl;
+  for (int i = LatencyType::P50; i < LatencyType::END_OF_LATENCY_TYPE; ++i)
+  {
+    std::cout << "- " << std::setw(9) << std::left << getLatencyTypeString(i) << ":  "
+              << result.percentile[i] << " ms" << std::endl;
+  }
+  std::cout << "- " << std::setw(9) << std::left << "MAX"
+            << ":  " << result.max << " ms" << std::endl;
+
+  std::cout << "-----------------------------------" << std::endl;
+  uint32_t widest = 0;
+  for (const auto &bucket : result.histogram)
+    widest = std::max(widest, bucket.count);
+  for (const auto &bucket : result.histogram)
+  {
+    const int bar = widest == 0 ? 0 : (bucket.count * 40 + widest - 1) / widest;
+    std::cout << std::setw(10) << std::right << bucket.lower << " - " << std::setw(10)
+              << std::left << bucket.upper << " ms " << std::setw(8) << std::right << bucket.count
+              << " " << std::string(bar, '#') << std::endl;
+  }
+  std::cout << std::left;
+
+  std::cout << std::setprecision(ss_precision);
+  std::cout << std::defaultfloat;
+
+  std::cout << "===================================" << std::endl;
+}
+
+void writeLoadResult(const LoadResult &result, const std::string &exec, const std::string &model,
+                     const std::string &backend)
+{
+  const std::string prefix = exec + "-" + model + "-" + backend + "-load";
+
+  std::vector<std::string> header{"Model",    "Backend",         "Clients", "Session",
+                                  "Load",     "Target QPS",      "Requests", "Throughput",
+                                  "Min (ms)", "Mean (ms)"};
+  for (int i = LatencyType::P50; i < LatencyType::END_OF_LATENCY_TYPE; ++i)
+    header.emplace_back(getLatencyTypeString(i) + " (ms)");
+  header.emplace_back("Max (ms)");
+
+  const std::string csv_filename = prefix + ".csv";
+  CsvWriter writer(csv_filename, header);
+  const auto &option = result.option;
+  writer << model << backend << option.clients
+         << std::string(option.shared_session ? "shared" : "client")
+         << std::string(option.target_qps > 0 ? "open" : "closed") << option.target_qps
+         << result.requests << result.throughput << result.min << result.mean;
+  for (int i = LatencyType::P50; i < LatencyType::END_OF_LATENCY_TYPE; ++i)
+    writer << result.percentile[i];
+  writer << result.max;
+
+  if (!writer.done())
+  {
+    std::cerr << "Writing to " << csv_filename << " is failed" << std::endl;
+  }
+
+  const std::string histogram_filename = prefix + "-histogram.csv";
+  CsvWriter histogram_writer(histogram_filename,
+                             {"Lower (ms)", "Upper (ms)", "Count", "Cumulative (%)"});
+  uint32_t cumulative = 0;
+  for (const auto &bucket : result.histogram)
+  {
+    cumulative += bucket.count;
+    histogram_writer << bucket.lower << bucket.upper << bucket.count
+                     << cumulative * 100.0 / result.requests;
+  }
+
+  if (!histogram_writer.done(result.histogram.size()))
+  {
+    std::cerr << "Writing to " << histogram_filename << " is failed" << std::endl;
+  }
+}
+
+} // namespace benchmark
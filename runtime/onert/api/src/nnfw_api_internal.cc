@@ -165,7 +165,21 @@ nnfw_session::nnfw_session()
   // DO NOTHING
 }
 
-nnfw_session::~nnfw_session() = default;
+nnfw_session::~nnfw_session()
+{
+  if (!_compiler)
+    return;
+
+  // Execution time learned by online scheduling is stored once, not on each run
+  try
+  {
+    _compiler->storeExecTime();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Warning: execution time is not stored : " << e.what() << std::endl;
+  }
+}
 
 NNFW_STATUS nnfw_session::load_circle_from_buffer(uint8_t *buffer, size_t size)
 {
@@ -374,6 +388,7 @@ NNFW_STATUS nnfw_session::run()
   try
   {
     _execution->execute();
+    rescheduleIfNeeded();
   }
   catch (const onert::InsufficientBufferSizeException &e)
   {
@@ -416,6 +431,7 @@ NNFW_STATUS nnfw_session::await()
   }
 
   _execution->waitFinish();
+  rescheduleIfNeeded();
 
   _state = State::FINISHED_RUN;
   return NNFW_STATUS_NO_ERROR;
@@ -1002,6 +1018,27 @@ bool nnfw_session::isStatePreparedOrFinishedRun()
   return isStatePrepared() || isStateFinishedRun();
 }
 
+// NOTE When the backend assignment switches, the model is compiled again synchronously here, so
+//      that the run or await which triggers it returns as late as the first compilation takes.
+//      The evaluations get less frequent after each switch, up to 16 times of the period.
+void nnfw_session::rescheduleIfNeeded()
+{
+  if (_compiler->options().he_online_period <= 0)
+    return;
+
+  // Failure of rescheduling is not an error of the run, as the current executors still work
+  try
+  {
+    auto executors = _compiler->reschedule();
+    if (executors != nullptr)
+      _execution->changeExecutors(executors);
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Warning: rescheduling is skipped : " << e.what() << std::endl;
+  }
+}
+
 NNFW_STATUS nnfw_session::input_tensorindex(const char *tensorname, uint32_t *index)
 {
   return getTensorIndexImpl(*primary_subgraph(), tensorname, index, true);
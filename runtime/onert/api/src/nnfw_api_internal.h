@@ -151,6 +151,7 @@ private:
   bool isStateRunning();
   bool isStateFinishedRun();
   bool isStatePreparedOrFinishedRun();
+  void rescheduleIfNeeded();
 
 private:
   State _state{State::INITIALIZED};
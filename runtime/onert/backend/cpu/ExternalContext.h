@@ -19,6 +19,8 @@
 
 #include <util/ConfigSource.h>
 #include <ruy/context.h>
+#include <cker/CpuBackendThreadpool.h>
+#include <cker/Half.h>
 
 namespace onert
 {
@@ -33,9 +35,10 @@ private:
   static const int kDefaultNumThreadpoolThreads = 1;
 
 public:
-  ExternalContext() : _ruy_context(new ruy::Context)
+  ExternalContext() : _ruy_context(new ruy::Context), _use_half_weights(false)
   {
     setMaxNumThreads(onert::util::getConfigInt(onert::util::config::RUY_THREADS));
+    setWeightStorage(onert::util::getConfigString(onert::util::config::CPU_WEIGHT_STORAGE));
   }
 
   void setMaxNumThreads(int max_num_threads)
@@ -45,10 +48,40 @@ public:
     _ruy_context->set_max_num_threads(target_num_threads);
   }
 
+  /**
+   * @brief Set the type to keep constant float weights of FullyConnected, Conv2D and Gather in
+   *
+   * @param weight_storage "fp16", "bf16" or "fp32". Others are regarded as "fp32".
+   */
+  void setWeightStorage(const std::string &weight_storage)
+  {
+    _use_half_weights = weight_storage == "fp16" || weight_storage == "bf16";
+    _half_weight_type =
+      weight_storage == "bf16" ? nnfw::cker::HalfType::kBFloat16 : nnfw::cker::HalfType::kFloat16;
+  }
+
   ruy::Context *ruy_context() const { return _ruy_context.get(); }
 
+  bool useHalfWeights() const { return _use_half_weights; }
+  nnfw::cker::HalfType halfWeightType() const { return _half_weight_type; }
+
+  /**
+   * @brief Run fn(begin, end) over [0, size) split across the threads of the context
+   *
+   * @param work_per_item Number of elements processed by an item, to avoid splitting small work
+   */
+  template <typename Func>
+  void parallelFor(int64_t size, int64_t work_per_item, const Func &fn) const
+  {
+    nnfw::cker::cpu_backend_threadpool::ParallelFor(
+      size, nnfw::cker::cpu_backend_threadpool::ParallelForMinGrain(work_per_item),
+      _ruy_context.get(), fn);
+  }
+
 private:
   const std::unique_ptr<ruy::Context> _ruy_context;
+  bool _use_half_weights;
+  nnfw::cker::HalfType _half_weight_type = nnfw::cker::HalfType::kFloat16;
 };
 
 } // namespace cpu
@@ -29,6 +29,7 @@
 #include "ops/ElementwiseActivationLayer.h"
 #include "ops/ElementwiseBinaryLayer.h"
 #include "ops/ElementwiseUnaryLayer.h"
+#include "ops/EmbeddingLookupLayer.h"
 #include "ops/ExpandDimsLayer.h"
 #include "ops/FillLayer.h"
 #include "ops/FullyConnectedLayer.h"
@@ -59,6 +60,7 @@
 #include "ops/SplitVLayer.h"
 #include "ops/TileLayer.h"
 #include "ops/TransposeLayer.h"
+#include "ops/TransposeConvLayer.h"
 #include "ops/UnpackLayer.h"
 #include "ops/SquaredDiffLayer.h"
 #include "ops/L2NormLayer.h"
@@ -112,6 +114,8 @@ convertElementwiseActivationType(ir::operation::ElementwiseActivation::Type type
   {
     case ir::operation::ElementwiseActivation::Type::ELU:
       return ops::ElementwiseActivationType::kElu;
+    case ir::operation::ElementwiseActivation::Type::HARD_SWISH:
+      return ops::ElementwiseActivationType::kHardSwish;
     case ir::operation::ElementwiseActivation::Type::LOGISTIC:
       return ops::ElementwiseActivationType::kLogistic;
     case ir::operation::ElementwiseActivation::Type::RELU:
@@ -318,7 +322,7 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
     fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, param_padding.param.left,
                   param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
                   stride.horizontal, stride.vertical, dilation.width_factor, dilation.height_factor,
-                  activation, ofm_tensor);
+                  activation, ofm_tensor, _external_context);
 
     _return_fn = std::move(fn);
     return;
@@ -336,7 +340,8 @@ void KernelGenerator::visit(const ir::operation::Conv2D &node)
 
   fn->configure(ifm_tensor, ker_tensor, bias_tensor, param_padding.type, padding.left,
                 padding.right, padding.top, padding.bottom, stride.horizontal, stride.vertical,
-                dilation.width_factor, dilation.height_factor, activation, ofm_tensor);
+                dilation.width_factor, dilation.height_factor, activation, ofm_tensor,
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -393,7 +398,7 @@ void KernelGenerator::visit(const ir::operation::Concat &node)
 
   auto fn = std::make_unique<ops::ConcatLayer>();
 
-  fn->configure(input_tensors, axis, output_tensor);
+  fn->configure(input_tensors, axis, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -515,7 +520,7 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -535,7 +540,7 @@ void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
 
   fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, activation,
-                convertArithmeticType(node.param().arithmetic_type));
+                convertArithmeticType(node.param().arithmetic_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -591,7 +596,7 @@ void KernelGenerator::visit(const ir::operation::Gather &node)
 
   auto fn = std::make_unique<ops::GatherLayer>();
 
-  fn->configure(input_tensor, indices_tensor, output_tensor, axis_value);
+  fn->configure(input_tensor, indices_tensor, output_tensor, axis_value, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -724,6 +729,23 @@ void KernelGenerator::visit(const ir::operation::ElementwiseUnary &node)
   }
 }
 
+void KernelGenerator::visit(const ir::operation::EmbeddingLookup &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto lookups_index{node.getInputs().at(ir::operation::EmbeddingLookup::Input::LOOKUPS)};
+  const auto values_index{node.getInputs().at(ir::operation::EmbeddingLookup::Input::VALUES)};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto lookups_tensor = _tensor_reg->getPortableTensor(lookups_index);
+  auto values_tensor = _tensor_reg->getPortableTensor(values_index);
+
+  auto fn = std::make_unique<ops::EmbeddingLookupLayer>();
+
+  fn->configure(lookups_tensor, values_tensor, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::ExpandDims &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -809,7 +831,7 @@ void KernelGenerator::visit(const ir::operation::Pad &node)
     value = reinterpret_cast<const void *>(_ctx.at(value_index).data()->base());
   }
 
-  fn->configure(input, output, pad_base, pad_rank, value);
+  fn->configure(input, output, pad_base, pad_rank, value, _external_context);
   _return_fn = std::move(fn);
 }
 
@@ -825,7 +847,53 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 
   auto fn = std::make_unique<ops::TransposeLayer>();
 
-  fn->configure(input_tensor, perm_tensor, output_tensor);
+  fn->configure(input_tensor, perm_tensor, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  if (node.getInputs().size() > 3)
+    throw std::runtime_error("TransposeConv: bias input is not supported");
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto ker_tensor = _tensor_reg->getPortableTensor(ker_index);
+
+  const auto stride = node.param().stride;
+  const auto param_padding = node.param().padding;
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  if (_ctx.at(ifm_index).info().isDynamic() || _ctx.at(ofm_index).info().isDynamic())
+  {
+    fn->configure(ifm_tensor, ker_tensor, param_padding.type, param_padding.param.left,
+                  param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
+                  stride.horizontal, stride.vertical, ofm_tensor, _external_context);
+
+    _return_fn = std::move(fn);
+    return;
+  }
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature(_current_layout);
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature(_current_layout);
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _ctx.at(ker_index).shape();
+  const auto ker_height = ker_shape.dim(1);
+  const auto ker_width = ker_shape.dim(2);
+
+  // Padding of TransposeConv is the one of the convolution from the output to the input
+  const auto padding =
+    ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride, ker_width, ker_height);
+
+  fn->configure(ifm_tensor, ker_tensor, param_padding.type, padding.left, padding.right,
+                padding.top, padding.bottom, stride.horizontal, stride.vertical, ofm_tensor,
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -845,7 +913,7 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
   {
     auto fn = std::make_unique<ops::MeanLayer>();
 
-    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, keep_dims, _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -919,7 +987,7 @@ void KernelGenerator::visit(const ir::operation::StridedSlice &node)
   auto fn = std::make_unique<ops::StridedSliceLayer>();
 
   fn->configure(input_tensor, starts_tensor, ends_tensor, strides_tensor, output_tensor, begin_mask,
-                end_mask, shrink_axis_mask);
+                end_mask, shrink_axis_mask, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -977,7 +1045,7 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   if (node.getInputs().size() == 1)
   {
     fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
-                  align_corners, half_pixel_centers);
+                  align_corners, half_pixel_centers, _external_context);
   }
   else
   {
@@ -990,11 +1058,12 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
       const auto height_out = size_vec[0];
       const auto width_out = size_vec[1];
       fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
-                    half_pixel_centers);
+                    half_pixel_centers, _external_context);
     }
     else
     {
-      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers);
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers,
+                    _external_context);
     }
   }
 
@@ -1056,7 +1125,7 @@ void KernelGenerator::visit(const ir::operation::Pool2D &node)
 
   fn->configure(ifm_tensor, padding.left, padding.right, padding.top, padding.bottom,
                 stride.horizontal, stride.vertical, kw, kh, activation, ofm_tensor,
-                convertPoolType(node.param().op_type));
+                convertPoolType(node.param().op_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -1518,7 +1587,7 @@ void KernelGenerator::visit(const ir::operation::LSTM &node)
     /*output_offset=*/0, scratch_buffer_tensor, output_state_out_tensor, cell_state_out_tensor,
     output_tensor,
     !_ctx.at(output_state_in_index).info().isVariable() /* means empty buffer on frontend now */,
-    !_ctx.at(cell_state_in_index).info().isVariable());
+    !_ctx.at(cell_state_in_index).info().isVariable(), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -37,10 +37,11 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
   nnfw::cker::Shape _output_shape;
   nnfw::cker::BinaryArithmeticOpParam _op_params;
   bool _need_broadcast;
+  ruy::Context *_ruy_context;
 
   Eval(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-       nnfw::cker::BinaryArithmeticOpParam op_params)
-    : _op_params(std::move(op_params)), _need_broadcast(false)
+       nnfw::cker::BinaryArithmeticOpParam op_params, ruy::Context *ruy_context)
+    : _op_params(std::move(op_params)), _need_broadcast(false), _ruy_context(ruy_context)
   {
     if (!output->is_dynamic())
       updateCache(lhs, rhs, output);
@@ -68,8 +69,10 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     auto output_buffer = getBuffer<T>(output);
     if (_need_broadcast)
     {
-      nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+      nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(_op_params, _lhs_shape, lhs_buffer,
+                                                               _rhs_shape, rhs_buffer,
+                                                               _output_shape, output_buffer,
+                                                               _ruy_context);
     }
     else
     {
@@ -83,7 +86,7 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
 std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)>
 generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
                       IPortableTensor *output, const ir::Activation activation,
-                      nnfw::cker::BinaryArithmeticOpParam &op_params)
+                      nnfw::cker::BinaryArithmeticOpParam &op_params, ruy::Context *ruy_context)
 {
   switch (lhs->data_type())
   {
@@ -93,7 +96,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.float_activation_max = output_activation_max;
       op_params.float_activation_min = output_activation_min;
-      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params, ruy_context);
       break;
     }
     case OperandType::INT32:
@@ -102,7 +105,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.quantized_activation_max = output_activation_max;
       op_params.quantized_activation_min = output_activation_min;
-      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params, ruy_context);
       break;
     }
     default:
@@ -121,7 +124,8 @@ void setAddOrSubQuant8Params(const IPortableTensor *lhs, const IPortableTensor *
   op_params.quantized_activation_max = output_activation_max;
   op_params.quantized_activation_min = output_activation_min;
   // Parameters for scaled quantized computation
-  op_params.left_shift = 20;
+  // int16 values need less shift to keep scaled values in int32
+  op_params.left_shift = output->data_type() == OperandType::QUANT_INT16_ASYMM ? 15 : 20;
   // Zero-points of input and output tensors
   op_params.input1_offset = -lhs->data_zero_point();
   op_params.input2_offset = -rhs->data_zero_point();
@@ -165,7 +169,8 @@ void setMulQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
 
 void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
                                       IPortableTensor *output, const ir::Activation activation,
-                                      const ArithmeticType arithmetic_type)
+                                      const ArithmeticType arithmetic_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -174,7 +179,9 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
   _lhs = lhs;
   _rhs = rhs;
   _output = output;
+  _external_context = external_context;
 
+  auto ruy_context = _external_context->ruy_context();
   nnfw::cker::BinaryArithmeticOpParam op_params;
   switch (arithmetic_type)
   {
@@ -182,20 +189,26 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       if (_lhs->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
+      }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int16_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
       }
 
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::ADD>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kSub:
@@ -203,21 +216,28 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
+      }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        op_params.input2_multiplier *= -1;
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int16_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
       }
 
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::SUB>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kMul:
@@ -225,20 +245,27 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
+      }
+      else if (_lhs->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        nnfw::cker::BinaryArithmeticOpParam op_params;
+        setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int16_t>(
+          _lhs, _rhs, _output, op_params, ruy_context);
       }
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::MUL>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kDiv:
@@ -254,7 +281,7 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::DIV>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     default:
@@ -34,7 +34,7 @@ ConvolutionLayer::ConvolutionLayer()
     _paddingType(ir::PaddingType::EXPLICIT), _paddingLeft(0), _paddingTop(0), _paddingRight(0),
     _paddingBottom(0), _strideWidth(0), _strideHeight(0), _dilationWidthFactor(1),
     _dilationHeightFactor(1), _activation(ir::Activation::NONE),
-    _conv_kernel(new nnfw::cker::Conv()), _prepare(false)
+    _conv_kernel(new nnfw::cker::Conv()), _external_context(nullptr), _prepare(false)
 {
   // DO NOTHING
 }
@@ -125,6 +125,39 @@ void ConvolutionLayer::convQuant8PerChannel()
          reinterpret_cast<int8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convQuant16PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_height = _strideHeight;
+  op_params.stride_width = _strideWidth;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.padding_values.height = _paddingTop;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  const auto bias_data = _bias ? getBuffer<int64_t>(_bias) : nullptr;
+  if (_kernel->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    kernel(op_params, getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel),
+           getBuffer<int16_t>(_kernel), getShape(_bias), bias_data, getShape(_output),
+           getBuffer<int16_t>(_output));
+  }
+  else
+  {
+    kernel(op_params, getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel),
+           getBuffer<int8_t>(_kernel), getShape(_bias), bias_data, getShape(_output),
+           getBuffer<int16_t>(_output));
+  }
+}
+
 void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
                                  const IPortableTensor *bias, const ir::PaddingType paddingType,
                                  const uint32_t paddingLeft, const uint32_t paddingRight,
@@ -132,7 +165,8 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
                                  const uint32_t strideWidth, const uint32_t strideHeight,
                                  const uint32_t dilationWidthFactor,
                                  const uint32_t dilationHeightFactor,
-                                 const ir::Activation activation, IPortableTensor *output)
+                                 const ir::Activation activation, IPortableTensor *output,
+                                 const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _kernel = kernel;
@@ -148,6 +182,7 @@ void ConvolutionLayer::configure(const IPortableTensor *input, const IPortableTe
   _dilationHeightFactor = dilationHeightFactor;
   _activation = activation;
   _output = output;
+  _external_context = external_context;
 }
 
 void ConvolutionLayer::run()
@@ -195,6 +230,10 @@ void ConvolutionLayer::run()
   {
     convQuant8PerChannel();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    convQuant16PerChannel();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -207,11 +246,28 @@ void ConvolutionLayer::prepare()
     return;
 
   nnfw::cker::Conv &kernel = *_conv_kernel;
-  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
+  if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant() &&
+      _external_context->useHalfWeights())
+  {
+    kernel.prepareHalf(getShape(_kernel), getBuffer<float>(_kernel),
+                       _external_context->halfWeightType(), getPaddingType(_paddingType),
+                       _dilationWidthFactor, _dilationHeightFactor);
+
+    // Float weights are not used any more
+    auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
+    if (kernel_tensor)
+      // TODO Remove const_cast
+      const_cast<Tensor *>(kernel_tensor)->decrease_ref();
+  }
+  else if (_input->data_type() == OperandType::FLOAT32 && _kernel->is_constant())
   {
     bool is_transposed = false;
+    // Winograd is chosen by the output size, which is not known yet if it's dynamic
+    const auto output_shape =
+      _input->is_dynamic() || _output->is_dynamic() ? nnfw::cker::Shape() : getShape(_output);
     kernel.prepare(getShape(_kernel), getBuffer<float>(_kernel), getPaddingType(_paddingType),
-                   is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+                   is_transposed, _dilationWidthFactor, _dilationHeightFactor, _strideWidth,
+                   _strideHeight, output_shape);
 
     // Decrease reference of _kernel(weights) only when _kernel is constant
     if (is_transposed)
@@ -242,6 +298,23 @@ void ConvolutionLayer::prepare()
       throw std::runtime_error{"Conv2D: Int8 dynamic weight is not supported"};
     }
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    // int16 activations are symmetric, so the kernel takes no offsets
+    if (_input->data_zero_point() != 0 || _output->data_zero_point() != 0)
+      throw std::runtime_error{"Conv2D: Int16 needs zero points of 0"};
+    if (_kernel->is_constant() && !_input->is_dynamic() && !_output->is_dynamic())
+    {
+      GetQuantizedConvolutionMultipliersAndShifts(
+        _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+        _kernel->data_scales().size(), getShape(_kernel).Dims(0),
+        kernel.per_channel_output_multiplier(), kernel.per_channel_output_shift());
+    }
+    else
+    {
+      throw std::runtime_error{"Conv2D: Int16 dynamic weight is not supported"};
+    }
+  }
   _prepare = true;
 }
 
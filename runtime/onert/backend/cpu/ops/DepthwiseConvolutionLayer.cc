@@ -119,6 +119,47 @@ void DepthwiseConvolutionLayer::convQuant8PerChannel()
     _external_context->ruy_context());
 }
 
+void DepthwiseConvolutionLayer::convQuant16PerChannel()
+{
+  if (!_prepared)
+  {
+    prepareQuant8PerChannel();
+    _prepared = true;
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidth;
+  op_params.dilation_height_factor = _dilationHeight;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  const auto bias_data = _bias ? getBuffer<int64_t>(_bias) : nullptr;
+  if (_kernel->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    nnfw::cker::reference_integer_ops::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel), getBuffer<int16_t>(_kernel),
+      getShape(_bias), bias_data, getShape(_output), getBuffer<int16_t>(_output));
+  }
+  else
+  {
+    nnfw::cker::reference_integer_ops::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel), getBuffer<int8_t>(_kernel),
+      getShape(_bias), bias_data, getShape(_output), getBuffer<int16_t>(_output));
+  }
+}
+
 void DepthwiseConvolutionLayer::prepareQuant8PerChannel()
 {
   GetQuantizedConvolutionMultipliersAndShifts(
@@ -151,7 +192,13 @@ void DepthwiseConvolutionLayer::configure(
   _output = output;
   _external_context = external_context;
 
-  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  // int16 activations are symmetric, so the kernel takes no offsets
+  if (_input->data_type() == OperandType::QUANT_INT16_ASYMM &&
+      (_input->data_zero_point() != 0 || _output->data_zero_point() != 0))
+    throw std::runtime_error{"DepthwiseConv: Int16 needs zero points of 0"};
+
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM ||
+      _input->data_type() == OperandType::QUANT_INT16_ASYMM)
   {
     if (_kernel->is_constant() && !_input->is_dynamic() && !_output->is_dynamic())
     {
@@ -175,6 +222,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQuant8PerChannel();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    convQuant16PerChannel();
+  }
   else
   {
     throw std::runtime_error{"DepthwiseConv: unsupported data type"};
@@ -44,6 +44,8 @@ public:
 
   void convQuant8PerChannel();
 
+  void convQuant16PerChannel();
+
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, const uint32_t paddingLeft,
                  const uint32_t paddingRight, const uint32_t paddingTop,
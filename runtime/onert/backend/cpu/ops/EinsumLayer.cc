@@ -66,6 +66,23 @@ void EinsumLayer::run()
   }
 }
 
+void EinsumLayer::prepare()
+{
+  // Inputs of dynamic shapes are planned on the first run of each shape
+  for (const auto input : _inputs)
+  {
+    if (input->is_dynamic())
+      return;
+  }
+
+  std::vector<nnfw::cker::Shape> input_shapes;
+  for (const auto input : _inputs)
+  {
+    input_shapes.emplace_back(getShape(input));
+  }
+  _einsum_kernel->prepare(_equation, input_shapes);
+}
+
 void EinsumLayer::configure(const std::vector<const IPortableTensor *> &inputs,
                             std::string equation, IPortableTensor *output)
 {
@@ -55,6 +55,8 @@ public:
 
   void run() override;
 
+  void prepare() override;
+
 private:
   std::vector<const IPortableTensor *> _inputs;
   IPortableTensor *_output;
@@ -19,11 +19,14 @@
 #include "OperationUtils.h"
 
 #include <cker/operation/ELU.h>
+#include <cker/operation/HardSwish.h>
 #include <cker/operation/LeakyReLU.h>
 #include <cker/operation/Logistic.h>
+#include <cker/operation/LUT.h>
 #include <cker/operation/ReLU.h>
 #include <cker/operation/ReLU6.h>
 #include <cker/operation/Tanh.h>
+#include <cker/Utils.h>
 
 namespace onert
 {
@@ -34,6 +37,17 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+bool isQuant8(const IPortableTensor *tensor)
+{
+  return tensor->data_type() == OperandType::QUANT_UINT8_ASYMM ||
+         tensor->data_type() == OperandType::QUANT_INT8_ASYMM;
+}
+
+} // namespace
+
 ElementwiseActivationLayer::ElementwiseActivationLayer()
   : _input(nullptr), _output(nullptr), _kernel()
 {
@@ -42,32 +56,39 @@ ElementwiseActivationLayer::ElementwiseActivationLayer()
 
 void ElementwiseActivationLayer::PopulateLookupTable(const ElementwiseActivationType op_type)
 {
-  const auto input_scale = static_cast<double>(_input->data_scale());
+  std::function<float(float)> transform;
+  switch (op_type)
+  {
+    case ElementwiseActivationType::kElu:
+      transform = [](float value) { return value < 0.f ? std::exp(value) - 1.f : value; };
+      break;
+    case ElementwiseActivationType::kHardSwish:
+      transform = [](float value) { return nnfw::cker::HardSwish(value); };
+      break;
+    case ElementwiseActivationType::kLogistic:
+      transform = [](float value) { return 1.0f / (1.0f + std::exp(-value)); };
+      break;
+    case ElementwiseActivationType::kTanh:
+      transform = [](float value) { return std::tanh(value); };
+      break;
+    default:
+      throw std::runtime_error("ElementwiseActivationLayer : unsupported activation type");
+  }
+
+  const auto input_scale = _input->data_scale();
   const auto input_zero_point = static_cast<int32_t>(_input->data_zero_point());
-  const auto output_scale = static_cast<double>(_output->data_scale());
+  const auto output_scale = _output->data_scale();
   const auto output_zero_point = static_cast<int32_t>(_output->data_zero_point());
-  const float inverse_scale = 1 / output_scale;
-  int32_t maxval = std::numeric_limits<uint8_t>::max();
-  int32_t minval = std::numeric_limits<uint8_t>::min();
-  for (int32_t val = minval; val <= maxval; ++val)
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
   {
-    const float dequantized = input_scale * (val - input_zero_point);
-    float transformed = 0.f;
-    if (op_type == ElementwiseActivationType::kTanh)
-    {
-      transformed = std::tanh(dequantized);
-    }
-    else if (op_type == ElementwiseActivationType::kLogistic)
-    {
-      transformed = 1.0f / (1.0f + std::exp(-dequantized));
-    }
-    else
-    {
-      throw std::runtime_error("ElementwiseActivationLayer : unsupported activation type");
-    }
-    const float rescaled = std::round(transformed * inverse_scale);
-    const int32_t quantized = static_cast<int32_t>(rescaled + output_zero_point);
-    _table[val] = static_cast<uint8_t>(std::max(std::min(maxval, quantized), minval));
+    nnfw::cker::PopulateLookupTable<uint8_t>(transform, input_scale, input_zero_point,
+                                             output_scale, output_zero_point, _table);
+  }
+  else
+  {
+    assert(_input->data_type() == OperandType::QUANT_INT8_ASYMM);
+    nnfw::cker::PopulateLookupTable<int8_t>(transform, input_scale, input_zero_point,
+                                            output_scale, output_zero_point, _table);
   }
 }
 
@@ -75,12 +96,58 @@ void ElementwiseActivationLayer::EvalUsingLookupTable(const IPortableTensor *inp
                                                       IPortableTensor *output)
 {
   const int size = MatchingFlatSize(getShape(input), getShape(output));
-  const uint8_t *input_data = getBuffer<uint8_t>(input);
-  uint8_t *output_data = getBuffer<uint8_t>(output);
+  if (input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    nnfw::cker::LookupTable(getBuffer<uint8_t>(input), size, _table, getBuffer<uint8_t>(output));
+  }
+  else
+  {
+    nnfw::cker::LookupTable(getBuffer<int8_t>(input), size, _table, getBuffer<int8_t>(output));
+  }
+}
+
+void ElementwiseActivationLayer::PopulateInt16LookupTable(const ElementwiseActivationType op_type)
+{
+  // The table maps int16 values around 0 to results around 0
+  if (_input->data_zero_point() != 0 || _output->data_zero_point() != 0)
+    throw std::runtime_error("ElementwiseActivationLayer : Int16 needs zero points of 0");
+
+  // int16 values are mapped to the table of 512 segments over the whole input range
+  const auto input_scale = static_cast<double>(_input->data_scale());
+  const auto output_scale = static_cast<double>(_output->data_scale());
+  const double input_min = input_scale * std::numeric_limits<int16_t>::min();
+  const double input_max = input_scale * -std::numeric_limits<int16_t>::min();
+  // Table values are Q0.15, so results are rescaled from 1/32768 to output scale
+  const double rescale = 1.0 / (output_scale * 32768.0);
+
+  std::function<double(double)> transform;
+  if (op_type == ElementwiseActivationType::kTanh)
+  {
+    transform = [rescale](double value) { return std::tanh(value) * rescale; };
+  }
+  else if (op_type == ElementwiseActivationType::kLogistic)
+  {
+    transform = [rescale](double value) { return rescale / (1.0 + std::exp(-value)); };
+  }
+  else
+  {
+    throw std::runtime_error("ElementwiseActivationLayer : unsupported activation type");
+  }
+
+  _int16_table.resize(nnfw::cker::kInt16LUTSize);
+  nnfw::cker::PopulateInt16LookupTable(transform, input_min, input_max, _int16_table.data());
+}
+
+void ElementwiseActivationLayer::EvalUsingInt16LookupTable(const IPortableTensor *input,
+                                                           IPortableTensor *output)
+{
+  const int size = MatchingFlatSize(getShape(input), getShape(output));
+  const int16_t *input_data = getBuffer<int16_t>(input);
+  int16_t *output_data = getBuffer<int16_t>(output);
 
   for (int i = 0; i < size; ++i)
   {
-    output_data[i] = _table[input_data[i]];
+    output_data[i] = nnfw::cker::LookupInt16Table(input_data[i], _int16_table.data());
   }
 }
 
@@ -94,7 +161,13 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
   switch (op_type)
   {
     case ElementwiseActivationType::kElu:
-      if (input->data_type() == OperandType::FLOAT32)
+      if (isQuant8(_input))
+      {
+        PopulateLookupTable(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
+      else if (input->data_type() == OperandType::FLOAT32)
       {
         _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
           nnfw::cker::ELU(getShape(input), getBuffer<float>(input), getShape(output),
@@ -106,13 +179,38 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
         throw std::runtime_error{"ElementwiseActivationLayer(Elu): unsupported data type"};
       }
       break;
+    case ElementwiseActivationType::kHardSwish:
+      if (isQuant8(_input))
+      {
+        PopulateLookupTable(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
+      else if (_input->data_type() == OperandType::FLOAT32)
+      {
+        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
+          nnfw::cker::HardSwish(getShape(input), getBuffer<float>(input), getShape(output),
+                                getBuffer<float>(output));
+        };
+      }
+      else
+      {
+        throw std::runtime_error{"ElementwiseActivationLayer(HardSwish): unsupported data type"};
+      }
+      break;
     case ElementwiseActivationType::kLogistic:
-      if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+      if (isQuant8(_input))
       {
         PopulateLookupTable(op_type);
         _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
                             std::placeholders::_1, std::placeholders::_2);
       }
+      else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        PopulateInt16LookupTable(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingInt16LookupTable, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
         _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
@@ -153,12 +251,18 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       break;
     case ElementwiseActivationType::kTanh:
-      if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+      if (isQuant8(_input))
       {
         PopulateLookupTable(op_type);
         _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingLookupTable, this,
                             std::placeholders::_1, std::placeholders::_2);
       }
+      else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+      {
+        PopulateInt16LookupTable(op_type);
+        _kernel = std::bind(&ElementwiseActivationLayer::EvalUsingInt16LookupTable, this,
+                            std::placeholders::_1, std::placeholders::_2);
+      }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
         _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
@@ -168,7 +272,7 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       else
       {
-        throw std::runtime_error{"ElementwiseActivationLayer(Logistic): unsupported data type"};
+        throw std::runtime_error{"ElementwiseActivationLayer(Tanh): unsupported data type"};
       }
       break;
     case ElementwiseActivationType::kLeakyReLU:
@@ -21,6 +21,8 @@
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -33,6 +35,7 @@ namespace ops
 enum class ElementwiseActivationType
 {
   kElu,
+  kHardSwish,
   kLogistic,
   kReLU,
   kTanh,
@@ -54,10 +57,15 @@ public:
 
   void EvalUsingLookupTable(const IPortableTensor *input, IPortableTensor *output);
 
+  void PopulateInt16LookupTable(const ElementwiseActivationType op_type);
+
+  void EvalUsingInt16LookupTable(const IPortableTensor *input, IPortableTensor *output);
+
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
   uint8_t _table[256];
+  std::vector<int16_t> _int16_table;
   std::function<void(const IPortableTensor *input, IPortableTensor *output)> _kernel;
 };
 
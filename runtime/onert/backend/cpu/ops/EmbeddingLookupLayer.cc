@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "EmbeddingLookupLayer.h"
+
+#include "OperationUtils.h"
+#include "../Tensor.h"
+
+#include <cker/operation/EmbeddingLookup.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+EmbeddingLookupLayer::EmbeddingLookupLayer()
+  : _lookups{nullptr}, _values{nullptr}, _output{nullptr}, _external_context{nullptr},
+    _embedding_lookup{new nnfw::cker::EmbeddingLookup()}
+{
+  // DO NOTHING
+}
+
+EmbeddingLookupLayer::~EmbeddingLookupLayer() = default;
+
+void EmbeddingLookupLayer::configure(const IPortableTensor *lookups, const IPortableTensor *values,
+                                     IPortableTensor *output,
+                                     const std::shared_ptr<ExternalContext> &external_context)
+{
+  _lookups = lookups;
+  _values = values;
+  _output = output;
+  _external_context = external_context;
+}
+
+template <typename T> void EmbeddingLookupLayer::lookupByType()
+{
+  (*_embedding_lookup)(getShape(_values), getBuffer<T>(_values), getShape(_lookups).FlatSize(),
+                       getBuffer<int32_t>(_lookups), getBuffer<T>(_output),
+                       _external_context->ruy_context());
+}
+
+void EmbeddingLookupLayer::lookupHalfValues()
+{
+  (*_embedding_lookup)(getShape(_values), _half_values.data(),
+                       _external_context->halfWeightType(), getShape(_lookups).FlatSize(),
+                       getBuffer<int32_t>(_lookups), getBuffer<float>(_output),
+                       _external_context->ruy_context());
+}
+
+void EmbeddingLookupLayer::lookupHybrid()
+{
+  // Values quantized per row have a scale for each row, and others have one for the table
+  const auto &scales = _values->data_scales();
+  const float table_scale = _values->data_scale();
+  const float *scales_data = scales.empty() ? &table_scale : scales.data();
+  const int scales_count = scales.empty() ? 1 : static_cast<int>(scales.size());
+  if (scales_count != 1 && scales_count != getShape(_values).Dims(0))
+    throw std::runtime_error("EmbeddingLookup: values must be quantized per tensor or per row");
+
+  (*_embedding_lookup)(getShape(_values), getBuffer<int8_t>(_values), scales_data, scales_count,
+                       _values->data_zero_point(), getShape(_lookups).FlatSize(),
+                       getBuffer<int32_t>(_lookups), getBuffer<float>(_output),
+                       _external_context->ruy_context());
+}
+
+void EmbeddingLookupLayer::run()
+{
+  if (!_half_values.empty())
+  {
+    lookupHalfValues();
+    return;
+  }
+
+  switch (_values->data_type())
+  {
+    case OperandType::FLOAT32:
+      lookupByType<float>();
+      break;
+    case OperandType::INT32:
+      lookupByType<int32_t>();
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      lookupByType<uint8_t>();
+      break;
+    case OperandType::QUANT_INT8_ASYMM:
+    case OperandType::QUANT_INT8_SYMM:
+      if (_output->data_type() == OperandType::FLOAT32)
+        lookupHybrid();
+      else
+        lookupByType<int8_t>();
+      break;
+    default:
+      throw std::runtime_error("EmbeddingLookup: unsupported values data type");
+  }
+}
+
+void EmbeddingLookupLayer::prepare()
+{
+  if (_values->data_type() != OperandType::FLOAT32 || !_values->is_constant() ||
+      !_external_context->useHalfWeights())
+    return;
+
+  const int values_size = getShape(_values).FlatSize();
+  _half_values.resize(values_size);
+  nnfw::cker::ConvertFloatToHalf(getBuffer<float>(_values), values_size,
+                                 _external_context->halfWeightType(), _half_values.data());
+
+  // Float values are not used any more
+  auto values_tensor = dynamic_cast<const Tensor *>(_values);
+  if (values_tensor)
+    // TODO Remove const_cast
+    const_cast<Tensor *>(values_tensor)->decrease_ref();
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
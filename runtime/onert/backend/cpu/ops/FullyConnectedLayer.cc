@@ -30,6 +30,22 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// Per-channel kernels take no offset of weights
+bool hasZeroWeightsOffset(const IPortableTensor *weights)
+{
+  for (const auto zero_point : weights->data_zero_points())
+  {
+    if (zero_point != 0)
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
 FullyConnectedLayer::FullyConnectedLayer()
   : _input(nullptr), _weights(nullptr), _bias(nullptr), _output(nullptr),
     _activation(ir::Activation::NONE), _temp_arena(new nnfw::cker::FCTempArena()),
@@ -80,6 +96,77 @@ void FullyConnectedLayer::fullyConnectedQuant8()
                              getBuffer<uint8_t>(_output));
 }
 
+void FullyConnectedLayer::fullyConnectedQuant8PerChannel()
+{
+  if (!_prepared_per_channel)
+  {
+    prepareQuant8PerChannel();
+    _prepared_per_channel = true;
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.input_offset = -_input->data_zero_point();
+  // Zero points of weights are checked in prepare()
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::FullyConnectedPerChannel(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    getShape(_input), getBuffer<int8_t>(_input), getShape(_weights), getBuffer<int8_t>(_weights),
+    getShape(_bias), _bias ? getBuffer<int32_t>(_bias) : nullptr, getShape(_output),
+    getBuffer<int8_t>(_output), _external_context->ruy_context());
+}
+
+void FullyConnectedLayer::fullyConnectedQuant16PerChannel()
+{
+  if (!_prepared_per_channel)
+  {
+    prepareQuant8PerChannel();
+    _prepared_per_channel = true;
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  const auto bias_data = _bias ? getBuffer<int64_t>(_bias) : nullptr;
+  if (_weights->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    nnfw::cker::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getShape(_input), getBuffer<int16_t>(_input), getShape(_weights),
+      getBuffer<int16_t>(_weights), getShape(_bias), bias_data, getShape(_output),
+      getBuffer<int16_t>(_output));
+  }
+  else
+  {
+    nnfw::cker::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getShape(_input), getBuffer<int16_t>(_input), getShape(_weights), getBuffer<int8_t>(_weights),
+      getShape(_bias), bias_data, getShape(_output), getBuffer<int16_t>(_output));
+  }
+}
+
+void FullyConnectedLayer::prepareQuant8PerChannel()
+{
+  GetQuantizedConvolutionMultipliersAndShifts(
+    _input->data_scale(), _output->data_scale(), _weights->data_scales().data(),
+    _weights->data_scales().size(), getShape(_weights).Dims(0), _per_channel_output_multiplier,
+    _per_channel_output_shift);
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
@@ -186,6 +273,31 @@ void FullyConnectedLayer::fullyConnected16x1Float32()
 #endif
 }
 
+void FullyConnectedLayer::fullyConnectedHalfWeights()
+{
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.activation = convertActivationType(_activation);
+
+  nnfw::cker::FullyConnectedHalfWeights(
+    op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights), _half_weights.data(),
+    _external_context->halfWeightType(), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
+    getShape(_output), getBuffer<float>(_output), _external_context->ruy_context());
+}
+
+void FullyConnectedLayer::prepareHalfWeights()
+{
+  const int weights_size = getShape(_weights).FlatSize();
+  _half_weights.resize(weights_size);
+  nnfw::cker::ConvertFloatToHalf(getBuffer<float>(_weights), weights_size,
+                                 _external_context->halfWeightType(), _half_weights.data());
+
+  // Float weights are not used any more
+  auto weights_tensor = dynamic_cast<const Tensor *>(_weights);
+  if (weights_tensor)
+    // TODO Remove const_cast
+    const_cast<Tensor *>(weights_tensor)->decrease_ref();
+}
+
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
                                     const IPortableTensor *bias, ir::Activation activation,
                                     ir::FullyConnectedWeightsFormat weights_format,
@@ -220,6 +332,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedSparseWeight();
   }
+  else if (!_half_weights.empty())
+  {
+    fullyConnectedHalfWeights();
+  }
   else if (_input->data_type() == OperandType::FLOAT32)
   {
     _is_shuffled16x1float32 ? fullyConnected16x1Float32() : fullyConnectedFloat32();
@@ -228,6 +344,14 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    fullyConnectedQuant8PerChannel();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    fullyConnectedQuant16PerChannel();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -236,7 +360,8 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  // NOTE int64 bias of int16 FullyConnected is not checked as a float vector
+  if (_bias && _bias->is_constant() && _bias->data_type() != OperandType::INT64)
   {
     const int bias_size = getShape(_bias).FlatSize();
     if (nnfw::cker::IsZeroVector(getBuffer<float>(_bias), bias_size))
@@ -245,6 +370,35 @@ void FullyConnectedLayer::prepare()
     }
   }
 
+  if (_input->data_type() == OperandType::FLOAT32 &&
+      _weights->data_type() == OperandType::FLOAT32 && _weights->is_constant() &&
+      !_weights->sparsity() && !_is_shuffled16x1float32 && _external_context->useHalfWeights())
+  {
+    prepareHalfWeights();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    // ruy caches the packed weights, which is valid only for constant weights
+    if (!_weights->is_constant())
+      throw std::runtime_error{"FullyConnected: Int8 dynamic weight is not supported"};
+    if (!hasZeroWeightsOffset(_weights))
+      throw std::runtime_error{"FullyConnected: Int8 weights need zero points of 0"};
+
+    prepareQuant8PerChannel();
+    _prepared_per_channel = true;
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    // int16 activations are symmetric, so the kernel takes no offsets
+    if (_input->data_zero_point() != 0 || _output->data_zero_point() != 0)
+      throw std::runtime_error{"FullyConnected: Int16 needs zero points of 0"};
+    if (!hasZeroWeightsOffset(_weights))
+      throw std::runtime_error{"FullyConnected: Int16 weights need zero points of 0"};
+
+    prepareQuant8PerChannel();
+    _prepared_per_channel = true;
+  }
+
 #if (defined(__ARM_NEON__) || defined(__ARM_NEON)) && defined(USE_RUY_GEMV)
   // TODO This is workaround
   // The only fc hybrid will use ruy kernel
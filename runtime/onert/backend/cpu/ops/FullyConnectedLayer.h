@@ -51,12 +51,18 @@ public:
 
   void fullyConnectedQuant8();
 
+  void fullyConnectedQuant8PerChannel();
+
+  void fullyConnectedQuant16PerChannel();
+
   void fullyConnectedHybrid();
 
   void fullyConnectedSparseWeight();
 
   void fullyConnected16x1Float32();
 
+  void fullyConnectedHalfWeights();
+
   void configure(const IPortableTensor *input, const IPortableTensor *weights,
                  const IPortableTensor *bias, ir::Activation activation,
                  ir::FullyConnectedWeightsFormat weights_format, IPortableTensor *output,
@@ -66,6 +72,10 @@ public:
 
   void prepare() override;
 
+private:
+  void prepareQuant8PerChannel();
+  void prepareHalfWeights();
+
 private:
   const IPortableTensor *_input;
   const IPortableTensor *_weights;
@@ -80,6 +90,14 @@ private:
   bool _is_hybrid : 1;
   bool _is_shuffled16x1float32 : 1;
 
+  // Per-channel output multipliers and shifts for int8 weights
+  bool _prepared_per_channel = false;
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
+  // Constant float weights kept as float16 or bfloat16 by CPU_WEIGHT_STORAGE
+  std::vector<uint16_t> _half_weights;
+
 #ifdef USE_RUY_GEMV
   uint8_t *_cached_weights = nullptr; // weights to be cached and a key
   bool _is_weights_freed = false;     // is weights freed?
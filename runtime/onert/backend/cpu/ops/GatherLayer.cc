@@ -17,7 +17,9 @@
 #include "GatherLayer.h"
 
 #include "OperationUtils.h"
+#include "../Tensor.h"
 
+#include <cker/operation/EmbeddingLookup.h>
 #include <cker/operation/Gather.h>
 
 namespace onert
@@ -29,13 +31,24 @@ namespace cpu
 namespace ops
 {
 
+GatherLayer::GatherLayer()
+  : _input{nullptr}, _indices{nullptr}, _output{nullptr}, _axis{-1}, _external_context{nullptr},
+    _embedding_lookup{nullptr}
+{
+  // DO NOTHING
+}
+
+GatherLayer::~GatherLayer() = default;
+
 void GatherLayer::configure(const IPortableTensor *input, const IPortableTensor *indices,
-                            IPortableTensor *output, int32_t axis)
+                            IPortableTensor *output, int32_t axis,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _indices = indices;
   _axis = axis;
   _output = output;
+  _external_context = external_context;
 }
 
 template <typename InputType> void GatherLayer::runByInputType()
@@ -52,7 +65,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _external_context->ruy_context());
       break;
     }
     case OperandType::INT64:
@@ -61,7 +75,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        _external_context->ruy_context());
       break;
     }
     default:
@@ -69,8 +84,87 @@ template <typename InputType> void GatherLayer::runByInputType()
   }
 }
 
+void GatherLayer::runHalfInput()
+{
+  nnfw::cker::GatherParams op_params;
+  op_params.axis = _axis;
+  const auto half_type = _external_context->halfWeightType();
+
+  switch (_indices->data_type())
+  {
+    case OperandType::INT32:
+      nnfw::cker::Gather<int32_t>(op_params, getShape(_input), _half_input.data(), half_type,
+                                  getShape(_indices), getBuffer<int32_t>(_indices),
+                                  getShape(_output), getBuffer<float>(_output),
+                                  _external_context->ruy_context());
+      break;
+    case OperandType::INT64:
+      nnfw::cker::Gather<int64_t>(op_params, getShape(_input), _half_input.data(), half_type,
+                                  getShape(_indices), getBuffer<int64_t>(_indices),
+                                  getShape(_output), getBuffer<float>(_output),
+                                  _external_context->ruy_context());
+      break;
+    default:
+      throw std::runtime_error("Gather: unsupported indices data type");
+  }
+}
+
+template <typename IndicesType> void GatherLayer::runEmbeddingLookup()
+{
+  const int lookups_count = getShape(_indices).FlatSize();
+  const auto lookups_data = getBuffer<IndicesType>(_indices);
+  auto ruy_context = _external_context->ruy_context();
+
+  if (!_half_input.empty())
+  {
+    (*_embedding_lookup)(getShape(_input), _half_input.data(), _external_context->halfWeightType(),
+                         lookups_count, lookups_data, getBuffer<float>(_output), ruy_context);
+    return;
+  }
+
+  switch (_input->data_type())
+  {
+    case OperandType::FLOAT32:
+      (*_embedding_lookup)(getShape(_input), getBuffer<float>(_input), lookups_count,
+                           lookups_data, getBuffer<float>(_output), ruy_context);
+      break;
+    case OperandType::QUANT_UINT8_ASYMM:
+      (*_embedding_lookup)(getShape(_input), getBuffer<uint8_t>(_input), lookups_count,
+                           lookups_data, getBuffer<uint8_t>(_output), ruy_context);
+      break;
+    case OperandType::INT32:
+      (*_embedding_lookup)(getShape(_input), getBuffer<int32_t>(_input), lookups_count,
+                           lookups_data, getBuffer<int32_t>(_output), ruy_context);
+      break;
+    default:
+      throw std::runtime_error("Gather: unsupported input data type");
+  }
+}
+
 void GatherLayer::run()
 {
+  if (_embedding_lookup)
+  {
+    switch (_indices->data_type())
+    {
+      case OperandType::INT32:
+        runEmbeddingLookup<int32_t>();
+        break;
+      case OperandType::INT64:
+        runEmbeddingLookup<int64_t>();
+        break;
+      default:
+        throw std::runtime_error("Gather: unsupported indices data type");
+    }
+    return;
+  }
+
+  if (!_half_input.empty())
+  {
+    runHalfInput();
+    return;
+  }
+
   switch (_input->data_type())
   {
     case OperandType::FLOAT32:
@@ -87,6 +181,29 @@ void GatherLayer::run()
   }
 }
 
+void GatherLayer::prepare()
+{
+  // Rows of a constant table are gathered by lookups, skipping rows read already
+  if (_input->is_constant() && _axis == 0)
+    _embedding_lookup.reset(new nnfw::cker::EmbeddingLookup());
+
+  // Embedding tables are constant float input
+  if (_input->data_type() != OperandType::FLOAT32 || !_input->is_constant() ||
+      !_external_context->useHalfWeights())
+    return;
+
+  const int input_size = getShape(_input).FlatSize();
+  _half_input.resize(input_size);
+  nnfw::cker::ConvertFloatToHalf(getBuffer<float>(_input), input_size,
+                                 _external_context->halfWeightType(), _half_input.data());
+
+  // Float input is not used any more
+  auto input_tensor = dynamic_cast<const Tensor *>(_input);
+  if (input_tensor)
+    // TODO Remove const_cast
+    const_cast<Tensor *>(input_tensor)->decrease_ref();
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
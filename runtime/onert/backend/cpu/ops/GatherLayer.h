@@ -18,9 +18,20 @@
 #define __ONERT_BACKEND_CPU_OPS_GATHERLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
+#include <memory>
+
+namespace nnfw
+{
+namespace cker
+{
+class EmbeddingLookup;
+}
+} // namespace nnfw
+
 namespace onert
 {
 namespace backend
@@ -33,19 +44,22 @@ namespace ops
 class GatherLayer : public ::onert::exec::IFunction
 {
 public:
-  GatherLayer() : _input{nullptr}, _indices{nullptr}, _output{nullptr}, _axis{-1}
-  {
-    // DO NOTHING
-  }
+  GatherLayer();
+  ~GatherLayer();
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *indices,
-                 IPortableTensor *output, int32_t axis);
+                 IPortableTensor *output, int32_t axis,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
+  void prepare() override;
+
 private:
   template <typename OpType> void runByInputType();
+  void runHalfInput();
+  template <typename IndicesType> void runEmbeddingLookup();
 
 private:
   const IPortableTensor *_input;
@@ -53,6 +67,13 @@ private:
   IPortableTensor *_output;
 
   int32_t _axis;
+  std::shared_ptr<ExternalContext> _external_context;
+
+  // Set for a constant input gathered at axis 0, which is an embedding table
+  std::unique_ptr<nnfw::cker::EmbeddingLookup> _embedding_lookup;
+
+  // Constant float input kept as float16 or bfloat16 by CPU_WEIGHT_STORAGE
+  std::vector<uint16_t> _half_input;
 };
 
 } // namespace ops
@@ -21,6 +21,9 @@
 
 #include <cker/operation/LSTM.h>
 
+#include <algorithm>
+#include <cmath>
+
 namespace onert
 {
 namespace backend
@@ -58,6 +61,11 @@ inline void initializeStateBuffer(const onert::backend::IPortableTensor *tensor_
   else
     memset(buffer, 0, tensor_in->total_size());
 }
+
+bool isOptionalTensorGiven(const onert::backend::IPortableTensor *tensor)
+{
+  return tensor && tensor->total_size() > 0;
+}
 } // namespace
 
 void LSTMLayer::LSTMFloat()
@@ -146,7 +154,45 @@ void LSTMLayer::LSTMFloat()
 
   auto out_shape = _output->getShape();
   const int output_batch_leading_dim = out_shape.dim(out_shape.rank() - 1);
-  if (_time_major)
+  if (_prepared_float)
+  {
+    // The input projection of all gates for the whole sequence at once
+    const int n_rows = (use_cifg ? 3 : 4) * n_cell;
+    const bool use_layer_norm = forget_layer_norm_coefficients_ptr != nullptr;
+    _gates_buffer.resize(max_time * n_batch * n_rows);
+    nnfw::cker::LstmGatesMatMul(_input_weights_packed_float.data(), n_rows, n_input,
+                                getBuffer<float>(_input), max_time * n_batch,
+                                use_layer_norm ? nullptr : _gate_bias_packed.data(),
+                                _gates_buffer.data(), _external_context->ruy_context());
+
+    // The input and the gates have the same layout of time and batch
+    const int n_steps = _time_major ? max_time : n_batch * max_time;
+    const int n_step_batch = _time_major ? n_batch : 1;
+    for (int s = 0; s < n_steps; s++)
+    {
+      // If this is the forward_sequence, step forward, otherwise step
+      // backwards.
+      const int b = _time_major ? 0 : s / max_time;
+      const int t = s % max_time;
+      const int t_rel = _forward_sequence ? t : max_time - t - 1;
+      const int time_offset = _time_major ? t_rel : b * max_time + t_rel;
+      float *gates_ptr = _gates_buffer.data() + time_offset * n_step_batch * n_rows;
+      float *output_ptr = getBuffer<float>(_output) +
+                          time_offset * n_step_batch * output_batch_leading_dim + _output_offset;
+
+      nnfw::cker::LstmStepFloatWithPrecomputedInput(
+        _recurrent_weights_packed_float.data(), cell_to_input_weights_ptr,
+        cell_to_forget_weights_ptr, cell_to_output_weights_ptr, input_layer_norm_coefficients_ptr,
+        forget_layer_norm_coefficients_ptr, cell_layer_norm_coefficients_ptr,
+        output_layer_norm_coefficients_ptr, input_gate_bias_ptr,
+        getBuffer<float>(_forget_gate_bias), getBuffer<float>(_cell_gate_bias),
+        getBuffer<float>(_output_gate_bias), projection_weights_ptr, projection_bias_ptr,
+        &lstm_params, use_cifg, n_step_batch, n_cell, n_output, output_batch_leading_dim,
+        output_state_buf + b * output_batch_leading_dim, cell_state_buf + b * n_cell, gates_ptr,
+        scratch_buffer_buf, output_ptr);
+    }
+  }
+  else if (_time_major)
   {
     // Loop through the sequence.
     const int input_step = n_batch * n_input;
@@ -239,6 +285,248 @@ void LSTMLayer::LSTMFloat()
   }
 }
 
+void LSTMLayer::prepareFloat()
+{
+  const bool use_cifg = !isOptionalTensorGiven(_input_to_input_weights);
+  const IPortableTensor *input_weights[4] = {_input_to_input_weights, _input_to_forget_weights,
+                                             _input_to_cell_weights, _input_to_output_weights};
+  const IPortableTensor *recurrent_weights[4] = {
+    _recurrent_to_input_weights, _recurrent_to_forget_weights, _recurrent_to_cell_weights,
+    _recurrent_to_output_weights};
+  const IPortableTensor *gate_bias[4] = {_input_gate_bias, _forget_gate_bias, _cell_gate_bias,
+                                         _output_gate_bias};
+  for (int g = use_cifg ? 1 : 0; g < 4; ++g)
+  {
+    // Dynamic weights are multiplied gate by gate in LstmStepFloat
+    if (!input_weights[g]->is_constant() || !recurrent_weights[g]->is_constant() ||
+        !gate_bias[g]->is_constant())
+      return;
+  }
+
+  const int n_cell = _input_to_output_weights->getShape().dim(0);
+  const int n_input = _input_to_output_weights->getShape().dim(1);
+  const int n_output = _recurrent_to_output_weights->getShape().dim(1);
+  const int n_gates = use_cifg ? 3 : 4;
+
+  _input_weights_packed_float.resize(n_gates * n_cell * n_input);
+  _recurrent_weights_packed_float.resize(n_gates * n_cell * n_output);
+  _gate_bias_packed.resize(n_gates * n_cell);
+  for (int g = use_cifg ? 1 : 0, row = 0; g < 4; ++g, row += n_cell)
+  {
+    std::copy_n(getBuffer<float>(input_weights[g]), n_cell * n_input,
+                _input_weights_packed_float.data() + row * n_input);
+    std::copy_n(getBuffer<float>(recurrent_weights[g]), n_cell * n_output,
+                _recurrent_weights_packed_float.data() + row * n_output);
+    std::copy_n(getBuffer<float>(gate_bias[g]), n_cell, _gate_bias_packed.data() + row);
+  }
+
+  _prepared_float = true;
+}
+
+void LSTMLayer::prepareInteger8x8_16()
+{
+  if (isOptionalTensorGiven(_cell_to_input_weights) ||
+      isOptionalTensorGiven(_cell_to_forget_weights) ||
+      isOptionalTensorGiven(_cell_to_output_weights))
+    throw std::runtime_error{"LSTMLayer: Integer LSTM with peephole is not supported"};
+  if (isOptionalTensorGiven(_input_layer_norm_coefficients) ||
+      isOptionalTensorGiven(_forget_layer_norm_coefficients) ||
+      isOptionalTensorGiven(_cell_layer_norm_coefficients) ||
+      isOptionalTensorGiven(_output_layer_norm_coefficients))
+    throw std::runtime_error{"LSTMLayer: Integer LSTM with layer norm is not supported"};
+  if (isOptionalTensorGiven(_projection_weights))
+    throw std::runtime_error{"LSTMLayer: Integer LSTM with projection is not supported"};
+  if (_params.activation != ir::Activation::TANH)
+    throw std::runtime_error{"LSTMLayer: Integer LSTM supports only tanh activation"};
+
+  const bool use_cifg = !isOptionalTensorGiven(_input_to_input_weights);
+  const IPortableTensor *input_weights[4] = {_input_to_input_weights, _input_to_forget_weights,
+                                             _input_to_cell_weights, _input_to_output_weights};
+  const IPortableTensor *recurrent_weights[4] = {
+    _recurrent_to_input_weights, _recurrent_to_forget_weights, _recurrent_to_cell_weights,
+    _recurrent_to_output_weights};
+  const IPortableTensor *gate_bias[4] = {_input_gate_bias, _forget_gate_bias, _cell_gate_bias,
+                                         _output_gate_bias};
+  for (int g = use_cifg ? 1 : 0; g < 4; ++g)
+  {
+    if (!input_weights[g]->is_constant() || !recurrent_weights[g]->is_constant())
+      throw std::runtime_error{"LSTMLayer: Integer LSTM with dynamic weights is not supported"};
+  }
+
+  // The cell state has a power-of-two scale
+  const double cell_state_scale = _cell_state_in->data_scale();
+  const int cell_scale = static_cast<int>(std::round(std::log2(cell_state_scale)));
+  if (std::pow(2.0, cell_scale) != cell_state_scale)
+    throw std::runtime_error{"LSTMLayer: Integer LSTM needs power-of-two cell state scale"};
+  // tanh of the cell state is computed in Q(15 + cell_scale) of up to 6 integer bits
+  if (15 + cell_scale > 6)
+    throw std::runtime_error{"LSTMLayer: Integer LSTM needs cell state scale of 2^-9 or less"};
+  _integer_params.cell_scale = cell_scale;
+
+  const double cell_clip = _params.cell_threshold;
+  _integer_params.quantized_cell_clip =
+    cell_clip > 0 ? static_cast<int16_t>(std::min(
+                      std::max(std::round(cell_clip / cell_state_scale), -32768.0), 32767.0))
+                  : 0;
+
+  // Gates are calculated in Q3.12 before their activations, whose results are Q0.15
+  const double gate_scale = std::pow(2.0, -12);
+  const double input_scale = _input->data_scale();
+  const double output_state_scale = _output_state_in->data_scale();
+  for (int g = use_cifg ? 1 : 0; g < 4; ++g)
+  {
+    QuantizeMultiplier(input_weights[g]->data_scale() * input_scale / gate_scale,
+                       &_integer_params.effective_input_scale_a[g],
+                       &_integer_params.effective_input_scale_b[g]);
+    QuantizeMultiplier(recurrent_weights[g]->data_scale() * output_state_scale / gate_scale,
+                       &_integer_params.effective_recurrent_scale_a[g],
+                       &_integer_params.effective_recurrent_scale_b[g]);
+  }
+
+  // Without projection, the hidden state is the output state
+  QuantizeMultiplier(std::pow(2.0, -15) * std::pow(2.0, -15) / output_state_scale,
+                     &_integer_params.effective_hidden_scale_a,
+                     &_integer_params.effective_hidden_scale_b);
+  _integer_params.hidden_zp = _output_state_in->data_zero_point();
+
+  // Pack the weights of the gates, and fold the zero points of the input and the output state
+  // into the bias
+  const int n_cell = _input_to_output_weights->getShape().dim(0);
+  const int n_input = _input_to_output_weights->getShape().dim(1);
+  const int n_output = _recurrent_to_output_weights->getShape().dim(1);
+  const int n_gates = use_cifg ? 3 : 4;
+  const int32_t input_zp = _input->data_zero_point();
+  const int32_t output_state_zp = _output_state_in->data_zero_point();
+
+  _input_weights_packed.resize(n_gates * n_cell * n_input);
+  _recurrent_weights_packed.resize(n_gates * n_cell * n_output);
+  _input_effective_bias.resize(n_gates * n_cell);
+  _recurrent_effective_bias.resize(n_gates * n_cell);
+  for (int g = use_cifg ? 1 : 0, row = 0; g < 4; ++g)
+  {
+    const int8_t *input_weights_data = getBuffer<int8_t>(input_weights[g]);
+    const int8_t *recurrent_weights_data = getBuffer<int8_t>(recurrent_weights[g]);
+    const int32_t *bias_data =
+      isOptionalTensorGiven(gate_bias[g]) ? getBuffer<int32_t>(gate_bias[g]) : nullptr;
+    for (int c = 0; c < n_cell; ++c, ++row)
+    {
+      int32_t input_row_sum = 0;
+      for (int i = 0; i < n_input; ++i)
+      {
+        const int8_t weight = input_weights_data[c * n_input + i];
+        _input_weights_packed[row * n_input + i] = weight;
+        input_row_sum += weight;
+      }
+      int32_t recurrent_row_sum = 0;
+      for (int i = 0; i < n_output; ++i)
+      {
+        const int8_t weight = recurrent_weights_data[c * n_output + i];
+        _recurrent_weights_packed[row * n_output + i] = weight;
+        recurrent_row_sum += weight;
+      }
+      _input_effective_bias[row] = (bias_data ? bias_data[c] : 0) - input_zp * input_row_sum;
+      _recurrent_effective_bias[row] = -output_state_zp * recurrent_row_sum;
+    }
+  }
+
+  _prepared_integer = true;
+}
+
+void LSTMLayer::LSTMInteger8x8_16()
+{
+  if (!_prepared_integer)
+  {
+    prepareInteger8x8_16();
+  }
+
+  auto in_shape = _input->getShape();
+  assert(in_shape.rank() >= 2 && in_shape.rank() <= 3);
+  int max_time, n_batch;
+  if (in_shape.rank() == 3)
+  {
+    max_time = (_time_major) ? in_shape.dim(0) : in_shape.dim(1);
+    n_batch = (_time_major) ? in_shape.dim(1) : in_shape.dim(0);
+  }
+  else
+  {
+    max_time = 1;
+    n_batch = in_shape.dim(0);
+  }
+  const int n_input = in_shape.dim(_input->getShape().rank() - 1);
+  const int n_cell = _input_to_output_weights->getShape().dim(0);
+  const int n_output = _recurrent_to_output_weights->getShape().dim(1);
+  const bool use_cifg = !isOptionalTensorGiven(_input_to_input_weights);
+  const int n_gates = use_cifg ? 3 : 4;
+
+  // Optional outputs
+  int8_t *output_state_buf = getOptionalOutputBuffer<int8_t>(_output_state, &_output_state_vec,
+                                                             _output_state_in->total_size());
+  int16_t *cell_state_buf =
+    getOptionalOutputBuffer<int16_t>(_cell_state, &_cell_state_vec, _cell_state_in->total_size());
+
+  initializeStateBuffer(_output_state_in, output_state_buf, _has_output_state_data);
+  initializeStateBuffer(_cell_state_in, cell_state_buf, _has_cell_state_data);
+
+  // Scratch buffers are sized for a whole batch, and reused by every step
+  _input_accum_scratch.resize(n_gates * n_cell * n_batch);
+  _recurrent_accum_scratch.resize(n_gates * n_cell * n_batch);
+  _gate_scratch.resize(4 * n_cell * n_batch);
+
+  auto out_shape = _output->getShape();
+  const int output_batch_leading_dim = out_shape.dim(out_shape.rank() - 1);
+  auto ruy_context = _external_context->ruy_context();
+  if (_time_major)
+  {
+    // Loop through the sequence.
+    const int input_step = n_batch * n_input;
+    const int output_step = n_batch * output_batch_leading_dim;
+    for (int t = 0; t < max_time; t++)
+    {
+      // If this is the forward_sequence, step forward, otherwise step
+      // backwards.
+      const int t_rel = _forward_sequence ? t : max_time - t - 1;
+      const int8_t *input_ptr = getBuffer<int8_t>(_input) + t_rel * input_step;
+      int8_t *output_ptr = getBuffer<int8_t>(_output) + t_rel * output_step + _output_offset;
+
+      nnfw::cker::LstmStepInteger8x8_16(
+        _integer_params, use_cifg, input_ptr, _input_weights_packed.data(),
+        _input_effective_bias.data(), _recurrent_weights_packed.data(),
+        _recurrent_effective_bias.data(), n_batch, n_cell, n_input, n_output,
+        output_batch_leading_dim, output_state_buf, cell_state_buf, _input_accum_scratch.data(),
+        _recurrent_accum_scratch.data(), _gate_scratch.data(), output_ptr, ruy_context);
+    }
+  }
+  else
+  {
+    for (int b = 0; b < n_batch; b++)
+    {
+      const int input_step = n_input;
+      const int output_step = output_batch_leading_dim;
+      for (int t = 0; t < max_time; t++)
+      {
+        // If this is the forward_sequence, step forward, otherwise step
+        // backwards.
+        const int t_rel = _forward_sequence ? t : max_time - t - 1;
+        const int time_offset = b * max_time + t_rel;
+        const int8_t *input_ptr = getBuffer<int8_t>(_input) + time_offset * input_step;
+        int8_t *output_ptr =
+          getBuffer<int8_t>(_output) + time_offset * output_step + _output_offset;
+
+        // Offset the {output,cell}_state pointers to the right batch.
+        int8_t *output_state_ptr = output_state_buf + b * output_batch_leading_dim;
+        int16_t *cell_state_ptr = cell_state_buf + b * n_cell;
+
+        nnfw::cker::LstmStepInteger8x8_16(
+          _integer_params, use_cifg, input_ptr, _input_weights_packed.data(),
+          _input_effective_bias.data(), _recurrent_weights_packed.data(),
+          _recurrent_effective_bias.data(), /*n_batch=*/1, n_cell, n_input, n_output,
+          output_batch_leading_dim, output_state_ptr, cell_state_ptr, _input_accum_scratch.data(),
+          _recurrent_accum_scratch.data(), _gate_scratch.data(), output_ptr, ruy_context);
+      }
+    }
+  }
+}
+
 void LSTMLayer::configure(
   const IPortableTensor *input, const IPortableTensor *input_to_input_weights,
   const IPortableTensor *input_to_forget_weights, const IPortableTensor *input_to_cell_weights,
@@ -259,7 +547,8 @@ void LSTMLayer::configure(
   const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
   bool forward_sequence, bool time_major, int output_offset, IPortableTensor *scratch_buffer,
   IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-  bool has_output_state_data, bool has_cell_state_data)
+  bool has_output_state_data, bool has_cell_state_data,
+  const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _input_to_input_weights = input_to_input_weights;
@@ -298,6 +587,7 @@ void LSTMLayer::configure(
   _output = output;
   _has_output_state_data = has_output_state_data;
   _has_cell_state_data = has_cell_state_data;
+  _external_context = external_context;
 }
 
 void LSTMLayer::run()
@@ -307,12 +597,28 @@ void LSTMLayer::run()
   {
     LSTMFloat();
   }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    LSTMInteger8x8_16();
+  }
   else
   {
     throw std::runtime_error{"LSTMLayer: unsupported data type"};
   }
 }
 
+void LSTMLayer::prepare()
+{
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    prepareFloat();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    prepareInteger8x8_16();
+  }
+}
+
 } // namespace ops
 } // namespace cpu
 } // namespace backend
@@ -19,6 +19,8 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
+#include <cker/Types.h>
 #include <ir/InternalType.h>
 #include <ir/operation/LSTM.h>
 #include <exec/IFunction.h>
@@ -49,6 +51,8 @@ public:
 public:
   void LSTMFloat();
 
+  void LSTMInteger8x8_16();
+
   void configure(
     const IPortableTensor *input, const IPortableTensor *input_to_input_weights,
     const IPortableTensor *input_to_forget_weights, const IPortableTensor *input_to_cell_weights,
@@ -72,10 +76,17 @@ public:
     const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
     bool forward_sequence, bool time_major, int32_t output_offset, IPortableTensor *scratch_buffer,
     IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-    bool has_output_state_data, bool has_cell_state_data);
+    bool has_output_state_data, bool has_cell_state_data,
+    const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
+  void prepare() override;
+
+private:
+  void prepareFloat();
+  void prepareInteger8x8_16();
+
 private:
   const IPortableTensor *_input{nullptr};
   const IPortableTensor *_input_to_input_weights{nullptr};
@@ -119,6 +130,26 @@ private:
   int32_t _output_offset{0};
   bool _has_output_state_data{false};
   bool _has_cell_state_data{false};
+  std::shared_ptr<ExternalContext> _external_context{nullptr};
+
+  // For float LSTM with constant weights, weights of the gates are packed to be multiplied at once,
+  // and the input projection of the whole sequence is computed before the recurrent loop
+  bool _prepared_float{false};
+  std::vector<float> _input_weights_packed_float{};
+  std::vector<float> _recurrent_weights_packed_float{};
+  std::vector<float> _gate_bias_packed{};
+  std::vector<float> _gates_buffer{};
+
+  // For integer LSTM, weights of the gates are packed to be multiplied at once
+  bool _prepared_integer{false};
+  nnfw::cker::IntegerLSTMParams _integer_params{};
+  std::vector<int8_t> _input_weights_packed{};
+  std::vector<int8_t> _recurrent_weights_packed{};
+  std::vector<int32_t> _input_effective_bias{};
+  std::vector<int32_t> _recurrent_effective_bias{};
+  std::vector<int32_t> _input_accum_scratch{};
+  std::vector<int32_t> _recurrent_accum_scratch{};
+  std::vector<int16_t> _gate_scratch{};
 };
 
 } // namespace ops
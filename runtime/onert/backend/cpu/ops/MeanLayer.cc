@@ -29,7 +29,9 @@ namespace cpu
 namespace ops
 {
 
-MeanLayer::MeanLayer() : _input(nullptr), _axes(nullptr), _output(nullptr), _keep_dims(false)
+MeanLayer::MeanLayer()
+  : _input(nullptr), _axes(nullptr), _output(nullptr), _keep_dims(false),
+    _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -45,7 +47,7 @@ void MeanLayer::MeanFloat32()
   if (axis_is_1_and_2)
   {
     nnfw::cker::MeanAxis1And2(inputShape, getBuffer<float>(_input), getShape(_output),
-                              getBuffer<float>(_output));
+                              getBuffer<float>(_output), _external_context->ruy_context());
   }
   else
   {
@@ -62,12 +64,14 @@ void MeanLayer::MeanQuant8()
 }
 
 void MeanLayer::configure(const IPortableTensor *input, const IPortableTensor *axes,
-                          IPortableTensor *output, bool keep_dims)
+                          IPortableTensor *output, bool keep_dims,
+                          const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _axes = axes;
   _output = output;
   _keep_dims = keep_dims;
+  _external_context = external_context;
 
   if (_input->data_type() != OperandType::FLOAT32 &&
       _input->data_type() != OperandType::QUANT_UINT8_ASYMM)
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_MEANLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -41,7 +42,7 @@ public:
   void MeanQuant8();
 
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 bool keep_dims);
+                 bool keep_dims, const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -50,6 +51,7 @@ private:
   const IPortableTensor *_axes;
   IPortableTensor *_output;
   bool _keep_dims;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -158,6 +158,10 @@ void CalculateActivationRangeQuantized(ir::Activation activation, const IPortabl
       qmin = std::numeric_limits<int8_t>::min();
       qmax = std::numeric_limits<int8_t>::max();
       break;
+    case OperandType::QUANT_INT16_ASYMM:
+      qmin = std::numeric_limits<int16_t>::min();
+      qmax = std::numeric_limits<int16_t>::max();
+      break;
     default:
       throw std::runtime_error("CalculateActivationRangeQuantized: Not supported operand type.");
   }
@@ -28,7 +28,8 @@ namespace ops
 {
 
 PadLayer::PadLayer()
-  : _input(nullptr), _output(nullptr), _padData(), _padRank(), _constantValueData()
+  : _input(nullptr), _output(nullptr), _padData(), _padRank(), _constantValueData(),
+    _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -36,17 +37,19 @@ PadLayer::PadLayer()
 template <typename T> void PadLayer::padImpl(const T *constant_value_data)
 {
   nnfw::cker::Pad<T>(_padData, _padRank, getShape(_input), getBuffer<T>(_input), getShape(_output),
-                     getBuffer<T>(_output), constant_value_data);
+                     getBuffer<T>(_output), constant_value_data, _external_context->ruy_context());
 }
 
 void PadLayer::configure(const IPortableTensor *input, IPortableTensor *output,
-                         const int32_t *padData, int32_t padRank, const void *constantValueData)
+                         const int32_t *padData, int32_t padRank, const void *constantValueData,
+                         const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   memcpy(_padData, padData, sizeof(_padData));
   _padRank = padRank;
   _constantValueData.v = constantValueData;
+  _external_context = external_context;
 }
 
 void PadLayer::run()
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_PADLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -42,7 +43,8 @@ public:
   template <typename T> void padImpl(const T *constant_value_data);
 
   void configure(const IPortableTensor *input, IPortableTensor *output, const int32_t *padData,
-                 int32_t padRank, const void *constantValueData = nullptr);
+                 int32_t padRank, const void *constantValueData,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -53,6 +55,7 @@ private:
   int32_t _padData[8];
   int32_t _padRank;
   ConstDataPtr _constantValueData;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -33,32 +33,35 @@ namespace ops
 namespace
 {
 template <typename T>
-void avgPool2D(const nnfw::cker::PoolParams &params, const IPortableTensor *input,
-               IPortableTensor *output)
+void avgPool2D(const nnfw::cker::PoolParams &params, ruy::Context *ruy_context,
+               const IPortableTensor *input, IPortableTensor *output)
 {
   nnfw::cker::AveragePool<T>(params, getShape(input), getBuffer<T>(input), getShape(output),
-                             getBuffer<T>(output));
+                             getBuffer<T>(output), ruy_context);
 }
 
 template <typename T>
-void maxPool2D(const nnfw::cker::PoolParams &params, const IPortableTensor *input,
-               IPortableTensor *output)
+void maxPool2D(const nnfw::cker::PoolParams &params, ruy::Context *ruy_context,
+               const IPortableTensor *input, IPortableTensor *output)
 {
   nnfw::cker::MaxPool<T>(params, getShape(input), getBuffer<T>(input), getShape(output),
-                         getBuffer<T>(output));
+                         getBuffer<T>(output), ruy_context);
 }
 
 template <typename T>
 std::function<void(const IPortableTensor *, IPortableTensor *)>
-generateKernelGeneric(const nnfw::cker::PoolParams &params, PoolType op_type)
+generateKernelGeneric(const nnfw::cker::PoolParams &params, PoolType op_type,
+                      ruy::Context *ruy_context)
 {
   if (op_type == PoolType::kAvg)
   {
-    return std::bind(&avgPool2D<T>, params, std::placeholders::_1, std::placeholders::_2);
+    return std::bind(&avgPool2D<T>, params, ruy_context, std::placeholders::_1,
+                     std::placeholders::_2);
   }
   else if (op_type == PoolType::kMax)
   {
-    return std::bind(&maxPool2D<T>, params, std::placeholders::_1, std::placeholders::_2);
+    return std::bind(&maxPool2D<T>, params, ruy_context, std::placeholders::_1,
+                     std::placeholders::_2);
   }
   else
   {
@@ -67,7 +70,7 @@ generateKernelGeneric(const nnfw::cker::PoolParams &params, PoolType op_type)
 }
 } // namespace
 
-PoolLayer::PoolLayer() : _input(nullptr), _output(nullptr), _kernel()
+PoolLayer::PoolLayer() : _input(nullptr), _output(nullptr), _external_context(nullptr), _kernel()
 {
   // DO NOTHING
 }
@@ -85,16 +88,19 @@ void PoolLayer::configure(const IPortableTensor *input, const uint32_t paddingLe
                           const uint32_t paddingTop, const uint32_t, const uint32_t strideWidth,
                           const uint32_t strideHeight, const uint32_t kernelWidth,
                           const uint32_t kernelHeight, const ir::Activation activation,
-                          IPortableTensor *output, const PoolType op_type)
+                          IPortableTensor *output, const PoolType op_type,
+                          const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(input != nullptr);
   assert(output != nullptr);
 
   _input = input;
   _output = output;
+  _external_context = external_context;
 
   POOLING_PARAMETERS
 
+  auto ruy_context = _external_context->ruy_context();
   switch (_input->data_type())
   {
     case OperandType::FLOAT32:
@@ -105,7 +111,7 @@ void PoolLayer::configure(const IPortableTensor *input, const uint32_t paddingLe
       op_params.float_activation_min = output_activation_min;
       op_params.float_activation_max = output_activation_max;
 
-      _kernel = generateKernelGeneric<float>(op_params, op_type);
+      _kernel = generateKernelGeneric<float>(op_params, op_type, ruy_context);
       break;
     }
     case OperandType::QUANT_UINT8_ASYMM:
@@ -116,7 +122,7 @@ void PoolLayer::configure(const IPortableTensor *input, const uint32_t paddingLe
                                         &output_activation_max);
       op_params.quantized_activation_min = output_activation_min;
       op_params.quantized_activation_max = output_activation_max;
-      _kernel = generateKernelGeneric<uint8_t>(op_params, op_type);
+      _kernel = generateKernelGeneric<uint8_t>(op_params, op_type, ruy_context);
       break;
     }
     case OperandType::QUANT_INT8_ASYMM:
@@ -127,7 +133,18 @@ void PoolLayer::configure(const IPortableTensor *input, const uint32_t paddingLe
                                         &output_activation_max);
       op_params.quantized_activation_min = output_activation_min;
       op_params.quantized_activation_max = output_activation_max;
-      _kernel = generateKernelGeneric<int8_t>(op_params, op_type);
+      _kernel = generateKernelGeneric<int8_t>(op_params, op_type, ruy_context);
+      break;
+    }
+    case OperandType::QUANT_INT16_ASYMM:
+    {
+      int32_t output_activation_min = 0;
+      int32_t output_activation_max = 0;
+      CalculateActivationRangeQuantized(activation, _output, &output_activation_min,
+                                        &output_activation_max);
+      op_params.quantized_activation_min = output_activation_min;
+      op_params.quantized_activation_max = output_activation_max;
+      _kernel = generateKernelGeneric<int16_t>(op_params, op_type, ruy_context);
       break;
     }
     default:
@@ -18,6 +18,7 @@
 #define __ONERT_BACKEND_CPU_OPS_POOLLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 #include "OperationUtils.h"
 
 #include <exec/IFunction.h>
@@ -49,13 +50,15 @@ public:
                  const uint32_t paddingBottom, const uint32_t strideWidth,
                  const uint32_t strideHeight, const uint32_t kernelWidth,
                  const uint32_t kernelHeight, const ir::Activation activation,
-                 IPortableTensor *output, const PoolType op_type);
+                 IPortableTensor *output, const PoolType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
 private:
   const IPortableTensor *_input;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 
   std::function<void(const IPortableTensor *, IPortableTensor *)> _kernel;
 };
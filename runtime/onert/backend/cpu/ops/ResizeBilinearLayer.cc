@@ -29,14 +29,15 @@ namespace ops
 
 ResizeBilinearLayer::ResizeBilinearLayer()
   : _input(nullptr), _output(nullptr), _size(nullptr), _output_height(0), _output_width(0),
-    _align_corners(false), _half_pixel_centers(false)
+    _align_corners(false), _half_pixel_centers(false), _external_context(nullptr)
 {
   // DO NOTHING
 }
 
 void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                     const IPortableTensor *size, bool align_corners,
-                                    bool half_pixel_centers)
+                                    bool half_pixel_centers,
+                                    const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(!size->is_constant());
   _input = input;
@@ -44,11 +45,13 @@ void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTenso
   _size = size;
   _align_corners = align_corners;
   _half_pixel_centers = half_pixel_centers;
+  _external_context = external_context;
 }
 
 void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                     int32_t output_height, int32_t output_width, bool align_corners,
-                                    bool half_pixel_centers)
+                                    bool half_pixel_centers,
+                                    const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(_size == nullptr);
   if (output_height < 0)
@@ -67,6 +70,7 @@ void ResizeBilinearLayer::configure(const IPortableTensor *input, IPortableTenso
   _output_width = output_width;
   _align_corners = align_corners;
   _half_pixel_centers = half_pixel_centers;
+  _external_context = external_context;
 }
 
 void ResizeBilinearLayer::run()
@@ -90,17 +94,20 @@ void ResizeBilinearLayer::run()
   {
     case OperandType::FLOAT32:
       nnfw::cker::ResizeBilinear(params, getShape(_input), getBuffer<float>(_input),
-                                 getShape(_output), getBuffer<float>(_output));
+                                 getShape(_output), getBuffer<float>(_output),
+                                 _external_context->ruy_context());
       break;
 
     case OperandType::QUANT_UINT8_ASYMM:
       nnfw::cker::ResizeBilinear(params, getShape(_input), getBuffer<uint8_t>(_input),
-                                 getShape(_output), getBuffer<uint8_t>(_output));
+                                 getShape(_output), getBuffer<uint8_t>(_output),
+                                 _external_context->ruy_context());
       break;
 
     case OperandType::QUANT_INT8_ASYMM:
       nnfw::cker::ResizeBilinear(params, getShape(_input), getBuffer<int8_t>(_input),
-                                 getShape(_output), getBuffer<int8_t>(_output));
+                                 getShape(_output), getBuffer<int8_t>(_output),
+                                 _external_context->ruy_context());
       break;
 
     case OperandType::UINT8:
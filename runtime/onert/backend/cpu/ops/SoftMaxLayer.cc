@@ -20,6 +20,8 @@
 
 #include <cker/operation/SoftMax.h>
 
+#include <cmath>
+
 namespace onert
 {
 namespace backend
@@ -29,7 +31,8 @@ namespace cpu
 namespace ops
 {
 
-SoftMaxLayer::SoftMaxLayer() : _input(nullptr), _output(nullptr), _beta(0.0)
+SoftMaxLayer::SoftMaxLayer()
+  : _input(nullptr), _output(nullptr), _beta(0.0), _external_context(nullptr)
 {
   // DO NOTHING
 }
@@ -48,15 +51,24 @@ void SoftMaxLayer::softmaxFloat32()
       throw std::runtime_error("batch_size should not be 0");
 
     uint32_t input_size = getNumberOfElements(_input) / batch_size;
-    nnfw::cker::Softmax(getBuffer<float>(_input), input_size, batch_size, _beta,
-                        getBuffer<float>(_output));
+    // Rows are independent, so a range of them is a smaller batch
+    _external_context->parallelFor(batch_size, input_size, [&](int64_t begin, int64_t end) {
+      nnfw::cker::Softmax(getBuffer<float>(_input) + begin * input_size, input_size, end - begin,
+                          _beta, getBuffer<float>(_output) + begin * input_size);
+    });
   }
   else if (getNumberOfDimensions(_input) == 4)
   {
     nnfw::cker::SoftmaxParams op_params;
     op_params.beta = _beta;
-    nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<float>(_input), getShape(_output),
-                        getBuffer<float>(_output));
+    // Softmax is along the last dimension, so a range of the other dimensions is a 2D tensor
+    const int depth = getSizeOfDimension(_input, 3);
+    const int rows = depth > 0 ? getNumberOfElements(_input) / depth : 0;
+    _external_context->parallelFor(rows, depth, [&](int64_t begin, int64_t end) {
+      const nnfw::cker::Shape shape({static_cast<int>(end - begin), depth});
+      nnfw::cker::Softmax(op_params, shape, getBuffer<float>(_input) + begin * depth, shape,
+                          getBuffer<float>(_output) + begin * depth);
+    });
   }
   else
   {
@@ -85,12 +97,26 @@ template <typename T> void SoftMaxLayer::softmaxQuant8()
 #endif
 }
 
+void SoftMaxLayer::softmaxQuant16()
+{
+  nnfw::cker::SoftmaxParams op_params;
+  op_params.input_multiplier = _input_multiplier;
+  op_params.input_left_shift = _input_left_shift;
+  op_params.exp_lut = _exp_lut.data();
+  op_params.one_over_one_plus_x_lut = _one_over_one_plus_x_lut.data();
+
+  nnfw::cker::SoftmaxInt16(op_params, getShape(_input), getBuffer<int16_t>(_input),
+                           getShape(_output), getBuffer<int16_t>(_output));
+}
+
 void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
-                             IPortableTensor *output)
+                             IPortableTensor *output,
+                             const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   _beta = beta;
+  _external_context = external_context;
 
   if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
       _input->data_type() == OperandType::QUANT_INT8_ASYMM)
@@ -104,6 +130,22 @@ void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
     nnfw::cker::PopulateSoftmaxLookupTable(_table, _input->data_scale(), _beta);
 #endif
   }
+  else if (_input->data_type() == OperandType::QUANT_INT16_ASYMM)
+  {
+    // The kernel outputs Q0.15, and int16 tensors are symmetric
+    if (_input->data_zero_point() != 0 || _output->data_zero_point() != 0)
+      throw std::runtime_error{"SoftMax: Int16 needs zero points of 0"};
+    if (std::abs(_output->data_scale() - 1.0f / 32768) > 0.001f / 32768)
+      throw std::runtime_error{"SoftMax: Int16 output needs scale of 1/32768"};
+
+    // Scale (input - max) so that [-65535, 0] corresponds to [-10.0, 0.0]
+    const double input_scale_beta_rescale = _input->data_scale() * _beta / (10.0 / 65535.0);
+    QuantizeMultiplier(input_scale_beta_rescale, &_input_multiplier, &_input_left_shift);
+
+    _exp_lut.resize(nnfw::cker::kInt16LUTSize);
+    _one_over_one_plus_x_lut.resize(nnfw::cker::kInt16LUTSize);
+    nnfw::cker::PopulateSoftmaxInt16LookupTables(_exp_lut.data(), _one_over_one_plus_x_lut.data());
+  }
 }
 
 void SoftMaxLayer::run()
@@ -119,6 +161,9 @@ void SoftMaxLayer::run()
     case OperandType::QUANT_INT8_ASYMM:
       softmaxQuant8<int8_t>();
       break;
+    case OperandType::QUANT_INT16_ASYMM:
+      softmaxQuant16();
+      break;
     default:
       throw std::runtime_error{"SoftMax: unsupported data type"};
   }
@@ -18,9 +18,12 @@
 #define __ONERT_BACKEND_CPU_OPS_SOFTMAXLAYER_H__
 
 #include <backend/IPortableTensor.h>
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -40,7 +43,10 @@ public:
 
   template <typename T> void softmaxQuant8();
 
-  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
+  void softmaxQuant16();
+
+  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
 
   void run() override;
 
@@ -53,6 +59,11 @@ private:
   float _table[256];
   uint8_t _uint8_table1[256];
   uint8_t _uint8_table2[256];
+  int32_t _input_multiplier = 0;
+  int _input_left_shift = 0;
+  std::vector<int16_t> _exp_lut;
+  std::vector<int16_t> _one_over_one_plus_x_lut;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include "../Tensor.h"
+#include "ir/Padding.h"
+#include <cker/operation/TransposeConv.h>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TransposeConvLayer::TransposeConvLayer()
+  : _input(nullptr), _kernel(nullptr), _output(nullptr), _paddingType(ir::PaddingType::EXPLICIT),
+    _paddingLeft(0), _paddingTop(0), _paddingRight(0), _paddingBottom(0), _strideWidth(0),
+    _strideHeight(0), _transpose_conv_kernel(new nnfw::cker::TransposeConvGemm()),
+    _external_context(nullptr), _prepare(false)
+{
+  // DO NOTHING
+}
+
+TransposeConvLayer::~TransposeConvLayer() = default;
+
+void TransposeConvLayer::transposeConvFloat32()
+{
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+
+  nnfw::cker::TransposeConvGemm &kernel = *_transpose_conv_kernel;
+  kernel(op_params, getShape(_input), getBuffer<float>(_input), getShape(_kernel),
+         getBuffer<float>(_kernel), getShape(_output), getBuffer<float>(_output));
+}
+
+void TransposeConvLayer::transposeConvQuant8()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(ir::Activation::NONE, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  // TransposeConv has no bias
+  double real_multiplier = 0.0;
+  int32_t output_multiplier = 0;
+  int32_t output_shift = 0;
+  GetQuantizedConvolutionMultiplier(_input, _kernel, nullptr, _output, &real_multiplier);
+  QuantizeMultiplier(real_multiplier, &output_multiplier, &output_shift);
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.weights_offset = -_kernel->data_zero_point();
+  op_params.output_offset = _output->data_zero_point();
+  op_params.output_multiplier = output_multiplier;
+  op_params.output_shift = output_shift;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::TransposeConvGemm &kernel = *_transpose_conv_kernel;
+  kernel(op_params, getShape(_input), getBuffer<uint8_t>(_input), getShape(_kernel),
+         getBuffer<uint8_t>(_kernel), getShape(_output), getBuffer<uint8_t>(_output),
+         _external_context->ruy_context());
+}
+
+void TransposeConvLayer::transposeConvQuant8PerChannel()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(ir::Activation::NONE, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_type = getPaddingType(_paddingType);
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = 1;
+  op_params.dilation_height_factor = 1;
+  op_params.input_offset = -_input->data_zero_point();
+  op_params.weights_offset = 0;
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::TransposeConvGemm &kernel = *_transpose_conv_kernel;
+  kernel(op_params, getShape(_input), getBuffer<int8_t>(_input), getShape(_kernel),
+         getBuffer<int8_t>(_kernel), getShape(_output), getBuffer<int8_t>(_output),
+         _external_context->ruy_context());
+}
+
+void TransposeConvLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                                   const ir::PaddingType paddingType, const uint32_t paddingLeft,
+                                   const uint32_t paddingRight, const uint32_t paddingTop,
+                                   const uint32_t paddingBottom, const uint32_t strideWidth,
+                                   const uint32_t strideHeight, IPortableTensor *output,
+                                   const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _kernel = kernel;
+  _paddingType = paddingType;
+  _paddingLeft = paddingLeft;
+  _paddingRight = paddingRight;
+  _paddingTop = paddingTop;
+  _paddingBottom = paddingBottom;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _output = output;
+  _external_context = external_context;
+}
+
+void TransposeConvLayer::run()
+{
+  prepare();
+
+  if (_input->is_dynamic() || _kernel->is_dynamic())
+  {
+    const auto ifm_shape = _input->getShape().asFeature(_input->layout());
+    const auto ofm_shape = _output->getShape().asFeature(_input->layout());
+    // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+    const auto ker_shape = _kernel->getShape();
+    const auto ker_height = ker_shape.dim(1);
+    const auto ker_width = ker_shape.dim(2);
+
+    ir::Stride stride;
+    stride.vertical = _strideHeight;
+    stride.horizontal = _strideWidth;
+
+    ir::Padding param_padding;
+    param_padding.type = _paddingType;
+    param_padding.param.left = _paddingLeft;
+    param_padding.param.right = _paddingRight;
+    param_padding.param.top = _paddingTop;
+    param_padding.param.bottom = _paddingBottom;
+
+    // Padding of TransposeConv is the one of the convolution from the output to the input
+    const auto padding =
+      ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride, ker_width, ker_height);
+
+    _paddingLeft = padding.left;
+    _paddingRight = padding.right;
+    _paddingTop = padding.top;
+    _paddingBottom = padding.bottom;
+  }
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    transposeConvFloat32();
+  }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    transposeConvQuant8();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    transposeConvQuant8PerChannel();
+  }
+  else
+  {
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+  }
+}
+
+void TransposeConvLayer::prepare()
+{
+  if (_prepare)
+    return;
+
+  nnfw::cker::TransposeConvGemm &kernel = *_transpose_conv_kernel;
+  if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    if (!_kernel->is_constant() || _input->is_dynamic() || _output->is_dynamic())
+      throw std::runtime_error{"TransposeConv: Int8 dynamic weight is not supported"};
+
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+      _kernel->data_scales().size(), getShape(_kernel).Dims(0),
+      kernel.per_channel_output_multiplier(), kernel.per_channel_output_shift());
+  }
+
+  // The reordered copy of a constant kernel is used from now on
+  if (_kernel->is_constant())
+  {
+    if (_input->data_type() == OperandType::FLOAT32)
+      kernel.prepare(getShape(_kernel), getBuffer<float>(_kernel));
+    else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+      kernel.prepare(getShape(_kernel), getBuffer<uint8_t>(_kernel));
+    else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+      kernel.prepare(getShape(_kernel), getBuffer<int8_t>(_kernel));
+
+    // The original kernel is not used any more
+    auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
+    if (kernel_tensor)
+      // TODO Remove const_cast
+      const_cast<Tensor *>(kernel_tensor)->decrease_ref();
+  }
+  _prepare = true;
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
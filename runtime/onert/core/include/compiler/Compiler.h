@@ -23,12 +23,18 @@
 #define __ONERT_COMPILER_COMPILE_H_
 
 #include "ir/Graph.h"
+#include "compiler/BackendResolver.h"
 #include "exec/IExecutor.h"
 #include "util/TracingCtx.h"
 
 namespace onert
 {
 
+namespace exec
+{
+class ExecTime;
+} // namespace exec
+
 namespace compiler
 {
 
@@ -52,15 +58,23 @@ struct CompilerOptions
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   std::string trace_filepath; //< File path to save trace records
+  int trace_ring_buffer_size; //< Records per thread for ring buffer tracing, 0 to trace events
+  int trace_sampling_period;  //< Trace 1 of every N runs with ring buffer tracing
   int graph_dump_level;       //< Graph dump level, values between 0 and 2 are valid
   std::string executor;       //< Executor name to use
   ManualSchedulerOptions manual_scheduler_options; //< Options for ManualScheduler
-  bool he_scheduler;      //< HEScheduler if true, ManualScheduler otherwise
-  bool he_profiling_mode; //< Whether HEScheduler profiling mode ON/OFF
-  bool disable_compile;   //< Run with Interpreter if true, try compilation otherwise
-  bool fp16_enable;       //< Whether fp16 mode ON/OFF
+  bool he_scheduler;                  //< HEScheduler if true, ManualScheduler otherwise
+  bool he_profiling_mode;             //< Whether HEScheduler profiling mode ON/OFF
+  int he_online_period;               //< Runs between online re-scheduling, 0 to disable it
+  int he_online_threshold;            //< Makespan improvement(%) to switch backend assignment
+  bool he_cost_model;                 //< Estimate unmeasured execution time with a cost model
+  std::string he_cost_model_filepath; //< Calibration file of the cost model, empty for defaults
+  bool disable_compile;               //< Run with Interpreter if true, try compilation otherwise
+  bool fp16_enable;                   //< Whether fp16 mode ON/OFF
 
   util::TracingCtx *tracing_ctx; //< Profiling information
+  // Measured by all executors of a session, so that none overwrites what others stored
+  std::shared_ptr<exec::ExecTime> exec_time;
 };
 
 CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs);
@@ -86,6 +100,25 @@ public:
    */
   std::shared_ptr<exec::ExecutorMap> compile(void);
 
+  /**
+   * @brief   Re-run HEScheduler with execution time measured while running, and compile again
+   *          if the predicted makespan improves by more than the threshold
+   * @note    Call this between runs, with online scheduling enabled. The call which switches
+   *          the assignment compiles the whole model again before returning, so that it takes as
+   *          long as the first compilation.
+   *
+   * @return std::shared_ptr<exec::ExecutorMap> New executors, or @c nullptr to keep current ones
+   */
+  std::shared_ptr<exec::ExecutorMap> reschedule(void);
+
+  /**
+   * @brief   Store execution time measured by online scheduling into the file
+   *
+   * @note    Measurements are kept in memory while running, not to slow down the runs. The
+   *          session calls this when it is closed.
+   */
+  void storeExecTime(void) const;
+
   State state(void) const { return _state; }
 
   /**
@@ -115,6 +148,11 @@ private:
   // subgraph is called.
   State _state;
   CompilerOptions _options;
+
+  // For online scheduling
+  std::unique_ptr<BackendResolver> _backend_assignment;
+  int _runs_since_schedule{0};
+  int _reschedule_backoff{1};
 };
 
 } // namespace compiler
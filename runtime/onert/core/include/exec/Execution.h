@@ -142,6 +142,13 @@ public:
   ir::Shape getInputShape(ir::IOIndex ind) const;
   ir::Shape getOutputShape(ir::IOIndex ind) const;
 
+  /**
+   * @brief     Replace executors with the ones compiled from the same model
+   * @param[in] executors New executors
+   * @note      Input and output settings are kept. It should not be called while executing.
+   */
+  void changeExecutors(const std::shared_ptr<ExecutorMap> &executors);
+
 private:
   const std::unique_ptr<IExecutor> &primary_executor() const
   {
@@ -150,7 +157,7 @@ private:
   std::unique_ptr<IExecutor> &primary_executor() { return _executors->at(ir::SubgraphIndex{0}); };
 
 private:
-  const std::shared_ptr<ExecutorMap> _executors;
+  std::shared_ptr<ExecutorMap> _executors;
   IODescription _io_desc;
   std::unique_ptr<std::thread> _exec_thread;
   bool finished{false};
@@ -37,6 +37,7 @@ public:
   enum class Type
   {
     ELU,
+    HARD_SWISH,
     LOGISTIC,
     RELU,
     TANH,
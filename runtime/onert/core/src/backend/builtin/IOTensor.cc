@@ -47,7 +47,16 @@ void IOTensor::setTensor(IPortableTensor *tensor)
 
 void IOTensor::setUserTensor(uint8_t *buffer, size_t size)
 {
-  _user_tensor = std::make_unique<UserTensor>(_orig_info, _orig_layout, buffer, size);
+  // Rebind the user tensor of the previous execution rather than creating one for every execution
+  if (_user_tensor)
+  {
+    _user_tensor->setBuffer(buffer, size);
+    _user_tensor->setShape(_orig_info.shape());
+  }
+  else
+  {
+    _user_tensor = std::make_unique<UserTensor>(_orig_info, _orig_layout, buffer, size);
+  }
   _tensor = _user_tensor.get();
 }
 
@@ -141,7 +141,7 @@ void KernelGenerator::visit(const ir::operation::While &node)
   // creating executor recusively
   auto fn = std::make_unique<::onert::backend::builtin::kernel::WhileLayer>(
     input_tensors, output_tensors, cond_subg_index, body_subg_index, _executor_map,
-    _dyn_tensor_manager->dynamic_mem_mgr().get(), _external_context);
+    _external_context);
 
   _return_fn = std::move(fn);
 }
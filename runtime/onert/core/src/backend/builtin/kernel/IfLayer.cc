@@ -60,17 +60,23 @@ void IfLayer::run()
     return ret;
   };
 
+  if (_then_exec == nullptr)
+  {
+    _then_exec = _executor_map->at(_then_subg_index).get();
+    _else_exec = _executor_map->at(_else_subg_index).get();
+  }
+
   exec::IExecutor *subg_exec = nullptr;
   bool cond_result = getResultCond(_cond_tensor);
   if (cond_result)
   {
     VERBOSE(If) << "Call to $" << _then_subg_index << " (then)" << std::endl;
-    subg_exec = _executor_map->at(_then_subg_index).get();
+    subg_exec = _then_exec;
   }
   else
   {
     VERBOSE(If) << "Call to $" << _else_subg_index << " (else)" << std::endl;
-    subg_exec = _executor_map->at(_else_subg_index).get();
+    subg_exec = _else_exec;
   }
 
   subg_exec->execute(_input_tensors, _output_tensors);
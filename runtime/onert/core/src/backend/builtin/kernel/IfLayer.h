@@ -51,6 +51,9 @@ private:
   const ir::SubgraphIndex _else_subg_index;
   exec::ExecutorMap *_executor_map;
   const std::shared_ptr<ExternalContext> _external_context;
+  // Resolved at the first run and kept for the following runs
+  exec::IExecutor *_then_exec{nullptr};
+  exec::IExecutor *_else_exec{nullptr};
 };
 
 } // namespace kernel
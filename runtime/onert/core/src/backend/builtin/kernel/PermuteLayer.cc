@@ -237,6 +237,12 @@ void PermuteLayer::run()
   assert(_src_tensors.size() == _dst_tensors.size());
   assert(_src_tensors.size() == _src_tensors_offsets.size());
   assert(_dst_tensors.size() == _dst_tensors_offsets.size());
+  // A model input and a model output can be bound to the same user buffer, e.g. for in-place
+  // update, and then there is nothing to copy
+  auto is_same_memory = [](const backend::ITensor *src, const backend::ITensor *dst) {
+    return !src->needMemoryMap() && !dst->needMemoryMap() && src->buffer() == dst->buffer() &&
+           src->layout() == dst->layout() && !src->has_padding() && !dst->has_padding();
+  };
   auto src_it = _src_tensors.begin();
   auto dst_it = _dst_tensors.begin();
   auto src_offsets_it = _src_tensors_offsets.begin();
@@ -254,7 +260,7 @@ void PermuteLayer::run()
     }
     else
     {
-      if (src != dst)
+      if (src != dst && !is_same_memory(src, dst))
       {
         // Conditions to run permutation with multithreading
         // 1. The tasks for multithreathing was created
@@ -35,43 +35,82 @@ WhileLayer::WhileLayer(const std::vector<backend::IPortableTensor *> input_tenso
                        const std::vector<backend::IPortableTensor *> output_tensors,
                        const ir::SubgraphIndex &cond_subg_index,
                        const ir::SubgraphIndex &body_subg_index, exec::ExecutorMap *executor_map,
-                       cpu_common::DynamicMemoryManager *dyn_memory_manager,
                        const std::shared_ptr<ExternalContext> &external_context)
   : _cond_subg_index{cond_subg_index}, _body_subg_index{body_subg_index},
     _input_tensors{input_tensors}, _output_tensors{output_tensors}, _executor_map{executor_map},
-    _dyn_memory_manager{dyn_memory_manager}, _external_context{external_context}
+    _external_context{external_context}
 {
   // At this point, executor_map may not have executors of cond subg and body subg
 }
 
+std::unique_ptr<Tensor> WhileLayer::createTempTensor(const IOTensor *io_tensor)
+{
+  auto tensor = std::make_unique<Tensor>(io_tensor->orig_info(), io_tensor->orig_layout(),
+                                         &_temp_memory_manager);
+  tensor->set_dynamic();
+  tensor->setBuffer(_temp_memory_manager.allocate(tensor.get(), tensor->total_size()));
+  return tensor;
+}
+
+// The body can write to op outputs if they don't need a permutation or reallocation
+bool WhileLayer::canWriteOutputsDirectly(exec::IExecutor *body_exec) const
+{
+  for (const auto input : _input_tensors)
+  {
+    if (input->is_dynamic())
+      return false;
+  }
+
+  const auto &body_outputs = body_exec->getOutputTensors();
+  assert(body_outputs.size() == _output_tensors.size());
+  for (size_t i = 0; i < body_outputs.size(); ++i)
+  {
+    const auto &body_output_info = body_outputs.at(i)->orig_info();
+    const auto op_output = _output_tensors.at(i);
+    if (body_output_info.isDynamic() || op_output->is_dynamic() ||
+        body_outputs.at(i)->orig_layout() != op_output->layout() ||
+        body_output_info.typeInfo().type() != op_output->data_type() ||
+        body_output_info.shape() != op_output->getShape())
+      return false;
+  }
+  return true;
+}
+
+const std::vector<IPortableTensor *> &WhileLayer::loopVars(exec::IExecutor *body_exec, int slot)
+{
+  auto &loop_vars = _loop_vars[slot];
+  if (_temp_tensors[slot].empty())
+  {
+    for (auto io_tensor : body_exec->getOutputTensors())
+    {
+      _temp_tensors[slot].emplace_back(createTempTensor(io_tensor));
+      loop_vars.emplace_back(_temp_tensors[slot].back().get());
+    }
+  }
+  return loop_vars;
+}
+
 void WhileLayer::run()
 {
   // Copy "_input_tensors" -> "cond subg inputs"
   // Run cond subg
   // Start loop while output of cond subg is ture
-  // // Copy "_input_tensors" -> "body subg inputs" in the first iteration, then copy "body subg
-  // outputs" -> "body subg inputs" in the second or more iterations
-  // // Run body subg
-  // // Copy "body subg outputs" -> "cond subg inputs"
-  // // Run cond subg
-  // If there is no loop copy "_input_tensors" -> "_dst_tensors", else copy "cond subg inputs" ->
-  // "_dst_tensors"
+  // // Run body subg with "_input_tensors" in the first iteration, then with the loop-carried
+  // // tensors of the previous iteration
+  // // Write body subg outputs to the loop-carried tensors of the other slot
+  // // Run cond subg with the loop-carried tensors which are just written
+  // If there is no loop copy "_input_tensors" -> "_output_tensors", else copy the last
+  // loop-carried tensors -> "_output_tensors" unless they are "_output_tensors" already
   auto cond_exec = _executor_map->at(_cond_subg_index).get();
   auto body_exec = _executor_map->at(_body_subg_index).get();
 
   // Need a temp tensor to hold the cond subgraph output
   assert(cond_exec->getOutputTensors().size() == 1);
-  auto cond_output_tensor = [&]() {
-    auto cond_output = cond_exec->getOutputTensors().at(0);
-    auto tensor = std::make_unique<Tensor>(cond_output->orig_info(), cond_output->orig_layout(),
-                                           _dyn_memory_manager);
-    tensor->set_dynamic();
-    tensor->setBuffer(_dyn_memory_manager->allocate(tensor.get(), tensor->total_size()));
-    return tensor;
-  }();
+  if (!_cond_output_tensor)
+    _cond_output_tensor = createTempTensor(cond_exec->getOutputTensors().at(0));
 
   VERBOSE(While) << "Call to $" << _cond_subg_index << " (cond)" << std::endl;
-  cond_exec->execute(_input_tensors, {cond_output_tensor.get()});
+  cond_exec->execute(_input_tensors, {_cond_output_tensor.get()});
   VERBOSE(While) << "Return from $" << _cond_subg_index << std::endl;
 
   auto getResultCond = [](backend::ITensor *tensor) -> bool {
@@ -80,65 +119,52 @@ void WhileLayer::run()
     return ret;
   };
 
-  std::vector<ITensor *> op_inputs(_input_tensors.begin(), _input_tensors.end());
   std::vector<ITensor *> op_outputs(_output_tensors.begin(), _output_tensors.end());
   // Copying body inputs to outputs when the loop body is never executed
-  if (!getResultCond(cond_output_tensor.get()))
+  if (!getResultCond(_cond_output_tensor.get()))
   {
+    std::vector<ITensor *> op_inputs(_input_tensors.begin(), _input_tensors.end());
     PermuteLayer copy_body_inputs_to_op_outputs{op_inputs, op_outputs, _external_context};
     copy_body_inputs_to_op_outputs.run();
     return;
   }
 
-  // Need some temp tensors to hold the body subgraph output
-  std::vector<std::unique_ptr<Tensor>> temp_outputs_o;
-  std::vector<IPortableTensor *> temp_outputs;
-  for (auto io_tensor : body_exec->getOutputTensors())
-  {
-    auto tensor = std::make_unique<Tensor>(io_tensor->orig_info(), io_tensor->orig_layout(),
-                                           _dyn_memory_manager);
-    tensor->set_dynamic();
-    tensor->setBuffer(_dyn_memory_manager->allocate(tensor.get(), tensor->total_size()));
-    temp_outputs.push_back(tensor.get());
-    temp_outputs_o.push_back(std::move(tensor));
-  }
+  // Body outputs of each iteration become body inputs of the next one, so that two slots are
+  // swapped instead of copying. One of them is "_output_tensors" if the body can write to them.
+  const bool write_outputs_directly = canWriteOutputsDirectly(body_exec);
+  const std::vector<IPortableTensor *> *slots[2];
+  slots[0] = &loopVars(body_exec, 0);
+  slots[1] = write_outputs_directly ? &_output_tensors : &loopVars(body_exec, 1);
 
-  std::vector<ITensor *> body_outputs(temp_outputs.begin(), temp_outputs.end());
-  PermuteLayer copy_body_outputs_to_op_outputs{body_outputs, op_outputs, _external_context};
+  // Loop while Cond subgraph's output is true
+  const std::vector<IPortableTensor *> *body_inputs = &_input_tensors;
+  int slot = _first_slot;
+  while (getResultCond(_cond_output_tensor.get()))
+  {
+    const auto body_outputs = slots[slot];
 
-  const auto body_execute_with_op_inputs = [&]() {
     VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_input_tensors, temp_outputs);
+    body_exec->execute(*body_inputs, *body_outputs);
     VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
-  };
 
-  const auto body_execute_with_body_outputs = [&]() {
-    VERBOSE(While) << "Call to $" << _body_subg_index << " (body)" << std::endl;
-    body_exec->execute(_output_tensors, temp_outputs);
-    VERBOSE(While) << "Return from $" << _body_subg_index << std::endl;
-  };
-
-  std::function<void()> body_execute = body_execute_with_op_inputs;
-  const auto cond_execute = [&]() {
     VERBOSE(While) << "Call to $" << _cond_subg_index << " (cond)" << std::endl;
-    cond_exec->execute(_output_tensors, {cond_output_tensor.get()});
+    cond_exec->execute(*body_outputs, {_cond_output_tensor.get()});
     VERBOSE(While) << "Return from $" << _cond_subg_index << std::endl;
-  };
 
-  // Loop while Cond subgraph's output is true
-  while (getResultCond(cond_output_tensor.get()))
-  {
-    body_execute();
-    copy_body_outputs_to_op_outputs.run();
-    cond_execute();
-    body_execute = body_execute_with_body_outputs;
+    body_inputs = body_outputs;
+    slot ^= 1;
   }
 
-  // Clean-up the temp tensors
-  _dyn_memory_manager->deallocate(cond_output_tensor.get());
-  for (auto tensor : temp_outputs)
+  if (body_inputs != &_output_tensors)
   {
-    _dyn_memory_manager->deallocate(tensor);
+    // Loops usually repeat the same number of iterations, so that start from the other slot next
+    // time to finish on "_output_tensors"
+    if (write_outputs_directly)
+      _first_slot ^= 1;
+
+    std::vector<ITensor *> body_outputs(body_inputs->begin(), body_inputs->end());
+    PermuteLayer copy_body_outputs_to_op_outputs{body_outputs, op_outputs, _external_context};
+    copy_body_outputs_to_op_outputs.run();
   }
 }
 
@@ -23,6 +23,8 @@
 #include <ir/OperandIndexSequence.h>
 #include <ir/Graph.h>
 #include "../ExternalContext.h"
+#include "../IOTensor.h"
+#include "../Tensor.h"
 
 #include "backend/cpu_common/MemoryManager.h"
 
@@ -41,20 +43,32 @@ public:
   WhileLayer(const std::vector<backend::IPortableTensor *> input_tensors,
              const std::vector<backend::IPortableTensor *> output_tensors,
              const ir::SubgraphIndex &cond_subg_index, const ir::SubgraphIndex &body_subg_index,
-             exec::ExecutorMap *executor_map, cpu_common::DynamicMemoryManager *dyn_memory_manager,
+             exec::ExecutorMap *executor_map,
              const std::shared_ptr<ExternalContext> &external_context);
 
 public:
   void run() override;
 
+private:
+  std::unique_ptr<Tensor> createTempTensor(const IOTensor *io_tensor);
+  bool canWriteOutputsDirectly(exec::IExecutor *body_exec) const;
+  const std::vector<IPortableTensor *> &loopVars(exec::IExecutor *body_exec, int slot);
+
 private:
   const ir::SubgraphIndex _cond_subg_index;
   const ir::SubgraphIndex _body_subg_index;
   const std::vector<backend::IPortableTensor *> _input_tensors;
   const std::vector<backend::IPortableTensor *> _output_tensors;
   exec::ExecutorMap *_executor_map;
-  cpu_common::DynamicMemoryManager *_dyn_memory_manager; // For generating temp tensors
   const std::shared_ptr<ExternalContext> _external_context;
+
+  // Temp tensors are kept across runs and reallocated only when their shape changes
+  cpu_common::DynamicMemoryManager _temp_memory_manager;
+  std::unique_ptr<Tensor> _cond_output_tensor;
+  // Loop-carried tensors of two slots which the body alternately reads from and writes to
+  std::vector<std::unique_ptr<Tensor>> _temp_tensors[2];
+  std::vector<IPortableTensor *> _loop_vars[2];
+  int _first_slot = 0;
 };
 
 } // namespace kernel
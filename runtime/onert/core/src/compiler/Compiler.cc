@@ -41,6 +41,8 @@
 #include "ir/OperationDumper.h"
 #include "misc/string_helpers.h"
 
+#include <algorithm>
+
 namespace
 {
 
@@ -76,10 +78,16 @@ CompilerOptions fetchCompilerOptionsFromGlobalConfig(const ir::Subgraphs &subgs)
   CompilerOptions options;
   options.backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
   options.trace_filepath = util::getConfigString(util::config::TRACE_FILEPATH);
+  options.trace_ring_buffer_size = util::getConfigInt(util::config::TRACE_RING_BUFFER_SIZE);
+  options.trace_sampling_period = util::getConfigInt(util::config::TRACE_SAMPLING_PERIOD);
   options.graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   options.executor = util::getConfigString(util::config::EXECUTOR);
   options.he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   options.he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
+  options.he_online_period = util::getConfigInt(util::config::ONLINE_SCHED_PERIOD);
+  options.he_online_threshold = util::getConfigInt(util::config::ONLINE_SCHED_THRESHOLD);
+  options.he_cost_model = util::getConfigBool(util::config::USE_COST_MODEL);
+  options.he_cost_model_filepath = util::getConfigString(util::config::COST_MODEL_FILEPATH);
   options.disable_compile = util::getConfigBool(util::config::DISABLE_COMPILE);
   options.fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
 
@@ -172,6 +180,10 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
                                           _options.backend_list.end(), "/")
                       << std::endl;
     VERBOSE(Compiler) << "trace_filepath           : " << _options.trace_filepath << std::endl;
+    VERBOSE(Compiler) << "trace_ring_buffer_size   : " << _options.trace_ring_buffer_size
+                      << std::endl;
+    VERBOSE(Compiler) << "trace_sampling_period    : " << _options.trace_sampling_period
+                      << std::endl;
     VERBOSE(Compiler) << "graph_dump_level         : " << _options.graph_dump_level << std::endl;
     VERBOSE(Compiler) << "executor                 : " << _options.executor << std::endl;
     VERBOSE(Compiler) << "manual backend_for_all   : "
@@ -181,11 +193,22 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
                       << std::endl;
     VERBOSE(Compiler) << "he_scheduler             : " << _options.he_scheduler << std::endl;
     VERBOSE(Compiler) << "he_profiling_mode        : " << _options.he_profiling_mode << std::endl;
+    VERBOSE(Compiler) << "he_online_period         : " << _options.he_online_period << std::endl;
+    VERBOSE(Compiler) << "he_online_threshold      : " << _options.he_online_threshold << std::endl;
+    VERBOSE(Compiler) << "he_cost_model            : " << _options.he_cost_model << std::endl;
+    VERBOSE(Compiler) << "he_cost_model_filepath   : " << _options.he_cost_model_filepath
+                      << std::endl;
     VERBOSE(Compiler) << "disable_compile          : " << _options.disable_compile << std::endl;
     VERBOSE(Compiler) << "fp16_enable              : " << _options.fp16_enable << std::endl
                       << std::noboolalpha;
   }
 
+  // Both are converted to unsigned sizes
+  if (_options.trace_ring_buffer_size < 0)
+    throw std::runtime_error("TRACE_RING_BUFFER_SIZE must not be negative");
+  if (_options.trace_sampling_period < 1)
+    throw std::runtime_error("TRACE_SAMPLING_PERIOD must be positive");
+
   _subgraphs->iterate([&](const ir::SubgraphIndex &, ir::Graph &subg) {
     // Mandatory passes
     pass::PassRunner{}
@@ -235,7 +258,24 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
     subg.setSubgraphs(nullptr);
   });
 
-  _subgraphs.reset();
+  // Executors of all subgraphs, and the ones compiled again, measure into one execution time
+  if ((_options.he_profiling_mode || _options.he_online_period > 0) && !_options.exec_time)
+    _options.exec_time = std::make_shared<exec::ExecTime>(BackendManager::get().getAll());
+
+  if (_options.he_online_period > 0)
+  {
+    // Keep the model to compile again, and the current backend assignment to be compared
+    _backend_assignment = std::make_unique<BackendResolver>();
+    const auto &lower_info = lowered_subgs.at(ir::SubgraphIndex{0})->lower_info();
+    primary_subgraph()->operations().iterate(
+      [&](const ir::OperationIndex &index, const ir::Operation &) {
+        _backend_assignment->setBackend(index, lower_info.operation.at(index).backend());
+      });
+  }
+  else
+  {
+    _subgraphs.reset();
+  }
 
   for (auto &pair : lowered_subgs)
   {
@@ -301,6 +341,58 @@ std::shared_ptr<exec::ExecutorMap> Compiler::compile(void)
   return executors;
 }
 
+std::shared_ptr<exec::ExecutorMap> Compiler::reschedule(void)
+{
+  if (_options.he_online_period <= 0 || _state != State::COMPILED || !_backend_assignment)
+    return nullptr;
+
+  // Every switch makes the next evaluation later, to avoid oscillating between assignments
+  if (++_runs_since_schedule < _options.he_online_period * _reschedule_backoff)
+    return nullptr;
+  _runs_since_schedule = 0;
+
+  auto options = _options;
+  options.he_scheduler = true;
+  options.he_profiling_mode = false;
+
+  int64_t current_makespan = 0;
+  int64_t new_makespan = 0;
+  try
+  {
+    const auto &graph = *primary_subgraph();
+    const auto backends = BackendManager::get().getAll();
+    HEScheduler current_scheduler{backends, options};
+    current_makespan = current_scheduler.predictMakespan(graph, *_backend_assignment);
+    HEScheduler new_scheduler{backends, options};
+    new_scheduler.schedule(graph);
+    new_makespan = new_scheduler.makespan();
+  }
+  catch (const std::exception &e)
+  {
+    VERBOSE(Compiler) << "Online scheduling is skipped : " << e.what() << std::endl;
+    return nullptr;
+  }
+
+  VERBOSE(Compiler) << "Predicted makespan : current " << current_makespan << ", rescheduled "
+                    << new_makespan << std::endl;
+  if (new_makespan * 100 >= current_makespan * (100 - _options.he_online_threshold))
+    return nullptr;
+
+  // HEScheduler of compilation gets the same assignment from the same measurements
+  static constexpr int max_backoff = 16;
+  _reschedule_backoff = std::min(_reschedule_backoff * 2, max_backoff);
+  _options = options;
+  _state = State::CREATED;
+  return compile();
+}
+
+void Compiler::storeExecTime(void) const
+{
+  // Profiling mode stores by itself after each run
+  if (_options.he_online_period > 0 && _options.exec_time)
+    _options.exec_time->storeOperationsExecTime();
+}
+
 bool Compiler::checkCompilable()
 {
   // Disable compile phase
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CostModel.h"
+
+#include "backend/IConfig.h"
+#include "ir/operation/BatchMatMul.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/FullyConnected.h"
+#include "ir/operation/TransposeConv.h"
+#include "util/logging.h"
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <fstream>
+
+namespace
+{
+
+using namespace onert;
+
+uint64_t numElements(const ir::Shape &shape)
+{
+  uint64_t num = 1;
+  for (int i = 0; i < shape.rank(); ++i)
+  {
+    // Unknown dimensions of dynamic tensors are counted as 1
+    num *= static_cast<uint64_t>(std::max(shape.dim(i), 1));
+  }
+  return num;
+}
+
+int32_t dimOrOne(const ir::Shape &shape, int axis)
+{
+  if (axis < 0)
+    axis += shape.rank();
+  if (axis < 0 || axis >= shape.rank())
+    return 1;
+  return std::max(shape.dim(axis), 1);
+}
+
+bool isQuantized(const ir::Graph &graph, const ir::Operation &node)
+{
+  const auto inputs = node.getInputs() | ir::Remove::UNDEFINED;
+  if (inputs.size() == 0)
+    return false;
+  const auto type = graph.operands().at(inputs.at(0)).typeInfo().type();
+  return type == ir::DataType::QUANT_UINT8_ASYMM || type == ir::DataType::QUANT_INT8_SYMM ||
+         type == ir::DataType::QUANT_INT8_ASYMM || type == ir::DataType::QUANT_INT16_ASYMM;
+}
+
+// NOTE These are rough numbers of a mid-range mobile CPU/GPU. Run cost_model_calibrator on the
+//      target to get better ones.
+const std::unordered_map<std::string, compiler::CostModel::Coefficients> kDefaultCoefficients = {
+  // id,        gflops, quant_gops, gbytes_per_sec, transfer_gbytes_per_sec, overhead_us
+  {"cpu", {8., 16., 4., 4., 2.}},
+  {"ruy", {16., 0., 4., 4., 5.}},
+  {"xnnpack", {20., 0., 4., 4., 3.}},
+  {"acl_neon", {12., 24., 4., 2., 10.}},
+  {"acl_cl", {50., 50., 10., 1., 100.}},
+};
+
+const std::unordered_map<std::string, std::unordered_set<ir::OpCode>> kDefaultSupportedOps = {
+  {"ruy", {ir::OpCode::Conv2D, ir::OpCode::FullyConnected}},
+  {"xnnpack", {ir::OpCode::Conv2D, ir::OpCode::DepthwiseConv2D, ir::OpCode::FullyConnected}},
+  {"acl_neon",
+   {ir::OpCode::ArgMinMax,
+    ir::OpCode::BatchToSpaceND,
+    ir::OpCode::BinaryArithmetic,
+    ir::OpCode::Comparison,
+    ir::OpCode::Concat,
+    ir::OpCode::Conv2D,
+    ir::OpCode::DepthToSpace,
+    ir::OpCode::DepthwiseConv2D,
+    ir::OpCode::ElementwiseActivation,
+    ir::OpCode::ElementwiseBinary,
+    ir::OpCode::ElementwiseUnary,
+    ir::OpCode::EmbeddingLookup,
+    ir::OpCode::ExpandDims,
+    ir::OpCode::FullyConnected,
+    ir::OpCode::Gather,
+    ir::OpCode::HashtableLookup,
+    ir::OpCode::InstanceNorm,
+    ir::OpCode::L2Normalization,
+    ir::OpCode::LocalResponseNormalization,
+    ir::OpCode::LSTM,
+    ir::OpCode::OneHot,
+    ir::OpCode::Pack,
+    ir::OpCode::Pad,
+    ir::OpCode::Pool2D,
+    ir::OpCode::PReLU,
+    ir::OpCode::Reduce,
+    ir::OpCode::Reshape,
+    ir::OpCode::ResizeBilinear,
+    ir::OpCode::RNN,
+    ir::OpCode::Slice,
+    ir::OpCode::Softmax,
+    ir::OpCode::SpaceToBatchND,
+    ir::OpCode::SpaceToDepth,
+    ir::OpCode::Split,
+    ir::OpCode::SquaredDifference,
+    ir::OpCode::Squeeze,
+    ir::OpCode::StridedSlice,
+    ir::OpCode::Transpose,
+    ir::OpCode::TransposeConv,
+    ir::OpCode::Unpack}},
+  {"acl_cl",
+   {ir::OpCode::ArgMinMax,
+    ir::OpCode::BatchToSpaceND,
+    ir::OpCode::BinaryArithmetic,
+    ir::OpCode::Comparison,
+    ir::OpCode::Concat,
+    ir::OpCode::Conv2D,
+    ir::OpCode::ConvertFp16ToFp32,
+    ir::OpCode::ConvertFp32ToFp16,
+    ir::OpCode::DepthToSpace,
+    ir::OpCode::DepthwiseConv2D,
+    ir::OpCode::ElementwiseActivation,
+    ir::OpCode::ElementwiseBinary,
+    ir::OpCode::ElementwiseUnary,
+    ir::OpCode::EmbeddingLookup,
+    ir::OpCode::ExpandDims,
+    ir::OpCode::FullyConnected,
+    ir::OpCode::Gather,
+    ir::OpCode::HashtableLookup,
+    ir::OpCode::InstanceNorm,
+    ir::OpCode::L2Normalization,
+    ir::OpCode::LocalResponseNormalization,
+    ir::OpCode::LSTM,
+    ir::OpCode::OneHot,
+    ir::OpCode::Pack,
+    ir::OpCode::Pad,
+    ir::OpCode::Pool2D,
+    ir::OpCode::PReLU,
+    ir::OpCode::Reduce,
+    ir::OpCode::Reshape,
+    ir::OpCode::ResizeBilinear,
+    ir::OpCode::ResizeNearestNeighbor,
+    ir::OpCode::Reverse,
+    ir::OpCode::RNN,
+    ir::OpCode::Slice,
+    ir::OpCode::Softmax,
+    ir::OpCode::SpaceToBatchND,
+    ir::OpCode::SpaceToDepth,
+    ir::OpCode::Split,
+    ir::OpCode::SplitV,
+    ir::OpCode::SquaredDifference,
+    ir::OpCode::Squeeze,
+    ir::OpCode::StridedSlice,
+    ir::OpCode::TopKV2,
+    ir::OpCode::Transpose,
+    ir::OpCode::TransposeConv,
+    ir::OpCode::Unpack}},
+};
+
+} // namespace
+
+namespace onert
+{
+namespace compiler
+{
+
+CostModel::CostModel()
+  : _coefficients{kDefaultCoefficients}, _supported_ops{kDefaultSupportedOps}
+{
+}
+
+void CostModel::load(const std::string &filepath)
+{
+  std::ifstream ifs{filepath};
+  if (!ifs.is_open())
+    throw std::runtime_error{"CostModel: cannot open calibration file " + filepath};
+
+  Json::Value root;
+  try
+  {
+    ifs >> root;
+  }
+  catch (const std::exception &e)
+  {
+    throw std::runtime_error{"CostModel: invalid calibration file " + filepath + " : " + e.what()};
+  }
+
+  for (const auto &id : root.getMemberNames())
+  {
+    const auto &value = root[id];
+    auto coef = _coefficients.count(id) ? _coefficients.at(id) : _coefficients.at("cpu");
+    coef.gflops = value.get("gflops", coef.gflops).asDouble();
+    coef.quant_gops = value.get("quant_gops", coef.quant_gops).asDouble();
+    coef.gbytes_per_sec = value.get("gbytes_per_sec", coef.gbytes_per_sec).asDouble();
+    coef.transfer_gbytes_per_sec =
+      value.get("transfer_gbytes_per_sec", coef.transfer_gbytes_per_sec).asDouble();
+    coef.overhead_us = value.get("overhead_us", coef.overhead_us).asDouble();
+    if (coef.gflops <= 0. || coef.gbytes_per_sec <= 0. || coef.transfer_gbytes_per_sec <= 0. ||
+        coef.quant_gops < 0. || coef.overhead_us < 0.)
+      throw std::runtime_error{"CostModel: invalid coefficients of " + id};
+    _coefficients[id] = coef;
+
+    if (value.isMember("ops"))
+    {
+      auto &ops = _supported_ops[id];
+      ops.clear();
+      for (const auto &op : value["ops"])
+        ops.insert(ir::toOpCode(op.asString()));
+    }
+
+    VERBOSE(CostModel) << "Calibrated " << id << " : " << coef.gflops << " GFLOPS, "
+                       << coef.quant_gops << " quant GOPS, " << coef.gbytes_per_sec << " GB/s, "
+                       << coef.transfer_gbytes_per_sec << " GB/s of transfer, "
+                       << coef.overhead_us << " us of overhead" << std::endl;
+  }
+}
+
+bool CostModel::knows(const backend::Backend *backend) const
+{
+  return _coefficients.find(backend->config()->id()) != _coefficients.end();
+}
+
+bool CostModel::isSupported(const backend::Backend *backend, const ir::Graph &graph,
+                            const ir::Operation &node) const
+{
+  const auto id = backend->config()->id();
+  const auto coef_it = _coefficients.find(id);
+  if (coef_it == _coefficients.end())
+    return false;
+  if (isQuantized(graph, node) && coef_it->second.quant_gops == 0.)
+    return false;
+
+  const auto ops_it = _supported_ops.find(id);
+  if (ops_it == _supported_ops.end())
+    return true;
+  return ops_it->second.find(node.opcode()) != ops_it->second.end();
+}
+
+int64_t CostModel::getOperationTime(const backend::Backend *backend, const ir::Graph &graph,
+                                    const ir::Operation &node) const
+{
+  const auto coef_it = _coefficients.find(backend->config()->id());
+  if (coef_it == _coefficients.end())
+    return NOT_FOUND;
+  const auto &coef = coef_it->second;
+
+  const auto ops_per_us = (isQuantized(graph, node) ? coef.quant_gops : coef.gflops) * 1e3;
+  const auto compute_us = ops_per_us > 0. ? countFlops(graph, node) / ops_per_us : 0.;
+  const auto memory_us = countBytes(graph, node) / (coef.gbytes_per_sec * 1e3);
+
+  // An operation is bound by either computation or memory
+  const auto time = coef.overhead_us + std::max(compute_us, memory_us);
+  return std::max<int64_t>(static_cast<int64_t>(time), 1);
+}
+
+int64_t CostModel::getPermuteTime(const backend::Backend *src_backend,
+                                  const backend::Backend *dst_backend, uint32_t size) const
+{
+  const auto src_it = _coefficients.find(src_backend->config()->id());
+  const auto dst_it = _coefficients.find(dst_backend->config()->id());
+  if (src_it == _coefficients.end() || dst_it == _coefficients.end())
+    return NOT_FOUND;
+
+  // Permutation runs on cpu and is limited by the slower side
+  const auto bandwidth =
+    std::min(src_it->second.transfer_gbytes_per_sec, dst_it->second.transfer_gbytes_per_sec);
+  const auto time = _coefficients.at("cpu").overhead_us + size / (bandwidth * 1e3);
+  return std::max<int64_t>(static_cast<int64_t>(time), 1);
+}
+
+uint64_t CostModel::countFlops(const ir::Graph &graph, const ir::Operation &node)
+{
+  const auto &operands = graph.operands();
+  const auto outputs = node.getOutputs() | ir::Remove::UNDEFINED;
+  uint64_t output_elems = 0;
+  for (const auto &output : outputs)
+    output_elems += numElements(operands.at(output).shape());
+
+  switch (node.opcode())
+  {
+    case ir::OpCode::Conv2D:
+    {
+      // Kernel is [O, H, W, I]
+      const auto &kernel = operands.at(node.getInputs().at(ir::operation::Conv2D::KERNEL)).shape();
+      return 2 * output_elems * dimOrOne(kernel, 1) * dimOrOne(kernel, 2) * dimOrOne(kernel, 3);
+    }
+    case ir::OpCode::DepthwiseConv2D:
+    {
+      // Kernel is [1, H, W, O]
+      const auto &kernel =
+        operands.at(node.getInputs().at(ir::operation::DepthwiseConv2D::KERNEL)).shape();
+      return 2 * output_elems * dimOrOne(kernel, 1) * dimOrOne(kernel, 2);
+    }
+    case ir::OpCode::FullyConnected:
+    {
+      // Weights are [O, I]
+      const auto &weights =
+        operands.at(node.getInputs().at(ir::operation::FullyConnected::WEIGHT)).shape();
+      return 2 * output_elems * dimOrOne(weights, -1);
+    }
+    case ir::OpCode::BatchMatMul:
+    {
+      const auto &op = static_cast<const ir::operation::BatchMatMul &>(node);
+      const auto &lhs = operands.at(node.getInputs().at(ir::operation::BatchMatMul::LHS)).shape();
+      return 2 * output_elems * dimOrOne(lhs, op.param().adj_x ? -2 : -1);
+    }
+    case ir::OpCode::TransposeConv:
+    {
+      // Every input element is scattered to H x W x O outputs
+      const auto &kernel =
+        operands.at(node.getInputs().at(ir::operation::TransposeConv::KERNEL)).shape();
+      const auto &input =
+        operands.at(node.getInputs().at(ir::operation::TransposeConv::INPUT)).shape();
+      return 2 * numElements(input) * dimOrOne(kernel, 0) * dimOrOne(kernel, 1) *
+             dimOrOne(kernel, 2);
+    }
+    default:
+      // Elementwise-like operations
+      return output_elems;
+  }
+}
+
+uint64_t CostModel::countBytes(const ir::Graph &graph, const ir::Operation &node)
+{
+  uint64_t bytes = 0;
+  for (const auto &ind : (node.getInputs() + node.getOutputs()) | ir::Remove::UNDEFINED)
+    bytes += graph.operands().at(ind).info().total_size();
+  return bytes;
+}
+
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  CostModel.h
+ * @brief This file contains CostModel class to estimate execution time without profiling
+ */
+
+#ifndef __ONERT_COMPILER_COST_MODEL_H__
+#define __ONERT_COMPILER_COST_MODEL_H__
+
+#include "backend/Backend.h"
+#include "ir/Graph.h"
+#include "ir/OpCode.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace onert
+{
+namespace compiler
+{
+
+/**
+ * @brief Analytical cost model of operations and permutations on backends
+ *
+ * Execution time is estimated from FLOPs and bytes moved by an operation, which are derived from
+ * operand shapes, with per-backend constants. It gives HEScheduler a reasonable first assignment
+ * before any profiling. Default constants are rough numbers, which can be replaced by a
+ * calibration file written by cost_model_calibrator.
+ */
+class CostModel
+{
+public:
+  /**
+   * @brief Per-backend constants of the cost model
+   */
+  struct Coefficients
+  {
+    double gflops;                  //< Throughput of float operations
+    double quant_gops;              //< Throughput of quantized operations, 0 if not supported
+    double gbytes_per_sec;          //< Memory bandwidth seen by operations
+    double transfer_gbytes_per_sec; //< Bandwidth of permutation from/to this backend
+    double overhead_us;             //< Fixed cost of running an operation
+  };
+
+  static const int64_t NOT_FOUND = -1;
+
+public:
+  CostModel();
+
+public:
+  /**
+   * @brief Load calibrated constants, which override the defaults of the backends in the file
+   *
+   * Each backend id maps to an object with "gflops", "quant_gops", "gbytes_per_sec",
+   * "transfer_gbytes_per_sec", "overhead_us" and optionally "ops", the list of supported
+   * operations. Missing entries keep the defaults.
+   *
+   * @param[in] filepath Path of the calibration file in JSON
+   */
+  void load(const std::string &filepath);
+  /**
+   * @brief Check whether the model has constants of a backend
+   */
+  bool knows(const backend::Backend *backend) const;
+  /**
+   * @brief Check whether an operation is assumed to be supported on a backend
+   */
+  bool isSupported(const backend::Backend *backend, const ir::Graph &graph,
+                   const ir::Operation &node) const;
+  /**
+   * @brief Estimate execution time of an operation on a backend
+   *
+   * @return Estimated time in microseconds, or NOT_FOUND if the backend is unknown
+   */
+  int64_t getOperationTime(const backend::Backend *backend, const ir::Graph &graph,
+                           const ir::Operation &node) const;
+  /**
+   * @brief Estimate time of permuting data between two backends
+   *
+   * @param[in] size Sum of sizes of the input and output in bytes
+   * @return Estimated time in microseconds, or NOT_FOUND if one of the backends is unknown
+   */
+  int64_t getPermuteTime(const backend::Backend *src_backend, const backend::Backend *dst_backend,
+                         uint32_t size) const;
+
+public:
+  /**
+   * @brief Count floating point (or integer for quantized) operations of an operation
+   */
+  static uint64_t countFlops(const ir::Graph &graph, const ir::Operation &node);
+  /**
+   * @brief Count bytes of all inputs and outputs of an operation
+   */
+  static uint64_t countBytes(const ir::Graph &graph, const ir::Operation &node);
+
+private:
+  std::unordered_map<std::string, Coefficients> _coefficients;
+  // Supported operations of backends, and backends without an entry like cpu support all
+  std::unordered_map<std::string, std::unordered_set<ir::OpCode>> _supported_ops;
+};
+
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_COST_MODEL_H__
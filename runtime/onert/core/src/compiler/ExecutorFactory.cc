@@ -205,6 +205,30 @@ backend::BackendContexts createBackendContexts(const compiler::LoweredGraph &lgr
   return contexts;
 }
 
+std::unique_ptr<exec::IExecutionObserver>
+createTracingObserver(const compiler::CompilerOptions &options, const ir::Graph &graph)
+{
+  if (options.trace_ring_buffer_size > 0)
+  {
+    return std::make_unique<exec::RingTracingObserver>(
+      options.trace_filepath, graph, options.tracing_ctx, options.trace_ring_buffer_size,
+      options.trace_sampling_period);
+  }
+  return std::make_unique<exec::TracingObserver>(options.trace_filepath, graph,
+                                                 options.tracing_ctx);
+}
+
+void addOnlineProfileObserver(exec::ExecutorBase *exec, const compiler::CompilerOptions &options)
+{
+  // Profiling mode measures with synchronization by itself
+  if (options.he_online_period <= 0 || options.he_profiling_mode)
+    return;
+
+  assert(options.exec_time);
+  exec->addObserver(std::make_unique<exec::OnlineProfileObserver>(
+    options.exec_time, exec->graph(), options.he_online_period));
+}
+
 } // namespace
 } // namespace onert
 
@@ -338,11 +362,11 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
     std::move(lowered_graph), std::move(backend_contexts), tensor_regs, std::move(code_map), order,
     options.tracing_ctx};
 
+  addOnlineProfileObserver(exec, options);
+
   if (!options.trace_filepath.empty())
   {
-    std::unique_ptr<exec::IExecutionObserver> ctp = std::make_unique<exec::TracingObserver>(
-      options.trace_filepath, exec->graph(), options.tracing_ctx);
-    exec->addObserver(std::move(ctp));
+    exec->addObserver(createTracingObserver(options, exec->graph()));
   }
 
   return exec;
@@ -428,24 +452,19 @@ exec::IExecutor *ExecutorFactory::createDataflowExecutor(
                                  std::move(code_map), options.tracing_ctx};
     if (options.he_profiling_mode)
     {
-      std::vector<const backend::Backend *> backends;
-      for (const auto &pair : backend_contexts)
-      {
-        backends.push_back(pair.first);
-      }
-      auto et = std::make_shared<exec::ExecTime>(backends);
+      assert(options.exec_time);
       std::unique_ptr<exec::IExecutionObserver> obs =
-        std::make_unique<exec::ProfileObserver>(et, dataflow_exec->graph());
+        std::make_unique<exec::ProfileObserver>(options.exec_time, dataflow_exec->graph());
       dataflow_exec->addObserver(std::move(obs));
     }
     exec = dataflow_exec;
   }
 
+  addOnlineProfileObserver(exec, options);
+
   if (!options.trace_filepath.empty())
   {
-    std::unique_ptr<exec::IExecutionObserver> ctp = std::make_unique<exec::TracingObserver>(
-      options.trace_filepath, exec->graph(), options.tracing_ctx);
-    exec->addObserver(std::move(ctp));
+    exec->addObserver(createTracingObserver(options, exec->graph()));
   }
 
   return exec;
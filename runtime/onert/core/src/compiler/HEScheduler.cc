@@ -237,14 +237,78 @@ std::unique_ptr<compiler::BackendResolver> HEScheduler::schedule(const ir::Graph
   return std::move(_backend_resolver);
 }
 
-int64_t HEScheduler::getOpTime(const backend::Backend *backend, const std::string &operation,
+int64_t HEScheduler::makespan() const
+{
+  // Without parallel executor, EFT of an operation is just its exec time and data transfer cost
+  int64_t makespan = 0;
+  for (const auto &it : _ops_eft)
+  {
+    makespan = _is_parallel_exec ? std::max(makespan, it.second) : makespan + it.second;
+  }
+  return makespan;
+}
+
+int64_t HEScheduler::predictMakespan(const ir::Graph &graph,
+                                     const BackendResolver &backend_resolver)
+{
+  _graph = &graph;
+  makeRank();
+
+  for (const auto *backend : _all_backends)
+  {
+    _backends_avail_time.emplace(backend, std::map<int64_t, int64_t>{{0, 0}});
+  }
+
+  // Calculate EFT like schedule(), but on the given backends
+  for (const auto &index : graph.topolSortOperations())
+  {
+    const auto *backend = backend_resolver.getBackend(index);
+    if (_backends_avail_time.find(backend) == _backends_avail_time.end())
+    {
+      throw std::runtime_error{"HEScheduler: Cannot predict makespan on backend " +
+                               backend->config()->id()};
+    }
+
+    std::multimap<int64_t, int64_t> transfer_st_exec_time;
+    const auto est_and_et = ESTAndExecTime(backend, index, transfer_st_exec_time);
+    for (const auto &it : transfer_st_exec_time)
+    {
+      auto prev_op_ft = backendAvailableTime(_cpu_backend, it.first, it.second);
+      _backends_avail_time[_cpu_backend].insert({prev_op_ft + it.second, prev_op_ft});
+    }
+
+    const auto eft = est_and_et.first + est_and_et.second;
+    _ops_eft[index] = eft;
+    _backends_avail_time[backend].emplace(eft, est_and_et.first);
+    _backend_resolver->setBackend(index, backend);
+  }
+
+  return makespan();
+}
+
+int64_t HEScheduler::getOpTime(const backend::Backend *backend, const ir::Operation &node,
                                bool quant, uint32_t size)
 {
-  const auto time = _exec_time->getOperationExecTime(backend, operation, quant, size);
+  const auto time = _exec_time->getOperationExecTime(backend, node.name(), quant, size);
   if (time != _exec_time->NOT_FOUND)
     return time;
 
-  return _is_supported.at(backend).at(operation) ? 1 : _exec_time->getMax();
+  const auto estimated_time = estimateOpTime(backend, node);
+  if (estimated_time != _exec_time->NOT_FOUND)
+    return estimated_time;
+
+  return _is_supported.at(backend).at(node.name()) ? 1 : _exec_time->getMax();
+}
+
+int64_t HEScheduler::estimateOpTime(const backend::Backend *backend, const ir::Operation &node)
+{
+  if (!_cost_model || !_cost_model->knows(backend))
+    return _exec_time->NOT_FOUND;
+
+  if (!_cost_model->isSupported(backend, *_graph, node))
+    return _exec_time->getMax();
+
+  return _cost_model->getOperationTime(backend, *_graph, node);
 }
 
 int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
@@ -256,6 +320,13 @@ int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
   if (time != _exec_time->NOT_FOUND)
     return time;
 
+  if (_cost_model)
+  {
+    const auto estimated_time = _cost_model->getPermuteTime(src_backend, dst_backend, size);
+    if (estimated_time != CostModel::NOT_FOUND)
+      return estimated_time;
+  }
+
   // FIXME permute time is not recorded so the control reaches here always
   // Makes the scheduler prefer keeping computations on one backend
   return size / 400;
@@ -263,6 +334,11 @@ int64_t HEScheduler::getPermuteTime(const backend::Backend *src_backend,
 
 int64_t HEScheduler::tryBackend(const ir::Operation &node, const backend::Backend *backend)
 {
+  // The cost model gives an estimation instead of profiling info
+  const auto estimated_time = estimateOpTime(backend, node);
+  if (estimated_time != _exec_time->NOT_FOUND)
+    return estimated_time;
+
   // if there is no profiling info don't use this backend during scheduling
   if (!_is_profiling_mode)
   {
@@ -352,7 +428,7 @@ int64_t HEScheduler::DFSMaxRank(const ir::OperationIndex &index)
   int64_t std = 0;
   for (const auto backend : _all_backends)
   {
-    const auto exec_time = getOpTime(backend, node.name(), quant, size);
+    const auto exec_time = getOpTime(backend, node, quant, size);
     if (exec_time < _exec_time->getMax())
     {
       std += (exec_time - rank) * (exec_time - rank);
@@ -501,7 +577,7 @@ HEScheduler::ESTAndExecTime(const backend::Backend *backend, const ir::Operation
     return {_exec_time->getMax(), _exec_time->getMax()};
   }
   // get average exec time of the op on this backend
-  auto exec_time = getOpTime(backend, node.name(), quant, size);
+  auto exec_time = getOpTime(backend, node, quant, size);
   if (backend->config()->id() == "cpu" && _is_parallel_exec)
   {
     exec_time *= CPU_DELAY;
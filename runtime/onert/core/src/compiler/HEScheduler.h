@@ -26,6 +26,7 @@
 #include "compiler/IScheduler.h"
 #include "compiler/BackendManager.h"
 #include "compiler/Compiler.h"
+#include "compiler/CostModel.h"
 #include "ir/Graph.h"
 #include "exec/ExecTime.h"
 #include "backend/Backend.h"
@@ -63,7 +64,9 @@ public:
       _all_backends.push_back(entry);
     }
     _backend_resolver = std::make_unique<compiler::BackendResolver>();
-    _exec_time = std::make_unique<exec::ExecTime>(_all_backends);
+    // Online scheduling measures into ExecTime of the compiler, which is not stored yet
+    _exec_time = options.exec_time ? options.exec_time
+                                   : std::make_shared<exec::ExecTime>(_all_backends);
 
     // Find cpu backend
     auto cpu_backend_it =
@@ -73,6 +76,14 @@ public:
     if (cpu_backend_it == _all_backends.end())
       throw std::runtime_error("HEScheduler could be used only if 'cpu' backend is available");
     _cpu_backend = *cpu_backend_it;
+
+    // Profiling mode needs to run unmeasured backends rather than to estimate them
+    if (options.he_cost_model && !_is_profiling_mode)
+    {
+      _cost_model = std::make_unique<CostModel>();
+      if (!options.he_cost_model_filepath.empty())
+        _cost_model->load(options.he_cost_model_filepath);
+    }
   }
 
 public:
@@ -84,6 +95,18 @@ public:
    */
   std::unique_ptr<compiler::BackendResolver> schedule(const ir::Graph &graph) final;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> getIndexedRanks() { return _op_to_rank; }
+  /**
+   * @brief   Get the predicted makespan of the last schedule
+   */
+  int64_t makespan() const;
+  /**
+   * @brief   Predict the makespan of given backend assignment with the measured execution time
+   *
+   * @param[in] graph Graph to predict
+   * @param[in] backend_resolver Backend assignment of all operations of the graph
+   * @return  Predicted makespan in microseconds
+   */
+  int64_t predictMakespan(const ir::Graph &graph, const BackendResolver &backend_resolver);
 
 private:
   bool isNodeProfiled(const ir::Operation &);
@@ -136,8 +159,15 @@ private:
   int64_t backendAvailableTime(const backend::Backend *backend, const int64_t &starting_time,
                                const int64_t &time_amount);
 
-  int64_t getOpTime(const backend::Backend *backend, const std::string &operation, bool quant,
+  int64_t getOpTime(const backend::Backend *backend, const ir::Operation &node, bool quant,
                     uint32_t size);
+  /**
+   * @brief   Estimate execution time of an operation by the cost model
+   *
+   * @return  Estimated time, ExecTime::getMax() if it is unsupported,
+   *          or ExecTime::NOT_FOUND if there is no estimation
+   */
+  int64_t estimateOpTime(const backend::Backend *backend, const ir::Operation &node);
 
   int64_t getPermuteTime(const backend::Backend *src_backend, const backend::Backend *dst_backend,
                          bool quant, uint32_t size);
@@ -170,7 +200,8 @@ private:
   std::multimap<int64_t, ir::OperationIndex, std::greater<int64_t>> _rank_to_op;
   std::shared_ptr<ir::OperationIndexMap<int64_t>> _op_to_rank;
   std::unique_ptr<compiler::BackendResolver> _backend_resolver;
-  std::unique_ptr<exec::ExecTime> _exec_time;
+  std::shared_ptr<exec::ExecTime> _exec_time;
+  std::unique_ptr<CostModel> _cost_model;
   const ir::Graph *_graph{nullptr};
   std::vector<const backend::Backend *> _all_backends;
   const backend::Backend *_cpu_backend{nullptr}; // TODO Change this to _builtin_backend
@@ -326,6 +326,25 @@ void StaticShapeInferer::visit(const ir::operation::ElementwiseUnary &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ElementwiseUnary::Input::INPUT));
 }
 
+void StaticShapeInferer::visit(const ir::operation::EmbeddingLookup &op)
+{
+  const auto lookups_idx{op.getInputs().at(ir::operation::EmbeddingLookup::Input::LOOKUPS)};
+  const auto &lookups = _operands.at(lookups_idx);
+
+  const auto values_idx{op.getInputs().at(ir::operation::EmbeddingLookup::Input::VALUES)};
+  const auto &values = _operands.at(values_idx);
+
+  // get mutable output operand
+  const auto output_idx = op.getOutputs().at(0);
+  ir::Operand &output = _operands.at(output_idx);
+
+  // EmbeddingLookup is Gather of values at axis 0
+  const auto rank = values.info().shape().rank();
+  ir::Shape new_shape =
+    shape_inference::inferGatherShape(values.info().shape(), lookups.info().shape(), 0, rank);
+  output.info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::ExpandDims &op)
 {
   const auto input_idx{op.getInputs().at(ir::operation::ExpandDims::Input::INPUT)};
@@ -16,8 +16,10 @@
 
 #include "DataflowExecutor.h"
 
+#include <algorithm>
 #include <cassert>
 
+#include "ir/OperationIndexMap.h"
 #include "util/logging.h"
 
 namespace onert
@@ -50,12 +52,45 @@ int64_t DataflowExecutor::calculateRank(const std::vector<ir::OperationIndex> &o
   return rank;
 }
 
+namespace
+{
+
+// The highest rank comes first, and the earlier ready job comes first among the same rank
+struct ReadyJobLess
+{
+  template <typename T> bool operator()(const T &lhs, const T &rhs) const
+  {
+    return lhs.rank < rhs.rank || (lhs.rank == rhs.rank && lhs.order > rhs.order);
+  }
+};
+
+} // namespace
+
 void DataflowExecutor::emplaceToReadyJobs(const uint32_t &id)
 {
   auto &job = _waiting_jobs[id];
   assert(job != nullptr);
   auto rank = calculateRank({_job_to_op[job->index()]});
-  _ready_jobs.emplace(rank, std::move(job));
+  _ready_jobs.push_back(ReadyJob{rank, _next_ready_order++, std::move(job)});
+  std::push_heap(_ready_jobs.begin(), _ready_jobs.end(), ReadyJobLess{});
+  assert(_num_waiting_jobs > 0);
+  --_num_waiting_jobs;
+}
+
+std::unique_ptr<Job> DataflowExecutor::popReadyJob()
+{
+  assert(!_ready_jobs.empty());
+  std::pop_heap(_ready_jobs.begin(), _ready_jobs.end(), ReadyJobLess{});
+  auto job = std::move(_ready_jobs.back().job);
+  _ready_jobs.pop_back();
+  return job;
+}
+
+void DataflowExecutor::moveFinishedJobsToWaitingJobs()
+{
+  _waiting_jobs.swap(_finished_jobs);
+  _num_waiting_jobs = _waiting_jobs.size();
+  _next_ready_order = 0;
 }
 
 void DataflowExecutor::notify(uint32_t finished_job_id)
@@ -70,11 +105,8 @@ void DataflowExecutor::notify(uint32_t finished_job_id)
     }
   }
 }
-bool DataflowExecutor::noWaitingJobs()
-{
-  return std::all_of(_waiting_jobs.begin(), _waiting_jobs.end(),
-                     [](const std::unique_ptr<Job> &job) { return job == nullptr; });
-}
+
+bool DataflowExecutor::noWaitingJobs() { return _num_waiting_jobs == 0; }
 
 DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                                    backend::BackendContexts &&backend_contexts,
@@ -88,37 +120,39 @@ DataflowExecutor::DataflowExecutor(std::unique_ptr<compiler::LoweredGraph> lower
 
   // Assign jobs convert OperationIndex to job index(uint32_t)
   uint32_t next_job_index = 0;
-  std::unordered_map<ir::OperationIndex, uint32_t> op_to_job;
+  ir::OperationIndexMap<uint32_t> op_to_job;
   const auto &operations = _lowered_graph->graph().operations();
+  const auto &operands = _lowered_graph->graph().operands();
+  op_to_job.reserve(operations.size());
+  _finished_jobs.reserve(operations.size());
+  _job_to_op.reserve(operations.size());
   operations.iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &) {
     VERBOSE(DataflowExecutor) << "Create a job " << next_job_index << " with Operation " << op_ind
                               << std::endl;
     _finished_jobs.emplace_back(
       std::make_unique<Job>(next_job_index, _code_map.at(op_ind).fn_seq.get()));
+    _job_to_op.emplace_back(op_ind);
     op_to_job[op_ind] = next_job_index++;
   });
 
   _waiting_jobs.resize(next_job_index);
+  _ready_jobs.reserve(next_job_index);
   _output_info.resize(next_job_index);
   _initial_input_info.resize(next_job_index, 0);
 
+  // Update output and input info from the uses of each output
   operations.iterate([&](const ir::OperationIndex &op_ind, const ir::Operation &op) {
-    auto job_index = op_to_job[op_ind];
-    for (auto output : op.getOutputs())
+    auto job_index = op_to_job.at(op_ind);
+    for (auto output : op.getOutputs() | ir::Remove::UNDEFINED)
     {
-      // Update output and input info
-      operations.iterate([&](const ir::OperationIndex &op_cur_ind, const ir::Operation &op_cur) {
-        if (op_cur.getInputs().contains(output))
-        {
-          auto dep_index = op_to_job[op_cur_ind];
-          ++_initial_input_info[dep_index];
-          _output_info[job_index].push_back(dep_index);
-        }
-      });
+      for (const auto &use : operands.at(output).getUses())
+      {
+        auto dep_index = op_to_job.at(use);
+        ++_initial_input_info[dep_index];
+        _output_info[job_index].push_back(dep_index);
+      }
     }
   });
-  for (const auto &s : op_to_job)
-    _job_to_op.emplace(s.second, s.first);
 
   _input_info = _initial_input_info;
 }
@@ -130,7 +164,7 @@ void DataflowExecutor::executeImpl()
   bool dynamic_input_exists = hasDynamicInput();
 
   // Execution setup
-  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+  moveFinishedJobsToWaitingJobs();
 
   for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
   {
@@ -147,8 +181,7 @@ void DataflowExecutor::executeImpl()
 
   while (!_ready_jobs.empty())
   {
-    auto job = std::move((_ready_jobs.begin())->second);
-    _ready_jobs.erase(_ready_jobs.begin());
+    auto job = popReadyJob();
     auto job_index = job->index();
     VERBOSE(DataflowExecutor) << "Run job " << job_index << std::endl;
 
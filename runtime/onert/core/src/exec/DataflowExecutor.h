@@ -18,8 +18,7 @@
 #define __ONERT_EXEC_DATAFLOW_EXECUTOR_H__
 
 #include <list>
-#include <map>
-#include <unordered_map>
+#include <vector>
 
 #include "exec/FunctionSequence.h"
 #include "Job.h"
@@ -60,6 +59,17 @@ public:
 protected:
   int64_t calculateRank(const std::vector<ir::OperationIndex> &operations);
   void emplaceToReadyJobs(const uint32_t &id);
+  std::unique_ptr<Job> popReadyJob();
+  void moveFinishedJobsToWaitingJobs();
+
+private:
+  struct ReadyJob
+  {
+    int64_t rank;
+    // Jobs of the same rank are popped in the order they get ready
+    uint32_t order;
+    std::unique_ptr<Job> job;
+  };
 
 protected:
   compiler::CodeMap _code_map;
@@ -73,6 +83,10 @@ protected:
    *        All the jobs are moved from #_finished_jobs to it when start a run
    */
   std::vector<std::unique_ptr<Job>> _waiting_jobs;
+  /**
+   * @brief The number of jobs in #_waiting_jobs, which are not ready yet
+   */
+  uint32_t _num_waiting_jobs{0};
   /**
    * @brief Jobs' output info
    *        Used for notifying after finishing a job
@@ -83,12 +97,14 @@ protected:
   /**
    * @brief A collection of jobs that are ready for execution
    *        Jobs in it are ready to be scheduled.
-   *        Ordered by priority from `_indexed_ranks`
+   *        It is a binary heap ordered by priority from `_indexed_ranks`, whose storage is
+   *        reserved for all the jobs at construction
    */
-  std::multimap<int64_t, std::unique_ptr<Job>, std::greater<int64_t>> _ready_jobs;
+  std::vector<ReadyJob> _ready_jobs;
+  uint32_t _next_ready_order{0};
 
-  /// @brief Which job runs which op and function.
-  std::unordered_map<uint32_t, ir::OperationIndex> _job_to_op;
+  /// @brief Which job runs which op and function. Indexed by job index.
+  std::vector<ir::OperationIndex> _job_to_op;
 };
 
 } // namespace exec
@@ -355,6 +355,30 @@ void DynamicShapeInferer::visit(const ir::operation::ElementwiseUnary &op)
   handleSimpleUnaryOp(op, op.getInputs().at(ir::operation::ElementwiseUnary::Input::INPUT));
 }
 
+void DynamicShapeInferer::visit(const ir::operation::EmbeddingLookup &op)
+{
+  const auto lookups_idx{op.getInputs().at(ir::operation::EmbeddingLookup::Input::LOOKUPS)};
+  const auto &lookups = _tensor_registry->getITensor(lookups_idx);
+  auto lookups_shape = lookups->getShape();
+
+  const auto values_idx{op.getInputs().at(ir::operation::EmbeddingLookup::Input::VALUES)};
+  const auto &values = _tensor_registry->getITensor(values_idx);
+  auto values_shape = values->getShape();
+
+  if (!(lookups->is_dynamic()) && !(values->is_dynamic()))
+    return;
+
+  // EmbeddingLookup is Gather of values at axis 0
+  ir::Shape new_shape =
+    shape_inference::inferGatherShape(values_shape, lookups_shape, 0, values_shape.rank());
+
+  auto output_ind = op.getOutputs().at(0);
+  auto output = _tensor_registry->getITensor(output_ind);
+
+  output->applyShape(new_shape);
+  assert(output->buffer() != nullptr);
+}
+
 void DynamicShapeInferer::visit(const ir::operation::ExpandDims &op)
 {
   // check if input is not dynamic
@@ -32,6 +32,18 @@ Execution::Execution(const std::shared_ptr<ExecutorMap> &executors) : _executors
   _io_desc.outputs.resize(primary_subg.getOutputs().size());
 }
 
+void Execution::changeExecutors(const std::shared_ptr<ExecutorMap> &executors)
+{
+  assert(executors != nullptr);
+  assert(executors->at(ir::SubgraphIndex{0}) != nullptr);
+  if (_exec_thread != nullptr && _exec_thread->joinable())
+    throw std::runtime_error{"Execution: cannot change executors while executing"};
+
+  _executors = executors;
+  assert(primary_subgraph().getInputs().size() == _io_desc.inputs.size());
+  assert(primary_subgraph().getOutputs().size() == _io_desc.outputs.size());
+}
+
 void Execution::changeInputShape(const ir::IOIndex &index, const ir::Shape &new_shape)
 {
   // This will be used later to set input tensor dynamic
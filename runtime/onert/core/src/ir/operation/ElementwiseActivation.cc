@@ -60,6 +60,7 @@ std::string ElementwiseActivation::name() const
   using ElementwiseActivationType = onert::ir::operation::ElementwiseActivation::Type;
   static const std::unordered_map<Type, std::string> name_map{
     {ElementwiseActivationType::ELU, "ELU"},
+    {ElementwiseActivationType::HARD_SWISH, "HardSwish"},
     {ElementwiseActivationType::LOGISTIC, "Logistic"},
     {ElementwiseActivationType::RELU, "ReLU"},
     {ElementwiseActivationType::TANH, "Tanh"},
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_UTIL_TRACE_RING_BUFFER_H__
+#define __ONERT_UTIL_TRACE_RING_BUFFER_H__
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Monotonic timestamp in nanoseconds for trace records
+ */
+inline uint64_t traceTimestampNs()
+{
+  auto now = std::chrono::steady_clock::now();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
+}
+
+/**
+ * @brief Fixed-size ring buffers of binary trace records, one per thread
+ *
+ * Each thread writes its own ring without any lock, and the oldest records are overwritten when
+ * a ring is full. A lock is taken only when a thread writes for the first time. Records must be
+ * read by iterate() only when no thread writes anymore, e.g. when a session is finished.
+ */
+template <typename Record> class TraceRingBuffer
+{
+public:
+  class Ring
+  {
+  public:
+    explicit Ring(size_t capacity) : _records(capacity) { _open_ts.reserve(kInitialDepth); }
+
+  public:
+    /**
+     * @brief Begin a scope, whose begin timestamp is kept until endScope()
+     */
+    void beginScope() { _open_ts.push_back(traceTimestampNs()); }
+    /**
+     * @brief End the innermost scope and return its begin timestamp
+     */
+    uint64_t endScope()
+    {
+      assert(!_open_ts.empty());
+      auto ts = _open_ts.back();
+      _open_ts.pop_back();
+      return ts;
+    }
+    void push(const Record &record)
+    {
+      const auto count = _count.load(std::memory_order_relaxed);
+      _records[count % _records.size()] = record;
+      _count.store(count + 1, std::memory_order_release);
+    }
+    template <typename Func> void iterate(Func &&fn) const
+    {
+      const auto count = _count.load(std::memory_order_acquire);
+      const auto size = std::min<uint64_t>(count, _records.size());
+      for (uint64_t i = count - size; i < count; ++i)
+        fn(_records[i % _records.size()]);
+    }
+
+  private:
+    static constexpr size_t kInitialDepth = 16;
+
+    std::vector<Record> _records;
+    std::atomic<uint64_t> _count{0};
+    std::vector<uint64_t> _open_ts;
+  };
+
+public:
+  explicit TraceRingBuffer(size_t capacity) : _id{nextId()}, _capacity{capacity}
+  {
+    assert(capacity > 0);
+  }
+
+public:
+  /**
+   * @brief Get the ring of the calling thread
+   */
+  Ring &local()
+  {
+    // Threads cache their rings of the recent buffers, so the lock is rarely taken
+    thread_local std::vector<std::pair<uint64_t, Ring *>> cache;
+    for (const auto &entry : cache)
+    {
+      if (entry.first == _id)
+        return *entry.second;
+    }
+
+    Ring *ring = nullptr;
+    {
+      std::lock_guard<std::mutex> lock{_mutex};
+      auto &slot = _rings[std::this_thread::get_id()];
+      if (slot == nullptr)
+        slot = std::make_unique<Ring>(_capacity);
+      ring = slot.get();
+    }
+
+    if (cache.size() >= kCacheSize)
+      cache.erase(cache.begin());
+    cache.emplace_back(_id, ring);
+    return *ring;
+  }
+
+  /**
+   * @brief Iterate all the records of all threads, from the oldest one of each thread
+   */
+  template <typename Func> void iterate(Func &&fn) const
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    for (const auto &it : _rings)
+      it.second->iterate(fn);
+  }
+
+private:
+  static uint64_t nextId()
+  {
+    static std::atomic<uint64_t> id{0};
+    return id++;
+  }
+
+private:
+  static constexpr size_t kCacheSize = 8;
+
+  // Unique among all buffers, unlike the address which can be reused after destruction
+  const uint64_t _id;
+  const size_t _capacity;
+  mutable std::mutex _mutex;
+  std::unordered_map<std::thread::id, std::unique_ptr<Ring>> _rings;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_TRACE_RING_BUFFER_H__
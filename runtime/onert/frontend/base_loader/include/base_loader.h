@@ -28,6 +28,7 @@
 #include <memory>
 #include <fstream>
 #include <limits>
+#include <unordered_set>
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/mman.h>
@@ -90,6 +91,8 @@ public:
 protected:
   ~BaseLoader() = default;
   void loadModel();
+  // Find constant tables of lookup operations, which are left in the mmap'd model file
+  void findEmbeddingTables();
 
   // Helper functions
   ir::Activation convertActivation(ActivationFunctionType type);
@@ -186,6 +189,8 @@ protected:
   std::unique_ptr<Verifier> _verifier;
   // Boolean flag to use MMAPED_DATA
   bool _use_mmaped_data = false;
+  // Buffers of embedding tables, which use MMAPED_DATA regardless of the flag
+  std::unordered_set<uint32_t> _mmaped_buffers;
 };
 
 template <typename LoaderDomain>
@@ -354,7 +359,7 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
       ptrdiff_t aligned_offset_start = (unaligned_offset_start / _pagesize) * _pagesize;
       size_t mmap_size = offset_end - aligned_offset_start;
 
-      if (_use_mmaped_data)
+      if (_use_mmaped_data || _mmaped_buffers.count(tensor->buffer()) > 0)
       {
         data_obj = std::make_unique<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
                                                     unaligned_offset_start, data_size);
@@ -636,6 +641,10 @@ void BaseLoader<LoaderDomain>::loadTransposeConv(const Operator *op, ir::Graph &
   const auto *options = op->builtin_options_as_TransposeConvOptions();
   loadStridesAndPaddings(param, options);
 
+  // The optional 4th input of TRANSPOSE_CONV is bias, which no backend adds
+  if (op->inputs()->size() > 3)
+    throw std::runtime_error("TransposeConv: bias input is not supported");
+
   loadOperationTo<ir::operation::TransposeConv>(op, subg, param);
 }
 
@@ -1374,6 +1383,9 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_ELU:
       loadElementwiseActivation(op, subg, ir::operation::ElementwiseActivation::Type::ELU);
       return;
+    case BuiltinOperator::BuiltinOperator_HARD_SWISH:
+      loadElementwiseActivation(op, subg, ir::operation::ElementwiseActivation::Type::HARD_SWISH);
+      return;
     case BuiltinOperator::BuiltinOperator_RELU:
       loadElementwiseActivation(op, subg, ir::operation::ElementwiseActivation::Type::RELU,
                                 ir::operation::ElementwiseActivation::infinity, 0.f);
@@ -1443,6 +1455,9 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
     case BuiltinOperator::BuiltinOperator_GATHER:
       loadGather(op, subg);
       return;
+    case BuiltinOperator::BuiltinOperator_EMBEDDING_LOOKUP:
+      loadOperationTo<ir::operation::EmbeddingLookup>(op, subg);
+      return;
     case BuiltinOperator::BuiltinOperator_SPACE_TO_BATCH_ND:
       loadOperationTo<ir::operation::SpaceToBatchND>(op, subg);
       return;
@@ -1594,6 +1609,38 @@ void BaseLoader<LoaderDomain>::loadOperation(const Operator *op, ir::Graph &subg
   }
 }
 
+template <typename LoaderDomain> void BaseLoader<LoaderDomain>::findEmbeddingTables()
+{
+  // Embedding tables are large while only a few rows are read in a run, so copying them into
+  // CachedData would touch every page of them for nothing
+  constexpr size_t kMinTableSize = 1 << 20;
+
+  for (const auto *subgraph : *_model->subgraphs())
+  {
+    for (const auto *op : *subgraph->operators())
+    {
+      const auto builtin_op = _model->operator_codes()->Get(op->opcode_index())->builtin_code();
+      int32_t table_input;
+      if (builtin_op == BuiltinOperator::BuiltinOperator_GATHER)
+        table_input = 0;
+      else if (builtin_op == BuiltinOperator::BuiltinOperator_EMBEDDING_LOOKUP)
+        table_input = 1;
+      else
+        continue;
+
+      if (op->inputs()->size() <= static_cast<uint32_t>(table_input))
+        continue;
+      const auto tensor_index = op->inputs()->Get(table_input);
+      if (isOptionalInputTensor(tensor_index))
+        continue;
+      const auto buffer_index = subgraph->tensors()->Get(tensor_index)->buffer();
+      const auto *data = _model->buffers()->Get(buffer_index)->data();
+      if (data != nullptr && data->size() >= kMinTableSize)
+        _mmaped_buffers.insert(buffer_index);
+    }
+  }
+}
+
 template <typename LoaderDomain> void BaseLoader<LoaderDomain>::loadModel()
 {
   LoaderDomain::VerifyModelBuffer(*_verifier.get());
@@ -1604,6 +1651,8 @@ template <typename LoaderDomain> void BaseLoader<LoaderDomain>::loadModel()
   // const auto *description = _model->description();
   // Metabuffer unsued
   // const auto *metadata_buffer = _model->metadata_buffer();
+  if (_fd != -1)
+    findEmbeddingTables();
   // Load subgraphs and map operations on subgraph
   const auto domain_subgraphs = _model->subgraphs();
   auto subgraphs = std::make_unique<ir::Subgraphs>();
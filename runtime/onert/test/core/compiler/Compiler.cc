@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "compiler/BackendManager.h"
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "exec/ExecTime.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "util/TracingCtx.h"
+
+namespace
+{
+
+using namespace onert::ir;
+
+// in1 + in2
+std::shared_ptr<Subgraphs> createAddModel()
+{
+  auto graph = std::make_shared<Graph>();
+  Shape shape{1, 2, 2, 1};
+  TypeInfo type{DataType::FLOAT32};
+  auto lhs = graph->addOperand(shape, type);
+  auto rhs = graph->addOperand(shape, type);
+  auto result = graph->addOperand(shape, type);
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = operation::BinaryArithmetic::ArithmeticType::ADD;
+  param.activation = Activation::NONE;
+  graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{result}, param));
+  graph->addInput(lhs);
+  graph->addInput(rhs);
+  graph->addOutput(result);
+  graph->verify();
+
+  auto subgs = std::make_shared<Subgraphs>();
+  subgs->push(SubgraphIndex{0}, graph);
+  return subgs;
+}
+
+} // namespace
+
+TEST(Compiler, neg_trace_ring_buffer_size)
+{
+  auto subgs = createAddModel();
+  onert::util::TracingCtx tracing_ctx{subgs.get()};
+  onert::compiler::Compiler compiler{subgs, &tracing_ctx};
+  compiler.options().trace_ring_buffer_size = -1;
+  EXPECT_THROW(compiler.compile(), std::runtime_error);
+}
+
+TEST(Compiler, neg_trace_sampling_period)
+{
+  for (int period : {0, -3})
+  {
+    auto subgs = createAddModel();
+    onert::util::TracingCtx tracing_ctx{subgs.get()};
+    onert::compiler::Compiler compiler{subgs, &tracing_ctx};
+    compiler.options().trace_sampling_period = period;
+    EXPECT_THROW(compiler.compile(), std::runtime_error);
+  }
+}
+
+TEST(Compiler, reschedule_disabled)
+{
+  auto subgs = createAddModel();
+  onert::util::TracingCtx tracing_ctx{subgs.get()};
+  onert::compiler::Compiler compiler{subgs, &tracing_ctx};
+  compiler.options().he_online_period = 0;
+  compiler.compile();
+  for (int i = 0; i < 3; ++i)
+    EXPECT_EQ(compiler.reschedule(), nullptr);
+  EXPECT_EQ(compiler.options().exec_time, nullptr);
+}
+
+TEST(Compiler, reschedule_not_compiled)
+{
+  auto subgs = createAddModel();
+  onert::util::TracingCtx tracing_ctx{subgs.get()};
+  onert::compiler::Compiler compiler{subgs, &tracing_ctx};
+  compiler.options().he_online_period = 1;
+  EXPECT_EQ(compiler.reschedule(), nullptr);
+}
+
+TEST(Compiler, reschedule_online)
+{
+  remove("exec_time.json");
+
+  auto subgs = createAddModel();
+  onert::util::TracingCtx tracing_ctx{subgs.get()};
+  onert::compiler::Compiler compiler{subgs, &tracing_ctx};
+  compiler.options().he_online_period = 2;
+  auto executors = compiler.compile();
+  const auto exec_time = compiler.options().exec_time;
+  ASSERT_NE(exec_time, nullptr);
+
+  const float input[4] = {1, 2, 3, 4};
+  float output[4] = {};
+  for (int i = 0; i < 2; ++i)
+  {
+    onert::exec::Execution execution{executors};
+    execution.setInput(IOIndex{0}, input, 16);
+    execution.setInput(IOIndex{1}, input, 16);
+    execution.setOutput(IOIndex{0}, output, 16);
+    execution.execute();
+    // With a single backend there is no better assignment
+    EXPECT_EQ(compiler.reschedule(), nullptr);
+  }
+
+  // Runs of the period are measured into the execution time of the compiler, in memory
+  const auto *cpu = onert::compiler::BackendManager::get().get("cpu");
+  ASSERT_NE(cpu, nullptr);
+  EXPECT_GE(exec_time->getOperationExecTime(cpu, "Add", false, 48), 1);
+  EXPECT_EQ(compiler.options().exec_time, exec_time);
+  EXPECT_NE(remove("exec_time.json"), 0);
+
+  compiler.storeExecTime();
+  {
+    onert::exec::ExecTime stored(onert::compiler::BackendManager::get().getAll());
+    EXPECT_GE(stored.getOperationExecTime(cpu, "Add", false, 48), 1);
+  }
+
+  EXPECT_EQ(remove("exec_time.json"), 0);
+}
@@ -110,6 +110,28 @@ struct MockBackendNPU : public Backend
   }
 };
 
+struct MockConfigRuy : public IConfig
+{
+  std::string id() override { return "ruy"; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  ir::Layout supportLayout(const ir::Operation &, ir::Layout) override
+  {
+    return ir::Layout::UNKNOWN;
+  }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+};
+
+struct MockBackendRuy : public Backend
+{
+  std::shared_ptr<IConfig> config() const override { return std::make_shared<MockConfigRuy>(); }
+  std::unique_ptr<BackendContext> newContext(ContextData &&data) const override
+  {
+    return std::make_unique<MockBackendContext>(this, std::move(data), nullptr);
+  }
+};
+
 //
 // Constants
 //
@@ -490,6 +512,86 @@ TEST_P(HESchedulerTestWithExecutorParam, branched_graph_known_exec_time)
   }
 }
 
+// Test makespan prediction of given backend assignments for straight graph
+TEST_P(HESchedulerTestWithExecutorParam, straight_graph_predict_makespan)
+{
+  setExecutor(GetParam());
+
+  // Prepare graph
+  ir::Subgraphs subgs;
+  auto graph(createStraightGraph());
+  subgs.push(ir::SubgraphIndex{0}, graph);
+  OperationIndex add_op_idx(0), sub_op_idx(1), mul_op_idx(2);
+
+  // Set default execution and transfer time, and reduce execution time of one node on each backend
+  setPermutationsExecutionTime(_mock_backends, OPERAND_SIZE, 1);
+  setOperationsExecutionTime(_mock_backends, {"Add", "Sub", "Mul"},
+                             {OPERATION_SIZE, OPERATION_SIZE, OPERATION_SIZE}, 1e4);
+  {
+    ExecTime et(_mock_backends);
+    setOperationExecTime(et, _cpu_backend, "Add", false, OPERATION_SIZE, 1);
+    setOperationExecTime(et, _gpu_backend, "Sub", false, OPERATION_SIZE, 1);
+    setOperationExecTime(et, _npu_backend, "Mul", false, OPERATION_SIZE, 1);
+    et.storeOperationsExecTime();
+  }
+  const auto options = compiler::fetchCompilerOptionsFromGlobalConfig(subgs);
+
+  // Expected behaviour: prediction of the scheduled assignment is the makespan of scheduling
+  auto scheduler = compiler::HEScheduler(_mock_backends, options);
+  const auto scheduled = scheduler.schedule(*graph);
+  const auto scheduled_makespan = scheduler.makespan();
+  {
+    auto predictor = compiler::HEScheduler(_mock_backends, options);
+    ASSERT_EQ(predictor.predictMakespan(*graph, *scheduled), scheduled_makespan);
+  }
+
+  // Expected behaviour: an assignment on a single backend is predicted to be slower
+  compiler::BackendResolver all_cpu;
+  all_cpu.setBackend(add_op_idx, _cpu_backend);
+  all_cpu.setBackend(sub_op_idx, _cpu_backend);
+  all_cpu.setBackend(mul_op_idx, _cpu_backend);
+  int64_t all_cpu_makespan = 0;
+  {
+    auto predictor = compiler::HEScheduler(_mock_backends, options);
+    all_cpu_makespan = predictor.predictMakespan(*graph, all_cpu);
+    ASSERT_GT(all_cpu_makespan, scheduled_makespan);
+  }
+
+  // Expected behaviour: the prediction follows execution time measured later
+  {
+    ExecTime et(_mock_backends);
+    setOperationExecTime(et, _cpu_backend, "Sub", false, OPERATION_SIZE, 1);
+    setOperationExecTime(et, _cpu_backend, "Mul", false, OPERATION_SIZE, 1);
+    et.storeOperationsExecTime();
+
+    auto predictor = compiler::HEScheduler(_mock_backends, options);
+    ASSERT_LT(predictor.predictMakespan(*graph, all_cpu), all_cpu_makespan);
+  }
+}
+
+// Test makespan prediction of an assignment on a backend which the scheduler does not know
+TEST_F(HESchedulerTest, neg_predict_makespan_unknown_backend)
+{
+  setExecutor(LINEAR);
+
+  ir::Subgraphs subgs;
+  auto graph(createStraightGraph());
+  subgs.push(ir::SubgraphIndex{0}, graph);
+  setPermutationsExecutionTime(_mock_backends, OPERAND_SIZE, 1);
+  setOperationsExecutionTime(_mock_backends, {"Add", "Sub", "Mul"},
+                             {OPERATION_SIZE, OPERATION_SIZE, OPERATION_SIZE}, 1e4);
+
+  MockBackendRuy ruy_backend;
+  compiler::BackendResolver assignment;
+  assignment.setBackend(OperationIndex{0}, _cpu_backend);
+  assignment.setBackend(OperationIndex{1}, &ruy_backend);
+  assignment.setBackend(OperationIndex{2}, _cpu_backend);
+
+  auto predictor =
+    compiler::HEScheduler(_mock_backends, compiler::fetchCompilerOptionsFromGlobalConfig(subgs));
+  ASSERT_THROW(predictor.predictMakespan(*graph, assignment), std::runtime_error);
+}
+
 // SchedulerTestWithExecutorParam tests are parameterized with executor name and runs three times -
 // one time for each executor
 INSTANTIATE_TEST_CASE_P(AllExecutors, HESchedulerTestWithExecutorParam,
@@ -568,6 +670,71 @@ TEST_F(HESchedulerTest, branched_graph_profiling_mode)
   }
 }
 
+// Test scheduler behavior with unknown execution time estimated by the cost model
+TEST_F(HESchedulerTest, straight_graph_cost_model)
+{
+  setProfilingMode(false);
+  setExecutor(LINEAR);
+
+  // Prepare graph: FC(compute-bound) -> Add
+  auto graph = std::make_shared<Graph>();
+  const TypeInfo float_op(DataType::FLOAT32);
+  auto fc_in_idx = graph->addOperand(ir::Shape{64, 1024}, float_op);
+  auto fc_weight_idx = graph->addOperand(ir::Shape{1024, 1024}, float_op);
+  auto fc_out_idx = graph->addOperand(ir::Shape{64, 1024}, float_op);
+  FullyConnected::Param fc_op_params{Activation::NONE};
+  auto fc_op_idx = graph->addOperation(std::make_unique<FullyConnected>(
+    OIS{fc_in_idx, fc_weight_idx}, OIS{fc_out_idx}, fc_op_params));
+  auto add_rhs_idx = graph->addOperand(ir::Shape{64, 1024}, float_op);
+  auto add_out_idx = graph->addOperand(ir::Shape{64, 1024}, float_op);
+  BinaryArithmetic::Param add_op_params{BinaryArithmetic::ArithmeticType::ADD, Activation::NONE};
+  auto add_op_idx = graph->addOperation(std::make_unique<BinaryArithmetic>(
+    OIS{fc_out_idx, add_rhs_idx}, OIS{add_out_idx}, add_op_params));
+  graph->verify();
+
+  ir::Subgraphs subgs;
+  subgs.push(ir::SubgraphIndex{0}, graph);
+
+  MockBackendRuy ruy_backend;
+  std::vector<const Backend *> backends{_cpu_backend, &ruy_backend};
+  // Create empty profile data
+  ExecTime{backends}.storeOperationsExecTime();
+
+  // Expected behaviour: FC goes to the faster GEMM backend, Add stays on cpu which supports it
+  {
+    auto options = compiler::fetchCompilerOptionsFromGlobalConfig(subgs);
+    options.he_cost_model = true;
+    auto scheduler = compiler::HEScheduler(backends, options);
+    const auto br = scheduler.schedule(*graph);
+    ASSERT_EQ(br->getBackend(fc_op_idx)->config()->id(), "ruy");
+    ASSERT_EQ(br->getBackend(add_op_idx)->config()->id(), "cpu");
+  }
+
+  // Expected behaviour: without the cost model, unmeasured backends are not used at all
+  {
+    auto options = compiler::fetchCompilerOptionsFromGlobalConfig(subgs);
+    options.he_cost_model = false;
+    auto scheduler = compiler::HEScheduler(backends, options);
+    ASSERT_THROW(scheduler.schedule(*graph), std::runtime_error);
+  }
+
+  // Expected behaviour: the cost model is off by default, so that the backend without
+  // measurements is not used and all nodes stay on the measured backend
+  {
+    ExecTime et(backends);
+    setOperationExecTime(et, _cpu_backend, "FullyConnected", false, calcOpSize(graph, fc_op_idx),
+                         1e4);
+    setOperationExecTime(et, _cpu_backend, "Add", false, calcOpSize(graph, add_op_idx), 1e2);
+    et.storeOperationsExecTime();
+
+    auto scheduler =
+      compiler::HEScheduler(backends, compiler::fetchCompilerOptionsFromGlobalConfig(subgs));
+    const auto br = scheduler.schedule(*graph);
+    ASSERT_EQ(br->getBackend(fc_op_idx)->config()->id(), "cpu");
+    ASSERT_EQ(br->getBackend(add_op_idx)->config()->id(), "cpu");
+  }
+}
+
 // TODO: Add tests with unknown execution and permutation time
 
 } // unnamed namespace
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "compiler/Compiler.h"
+#include "exec/Execution.h"
+#include "exec/ExecutionObservers.h"
+#include "exec/ExecutorBase.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "util/TracingCtx.h"
+
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace
+{
+
+using namespace onert::ir;
+using ArithmeticType = operation::BinaryArithmetic::ArithmeticType;
+
+// Records the operations in the order they run
+class JobOrderObserver : public onert::exec::IExecutionObserver
+{
+public:
+  explicit JobOrderObserver(std::vector<OperationIndex> &order) : _order(order) {}
+  void handleJobBegin(onert::exec::IExecutor *, SubgraphIndex, OperationIndex op_ind,
+                      const onert::backend::Backend *) override
+  {
+    _order.push_back(op_ind);
+  }
+  void handleJobEnd(onert::exec::IExecutor *, SubgraphIndex, OperationIndex,
+                    const onert::backend::Backend *) override
+  {
+  }
+
+private:
+  std::vector<OperationIndex> &_order;
+};
+
+// A graph of binary operations on two inputs, which is run by DataflowExecutor
+class DataflowModel
+{
+public:
+  DataflowModel() : graph{std::make_shared<Graph>()}
+  {
+    input1 = addOperand();
+    input2 = addOperand();
+    graph->addInput(input1);
+    graph->addInput(input2);
+  }
+
+  OperandIndex addOperand()
+  {
+    return graph->addOperand(Shape{1, 2, 2, 1}, TypeInfo{DataType::FLOAT32});
+  }
+
+  OperationIndex addOperation(ArithmeticType type, OperandIndex lhs, OperandIndex rhs,
+                              OperandIndex *output)
+  {
+    *output = addOperand();
+    operation::BinaryArithmetic::Param param;
+    param.arithmetic_type = type;
+    param.activation = Activation::NONE;
+    return graph->addOperation(std::make_unique<operation::BinaryArithmetic>(
+      OperandIndexSequence{lhs, rhs}, OperandIndexSequence{*output}, param));
+  }
+
+  void compile(OperandIndex output)
+  {
+    graph->addOutput(output);
+    graph->verify();
+
+    auto subgs = std::make_shared<Subgraphs>();
+    subgs->push(SubgraphIndex{0}, graph);
+    tracing_ctx = std::make_unique<onert::util::TracingCtx>(subgs.get());
+    onert::compiler::Compiler compiler{subgs, tracing_ctx.get()};
+    compiler.options().executor = "Dataflow";
+    executors = compiler.compile();
+
+    auto executor =
+      dynamic_cast<onert::exec::ExecutorBase *>(executors->at(SubgraphIndex{0}).get());
+    ASSERT_NE(executor, nullptr);
+    executor->addObserver(std::make_unique<JobOrderObserver>(order));
+  }
+
+  void run(const float *input1_buffer, const float *input2_buffer, float *output_buffer)
+  {
+    order.clear();
+    onert::exec::Execution execution{executors};
+    execution.setInput(IOIndex{0}, input1_buffer, 16);
+    execution.setInput(IOIndex{1}, input2_buffer, 16);
+    execution.setOutput(IOIndex{0}, output_buffer, 16);
+    execution.execute();
+  }
+
+public:
+  std::shared_ptr<Graph> graph;
+  OperandIndex input1;
+  OperandIndex input2;
+  std::shared_ptr<onert::exec::ExecutorMap> executors;
+  std::unique_ptr<onert::util::TracingCtx> tracing_ctx;
+  std::vector<OperationIndex> order;
+};
+
+} // namespace
+
+TEST(DataflowExecutor, diamond)
+{
+  // t = in1 + in2, l = t + in2, r = t * in1, out = l - r
+  DataflowModel model;
+  OperandIndex t, l, r, out;
+  auto top = model.addOperation(ArithmeticType::ADD, model.input1, model.input2, &t);
+  auto left = model.addOperation(ArithmeticType::ADD, t, model.input2, &l);
+  auto right = model.addOperation(ArithmeticType::MUL, t, model.input1, &r);
+  auto bottom = model.addOperation(ArithmeticType::SUB, l, r, &out);
+  model.compile(out);
+
+  const float input1[4] = {1, 0, -1, 2};
+  const float input2[4] = {2, -3, 1, 0.5};
+  const float expected[4] = {2, -6, 1, -2};
+  // Runs again after the first run restored the jobs
+  for (int run = 0; run < 2; ++run)
+  {
+    float output[4] = {};
+    model.run(input1, input2, output);
+    for (int i = 0; i < 4; ++i)
+      EXPECT_EQ(output[i], expected[i]) << "run " << run << " at " << i;
+
+    ASSERT_EQ(model.order.size(), 4u);
+    EXPECT_EQ(model.order[0], top);
+    EXPECT_EQ(model.order[3], bottom);
+    EXPECT_TRUE((model.order[1] == left && model.order[2] == right) ||
+                (model.order[1] == right && model.order[2] == left));
+  }
+}
+
+TEST(DataflowExecutor, sameRankInReadyOrder)
+{
+  // a, b and c are ready at first, and d gets ready after b, so that c runs before d
+  // d = a + b, out = d + c
+  DataflowModel model;
+  OperandIndex a, b, c, d, out;
+  auto op_a = model.addOperation(ArithmeticType::ADD, model.input1, model.input2, &a);
+  auto op_b = model.addOperation(ArithmeticType::MUL, model.input1, model.input2, &b);
+  auto op_c = model.addOperation(ArithmeticType::SUB, model.input1, model.input2, &c);
+  auto op_d = model.addOperation(ArithmeticType::ADD, a, b, &d);
+  auto op_out = model.addOperation(ArithmeticType::ADD, d, c, &out);
+  model.compile(out);
+
+  const float input1[4] = {1, 0, -1, 2};
+  const float input2[4] = {2, -3, 1, 0.5};
+  // (in1 + in2) + in1 * in2 + (in1 - in2)
+  const float expected[4] = {4, 0, -3, 5};
+  // Without ranks all the jobs have the same rank, so they run in the order they get ready
+  const std::vector<OperationIndex> expected_order = {op_a, op_b, op_c, op_d, op_out};
+  for (int run = 0; run < 2; ++run)
+  {
+    float output[4] = {};
+    model.run(input1, input2, output);
+    for (int i = 0; i < 4; ++i)
+      EXPECT_EQ(output[i], expected[i]) << "run " << run << " at " << i;
+    EXPECT_EQ(model.order, expected_order) << "run " << run;
+  }
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/ExecutionObservers.h"
+#include "backend/IConfig.h"
+#include "backend/Backend.h"
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+
+#include <gtest/gtest.h>
+
+namespace
+{
+using namespace onert;
+using namespace exec;
+using namespace backend;
+
+struct MockConfig : public IConfig
+{
+  std::string id() override { return "b1"; }
+  bool initialize() override { return true; };
+  bool supportPermutation() override { return false; }
+  ir::Layout supportLayout(const ir::Operation &, ir::Layout) override
+  {
+    return ir::Layout::UNKNOWN;
+  }
+  bool supportDynamicTensor() override { return false; }
+  bool supportFP16() override { return false; }
+};
+
+struct MockBackend : public ::onert::backend::Backend
+{
+  std::shared_ptr<onert::backend::IConfig> config() const override
+  {
+    return std::make_shared<MockConfig>();
+  }
+  std::unique_ptr<onert::backend::BackendContext> newContext(ContextData &&) const override
+  {
+    return nullptr;
+  }
+};
+
+// Sum of the sizes of inputs and outputs of the operation, which are 3 tensors of 4 floats
+const uint32_t OPERATION_SIZE = 48;
+
+// Graph of a single binary operation
+std::unique_ptr<ir::Graph> createGraph(ir::operation::BinaryArithmetic::ArithmeticType type)
+{
+  auto graph = std::make_unique<ir::Graph>();
+  ir::Shape shape{1, 2, 2, 1};
+  ir::TypeInfo type_info{ir::DataType::FLOAT32};
+  auto lhs = graph->addOperand(shape, type_info);
+  auto rhs = graph->addOperand(shape, type_info);
+  auto result = graph->addOperand(shape, type_info);
+  ir::operation::BinaryArithmetic::Param param{type, ir::Activation::NONE};
+  graph->addOperation(std::make_unique<ir::operation::BinaryArithmetic>(
+    ir::OperandIndexSequence{lhs, rhs}, ir::OperandIndexSequence{result}, param));
+  return graph;
+}
+
+void run(OnlineProfileObserver &observer, const Backend *backend)
+{
+  observer.handleSubgraphBegin(ir::SubgraphIndex{0});
+  observer.handleJobBegin(nullptr, ir::SubgraphIndex{0}, ir::OperationIndex{0}, backend);
+  observer.handleJobEnd(nullptr, ir::SubgraphIndex{0}, ir::OperationIndex{0}, backend);
+  observer.handleSubgraphEnd(ir::SubgraphIndex{0});
+}
+
+} // namespace
+
+TEST(OnlineProfileObserver, update_every_period)
+{
+  // Measurements of other tests should not be loaded
+  remove("exec_time.json");
+
+  MockBackend backend;
+  std::vector<const Backend *> backends = {&backend};
+  auto graph = createGraph(ir::operation::BinaryArithmetic::ArithmeticType::ADD);
+  auto et = std::make_shared<ExecTime>(backends);
+  OnlineProfileObserver observer{et, *graph, 3};
+
+  for (int i = 0; i < 2; ++i)
+  {
+    run(observer, &backend);
+    ASSERT_TRUE(et->getOperationExecTime(&backend, "Add", false, OPERATION_SIZE) ==
+                ExecTime::NOT_FOUND);
+  }
+
+  // Updated even if it took less than 1 us
+  run(observer, &backend);
+  ASSERT_GE(et->getOperationExecTime(&backend, "Add", false, OPERATION_SIZE), 1);
+
+  // Not stored into the file while running
+  EXPECT_NE(remove("exec_time.json"), 0);
+}
+
+TEST(OnlineProfileObserver, share_exec_time)
+{
+  remove("exec_time.json");
+
+  MockBackend backend;
+  std::vector<const Backend *> backends = {&backend};
+  auto add_graph = createGraph(ir::operation::BinaryArithmetic::ArithmeticType::ADD);
+  auto mul_graph = createGraph(ir::operation::BinaryArithmetic::ArithmeticType::MUL);
+  auto et = std::make_shared<ExecTime>(backends);
+  // Like the executors of subgraphs
+  OnlineProfileObserver add_observer{et, *add_graph, 1};
+  OnlineProfileObserver mul_observer{et, *mul_graph, 1};
+
+  run(add_observer, &backend);
+  run(mul_observer, &backend);
+  et->storeOperationsExecTime();
+
+  // Stored once with measurements of both
+  ExecTime stored(backends);
+  ASSERT_GE(stored.getOperationExecTime(&backend, "Add", false, OPERATION_SIZE), 1);
+  ASSERT_GE(stored.getOperationExecTime(&backend, "Mul", false, OPERATION_SIZE), 1);
+
+  EXPECT_EQ(remove("exec_time.json"), 0);
+}
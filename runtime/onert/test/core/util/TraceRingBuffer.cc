@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "util/TraceRingBuffer.h"
+
+#include <map>
+#include <thread>
+#include <vector>
+
+using onert::util::TraceRingBuffer;
+
+namespace
+{
+
+struct Record
+{
+  uint32_t writer;
+  uint32_t seq;
+};
+
+std::vector<Record> collect(const TraceRingBuffer<Record> &buffer)
+{
+  std::vector<Record> records;
+  buffer.iterate([&](const Record &record) { records.push_back(record); });
+  return records;
+}
+
+} // namespace
+
+TEST(TraceRingBuffer, keep_records_until_full)
+{
+  TraceRingBuffer<Record> buffer{4};
+  EXPECT_TRUE(collect(buffer).empty());
+
+  for (uint32_t i = 0; i < 3; ++i)
+    buffer.local().push(Record{0, i});
+
+  auto records = collect(buffer);
+  ASSERT_EQ(records.size(), 3u);
+  for (uint32_t i = 0; i < 3; ++i)
+    EXPECT_EQ(records[i].seq, i);
+}
+
+TEST(TraceRingBuffer, wraparound)
+{
+  TraceRingBuffer<Record> buffer{4};
+  // Wrap around the ring more than once, so the oldest records are overwritten
+  for (uint32_t i = 0; i < 10; ++i)
+    buffer.local().push(Record{0, i});
+
+  auto records = collect(buffer);
+  ASSERT_EQ(records.size(), 4u);
+  for (uint32_t i = 0; i < 4; ++i)
+    EXPECT_EQ(records[i].seq, 6 + i);
+}
+
+TEST(TraceRingBuffer, nested_scopes)
+{
+  TraceRingBuffer<Record> buffer{4};
+  auto &ring = buffer.local();
+  ring.beginScope();
+  ring.beginScope();
+  const auto inner = ring.endScope();
+  const auto outer = ring.endScope();
+  EXPECT_LE(outer, inner);
+  EXPECT_LE(inner, onert::util::traceTimestampNs());
+}
+
+TEST(TraceRingBuffer, rings_of_buffers)
+{
+  // A thread has its own ring in each buffer, even a buffer at the address of a destroyed one
+  for (uint32_t round = 0; round < 3; ++round)
+  {
+    TraceRingBuffer<Record> buffer1{8};
+    TraceRingBuffer<Record> buffer2{8};
+    buffer1.local().push(Record{1, round});
+    buffer2.local().push(Record{2, round});
+    buffer2.local().push(Record{2, round});
+
+    auto records1 = collect(buffer1);
+    auto records2 = collect(buffer2);
+    ASSERT_EQ(records1.size(), 1u);
+    ASSERT_EQ(records2.size(), 2u);
+    EXPECT_EQ(records1[0].writer, 1u);
+    EXPECT_EQ(records2[0].writer, 2u);
+    EXPECT_EQ(records2[1].writer, 2u);
+  }
+}
+
+TEST(TraceRingBuffer, concurrent_writers)
+{
+  constexpr uint32_t kWriters = 4;
+  constexpr uint32_t kRecords = 10000;
+  constexpr uint32_t kCapacity = 100;
+  TraceRingBuffer<Record> buffer{kCapacity};
+
+  std::vector<std::thread> writers;
+  for (uint32_t w = 0; w < kWriters; ++w)
+  {
+    writers.emplace_back([&buffer, w]() {
+      for (uint32_t i = 0; i < kRecords; ++i)
+        buffer.local().push(Record{w, i});
+    });
+  }
+  for (auto &writer : writers)
+    writer.join();
+
+  // Each writer keeps its latest records in order, which are not mixed with others
+  std::map<uint32_t, std::vector<uint32_t>> seqs;
+  for (const auto &record : collect(buffer))
+    seqs[record.writer].push_back(record.seq);
+  ASSERT_EQ(seqs.size(), kWriters);
+  for (const auto &it : seqs)
+  {
+    ASSERT_EQ(it.second.size(), kCapacity);
+    for (uint32_t i = 0; i < kCapacity; ++i)
+      EXPECT_EQ(it.second[i], kRecords - kCapacity + i) << "writer " << it.first;
+  }
+}
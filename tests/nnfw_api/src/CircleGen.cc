@@ -261,6 +261,12 @@ uint32_t CircleGen::addOperatorLogSoftmax(const OperatorParams &params)
                                 circle::BuiltinOptions_LogSoftmaxOptions, options);
 }
 
+uint32_t CircleGen::addOperatorLogistic(const OperatorParams &params)
+{
+  return addOperatorWithOptions(params, circle::BuiltinOperator_LOGISTIC,
+                                circle::BuiltinOptions_NONE, 0);
+}
+
 uint32_t CircleGen::addOperatorMean(const OperatorParams &params, bool keep_dims)
 {
   auto options = circle::CreateReducerOptions(_fbb, keep_dims).Union();
@@ -419,6 +425,12 @@ uint32_t CircleGen::addOperatorSub(const OperatorParams &params,
                                 circle::BuiltinOptions_SubOptions, options);
 }
 
+uint32_t CircleGen::addOperatorTanh(const OperatorParams &params)
+{
+  return addOperatorWithOptions(params, circle::BuiltinOperator_TANH, circle::BuiltinOptions_NONE,
+                                0);
+}
+
 uint32_t CircleGen::addOperatorTile(const OperatorParams &params)
 {
   auto options = circle::CreateTileOptions(_fbb).Union();
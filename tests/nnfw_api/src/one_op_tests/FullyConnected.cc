@@ -207,3 +207,30 @@ TEST_F(GenModelTest, neg_OneOp_FullyConnected_NoBias)
 
   SUCCEED();
 }
+
+TEST_F(GenModelTest, neg_OneOp_FullyConnected_I8_NonZero_ZeroPoints)
+{
+  CircleGen cgen;
+  // clang-format off
+  std::vector<int8_t> weight_data{ 1, 2, 3, 4,
+                                   5, 6, 7, 8 };
+  // clang-format on
+  uint32_t weight_buf = cgen.addBuffer(weight_data);
+  std::vector<int32_t> bias_data{0, 0};
+  uint32_t bias_buf = cgen.addBuffer(bias_data);
+  int input = cgen.addTensor({{1, 4}, circle::TensorType::TensorType_INT8}, 0.5, 0);
+  std::vector<float> weight_scales = {0.5, 0.5};
+  std::vector<int64_t> weight_zeropoints = {0, 10};
+  int weight = cgen.addTensor({{2, 4}, circle::TensorType::TensorType_INT8, weight_buf},
+                              weight_scales, weight_zeropoints);
+  int bias = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32, bias_buf}, 0.25, 0);
+  int output = cgen.addTensor({{1, 2}, circle::TensorType::TensorType_INT8}, 1.0, 0);
+  cgen.addOperatorFullyConnected({{input, weight, bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
@@ -92,3 +92,33 @@ TEST_F(GenModelTest, neg_OneOp_Softmax_Type)
 
   SUCCEED();
 }
+
+TEST_F(GenModelTest, neg_OneOp_Softmax_Int16ZeroPoint)
+{
+  CircleGen cgen;
+  int input = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0, 3);
+  int out = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0f / 32768, 0);
+  cgen.addOperatorSoftmax({{input}, {out}}, 0.1);
+  cgen.setInputsAndOutputs({input}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_Softmax_Int16OutputScale)
+{
+  CircleGen cgen;
+  int input = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0, 0);
+  int out = cgen.addTensor({{1, 2, 1, 4}, circle::TensorType::TensorType_INT16}, 1.0f / 256, 0);
+  cgen.addOperatorSoftmax({{input}, {out}}, 0.1);
+  cgen.setInputsAndOutputs({input}, {out});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
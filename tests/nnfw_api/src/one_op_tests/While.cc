@@ -156,6 +156,118 @@ TEST_F(GenModelTest, OneOp_While_TwoInputs)
   SUCCEED();
 }
 
+// The model looks just like the below pseudocode
+//
+// function model(x, end, shape)
+// {
+//   x = reshape(x, shape)  // only if dynamic_input
+//   while (x < end)
+//   {
+//     x = x + 10.0
+//   }
+//   return x
+// }
+//
+// With a static input, the body writes to the outputs of WHILE directly in every other iteration.
+// With a dynamic input, it writes to temporary tensors which are copied to the outputs.
+CircleBuffer genWhileTripCountModel(bool dynamic_input)
+{
+  CircleGen cgen;
+  std::vector<float> incr_data{10};
+  uint32_t incr_buf = cgen.addBuffer(incr_data);
+
+  // primary subgraph
+  {
+    int x_in = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int end_in = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int end_out = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    if (dynamic_input)
+    {
+      int shape = cgen.addTensor({{1}, circle::TensorType_INT32});
+      int x_dyn = cgen.addTensor({{}, circle::TensorType_FLOAT32}); // dynamic tensor of shape {}
+      int x_out = cgen.addTensor({{}, circle::TensorType_FLOAT32}); // dynamic tensor of shape {}
+      cgen.addOperatorReshape({{x_in, shape}, {x_dyn}});
+      cgen.addOperatorWhile({{x_dyn, end_in}, {x_out, end_out}}, 1, 2);
+      cgen.setInputsAndOutputs({x_in, end_in, shape}, {x_out});
+    }
+    else
+    {
+      int x_out = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+      cgen.addOperatorWhile({{x_in, end_in}, {x_out, end_out}}, 1, 2);
+      cgen.setInputsAndOutputs({x_in, end_in}, {x_out});
+    }
+  }
+
+  // cond subgraph
+  {
+    cgen.nextSubgraph();
+    int x = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int end = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int result = cgen.addTensor({{1}, circle::TensorType_BOOL});
+    cgen.addOperatorLess({{x, end}, {result}});
+    cgen.setInputsAndOutputs({x, end}, {result});
+  }
+
+  // body subgraph
+  {
+    cgen.nextSubgraph();
+    int x_in = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int incr = cgen.addTensor({{1}, circle::TensorType_FLOAT32, incr_buf});
+    int x_out = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    int end = cgen.addTensor({{1}, circle::TensorType_FLOAT32});
+    cgen.addOperatorAdd({{x_in, incr}, {x_out}}, circle::ActivationFunctionType_NONE);
+    cgen.setInputsAndOutputs({x_in, end}, {x_out, end});
+  }
+
+  return cgen.finish();
+}
+
+// {x, end, expected x} of 0, 1, odd and even number of iterations
+const std::vector<std::vector<float>> while_trip_count_cases = {
+  {0, 0, 0}, {5, 10, 15}, {0, 30, 30}, {1, 40, 41}};
+
+TEST_F(GenModelTest, OneOp_While_TripCounts)
+{
+  _context = std::make_unique<GenModelTestContext>(genWhileTripCountModel(false));
+  // Test cases run in one session one after another, so that each case runs twice and after an
+  // odd and even number of iterations, which swap the slot written first by the next run
+  for (int round = 0; round < 2; ++round)
+  {
+    for (const auto &c : while_trip_count_cases)
+    {
+      for (int repeat = 0; repeat < 2; ++repeat)
+        _context->addTestCase(uniformTCD<float>({{c[0]}, {c[1]}}, {{c[2]}}));
+    }
+  }
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_While_TripCounts_DynamicInput)
+{
+  _context = std::make_unique<GenModelTestContext>(genWhileTripCountModel(true));
+  // Output shape is unknown before running
+  _context->output_sizes(0, sizeof(float));
+  for (int round = 0; round < 2; ++round)
+  {
+    for (const auto &c : while_trip_count_cases)
+    {
+      for (int repeat = 0; repeat < 2; ++repeat)
+      {
+        _context->addTestCase(TestCaseData{}
+                                .addInput<float>({c[0]})
+                                .addInput<float>({c[1]})
+                                .addInput<int32_t>({1})
+                                .addOutput<float>({c[2]}));
+      }
+    }
+  }
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
 class WhileWrongSubgraphIndex : public GenModelTest,
                                 public ::testing::WithParamInterface<std::pair<int, int>>
 {
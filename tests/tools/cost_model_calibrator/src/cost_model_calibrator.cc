@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "CircleGen.h"
+
+#include <nnfw.h>
+#include <nnfw_internal.h>
+
+#include <json/json.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+const int kWarmupRuns = 3;
+const int kMeasureRuns = 20;
+
+struct Sample
+{
+  double work; // FLOPs or bytes
+  double us;
+};
+
+/**
+ * @brief Fit us = intercept + slope * work by least squares
+ */
+std::pair<double, double> fitLinear(const std::vector<Sample> &samples)
+{
+  const double n = samples.size();
+  double sum_x = 0., sum_y = 0., sum_xx = 0., sum_xy = 0.;
+  for (const auto &s : samples)
+  {
+    sum_x += s.work;
+    sum_y += s.us;
+    sum_xx += s.work * s.work;
+    sum_xy += s.work * s.us;
+  }
+  const double denom = n * sum_xx - sum_x * sum_x;
+  if (n < 2 || denom == 0.)
+    throw std::runtime_error{"Not enough samples to fit"};
+  const double slope = (n * sum_xy - sum_x * sum_y) / denom;
+  const double intercept = (sum_y - slope * sum_x) / n;
+  return {intercept, slope};
+}
+
+CircleBuffer buildFullyConnected(int batch, int depth, bool quant)
+{
+  CircleGen cgen;
+  const auto type =
+    quant ? circle::TensorType::TensorType_UINT8 : circle::TensorType::TensorType_FLOAT32;
+  int weight_buf, bias_buf;
+  if (quant)
+  {
+    weight_buf = cgen.addBuffer(std::vector<uint8_t>(depth * depth, 129));
+    bias_buf = cgen.addBuffer(std::vector<int32_t>(depth, 0));
+  }
+  else
+  {
+    weight_buf = cgen.addBuffer(std::vector<float>(depth * depth, 0.01f));
+    bias_buf = cgen.addBuffer(std::vector<float>(depth, 0.f));
+  }
+
+  int in, weight, bias, out;
+  if (quant)
+  {
+    in = cgen.addTensor({{batch, depth}, type}, 0.5f, 128);
+    weight = cgen.addTensor({{depth, depth}, type, weight_buf}, 0.01f, 128);
+    bias = cgen.addTensor({{depth}, circle::TensorType::TensorType_INT32, bias_buf}, 0.005f, 0);
+    out = cgen.addTensor({{batch, depth}, type}, 1.f, 128);
+  }
+  else
+  {
+    in = cgen.addTensor({{batch, depth}, type});
+    weight = cgen.addTensor({{depth, depth}, type, weight_buf});
+    bias = cgen.addTensor({{depth}, type, bias_buf});
+    out = cgen.addTensor({{batch, depth}, type});
+  }
+  cgen.addOperatorFullyConnected({{in, weight, bias}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+CircleBuffer buildAdd(int size)
+{
+  CircleGen cgen;
+  const auto type = circle::TensorType::TensorType_FLOAT32;
+  int lhs = cgen.addTensor({{1, size}, type});
+  int rhs = cgen.addTensor({{1, size}, type});
+  int out = cgen.addTensor({{1, size}, type});
+  cgen.addOperatorAdd({{lhs, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({lhs, rhs}, {out});
+  return cgen.finish();
+}
+
+uint64_t bufferSize(const nnfw_tensorinfo &ti)
+{
+  uint64_t size =
+    ti.dtype == NNFW_TYPE_TENSOR_FLOAT32 || ti.dtype == NNFW_TYPE_TENSOR_INT32 ? 4 : 1;
+  for (int32_t i = 0; i < ti.rank; ++i)
+    size *= ti.dims[i];
+  return size;
+}
+
+/**
+ * @brief Run a model on a backend and return the median time of a run in microseconds
+ *
+ * @return Negative value if the backend fails to prepare the model
+ */
+double measure(const CircleBuffer &cbuf, const std::string &backend)
+{
+  nnfw_session *session = nullptr;
+  if (nnfw_create_session(&session) != NNFW_STATUS_NO_ERROR)
+    throw std::runtime_error{"Failed to create a session"};
+
+  double median_us = -1.;
+  if (nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()) == NNFW_STATUS_NO_ERROR &&
+      nnfw_set_available_backends(session, backend.c_str()) == NNFW_STATUS_NO_ERROR &&
+      nnfw_prepare(session) == NNFW_STATUS_NO_ERROR)
+  {
+    uint32_t num_inputs = 0, num_outputs = 0;
+    nnfw_input_size(session, &num_inputs);
+    nnfw_output_size(session, &num_outputs);
+
+    std::vector<std::vector<uint8_t>> buffers;
+    for (uint32_t i = 0; i < num_inputs; ++i)
+    {
+      nnfw_tensorinfo ti;
+      nnfw_input_tensorinfo(session, i, &ti);
+      buffers.emplace_back(bufferSize(ti), 1);
+      nnfw_set_input(session, i, ti.dtype, buffers.back().data(), buffers.back().size());
+    }
+    for (uint32_t i = 0; i < num_outputs; ++i)
+    {
+      nnfw_tensorinfo ti;
+      nnfw_output_tensorinfo(session, i, &ti);
+      buffers.emplace_back(bufferSize(ti));
+      nnfw_set_output(session, i, ti.dtype, buffers.back().data(), buffers.back().size());
+    }
+
+    std::vector<double> times;
+    for (int i = 0; i < kWarmupRuns + kMeasureRuns; ++i)
+    {
+      const auto begin = std::chrono::steady_clock::now();
+      if (nnfw_run(session) != NNFW_STATUS_NO_ERROR)
+        break;
+      const auto end = std::chrono::steady_clock::now();
+      if (i >= kWarmupRuns)
+        times.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+    }
+    if (!times.empty())
+    {
+      std::nth_element(times.begin(), times.begin() + times.size() / 2, times.end());
+      median_us = times[times.size() / 2];
+    }
+  }
+
+  nnfw_close_session(session);
+  return median_us;
+}
+
+/**
+ * @brief Fit throughput of FullyConnected in G(FL)OPS and its intercept in microseconds
+ *
+ * @return {0, 0} if the backend does not support it
+ */
+std::pair<double, double> calibrateFullyConnected(const std::string &backend, bool quant)
+{
+  // Large enough to be bound by computation
+  const int depth = 512;
+  std::vector<Sample> samples;
+  for (int batch : {32, 64, 128, 256})
+  {
+    const auto us = measure(buildFullyConnected(batch, depth, quant), backend);
+    if (us < 0.)
+      return {0., 0.};
+    samples.push_back({2. * batch * depth * depth, us});
+  }
+  const auto fit = fitLinear(samples);
+  if (fit.second <= 0.)
+    throw std::runtime_error{"Measurements of FullyConnected on " + backend + " are too noisy"};
+  // slope is us per op
+  return {1e-3 / fit.second, std::max(fit.first, 0.)};
+}
+
+/**
+ * @brief Fit memory bandwidth in GB/s and its intercept in microseconds with Add
+ */
+std::pair<double, double> calibrateMemory(const std::string &backend)
+{
+  std::vector<Sample> samples;
+  for (int size : {1 << 16, 1 << 18, 1 << 20, 1 << 22})
+  {
+    const auto us = measure(buildAdd(size), backend);
+    if (us < 0.)
+      return {0., 0.};
+    // Two inputs and an output
+    samples.push_back({3. * size * sizeof(float), us});
+  }
+  const auto fit = fitLinear(samples);
+  if (fit.second <= 0.)
+    throw std::runtime_error{"Measurements of Add on " + backend + " are too noisy"};
+  return {1e-3 / fit.second, std::max(fit.first, 0.)};
+}
+
+} // namespace
+
+int main(const int argc, char **argv)
+{
+  if (argc < 3)
+  {
+    std::cerr << "Usage: " << argv[0] << " output.json backend [backend ...]" << std::endl;
+    return 1;
+  }
+
+  Json::Value root;
+  try
+  {
+    for (int i = 2; i < argc; ++i)
+    {
+      const std::string backend = argv[i];
+      std::cout << "Calibrating " << backend << "..." << std::endl;
+
+      const auto fc = calibrateFullyConnected(backend, false);
+      const auto memory = calibrateMemory(backend);
+      if (fc.first <= 0. && memory.first <= 0.)
+      {
+        std::cerr << "  " << backend << " fails to run both FullyConnected and Add, skipped"
+                  << std::endl;
+        continue;
+      }
+      const auto quant_fc = calibrateFullyConnected(backend, true);
+
+      Json::Value value;
+      if (fc.first > 0.)
+        value["gflops"] = fc.first;
+      value["quant_gops"] = std::max(quant_fc.first, 0.);
+      if (memory.first > 0.)
+      {
+        value["gbytes_per_sec"] = memory.first;
+        // Data of a backend on device memory needs a transfer, which this cannot measure
+        if (backend != "acl_cl")
+          value["transfer_gbytes_per_sec"] = memory.first;
+      }
+      // Fixed cost shared by all operations
+      value["overhead_us"] = fc.first > 0. && memory.first > 0.
+                               ? std::min(fc.second, memory.second)
+                               : std::max(fc.second, memory.second);
+      root[backend] = value;
+
+      std::cout << value.toStyledString();
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error: " << e.what() << std::endl;
+    return 1;
+  }
+
+  std::ofstream ofs{argv[1]};
+  ofs << root.toStyledString();
+  std::cout << "Written to " << argv[1] << std::endl;
+  return 0;
+}
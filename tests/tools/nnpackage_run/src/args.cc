@@ -189,6 +189,18 @@ void Args::Initialize(void)
     }
   };
 
+  auto process_load_session = [&](const std::string &session_str) {
+    if (session_str == "shared")
+      _load_shared_session = true;
+    else if (session_str == "client")
+      _load_shared_session = false;
+    else
+    {
+      std::cerr << "'--load_session' must be 'shared' or 'client': " << session_str << std::endl;
+      exit(1);
+    }
+  };
+
   // General options
   po::options_description general("General options", 100);
 
@@ -234,6 +246,20 @@ void Args::Initialize(void)
          "0: prints the only result. Messages btw run don't print\n"
          "1: prints result and message btw run\n"
          "2: prints all of messages to print\n")
+    ("load_clients", po::value<int>()->default_value(0)->notifier([&](const auto &v) { _load_clients = v; }),
+         "The number of concurrent clients for tail latency benchmark\n"
+         "0: runs num_runs sequentially as default\n"
+         "N: runs from N client threads for load_duration ms and reports latency percentiles\n"
+         "{exec}-{nnpkg}-{backend}-load.csv and -load-histogram.csv are generated with write_report.\n")
+    ("load_session", po::value<std::string>()->default_value("shared")->notifier(process_load_session),
+         "Session of each client in tail latency benchmark\n"
+         "'shared': all clients share a session and their runs are serialized\n"
+         "'client': each client loads and prepares its own session\n")
+    ("load_qps", po::value<double>()->default_value(0)->notifier([&](const auto &v) { _load_qps = v; }),
+         "Target requests per second of all clients in open loop\n"
+         "0: closed loop, i.e. each client runs again as soon as its previous run completes\n")
+    ("load_duration", po::value<int>()->default_value(10000)->notifier([&](const auto &v) { _load_duration = v; }),
+         "Duration(ms) of tail latency benchmark")
     ;
   // clang-format on
 
@@ -288,6 +314,14 @@ void Args::Parse(const int argc, char **argv)
     exit(1);
   }
 
+  if (_load_clients < 0 || _load_qps < 0 || _load_duration <= 0)
+  {
+    std::cerr << "'--load_clients' and '--load_qps' must not be negative and '--load_duration' must "
+                 "be positive"
+              << std::endl;
+    exit(1);
+  }
+
   // This must be run after `notify` as `_warm_up_runs` must have been processed before.
   if (vm.count("mem_poll"))
   {
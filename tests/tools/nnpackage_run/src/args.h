@@ -65,6 +65,10 @@ public:
   /// @brief Return true if "--shape_run" or "--shape_prepare" is provided
   bool shapeParamProvided();
   const int getVerboseLevel(void) const { return _verbose_level; }
+  const int getLoadClients(void) const { return _load_clients; }
+  const bool getLoadSharedSession(void) const { return _load_shared_session; }
+  const double getLoadQps(void) const { return _load_qps; }
+  const int getLoadDuration(void) const { return _load_duration; }
 
 private:
   void Initialize();
@@ -91,6 +95,10 @@ private:
   bool _write_report;
   bool _print_version = false;
   int _verbose_level;
+  int _load_clients;
+  bool _load_shared_session = true;
+  double _load_qps;
+  int _load_duration;
 };
 
 } // end of namespace nnpkg_run
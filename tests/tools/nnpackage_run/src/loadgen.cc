@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "loadgen.h"
+#include "nnfw.h"
+#include "nnfw_util.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+namespace nnpkg_run
+{
+
+benchmark::LoadResult LoadGenerator::run(const std::vector<nnfw_session *> &sessions)
+{
+  using clock = std::chrono::steady_clock;
+
+  const uint32_t clients = option_.clients;
+  if (clients == 0)
+    throw std::runtime_error("LoadGenerator: the number of clients must be positive");
+  if (sessions.size() != (option_.shared_session ? 1 : clients))
+    throw std::runtime_error("LoadGenerator: the number of sessions does not match");
+
+  // A session is not reentrant, so that runs on a shared session are serialized
+  std::mutex session_mutex;
+  auto run_session = [&](nnfw_session *session) {
+    if (option_.shared_session)
+    {
+      std::lock_guard<std::mutex> lock(session_mutex);
+      NNPR_ENSURE_STATUS(nnfw_run(session));
+    }
+    else
+    {
+      NNPR_ENSURE_STATUS(nnfw_run(session));
+    }
+  };
+
+  // Clients start together after all of them finish warmup
+  std::mutex start_mutex;
+  std::condition_variable start_cv;
+  uint32_t num_ready = 0;
+  bool started = false;
+  clock::time_point start;
+
+  const auto duration = std::chrono::milliseconds(option_.duration);
+  const bool open_loop = option_.target_qps > 0;
+  const auto interval = std::chrono::duration<double>(open_loop ? 1.0 / option_.target_qps : 0);
+
+  std::vector<std::vector<uint64_t>> latencies(clients);
+  std::vector<clock::time_point> last_done(clients);
+  std::vector<std::thread> threads;
+
+  for (uint32_t c = 0; c < clients; ++c)
+  {
+    threads.emplace_back([&, c]() {
+      nnfw_session *session = option_.shared_session ? sessions[0] : sessions[c];
+
+      for (uint32_t i = 0; i < warmup_runs_; ++i)
+        run_session(session);
+
+      {
+        std::unique_lock<std::mutex> lock(start_mutex);
+        ++num_ready;
+        start_cv.notify_all();
+        start_cv.wait(lock, [&]() { return started; });
+      }
+
+      const auto deadline = start + duration;
+      auto &latency = latencies[c];
+      for (uint64_t k = 0;; ++k)
+      {
+        clock::time_point issued;
+        if (open_loop)
+        {
+          // Request (c + k * clients) of the whole schedule
+          issued = start + std::chrono::duration_cast<clock::duration>(
+                             interval * static_cast<double>(c + k * clients));
+          if (issued >= deadline)
+            break;
+          std::this_thread::sleep_until(issued);
+        }
+        else
+        {
+          issued = clock::now();
+          if (issued >= deadline)
+            break;
+        }
+
+        run_session(session);
+
+        last_done[c] = clock::now();
+        latency.push_back(
+          std::chrono::duration_cast<std::chrono::microseconds>(last_done[c] - issued).count());
+      }
+    });
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(start_mutex);
+    start_cv.wait(lock, [&]() { return num_ready == clients; });
+    start = clock::now();
+    started = true;
+  }
+  start_cv.notify_all();
+
+  for (auto &thread : threads)
+    thread.join();
+
+  std::vector<uint64_t> latency;
+  auto end = start;
+  for (uint32_t c = 0; c < clients; ++c)
+  {
+    latency.insert(latency.end(), latencies[c].begin(), latencies[c].end());
+    if (!latencies[c].empty())
+      end = std::max(end, last_done[c]);
+  }
+  const uint64_t elapsed =
+    std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+  return benchmark::LoadResult(option_, std::move(latency), elapsed);
+}
+
+} // end of namespace nnpkg_run
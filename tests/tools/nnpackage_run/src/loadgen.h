@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNPACKAGE_RUN_LOADGEN_H__
+#define __NNPACKAGE_RUN_LOADGEN_H__
+
+#include "benchmark/LoadResult.h"
+
+#include <vector>
+
+struct nnfw_session;
+
+namespace nnpkg_run
+{
+/**
+ * @brief Run prepared sessions from concurrent clients and collect per-request latency
+ *
+ * In closed loop, each client issues the next request as soon as the previous one completes.
+ * In open loop, requests are scheduled at fixed intervals of 1/qps across the clients and
+ * latency is measured from the scheduled time, so that a slow request also counts the delay
+ * it imposes on the following ones.
+ */
+class LoadGenerator
+{
+public:
+  LoadGenerator(const benchmark::LoadOption &option, uint32_t warmup_runs)
+    : option_(option), warmup_runs_(warmup_runs)
+  {
+  }
+  /**
+   * @param sessions One session shared by all clients or one session per client
+   */
+  benchmark::LoadResult run(const std::vector<nnfw_session *> &sessions);
+
+private:
+  benchmark::LoadOption option_;
+  uint32_t warmup_runs_;
+};
+} // namespace nnpkg_run
+
+#endif // __NNPACKAGE_RUN_LOADGEN_H__
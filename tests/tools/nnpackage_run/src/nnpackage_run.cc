@@ -20,6 +20,7 @@
 #if defined(ONERT_HAVE_HDF5) && ONERT_HAVE_HDF5 == 1
 #include "h5formatter.h"
 #endif
+#include "loadgen.h"
 #include "nnfw.h"
 #include "nnfw_util.h"
 #include "nnfw_internal.h"
@@ -33,6 +34,7 @@
 #include <cstdlib>
 #include <iostream>
 #include <libgen.h>
+#include <memory>
 #include <stdexcept>
 #include <unordered_map>
 #include <vector>
@@ -46,6 +48,25 @@ void overwriteShapeMap(nnpkg_run::TensorShapeMap &shape_map,
     shape_map[i] = shapes[i];
 }
 
+// {exec} and {nnpkg} of report file names
+void getReportBasenames(const char *exec_path, const std::string &nnpackage_path,
+                        std::string &exec_basename, std::string &nnpkg_basename)
+{
+  char buf[PATH_MAX];
+  char *res = realpath(nnpackage_path.c_str(), buf);
+  if (res)
+  {
+    nnpkg_basename = basename(buf);
+  }
+  else
+  {
+    std::cerr << "E: during getting realpath from nnpackage_path." << std::endl;
+    exit(-1);
+  }
+  std::string exec_buf = exec_path;
+  exec_basename = basename(&exec_buf[0]);
+}
+
 int main(const int argc, char **argv)
 {
   using namespace nnpkg_run;
@@ -122,7 +143,7 @@ int main(const int argc, char **argv)
       }
     };
 
-    auto setTensorInfo = [session](const TensorShapeMap &tensor_shape_map) {
+    auto setTensorInfo = [](nnfw_session *session, const TensorShapeMap &tensor_shape_map) {
       for (auto tensor_shape : tensor_shape_map)
       {
         auto ind = tensor_shape.first;
@@ -172,7 +193,7 @@ int main(const int argc, char **argv)
     if (args.getWhenToUseH5Shape() == WhenToUseH5Shape::PREPARE)
       fill_shape_from_h5(args.getLoadFilename(), args.getShapeMapForPrepare());
 #endif
-    setTensorInfo(args.getShapeMapForPrepare());
+    setTensorInfo(session, args.getShapeMapForPrepare());
 
     // prepare execution
 
@@ -187,7 +208,7 @@ int main(const int argc, char **argv)
         (!args.getLoadFilename().empty() && !args.shapeParamProvided()))
       fill_shape_from_h5(args.getLoadFilename(), args.getShapeMapForRun());
 #endif
-    setTensorInfo(args.getShapeMapForRun());
+    setTensorInfo(session, args.getShapeMapForRun());
 
     // prepare input
     std::vector<Allocation> inputs(num_inputs);
@@ -205,26 +226,85 @@ int main(const int argc, char **argv)
     NNPR_ENSURE_STATUS(nnfw_output_size(session, &num_outputs));
     std::vector<Allocation> outputs(num_outputs);
     auto output_sizes = args.getOutputSizes();
-    for (uint32_t i = 0; i < num_outputs; i++)
-    {
-      nnfw_tensorinfo ti;
-      uint64_t output_size_in_bytes = 0;
+    auto setOutputs = [&output_sizes](nnfw_session *session, std::vector<Allocation> &outputs) {
+      for (uint32_t i = 0; i < outputs.size(); i++)
       {
-        auto found = output_sizes.find(i);
-        if (found == output_sizes.end())
+        nnfw_tensorinfo ti;
+        uint64_t output_size_in_bytes = 0;
         {
-          NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
-          output_size_in_bytes = bufsize_for(&ti);
+          auto found = output_sizes.find(i);
+          if (found == output_sizes.end())
+          {
+            NNPR_ENSURE_STATUS(nnfw_output_tensorinfo(session, i, &ti));
+            output_size_in_bytes = bufsize_for(&ti);
+          }
+          else
+          {
+            output_size_in_bytes = found->second;
+          }
         }
-        else
+        outputs[i].alloc(output_size_in_bytes);
+        NNPR_ENSURE_STATUS(
+          nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
+        NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+      }
+    };
+    setOutputs(session, outputs);
+
+    // tail latency benchmark under concurrent load instead of sequential runs
+    if (args.getLoadClients() > 0)
+    {
+      benchmark::LoadOption load_option;
+      load_option.clients = args.getLoadClients();
+      load_option.shared_session = args.getLoadSharedSession();
+      load_option.target_qps = args.getLoadQps();
+      load_option.duration = args.getLoadDuration();
+
+      // Sessions of other clients read the same inputs and write their own outputs
+      std::vector<nnfw_session *> sessions{session};
+      std::vector<std::unique_ptr<std::vector<Allocation>>> client_outputs;
+      for (uint32_t c = 1; !load_option.shared_session && c < load_option.clients; ++c)
+      {
+        nnfw_session *client_session = nullptr;
+        NNPR_ENSURE_STATUS(nnfw_create_session(&client_session));
+        NNPR_ENSURE_STATUS(nnfw_load_model_from_file(client_session, nnpackage_path.c_str()));
+        if (available_backends)
+          NNPR_ENSURE_STATUS(nnfw_set_available_backends(client_session, available_backends));
+        setTensorInfo(client_session, args.getShapeMapForPrepare());
+        NNPR_ENSURE_STATUS(nnfw_prepare(client_session));
+        setTensorInfo(client_session, args.getShapeMapForRun());
+
+        for (uint32_t i = 0; i < num_inputs; i++)
         {
-          output_size_in_bytes = found->second;
+          nnfw_tensorinfo ti;
+          NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(client_session, i, &ti));
+          NNPR_ENSURE_STATUS(
+            nnfw_set_input(client_session, i, ti.dtype, inputs[i].data(), bufsize_for(&ti)));
+          NNPR_ENSURE_STATUS(nnfw_set_input_layout(client_session, i, NNFW_LAYOUT_CHANNELS_LAST));
         }
+        client_outputs.emplace_back(new std::vector<Allocation>(num_outputs));
+        setOutputs(client_session, *client_outputs.back());
+
+        sessions.push_back(client_session);
       }
-      outputs[i].alloc(output_size_in_bytes);
-      NNPR_ENSURE_STATUS(
-        nnfw_set_output(session, i, ti.dtype, outputs[i].data(), output_size_in_bytes));
-      NNPR_ENSURE_STATUS(nnfw_set_output_layout(session, i, NNFW_LAYOUT_CHANNELS_LAST));
+
+      auto load_result = LoadGenerator(load_option, args.getWarmupRuns()).run(sessions);
+
+      for (auto s : sessions)
+        NNPR_ENSURE_STATUS(nnfw_close_session(s));
+
+      benchmark::printLoadResult(load_result);
+
+      if (args.getWriteReport() == false)
+        return 0;
+
+      std::string exec_basename;
+      std::string nnpkg_basename;
+      std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
+      getReportBasenames(argv[0], nnpackage_path, exec_basename, nnpkg_basename);
+      benchmark::writeLoadResult(load_result, exec_basename, nnpkg_basename, backend_name);
+
+      return 0;
     }
 
     // NOTE: Measuring memory can't avoid taking overhead. Therefore, memory will be measured on the
@@ -286,20 +366,7 @@ int main(const int argc, char **argv)
     std::string exec_basename;
     std::string nnpkg_basename;
     std::string backend_name = (available_backends) ? available_backends : default_backend_cand;
-    {
-      char buf[PATH_MAX];
-      char *res = realpath(nnpackage_path.c_str(), buf);
-      if (res)
-      {
-        nnpkg_basename = basename(buf);
-      }
-      else
-      {
-        std::cerr << "E: during getting realpath from nnpackage_path." << std::endl;
-        exit(-1);
-      }
-      exec_basename = basename(argv[0]);
-    }
+    getReportBasenames(argv[0], nnpackage_path, exec_basename, nnpkg_basename);
 
     benchmark::writeResult(result, exec_basename, nnpkg_basename, backend_name);
 